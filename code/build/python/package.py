@@ -186,6 +186,7 @@ devfolderinfolist = [
     {'src': 'include',                                                  'dst': None},
     {'src': '../tools/orxCrypt/bin',                                    'dst': 'tools/orxCrypt/bin'},
     {'src': '../tools/orxFontGen/bin',                                  'dst': 'tools/orxFontGen/bin'},
+    {'src': '../tools/orxAtlasGen/bin',                                 'dst': 'tools/orxAtlasGen/bin'},
 ]
 
 tutorialfolderinfolist = [
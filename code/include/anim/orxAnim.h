@@ -224,6 +224,14 @@ extern orxDLLAPI const orxANIM_CUSTOM_EVENT *orxFASTCALL orxAnim_GetEventAfter(c
  */
 extern orxDLLAPI orxU32 orxFASTCALL           orxAnim_GetKey(const orxANIM *_pstAnim, orxFLOAT _fTimeStamp);
 
+/** Gets animation's key index from a time stamp, starting from a previously found key
+ * @param[in]   _pstAnim        Concerned animation
+ * @param[in]   _fTimeStamp     TimeStamp of the desired animation key
+ * @param[in]   _u32HintIndex   Index of the previously found key (checked first, along with the following one), orxU32_UNDEFINED for none
+ * @return      Animation key index / orxU32_UNDEFINED
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxAnim_GetKeyFromHint(const orxANIM *_pstAnim, orxFLOAT _fTimeStamp, orxU32 _u32HintIndex);
+
 /** Anim key data accessor
  * @param[in]   _pstAnim        Concerned animation
  * @param[in]   _u32Index       Index of desired key data
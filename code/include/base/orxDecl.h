@@ -383,6 +383,18 @@
 #endif
 
 
+/** Thread local storage */
+#ifdef __orxMSVC__
+
+  #define orxTHREAD_LOCAL       __declspec(thread)
+
+#else /* __orxMSVC__ */
+
+  #define orxTHREAD_LOCAL       __thread
+
+#endif /* __orxMSVC__ */
+
+
 /** Memory alignment macros */
 #define orxALIGN(VALUE, BLOCK_SIZE)     (((orxUPTR)(VALUE) + ((orxUPTR)(BLOCK_SIZE) - 1)) & (~((orxUPTR)(BLOCK_SIZE) - 1)))
 
@@ -106,6 +106,20 @@ typedef struct __orxCLOCK_INFO_t
 } orxCLOCK_INFO;
 
 
+/** Clock pacing info structure
+ */
+typedef struct __orxCLOCK_PACING_INFO_t
+{
+  orxDOUBLE         dSleepTime;                                   /**< Time spent sleeping between updates (in seconds) : 8 */
+  orxDOUBLE         dSpinTime;                                    /**< Time spent actively waiting between updates (in seconds) : 16 */
+  orxDOUBLE         dMeanJitter;                                  /**< Mean delay between the expected and the actual update times (in seconds) : 24 */
+  orxDOUBLE         dMaxJitter;                                   /**< Max delay between the expected and the actual update times (in seconds) : 32 */
+  orxDOUBLE         dSpinThreshold;                               /**< Current calibrated active wait slice (in seconds) : 40 */
+  orxU32            u32FrameCount;                                /**< Number of paced updates : 44 */
+
+} orxCLOCK_PACING_INFO;
+
+
 /** Event enum
  */
 typedef enum __orxCLOCK_EVENT_t
@@ -306,6 +320,17 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxClock_AddGlobalTimer(co
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxClock_RemoveGlobalTimer(const orxCLOCK_FUNCTION _pfnCallback, orxFLOAT _fDelay, void *_pContext);
 
 
+/** Gets frame pacing info (sleep & active wait times, wake up jitter), accumulated since the last reset
+ * @param[out]  _pstPacingInfo                        Pacing info to fill
+ * @return      orxCLOCK_PACING_INFO
+ */
+extern orxDLLAPI orxCLOCK_PACING_INFO *orxFASTCALL    orxClock_GetPacingInfo(orxCLOCK_PACING_INFO *_pstPacingInfo);
+
+/** Resets frame pacing info
+ */
+extern orxDLLAPI void orxFASTCALL                     orxClock_ResetPacingInfo();
+
+
 #endif /* _orxCLOCK_H_ */
 
 /** @} */
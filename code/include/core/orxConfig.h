@@ -104,6 +104,11 @@ extern orxDLLAPI void orxFASTCALL             orxConfig_EnableTypoCheck(orxBOOL
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxConfig_IsTypoCheckEnabled();
 
+/** Gets config revision: it changes whenever any value, section or inheritance gets modified (including reloads)
+ * @return Current config revision
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxConfig_GetRevision();
+
 
 /** Sets encryption key
  * @param[in] _zEncryptionKey  Encryption key to use, orxNULL to clear
@@ -162,6 +167,21 @@ extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_ReloadHistory();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEncryption, const orxCONFIG_SAVE_FUNCTION _pfnSaveCallback);
 
+/** Writes a binary snapshot of the whole config (sections, entries & cached values) to given file, for faster startup.
+ * The snapshot is tied to the build that wrote it and to the content of all the config files it has been built from.
+ * @param[in] _zFileName        File name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_SaveSnapshot(const orxSTRING _zFileName);
+
+/** Loads a binary snapshot written by orxConfig_SaveSnapshot. If the snapshot is invalid, comes from an incompatible build,
+ * if any of its config files has changed since it was written or if it can't be applied (out of memory), it'll be ignored and the config will be left untouched.
+ * Commands embedded in the original config files are not executed again.
+ * @param[in] _zFileName        File name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE, in which case orxConfig_Load should be used instead
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_LoadSnapshot(const orxSTRING _zFileName);
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
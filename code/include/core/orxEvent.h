@@ -69,6 +69,11 @@ do                                                                  \
 #define orxEVENT_KU32_FLAG_ID_NONE                    0x00000000
 #define orxEVENT_KU32_MASK_ID_ALL                     0xFFFFFFFF
 
+#define orxEVENT_KU32_POST_FLAG_NONE                  0x00000000  /**< No flags */
+#define orxEVENT_KU32_POST_FLAG_COALESCE              0x00000001  /**< Only the most recent pending event with the same type, ID & sender will be sent */
+
+#define orxEVENT_KU32_POST_PAYLOAD_SIZE               64          /**< Max size of a payload copied by orxEvent_Post() */
+
 
 /** Event type enum
  */
@@ -123,6 +128,22 @@ typedef struct __orxEVENT_t
 
 } orxEVENT;
 
+/** Posted events info structure
+ */
+typedef struct __orxEVENT_POST_INFO_t
+{
+  orxDOUBLE         dDrainTime;                       /**< Cumulated time spent sending posted events (in seconds) : 8 */
+  orxDOUBLE         dMaxDrainTime;                    /**< Max time spent sending posted events in a single drain (in seconds) : 16 */
+  orxU32            u32QueueDepth;                    /**< Current number of pending posted events : 20 */
+  orxU32            u32MaxQueueDepth;                 /**< Max number of pending posted events at drain time : 24 */
+  orxU32            u32PostCount;                     /**< Number of posted events : 28 */
+  orxU32            u32DropCount;                     /**< Number of events dropped because the queue was full : 32 */
+  orxU32            u32DispatchCount;                 /**< Number of sent posted events : 36 */
+  orxU32            u32CoalesceCount;                 /**< Number of posted events superseded by more recent ones : 40 */
+  orxU32            u32DrainCount;                    /**< Number of drains : 44 */
+
+} orxEVENT_POST_INFO;
+
 
 /**
  * Event handler type / return orxSTATUS_FAILURE if events processing should be stopped for the current event, orxSTATUS_FAILURE otherwise
@@ -196,6 +217,45 @@ extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_Send(orxEVENT *_pstEvent);
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_SendShort(orxEVENT_TYPE _eEventType, orxENUM _eEventID);
 
+/** Is an event handled, ie. is there at least one handler registered for it? Can be used to skip preparing events nobody listens to
+ * @param[in] _eEventType           Event type
+ * @param[in] _eEventID             Event ID
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxEvent_IsHandled(orxEVENT_TYPE _eEventType, orxENUM _eEventID);
+
+/** Posts an event: it will be sent from the main thread when the core clock drains posted events, can be called from any thread
+ * @param[in] _pstEvent             Event to post, its fields are copied
+ * @param[in] _u32PayloadSize       Size of the payload to copy along with the event (up to orxEVENT_KU32_POST_PAYLOAD_SIZE), 0 to keep the payload pointer as is
+ * @param[in] _u32Flags             Post flags (orxEVENT_KU32_POST_FLAG_*)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the queue is full
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_Post(const orxEVENT *_pstEvent, orxU32 _u32PayloadSize, orxU32 _u32Flags);
+
+/** Posts a simple event, can be called from any thread
+ * @param[in] _eEventType           Event type
+ * @param[in] _eEventID             Event ID
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the queue is full
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_PostShort(orxEVENT_TYPE _eEventType, orxENUM _eEventID);
+
+/** Sends pending posted events, from the main thread. This is done automatically on the core clock, using the budgets defined in config
+ * @param[in] _u32MaxCount          Max number of events to send, 0 for no limit besides the queue size
+ * @param[in] _fMaxTime             Max time to spend sending events (in seconds), <= 0 for no limit; remaining events are kept for the next drain
+ * @return Number of sent events
+ */
+extern orxDLLAPI orxU32 orxFASTCALL     orxEvent_ProcessPosted(orxU32 _u32MaxCount, orxFLOAT _fMaxTime);
+
+/** Gets posted events info
+ * @param[out] _pstPostInfo         Post info to fill
+ * @return orxEVENT_POST_INFO
+ */
+extern orxDLLAPI orxEVENT_POST_INFO *orxFASTCALL orxEvent_GetPostInfo(orxEVENT_POST_INFO *_pstPostInfo);
+
+/** Resets posted events info
+ */
+extern orxDLLAPI void orxFASTCALL       orxEvent_ResetPostInfo();
+
 /** Is currently sending an event?
  * @return orxTRUE / orxFALSE
  */
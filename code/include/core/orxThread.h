@@ -63,10 +63,16 @@
 /** Semaphore structure */
 typedef struct __orxTHREAD_SEMAPHORE_t                orxTHREAD_SEMAPHORE;
 
+/** Parallel job structure */
+typedef struct __orxTHREAD_JOB_t                      orxTHREAD_JOB;
+
 
 /** Thread run function type */
 typedef orxSTATUS (orxFASTCALL *orxTHREAD_FUNCTION)(void *_pContext);
 
+/** Parallel for function type, called for a contiguous range of indices */
+typedef orxSTATUS (orxFASTCALL *orxTHREAD_PARALLEL_FUNCTION)(orxU32 _u32Index, orxU32 _u32Count, void *_pContext);
+
 
 /** Thread module setup
  */
@@ -167,6 +173,22 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunTask(const or
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunTaskLinear(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext);
 
+/** Runs a function in parallel over [0, _u32Count[, split in ranges of _u32Grain indices, on the task workers. Queued
+ * ranges are shared between all the workers and the thread calling orxThread_WaitJob(), which must be called exactly once per job.
+ * @param[in]   _u32Count                             Number of indices to process
+ * @param[in]   _u32Grain                             Number of indices per range, 0 for automatic
+ * @param[in]   _pfnRun                               Function to run for each range, can be run concurrently from any thread
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ * @return      orxTHREAD_JOB / orxNULL
+ */
+extern orxDLLAPI orxTHREAD_JOB *orxFASTCALL           orxThread_ParallelFor(orxU32 _u32Count, orxU32 _u32Grain, const orxTHREAD_PARALLEL_FUNCTION _pfnRun, void *_pContext);
+
+/** Waits for a parallel job to complete, processing its remaining ranges on the calling thread. The job is released and becomes invalid.
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS if no range returned orxSTATUS_FAILURE, orxSTATUS_FAILURE otherwise
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_WaitJob(orxTHREAD_JOB *_pstJob);
+
 /** Gets number of pending asynchronous tasks awaiting full completion (might pump task notifications if called from main thread)
  * @return      Number of pending asynchronous tasks
  */
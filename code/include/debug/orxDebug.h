@@ -118,6 +118,19 @@ typedef enum __orxDEBUG_LEVEL_t
 
 } orxDEBUG_LEVEL;
 
+/* Log backend mode enum */
+typedef enum __orxDEBUG_MODE_t
+{
+  orxDEBUG_MODE_SYNC = 0,                     /**< Files are written & flushed by the logging thread */
+  orxDEBUG_MODE_ASYNC,                        /**< Files are written by a background thread */
+  orxDEBUG_MODE_COMPACT,                      /**< Files are written by a background thread, in a binary format (see _orxDebug_DecodeCompactFile) */
+
+  orxDEBUG_MODE_NUMBER,
+
+  orxDEBUG_MODE_NONE = orxENUM_NONE
+
+} orxDEBUG_MODE;
+
 
 /* Log callback function */
 typedef orxSTATUS (orxFASTCALL *orxDEBUG_CALLBACK_FUNCTION)(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction, const orxSTRING _zFile, orxU32 _u32Line, const orxSTRING _zLog);
@@ -285,6 +298,12 @@ while(orxFALSE)
 
   #define orxDEBUG_SET_LOG_CALLBACK(CALLBACK) _orxDebug_SetLogCallback(CALLBACK)
 
+  /* Backend */
+  #define orxDEBUG_SET_MODE(MODE)             _orxDebug_SetMode(MODE)
+  #define orxDEBUG_GET_MODE()                 _orxDebug_GetMode()
+  #define orxDEBUG_SET_FILE_ROTATION(SIZE, NUMBER) _orxDebug_SetFileRotation(SIZE, NUMBER)
+  #define orxDEBUG_FLUSH()                    _orxDebug_Flush()
+
   /* Break */
   #define orxBREAK()                          _orxDebug_Break()
 
@@ -351,6 +370,12 @@ while(orxFALSE)
 
   #define orxDEBUG_SET_LOG_CALLBACK(CALLBACK) _orxDebug_SetLogCallback(CALLBACK)
 
+  /* Backend */
+  #define orxDEBUG_SET_MODE(MODE)             _orxDebug_SetMode(MODE)
+  #define orxDEBUG_GET_MODE()                 _orxDebug_GetMode()
+  #define orxDEBUG_SET_FILE_ROTATION(SIZE, NUMBER) _orxDebug_SetFileRotation(SIZE, NUMBER)
+  #define orxDEBUG_FLUSH()                    _orxDebug_Flush()
+
   /* Break */
   #define orxBREAK()
 
@@ -458,6 +483,34 @@ extern orxDLLAPI void orxFASTCALL             _orxDebug_SetLogFile(const orxSTRI
 */
 extern orxDLLAPI void orxFASTCALL             _orxDebug_SetLogCallback(const orxDEBUG_CALLBACK_FUNCTION _pfnLogCallback);
 
+/** Sets the log backend mode, should be called when no other thread is logging
+ * @param[in]   _eMode                        Mode to use
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the mode isn't supported on this platform
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        _orxDebug_SetMode(orxDEBUG_MODE _eMode);
+
+/** Gets the log backend mode
+ * @return      orxDEBUG_MODE
+ */
+extern orxDLLAPI orxDEBUG_MODE orxFASTCALL    _orxDebug_GetMode();
+
+/** Sets size-based rotation of the log & debug files
+ * @param[in]   _u32MaxSize                   Size, in bytes, above which a file gets rotated, 0 to disable rotation
+ * @param[in]   _u32MaxFileNumber             Number of rotated files to keep (name.1 being the most recent), 0 to simply restart the file
+ */
+extern orxDLLAPI void orxFASTCALL             _orxDebug_SetFileRotation(orxU32 _u32MaxSize, orxU32 _u32MaxFileNumber);
+
+/** Writes all pending logs to their files
+ */
+extern orxDLLAPI void orxFASTCALL             _orxDebug_Flush();
+
+/** Decodes a compact log file into text
+ * @param[in]   _zInputFile                   Compact log file (written with orxDEBUG_MODE_COMPACT)
+ * @param[in]   _zOutputFile                  Text file to write, orxNULL for stdout
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        _orxDebug_DecodeCompactFile(const orxSTRING _zInputFile, const orxSTRING _zOutputFile);
+
 #endif /* __orxDEBUG_H_ */
 
 /** @} */
@@ -158,6 +158,23 @@ extern orxDLLAPI void orxFASTCALL                 orxProfiler_ResetAllMarkers();
  */
 extern orxDLLAPI void orxFASTCALL                 orxProfiler_ResetAllMaxima();
 
+
+/** Starts capturing all marker push/pop operations, on all threads, for later export as a Chrome trace
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxProfiler_StartCapture();
+
+/** Stops the current capture and exports it as a Chrome trace JSON file (chrome://tracing, Perfetto, ...)
+ * @param[in] _zFileName        Name of the file to export, orxNULL to discard the capture
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxProfiler_StopCapture(const orxSTRING _zFileName);
+
+/** Is the profiler capturing?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxProfiler_IsCapturing();
+
 /** Gets the time elapsed since last reset
  * @return Time elapsed since the last reset, in seconds
  */
@@ -940,6 +940,16 @@ extern orxDLLAPI orxBITMAP *orxFASTCALL               orxDisplay_LoadBitmap(cons
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFileName);
 
+/** Encodes raw RGBA data and writes it to an opened resource, synchronously, the format being deduced from the resource's extension (png, qoi, jpg, bmp, defaults to tga)
+ * This function can be called from any thread and will not close the resource nor free the data
+ * @param[in]   _hResource                            Opened resource to write to
+ * @param[in]   _u32Width                             Width of the image, in pixels
+ * @param[in]   _u32Height                            Height of the image, in pixels
+ * @param[in]   _au8Data                              RGBA data, _u32Width * _u32Height * sizeof(orxRGBA) bytes
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_EncodeBitmapData(orxHANDLE _hResource, orxU32 _u32Width, orxU32 _u32Height, const orxU8 *_au8Data);
+
 
 /** Loads a font from a TrueType/OpenType file (an event of ID orxDISPLAY_EVENT_BITMAP_LOAD will be sent upon completion, whether the loading is asynchronous or not)
  * @param[in]   _zFileName                            Name of the file to load
@@ -953,6 +963,29 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SaveBitmap(cons
  */
 extern orxDLLAPI orxBITMAP *orxFASTCALL               orxDisplay_LoadFont(const orxSTRING _zFileName, const orxSTRING _zCharacterList, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvCharacterSpacing, const orxVECTOR *_pvCharacterPadding, orxBOOL _bSDF, orxFLOAT *_afCharacterWidthList);
 
+/** Loads a typeface from a TrueType/OpenType file, for on-demand glyph rendering (see orxDisplay_RenderGlyph)
+ * @param[in]   _zFileName                            Name of the file to load
+ * @param[in]   _pvCharacterSize                      Size of characters, X = 0 for variable width
+ * @param[in]   _pvCharacterPadding                   Padding added on all sides, inside a glyph
+ * @param[in]   _bSDF                                 Will render SDF (Signed Distance Field) glyphs if set to true or regular ones otherwise
+ * @return Typeface handle / orxHANDLE_UNDEFINED
+ */
+extern orxDLLAPI orxHANDLE orxFASTCALL                orxDisplay_LoadTypeface(const orxSTRING _zFileName, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvCharacterPadding, orxBOOL _bSDF);
+
+/** Deletes a typeface, none of its glyphs should still be rendering
+ * @param[in]   _hTypeface                            Concerned typeface
+ */
+extern orxDLLAPI void orxFASTCALL                     orxDisplay_DeleteTypeface(orxHANDLE _hTypeface);
+
+/** Gets a glyph's width and optionally renders it, can be called from any thread
+ * @param[in]   _hTypeface                            Concerned typeface
+ * @param[in]   _u32CharacterCodePoint                Code point of the character
+ * @param[out]  _pfWidth                              Width of the glyph, in pixels
+ * @param[out]  _pu8Data                              RGBA buffer of (width x character height) pixels that will receive the glyph, orxNULL to only retrieve its width
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_RenderGlyph(const orxHANDLE _hTypeface, orxU32 _u32CharacterCodePoint, orxFLOAT *_pfWidth, orxU8 *_pu8Data);
+
 
 /** Sets temp bitmap, if a valid temp bitmap is given, load operations will be asynchronous
  * @param[in]   _pstBitmap                            Concerned bitmap, orxNULL for forcing synchronous load operations
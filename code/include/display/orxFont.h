@@ -65,6 +65,8 @@
 #define orxFONT_KZ_CONFIG_TYPEFACE                    "Typeface"
 #define orxFONT_KZ_CONFIG_SDF                         "SDF"
 #define orxFONT_KZ_CONFIG_SHADER                      "Shader"
+#define orxFONT_KZ_CONFIG_DYNAMIC                     "Dynamic"
+#define orxFONT_KZ_CONFIG_ATLAS_SIZE                  "AtlasSize"
 
 #define orxFONT_KZ_ASCII                              "ascii"
 #define orxFONT_KZ_ANSI                               "ansi"
@@ -239,6 +241,19 @@ extern orxDLLAPI const orxSHADER *orxFASTCALL         orxFont_GetShader(const or
  */
 extern orxDLLAPI orxBOOL orxFASTCALL                  orxFont_IsSDF(const orxFONT *_pstFont);
 
+/** Is Font dynamic (glyphs are rendered on demand in an atlas)?
+ * @param[in]   _pstFont      Concerned font
+ * @return      orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL                  orxFont_IsDynamic(const orxFONT *_pstFont);
+
+/** Makes sure all the characters of a string are available in a dynamic font's atlas, missing ones will be rendered asynchronously and become visible a frame later
+ * @param[in]   _pstFont      Concerned font
+ * @param[in]   _zString      String whose characters will be used
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxFont_CacheCharacters(const orxFONT *_pstFont, const orxSTRING _zString);
+
 
 /** Gets font's map
  * @param[in]   _pstFont      Concerned font
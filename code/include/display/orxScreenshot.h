@@ -91,6 +91,21 @@ extern orxDLLAPI void orxFASTCALL       orxScreenshot_Exit();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxScreenshot_Capture();
 
+/** Starts recording screenshots, one per rendered frame (capture is queued at the end of each render, waiting for a free staging buffer so that no frame is dropped)
+ * @param[in]   _u32FrameCount  Number of frames to record, 0 to record until orxScreenshot_StopRecording() is called
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxScreenshot_Record(orxU32 _u32FrameCount);
+
+/** Stops recording screenshots, already captured frames will still be saved
+ */
+extern orxDLLAPI void orxFASTCALL       orxScreenshot_StopRecording();
+
+/** Is recording screenshots?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxScreenshot_IsRecording();
+
 #endif /* _orxSCREENSHOT_H_ */
 
 /** @} */
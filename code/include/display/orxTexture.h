@@ -60,6 +60,8 @@
 
 #define orxTEXTURE_KZ_LOGO_NAME           "orx:texture:logo"
 
+#define orxTEXTURE_KZ_CONFIG_ATLAS        "TextureAtlas"
+
 
 /** Event enum
  */
@@ -155,7 +157,7 @@ extern orxDLLAPI orxTEXTURE *orxFASTCALL  orxTexture_Get(const orxSTRING _zName)
 
 /** Gets texture name
  * @param[in]   _pstTexture   Concerned texture
- * @return      Texture name / orxSTRING_EMPTY
+ * @return      Texture name / orxSTRING_EMPTY (for a graphic using an atlas region, this is the name of the atlas page, not the original file)
  */
 extern orxDLLAPI const orxSTRING orxFASTCALL orxTexture_GetName(const orxTEXTURE *_pstTexture);
 
@@ -169,6 +171,16 @@ extern orxDLLAPI orxTEXTURE *orxFASTCALL  orxTexture_GetScreenTexture();
  */
 extern orxDLLAPI orxU32 orxFASTCALL       orxTexture_GetLoadCount();
 
+/** Gets the atlas region of a bitmap file, as defined in the TextureAtlas config section (see orxAtlasGen)
+ * orxTexture_Load() doesn't apply this mapping: only graphics created from config load the page and restrict themselves to the region
+ * @param[in]   _zFileName      Name of the original bitmap file
+ * @param[out]  _pzPageName     Name of the atlas page bitmap file containing it, orxNULL to ignore
+ * @param[out]  _pvOrigin       Top left corner of the region in the page, orxNULL to ignore
+ * @param[out]  _pvSize         Size of the region, orxNULL to ignore
+ * @return      orxSTATUS_SUCCESS if the file is part of an atlas, orxSTATUS_FAILURE otherwise
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL    orxTexture_GetAtlasRegion(const orxSTRING _zFileName, const orxSTRING *_pzPageName, orxVECTOR *_pvOrigin, orxVECTOR *_pvSize);
+
 #endif /* _orxTEXTURE_H_ */
 
 /** @} */
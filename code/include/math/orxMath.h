@@ -122,6 +122,16 @@
 #define orxS2F(V)                 ((orxFLOAT)(V))
 
 
+/** Random stream: counter-based generator whose state can be owned by a single thread/job
+ */
+typedef struct __orxMATH_RANDOM_STREAM_t
+{
+  orxU64  u64State;                               /**< Counter state : 8 */
+  orxU64  u64Gamma;                               /**< Counter increment (odd) : 16 */
+
+} orxMATH_RANDOM_STREAM;
+
+
 /*** Module functions *** */
 
 /** Inits the random seed
@@ -214,6 +224,61 @@ extern orxDLLAPI void orxFASTCALL     orxMath_GetRandomSeeds(orxU32 _au32Seeds[4
  */
 extern orxDLLAPI void orxFASTCALL     orxMath_SetRandomSeeds(const orxU32 _au32Seeds[4]);
 
+/** Inits a random stream, streams inited with the same seed will produce the same sequence
+ * @param[out]  _pstStream                      Stream to init
+ * @param[in]   _u64Seed                        Seed to use
+ */
+extern orxDLLAPI void orxFASTCALL     orxMath_InitRandomStream(orxMATH_RANDOM_STREAM *_pstStream, orxU64 _u64Seed);
+
+/** Splits a random stream: the parent stream is advanced and the child stream is statistically independent from it, deterministic for a given parent state
+ * @param[in]   _pstStream                      Stream to split
+ * @param[out]  _pstChild                       Child stream
+ */
+extern orxDLLAPI void orxFASTCALL     orxMath_SplitRandomStream(orxMATH_RANDOM_STREAM *_pstStream, orxMATH_RANDOM_STREAM *_pstChild);
+
+/** Skips values of a random stream in constant time
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _u64Count                       Number of values to skip
+ */
+extern orxDLLAPI void orxFASTCALL     orxMath_SkipRandomStream(orxMATH_RANDOM_STREAM *_pstStream, orxU64 _u64Count);
+
+/** Gets the calling thread's default random stream, seeded from orxMath_InitRandom's seed on first use
+ * @return      Calling thread's random stream, only to be used by that thread
+ */
+extern orxDLLAPI orxMATH_RANDOM_STREAM *orxFASTCALL orxMath_GetThreadRandomStream();
+
+/** Gets a random orxFLOAT value from a stream
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _fMin                           Minimum boundary (inclusive)
+ * @param[in]   _fMax                           Maximum boundary (exclusive)
+ * @return      Random value
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL orxMath_GetRandomStreamFloat(orxMATH_RANDOM_STREAM *_pstStream, orxFLOAT _fMin, orxFLOAT _fMax);
+
+/** Gets a random orxU32 value from a stream
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _u32Min                         Minimum boundary (inclusive)
+ * @param[in]   _u32Max                         Maximum boundary (inclusive)
+ * @return      Random value
+ */
+extern orxDLLAPI orxU32 orxFASTCALL   orxMath_GetRandomStreamU32(orxMATH_RANDOM_STREAM *_pstStream, orxU32 _u32Min, orxU32 _u32Max);
+
+/** Gets a random orxS32 value from a stream
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _s32Min                         Minimum boundary (inclusive)
+ * @param[in]   _s32Max                         Maximum boundary (inclusive)
+ * @return      Random value
+ */
+extern orxDLLAPI orxS32 orxFASTCALL   orxMath_GetRandomStreamS32(orxMATH_RANDOM_STREAM *_pstStream, orxS32 _s32Min, orxS32 _s32Max);
+
+/** Gets a random orxU64 value from a stream
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _u64Min                         Minimum boundary (inclusive)
+ * @param[in]   _u64Max                         Maximum boundary (inclusive)
+ * @return      Random value
+ */
+extern orxDLLAPI orxU64 orxFASTCALL   orxMath_GetRandomStreamU64(orxMATH_RANDOM_STREAM *_pstStream, orxU64 _u64Min, orxU64 _u64Max);
+
 
 /*** Inlined functions *** */
 
@@ -59,6 +59,7 @@
   #define orxMEMORY_ATOMIC_DEC32(ADDRESS)                 __atomic_sub_fetch((ADDRESS), 1, __ATOMIC_SEQ_CST)
   #define orxMEMORY_ATOMIC_INC64(ADDRESS)                 __atomic_add_fetch((ADDRESS), 1, __ATOMIC_SEQ_CST)
   #define orxMEMORY_ATOMIC_DEC64(ADDRESS)                 __atomic_sub_fetch((ADDRESS), 1, __ATOMIC_SEQ_CST)
+  #define orxMEMORY_ATOMIC_CAS32(ADDRESS, OLD, NEW)       (__sync_bool_compare_and_swap((ADDRESS), (OLD), (NEW)) ? orxTRUE : orxFALSE)
   #define orxHAS_ATOMICS
   #if defined(__orxGCC__)
     #pragma GCC diagnostic push
@@ -79,6 +80,7 @@
   #define orxMEMORY_ATOMIC_DEC32(ADDRESS)                 ((orxU32)_InterlockedDecrement((volatile long *)(ADDRESS)))
   #define orxMEMORY_ATOMIC_INC64(ADDRESS)                 ((orxU64)_InterlockedIncrement64((volatile __int64 *)(ADDRESS)))
   #define orxMEMORY_ATOMIC_DEC64(ADDRESS)                 ((orxU64)_InterlockedDecrement64((volatile __int64 *)(ADDRESS)))
+  #define orxMEMORY_ATOMIC_CAS32(ADDRESS, OLD, NEW)       ((_InterlockedCompareExchange((volatile long *)(ADDRESS), (long)(NEW), (long)(OLD)) == (long)(OLD)) ? orxTRUE : orxFALSE)
   #define orxHAS_ATOMICS
 #else
   #define orxMEMORY_BARRIER()
@@ -86,6 +88,7 @@
   #define orxMEMORY_ATOMIC_DEC32(ADDRESS)                 (--(*(ADDRESS)))
   #define orxMEMORY_ATOMIC_INC64(ADDRESS)                 (++(*(ADDRESS)))
   #define orxMEMORY_ATOMIC_DEC64(ADDRESS)                 (--(*(ADDRESS)))
+  #define orxMEMORY_ATOMIC_CAS32(ADDRESS, OLD, NEW)       ((*(ADDRESS) == (OLD)) ? (*(ADDRESS) = (NEW), orxTRUE) : orxFALSE)
   #undef orxHAS_MEMORY_BARRIER
   #undef orxHAS_ATOMICS
 
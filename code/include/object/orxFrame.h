@@ -177,6 +177,18 @@ extern orxDLLAPI orxFRAME *orxFASTCALL        orxFrame_GetSibling(const orxFRAME
 extern orxDLLAPI orxBOOL orxFASTCALL          orxFrame_IsRootChild(const orxFRAME *_pstFrame);
 
 
+/** Sets frame dirty tracking: tracked frames are added to the dirty list whenever their global data changes
+ * @param[in]   _pstFrame       Concerned frame
+ * @param[in]   _bTrack         orxTRUE to track, orxFALSE otherwise
+ */
+extern orxDLLAPI void orxFASTCALL             orxFrame_TrackDirty(orxFRAME *_pstFrame, orxBOOL _bTrack);
+
+/** Pops the next dirty frame (its dirty status is cleared)
+ * @return orxFRAME / orxNULL if no tracked frame changed since the last pop
+ */
+extern orxDLLAPI orxFRAME *orxFASTCALL        orxFrame_PopDirty();
+
+
 /** Sets frame position
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _eSpace         Coordinate space system to use
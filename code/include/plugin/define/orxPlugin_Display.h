@@ -56,7 +56,11 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_t
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DELETE_BITMAP,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_LOAD_BITMAP,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SAVE_BITMAP,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_ENCODE_BITMAP_DATA,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_LOAD_FONT,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_LOAD_TYPEFACE,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DELETE_TYPEFACE,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_RENDER_GLYPH,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_TEMP_BITMAP,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_TEMP_BITMAP,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_DESTINATION_BITMAPS,
@@ -164,6 +164,18 @@ extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_Start(const orxSHADER
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_Stop(const orxSHADER *_pstShader);
 
+/** Restarts an already started shader for a new owner, only uploading the parameter values that changed since they were last uploaded
+ * @param[in] _pstShader              Concerned Shader, needs to be currently started
+ * @param[in] _pstOwner               New owner structure (orxOBJECT / orxVIEWPORT)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_Restart(const orxSHADER *_pstShader, const orxSTRUCTURE *_pstOwner);
+
+/** Gets the number of parameter values uploaded since the module was initialized
+ * @return Parameter value upload count
+ */
+extern orxDLLAPI orxU32 orxFASTCALL             orxShader_GetParamUploadCount();
+
 
 /** Adds a float parameter definition to a shader (parameters need to be set before compiling the shader code)
  * @param[in] _pstShader              Concerned Shader
@@ -29,189 +29,2384 @@
  *
  * Dummy display plugin implementation
  *
+ * Renders on the CPU into in-memory bitmaps, without any window or GPU.
+ * Quads are batched and rasterized when the render state changes, lines,
+ * polygons and meshes are rasterized directly. Loading is synchronous and
+ * shaders aren't supported. Typefaces can be loaded for on-demand glyph
+ * rendering, SDF glyphs are rendered as regular ones.
+ *
+ */
+
+
+#include "orxPluginAPI.h"
+
+#define STBI_NO_STDIO
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_NO_HDR
+#define STBI_NO_PIC
+#define STBI_MALLOC(sz)         orxMemory_Allocate((orxU32)sz, orxMEMORY_TYPE_TEMP)
+#define STBI_REALLOC(p, newsz)  orxMemory_Reallocate(p, newsz, orxMEMORY_TYPE_TEMP)
+#define STBI_FREE(p)            orxMemory_Free(p)
+#include "stb_image.h"
+#undef STBI_FREE
+#undef STBI_REALLOC
+#undef STBI_MALLOC
+#undef STBI_NO_PIC
+#undef STBI_NO_HDR
+#undef STB_IMAGE_IMPLEMENTATION
+#undef STBI_NO_STDIO
+
+#define STBI_WRITE_NO_STDIO
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define STBIW_MALLOC(sz)        orxMemory_Allocate(sz, orxMEMORY_TYPE_TEMP)
+#define STBIW_REALLOC(p, newsz) orxMemory_Reallocate(p, newsz, orxMEMORY_TYPE_TEMP)
+#define STBIW_FREE(p)           orxMemory_Free(p)
+#define STBIW_MEMMOVE(a, b, sz) orxMemory_Move(a, b, sz)
+#define STBIW_ASSERT(x)         orxASSERT(x)
+#include "stb_image_write.h"
+#undef STBIW_ASSERT
+#undef STBIW_MEMMOVE
+#undef STBIW_FREE
+#undef STBIW_REALLOC
+#undef STBIW_MALLOC
+#undef STB_IMAGE_WRITE_IMPLEMENTATION
+#undef STBI_WRITE_NO_STDIO
+
+#define QOI_NO_STDIO
+#define QOI_IMPLEMENTATION
+#define QOI_MALLOC(sz)          orxMemory_Allocate(sz, orxMEMORY_TYPE_TEMP)
+#define QOI_FREE(p)             orxMemory_Free(p)
+#define QOI_ZEROARR(a)          orxMemory_Zero(a, sizeof(a))
+#include "qoi.h"
+#undef QOI_ZEROARR
+#undef QOI_FREE
+#undef QOI_MALLOC
+#undef QOI_IMPLEMENTATION
+#undef QOI_NO_STDIO
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#define STBTT_STATIC
+#define STBTT_ifloor(x)         ((int)orxMath_Floor((orxFLOAT)(x)))
+#define STBTT_iceil(x)          ((int)orxMath_Ceil((orxFLOAT)(x)))
+#define STBTT_sqrt(x)           orxMath_Sqrt((orxFLOAT)(x))
+#define STBTT_pow(x, y)         orxMath_Pow((orxFLOAT)(x), (orxFLOAT)(y))
+#define STBTT_fmod(x, y)        orxMath_Mod((orxFLOAT)(x), (orxFLOAT)(y))
+#define STBTT_cos(x)            orxMath_Cos((orxFLOAT)(x))
+#define STBTT_acos(x)           orxMath_ACos((orxFLOAT)(x))
+#define STBTT_fabs(x)           orxMath_Abs((orxFLOAT)(x))
+#define STBTT_malloc(sz, u)     orxMemory_Allocate((orxU32)(sz), orxMEMORY_TYPE_TEMP)
+#define STBTT_free(p, u)        orxMemory_Free(p)
+#define STBTT_assert(x)         orxASSERT(x)
+#define STBTT_strlen(x)         orxString_GetLength(x)
+#define STBTT_memcpy            orxMemory_Copy
+#define STBTT_memset            orxMemory_Set
+#include "stb_truetype.h"
+#undef STBTT_memset
+#undef STBTT_memcpy
+#undef STBTT_strlen
+#undef STBTT_assert
+#undef STBTT_free
+#undef STBTT_malloc
+#undef STBTT_fabs
+#undef STBTT_acos
+#undef STBTT_cos
+#undef STBTT_fmod
+#undef STBTT_pow
+#undef STBTT_sqrt
+#undef STBTT_iceil
+#undef STBTT_ifloor
+#undef STBTT_STATIC
+#undef STB_TRUETYPE_IMPLEMENTATION
+
+
+/** Module flags
+ */
+#define orxDISPLAY_KU32_STATIC_FLAG_NONE        0x00000000  /**< No flags */
+
+#define orxDISPLAY_KU32_STATIC_FLAG_READY       0x00000001  /**< Ready flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_VSYNC       0x00000002  /**< VSync flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN  0x00000004  /**< Full screen flag */
+
+#define orxDISPLAY_KU32_STATIC_MASK_ALL         0xFFFFFFFF  /**< All mask */
+
+#define orxDISPLAY_KU32_BITMAP_BANK_SIZE        256
+
+#define orxDISPLAY_KU32_VERTEX_BUFFER_SIZE      (4 * 2048)  /**< 2048 items batch capacity */
+#define orxDISPLAY_KU32_INDEX_BUFFER_SIZE       (6 * 2048)  /**< 2048 items batch capacity */
+
+#define orxDISPLAY_KU32_CIRCLE_LINE_NUMBER      32
+
+#define orxDISPLAY_KU32_DEFAULT_WIDTH           1280
+#define orxDISPLAY_KU32_DEFAULT_HEIGHT          720
+#define orxDISPLAY_KU32_DEFAULT_DEPTH           32
+#define orxDISPLAY_KU32_DEFAULT_REFRESH_RATE    60
+
+/** Multiplies two 8-bit normalized values, with rounding (exact division by 255)
+ */
+#define orxDISPLAY_MUL8(A, B)                   ((((orxU32)(A) * (orxU32)(B) + 0x80) + (((orxU32)(A) * (orxU32)(B) + 0x80) >> 8)) >> 8)
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Internal bitmap structure
+ */
+struct __orxBITMAP_t
+{
+  orxRGBA                  *astData;
+  orxFLOAT                  fWidth, fHeight;
+  orxU32                    u32Width, u32Height;
+  orxFLOAT                  fRecWidth, fRecHeight;
+  orxAABOX                  stClip;
+  const orxSTRING           zLocation;
+  orxSTRINGID               stFilenameID;
+  orxU32                    u32ID;
+};
+
+/** Internal bitmap save info structure
+ */
+typedef struct __orxDISPLAY_SAVE_INFO_t
+{
+  orxU8      *pu8ImageData;
+  orxHANDLE   hResource;
+  orxU32      u32Width;
+  orxU32      u32Height;
+
+} orxDISPLAY_SAVE_INFO;
+
+/** Internal typeface structure (on-demand glyph rendering)
  */
+typedef struct __orxDISPLAY_TYPEFACE_t
+{
+  stbtt_fontinfo            stFontInfo;
+  orxVECTOR                 vCharacterSize;
+  orxVECTOR                 vFontScale;
+  orxFLOAT                  fXPadding;
+  orxFLOAT                  fYPadding;
+  orxFLOAT                  fBaseLine;
+  orxS32                    s32X0;
+  orxS32                    s32X1;
+
+} orxDISPLAY_TYPEFACE;
+
+/** Static structure
+ */
+typedef struct __orxDISPLAY_STATIC_t
+{
+  orxBANK                  *pstBitmapBank;
+  orxBITMAP                *pstScreen;
+  orxBITMAP                *pstDestination;
+  const orxBITMAP          *pstBatchBitmap;
+  orxDISPLAY_BLEND_MODE     eBatchBlendMode;
+  orxBOOL                   bBatchSmoothing;
+  orxBOOL                   bDefaultSmoothing;
+  orxS32                    s32BufferIndex;
+  orxS32                    s32ElementNumber;
+  orxU32                    u32BitmapCounter;
+  orxU32                    u32RefreshRate;
+  orxU32                    u32Flags;
+  orxDISPLAY_VERTEX         astVertexList[orxDISPLAY_KU32_VERTEX_BUFFER_SIZE];
+  orxU16                    au16IndexList[orxDISPLAY_KU32_INDEX_BUFFER_SIZE];
+
+} orxDISPLAY_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxDISPLAY_STATIC sstDisplay;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static orxINLINE orxRGBA orxDisplay_Dummy_SampleBitmap(const orxBITMAP *_pstBitmap, orxFLOAT _fU, orxFLOAT _fV, orxBOOL _bSmoothing)
+{
+  orxRGBA stResult;
+
+  /* Smoothing? */
+  if(_bSmoothing != orxFALSE)
+  {
+    const orxRGBA  *pst00, *pst01, *pst10, *pst11;
+    orxFLOAT        fX, fY;
+    orxS32          s32X0, s32Y0, s32X1, s32Y1;
+    orxU32          u32FracX, u32FracY, u32InvFracX, u32InvFracY;
+
+    /* Gets texel space coordinates */
+    fX = (_fU * _pstBitmap->fWidth) - orx2F(0.5f);
+    fY = (_fV * _pstBitmap->fHeight) - orx2F(0.5f);
+
+    /* Gets surrounding texels, clamped to edge */
+    s32X0     = orxF2S(orxMath_Floor(fX));
+    s32Y0     = orxF2S(orxMath_Floor(fY));
+    u32FracX  = (orxU32)orxF2S((fX - orxS2F(s32X0)) * orx2F(256.0f));
+    u32FracY  = (orxU32)orxF2S((fY - orxS2F(s32Y0)) * orx2F(256.0f));
+    s32X1     = orxCLAMP(s32X0 + 1, 0, (orxS32)_pstBitmap->u32Width - 1);
+    s32Y1     = orxCLAMP(s32Y0 + 1, 0, (orxS32)_pstBitmap->u32Height - 1);
+    s32X0     = orxCLAMP(s32X0, 0, (orxS32)_pstBitmap->u32Width - 1);
+    s32Y0     = orxCLAMP(s32Y0, 0, (orxS32)_pstBitmap->u32Height - 1);
+    u32FracX  = orxMIN(u32FracX, 256);
+    u32FracY  = orxMIN(u32FracY, 256);
+    u32InvFracX = 256 - u32FracX;
+    u32InvFracY = 256 - u32FracY;
+
+    /* Gets texels */
+    pst00 = &(_pstBitmap->astData[s32Y0 * _pstBitmap->u32Width + s32X0]);
+    pst01 = &(_pstBitmap->astData[s32Y0 * _pstBitmap->u32Width + s32X1]);
+    pst10 = &(_pstBitmap->astData[s32Y1 * _pstBitmap->u32Width + s32X0]);
+    pst11 = &(_pstBitmap->astData[s32Y1 * _pstBitmap->u32Width + s32X1]);
+
+    /* Filters them */
+#define orxDISPLAY_FILTER(CHANNEL)                                                                                          \
+    (orxU8)(((((pst00->CHANNEL * u32InvFracX) + (pst01->CHANNEL * u32FracX)) * u32InvFracY)                                 \
+           + (((pst10->CHANNEL * u32InvFracX) + (pst11->CHANNEL * u32FracX)) * u32FracY) + 0x8000) >> 16)
+
+    stResult.u8R = orxDISPLAY_FILTER(u8R);
+    stResult.u8G = orxDISPLAY_FILTER(u8G);
+    stResult.u8B = orxDISPLAY_FILTER(u8B);
+    stResult.u8A = orxDISPLAY_FILTER(u8A);
+
+#undef orxDISPLAY_FILTER
+  }
+  else
+  {
+    orxS32 s32X, s32Y;
+
+    /* Gets nearest texel, clamped to edge */
+    s32X = orxF2S(orxMath_Floor(_fU * _pstBitmap->fWidth));
+    s32Y = orxF2S(orxMath_Floor(_fV * _pstBitmap->fHeight));
+    s32X = orxCLAMP(s32X, 0, (orxS32)_pstBitmap->u32Width - 1);
+    s32Y = orxCLAMP(s32Y, 0, (orxS32)_pstBitmap->u32Height - 1);
+
+    /* Updates result */
+    stResult = _pstBitmap->astData[s32Y * _pstBitmap->u32Width + s32X];
+  }
+
+  /* Done! */
+  return stResult;
+}
+
+static orxINLINE void orxDisplay_Dummy_BlendPixel(orxRGBA *_pstDst, orxRGBA _stSrc, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxU32 u32Alpha, u32InvAlpha;
+
+  /* Depending on blend mode */
+  switch(_eBlendMode)
+  {
+    case orxDISPLAY_BLEND_MODE_ALPHA:
+    {
+      /* Src * SrcAlpha + Dst * (1 - SrcAlpha) */
+      u32Alpha        = _stSrc.u8A;
+      u32InvAlpha     = 0xFF - u32Alpha;
+      _pstDst->u8R    = (orxU8)(orxDISPLAY_MUL8(_stSrc.u8R, u32Alpha) + orxDISPLAY_MUL8(_pstDst->u8R, u32InvAlpha));
+      _pstDst->u8G    = (orxU8)(orxDISPLAY_MUL8(_stSrc.u8G, u32Alpha) + orxDISPLAY_MUL8(_pstDst->u8G, u32InvAlpha));
+      _pstDst->u8B    = (orxU8)(orxDISPLAY_MUL8(_stSrc.u8B, u32Alpha) + orxDISPLAY_MUL8(_pstDst->u8B, u32InvAlpha));
+      _pstDst->u8A    = (orxU8)(orxDISPLAY_MUL8(_stSrc.u8A, u32Alpha) + orxDISPLAY_MUL8(_pstDst->u8A, u32InvAlpha));
+
+      break;
+    }
+
+    case orxDISPLAY_BLEND_MODE_MULTIPLY:
+    {
+      /* Src * Dst */
+      _pstDst->u8R    = (orxU8)orxDISPLAY_MUL8(_stSrc.u8R, _pstDst->u8R);
+      _pstDst->u8G    = (orxU8)orxDISPLAY_MUL8(_stSrc.u8G, _pstDst->u8G);
+      _pstDst->u8B    = (orxU8)orxDISPLAY_MUL8(_stSrc.u8B, _pstDst->u8B);
+      _pstDst->u8A    = (orxU8)orxDISPLAY_MUL8(_stSrc.u8A, _pstDst->u8A);
+
+      break;
+    }
+
+    case orxDISPLAY_BLEND_MODE_ADD:
+    {
+      /* Src * SrcAlpha + Dst */
+      u32Alpha        = _stSrc.u8A;
+      _pstDst->u8R    = (orxU8)orxMIN(orxDISPLAY_MUL8(_stSrc.u8R, u32Alpha) + _pstDst->u8R, 0xFF);
+      _pstDst->u8G    = (orxU8)orxMIN(orxDISPLAY_MUL8(_stSrc.u8G, u32Alpha) + _pstDst->u8G, 0xFF);
+      _pstDst->u8B    = (orxU8)orxMIN(orxDISPLAY_MUL8(_stSrc.u8B, u32Alpha) + _pstDst->u8B, 0xFF);
+      _pstDst->u8A    = (orxU8)orxMIN(orxDISPLAY_MUL8(_stSrc.u8A, u32Alpha) + _pstDst->u8A, 0xFF);
+
+      break;
+    }
+
+    case orxDISPLAY_BLEND_MODE_PREMUL:
+    {
+      /* Src + Dst * (1 - SrcAlpha) */
+      u32InvAlpha     = 0xFF - _stSrc.u8A;
+      _pstDst->u8R    = (orxU8)orxMIN(_stSrc.u8R + orxDISPLAY_MUL8(_pstDst->u8R, u32InvAlpha), 0xFF);
+      _pstDst->u8G    = (orxU8)orxMIN(_stSrc.u8G + orxDISPLAY_MUL8(_pstDst->u8G, u32InvAlpha), 0xFF);
+      _pstDst->u8B    = (orxU8)orxMIN(_stSrc.u8B + orxDISPLAY_MUL8(_pstDst->u8B, u32InvAlpha), 0xFF);
+      _pstDst->u8A    = (orxU8)orxMIN(_stSrc.u8A + orxDISPLAY_MUL8(_pstDst->u8A, u32InvAlpha), 0xFF);
+
+      break;
+    }
+
+    default:
+    {
+      /* Src */
+      *_pstDst = _stSrc;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxBOOL orxDisplay_Dummy_IsTopLeftEdge(const orxDISPLAY_VERTEX *_pstStart, const orxDISPLAY_VERTEX *_pstEnd)
+{
+  /* Left edge (going up) or top edge (going right)? */
+  return ((_pstEnd->fY < _pstStart->fY) || ((_pstEnd->fY == _pstStart->fY) && (_pstEnd->fX > _pstStart->fX))) ? orxTRUE : orxFALSE;
+}
+
+static void orxFASTCALL orxDisplay_Dummy_RasterizeTriangle(const orxDISPLAY_VERTEX *_pstV0, const orxDISPLAY_VERTEX *_pstV1, const orxDISPLAY_VERTEX *_pstV2, const orxBITMAP *_pstBitmap, orxBOOL _bSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  const orxBITMAP          *pstDst;
+  const orxDISPLAY_VERTEX  *pstV1, *pstV2;
+  orxFLOAT                  fArea, fRecArea;
+
+  /* Gets destination */
+  pstDst = sstDisplay.pstDestination;
+
+  /* Gets orientation */
+  fArea = ((_pstV1->fX - _pstV0->fX) * (_pstV2->fY - _pstV0->fY)) - ((_pstV1->fY - _pstV0->fY) * (_pstV2->fX - _pstV0->fX));
+
+  /* Negative? */
+  if(fArea < orxFLOAT_0)
+  {
+    /* Swaps winding */
+    pstV1 = _pstV2;
+    pstV2 = _pstV1;
+    fArea = -fArea;
+  }
+  else
+  {
+    pstV1 = _pstV1;
+    pstV2 = _pstV2;
+  }
+
+  /* Valid destination and non-degenerate triangle? */
+  if((pstDst != orxNULL) && (pstDst->astData != orxNULL) && (fArea > orxFLOAT_0))
+  {
+    orxFLOAT fMinX, fMinY, fMaxX, fMaxY;
+    orxS32   s32MinX, s32MinY, s32MaxX, s32MaxY;
+
+    /* Gets bounding box */
+    fMinX = orxMIN(_pstV0->fX, orxMIN(pstV1->fX, pstV2->fX));
+    fMinY = orxMIN(_pstV0->fY, orxMIN(pstV1->fY, pstV2->fY));
+    fMaxX = orxMAX(_pstV0->fX, orxMAX(pstV1->fX, pstV2->fX));
+    fMaxY = orxMAX(_pstV0->fY, orxMAX(pstV1->fY, pstV2->fY));
+
+    /* Clips it against destination's clipping rectangle */
+    s32MinX = orxMAX(orxF2S(orxMath_Floor(fMinX)), orxF2S(pstDst->stClip.vTL.fX));
+    s32MinY = orxMAX(orxF2S(orxMath_Floor(fMinY)), orxF2S(pstDst->stClip.vTL.fY));
+    s32MaxX = orxMIN(orxF2S(orxMath_Ceil(fMaxX)), orxF2S(pstDst->stClip.vBR.fX)) - 1;
+    s32MaxY = orxMIN(orxF2S(orxMath_Ceil(fMaxY)), orxF2S(pstDst->stClip.vBR.fY)) - 1;
+
+    /* Not empty? */
+    if((s32MinX <= s32MaxX) && (s32MinY <= s32MaxY))
+    {
+      orxFLOAT  fE0DX, fE0DY, fE1DX, fE1DY, fE2DX, fE2DY, fE0Row, fE1Row, fE2Row, fPX, fPY;
+      orxFLOAT  fU0, fU1, fU2, fV0, fV1, fV2;
+      orxBOOL   bTopLeft0, bTopLeft1, bTopLeft2, bUniformColor;
+      orxS32    s32X, s32Y;
+
+      /* Gets edge function steps (E0: V1->V2, E1: V2->V0, E2: V0->V1) */
+      fE0DX = pstV1->fY - pstV2->fY;
+      fE0DY = pstV2->fX - pstV1->fX;
+      fE1DX = pstV2->fY - _pstV0->fY;
+      fE1DY = _pstV0->fX - pstV2->fX;
+      fE2DX = _pstV0->fY - pstV1->fY;
+      fE2DY = pstV1->fX - _pstV0->fX;
+
+      /* Gets fill rule */
+      bTopLeft0 = orxDisplay_Dummy_IsTopLeftEdge(pstV1, pstV2);
+      bTopLeft1 = orxDisplay_Dummy_IsTopLeftEdge(pstV2, _pstV0);
+      bTopLeft2 = orxDisplay_Dummy_IsTopLeftEdge(_pstV0, pstV1);
+
+      /* Gets first pixel center */
+      fPX = orxS2F(s32MinX) + orx2F(0.5f);
+      fPY = orxS2F(s32MinY) + orx2F(0.5f);
+
+      /* Inits edge functions */
+      fE0Row = (fE0DY * (fPY - pstV1->fY)) + (fE0DX * (fPX - pstV1->fX));
+      fE1Row = (fE1DY * (fPY - pstV2->fY)) + (fE1DX * (fPX - pstV2->fX));
+      fE2Row = (fE2DY * (fPY - _pstV0->fY)) + (fE2DX * (fPX - _pstV0->fX));
+
+      /* Gets interpolation values */
+      fRecArea      = orxFLOAT_1 / fArea;
+      fU0           = _pstV0->fU * fRecArea;
+      fU1           = pstV1->fU * fRecArea;
+      fU2           = pstV2->fU * fRecArea;
+      fV0           = _pstV0->fV * fRecArea;
+      fV1           = pstV1->fV * fRecArea;
+      fV2           = pstV2->fV * fRecArea;
+      bUniformColor = ((_pstV0->stRGBA.u32RGBA == pstV1->stRGBA.u32RGBA) && (_pstV0->stRGBA.u32RGBA == pstV2->stRGBA.u32RGBA)) ? orxTRUE : orxFALSE;
+
+      /* For all lines */
+      for(s32Y = s32MinY; s32Y <= s32MaxY; s32Y++, fE0Row += fE0DY, fE1Row += fE1DY, fE2Row += fE2DY)
+      {
+        orxRGBA  *pstPixel;
+        orxFLOAT  fE0, fE1, fE2;
+
+        /* Gets first pixel */
+        pstPixel = &(pstDst->astData[s32Y * pstDst->u32Width + s32MinX]);
+
+        /* For all columns */
+        for(s32X = s32MinX, fE0 = fE0Row, fE1 = fE1Row, fE2 = fE2Row;
+            s32X <= s32MaxX;
+            s32X++, pstPixel++, fE0 += fE0DX, fE1 += fE1DX, fE2 += fE2DX)
+        {
+          /* Inside? */
+          if(((fE0 > orxFLOAT_0) || ((fE0 == orxFLOAT_0) && (bTopLeft0 != orxFALSE)))
+          && ((fE1 > orxFLOAT_0) || ((fE1 == orxFLOAT_0) && (bTopLeft1 != orxFALSE)))
+          && ((fE2 > orxFLOAT_0) || ((fE2 == orxFLOAT_0) && (bTopLeft2 != orxFALSE))))
+          {
+            orxRGBA stColor;
+
+            /* Uniform color? */
+            if(bUniformColor != orxFALSE)
+            {
+              /* Uses it */
+              stColor = _pstV0->stRGBA;
+            }
+            else
+            {
+              orxFLOAT fL0, fL1, fL2;
+
+              /* Gets barycentric coordinates */
+              fL0 = fE0 * fRecArea;
+              fL1 = fE1 * fRecArea;
+              fL2 = fE2 * fRecArea;
+
+              /* Interpolates color */
+              stColor.u8R = (orxU8)orxF2U((fL0 * orxU2F(_pstV0->stRGBA.u8R)) + (fL1 * orxU2F(pstV1->stRGBA.u8R)) + (fL2 * orxU2F(pstV2->stRGBA.u8R)) + orx2F(0.5f));
+              stColor.u8G = (orxU8)orxF2U((fL0 * orxU2F(_pstV0->stRGBA.u8G)) + (fL1 * orxU2F(pstV1->stRGBA.u8G)) + (fL2 * orxU2F(pstV2->stRGBA.u8G)) + orx2F(0.5f));
+              stColor.u8B = (orxU8)orxF2U((fL0 * orxU2F(_pstV0->stRGBA.u8B)) + (fL1 * orxU2F(pstV1->stRGBA.u8B)) + (fL2 * orxU2F(pstV2->stRGBA.u8B)) + orx2F(0.5f));
+              stColor.u8A = (orxU8)orxF2U((fL0 * orxU2F(_pstV0->stRGBA.u8A)) + (fL1 * orxU2F(pstV1->stRGBA.u8A)) + (fL2 * orxU2F(pstV2->stRGBA.u8A)) + orx2F(0.5f));
+            }
+
+            /* Textured? */
+            if(_pstBitmap != orxNULL)
+            {
+              orxRGBA stTexel;
+
+              /* Samples texture */
+              stTexel = orxDisplay_Dummy_SampleBitmap(_pstBitmap,
+                                                      (fE0 * fU0) + (fE1 * fU1) + (fE2 * fU2),
+                                                      (fE0 * fV0) + (fE1 * fV1) + (fE2 * fV2),
+                                                      _bSmoothing);
+
+              /* Modulates color */
+              stColor.u8R = (orxU8)orxDISPLAY_MUL8(stColor.u8R, stTexel.u8R);
+              stColor.u8G = (orxU8)orxDISPLAY_MUL8(stColor.u8G, stTexel.u8G);
+              stColor.u8B = (orxU8)orxDISPLAY_MUL8(stColor.u8B, stTexel.u8B);
+              stColor.u8A = (orxU8)orxDISPLAY_MUL8(stColor.u8A, stTexel.u8A);
+            }
+
+            /* Blends it */
+            orxDisplay_Dummy_BlendPixel(pstPixel, stColor, _eBlendMode);
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Dummy_RasterizeLine(const orxDISPLAY_VERTEX *_pstStart, const orxDISPLAY_VERTEX *_pstEnd, const orxBITMAP *_pstBitmap, orxBOOL _bSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  const orxBITMAP *pstDst;
+
+  /* Gets destination */
+  pstDst = sstDisplay.pstDestination;
+
+  /* Valid? */
+  if((pstDst != orxNULL) && (pstDst->astData != orxNULL))
+  {
+    orxFLOAT  fDX, fDY, fX, fY, fT, fStepT;
+    orxS32    s32StepNumber, i, s32MinX, s32MinY, s32MaxX, s32MaxY;
+
+    /* Gets clipping rectangle */
+    s32MinX = orxF2S(pstDst->stClip.vTL.fX);
+    s32MinY = orxF2S(pstDst->stClip.vTL.fY);
+    s32MaxX = orxF2S(pstDst->stClip.vBR.fX);
+    s32MaxY = orxF2S(pstDst->stClip.vBR.fY);
+
+    /* Gets number of steps (one pixel per step along the major axis) */
+    fDX           = _pstEnd->fX - _pstStart->fX;
+    fDY           = _pstEnd->fY - _pstStart->fY;
+    s32StepNumber = orxF2S(orxMath_Ceil(orxMAX(orxMath_Abs(fDX), orxMath_Abs(fDY))));
+    s32StepNumber = orxMAX(s32StepNumber, 1);
+    fStepT        = orxFLOAT_1 / orxS2F(s32StepNumber);
+
+    /* For all steps */
+    for(i = 0, fT = orxFLOAT_0; i <= s32StepNumber; i++, fT += fStepT)
+    {
+      orxS32 s32X, s32Y;
+
+      /* Gets position */
+      fX    = _pstStart->fX + (fT * fDX);
+      fY    = _pstStart->fY + (fT * fDY);
+      s32X  = orxF2S(orxMath_Floor(fX));
+      s32Y  = orxF2S(orxMath_Floor(fY));
+
+      /* Inside clipping rectangle? */
+      if((s32X >= s32MinX) && (s32X < s32MaxX) && (s32Y >= s32MinY) && (s32Y < s32MaxY))
+      {
+        orxRGBA stColor;
+
+        /* Interpolates color */
+        stColor.u8R = (orxU8)orxF2U(orxLERP(orxU2F(_pstStart->stRGBA.u8R), orxU2F(_pstEnd->stRGBA.u8R), fT) + orx2F(0.5f));
+        stColor.u8G = (orxU8)orxF2U(orxLERP(orxU2F(_pstStart->stRGBA.u8G), orxU2F(_pstEnd->stRGBA.u8G), fT) + orx2F(0.5f));
+        stColor.u8B = (orxU8)orxF2U(orxLERP(orxU2F(_pstStart->stRGBA.u8B), orxU2F(_pstEnd->stRGBA.u8B), fT) + orx2F(0.5f));
+        stColor.u8A = (orxU8)orxF2U(orxLERP(orxU2F(_pstStart->stRGBA.u8A), orxU2F(_pstEnd->stRGBA.u8A), fT) + orx2F(0.5f));
+
+        /* Textured? */
+        if(_pstBitmap != orxNULL)
+        {
+          orxRGBA stTexel;
+
+          /* Samples texture */
+          stTexel = orxDisplay_Dummy_SampleBitmap(_pstBitmap, orxLERP(_pstStart->fU, _pstEnd->fU, fT), orxLERP(_pstStart->fV, _pstEnd->fV, fT), _bSmoothing);
+
+          /* Modulates color */
+          stColor.u8R = (orxU8)orxDISPLAY_MUL8(stColor.u8R, stTexel.u8R);
+          stColor.u8G = (orxU8)orxDISPLAY_MUL8(stColor.u8G, stTexel.u8G);
+          stColor.u8B = (orxU8)orxDISPLAY_MUL8(stColor.u8B, stTexel.u8B);
+          stColor.u8A = (orxU8)orxDISPLAY_MUL8(stColor.u8A, stTexel.u8A);
+        }
+
+        /* Blends it */
+        orxDisplay_Dummy_BlendPixel(&(pstDst->astData[s32Y * pstDst->u32Width + s32X]), stColor, _eBlendMode);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Dummy_DrawArrays()
+{
+  /* Has data? */
+  if(sstDisplay.s32BufferIndex > 0)
+  {
+    orxS32 i;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxDisplay_DrawArrays");
+
+    /* Checks */
+    orxASSERT(sstDisplay.pstBatchBitmap != orxNULL);
+
+    /* For all triangles */
+    for(i = 0; i < sstDisplay.s32ElementNumber; i += 3)
+    {
+      /* Rasterizes it */
+      orxDisplay_Dummy_RasterizeTriangle(&(sstDisplay.astVertexList[sstDisplay.au16IndexList[i]]),
+                                         &(sstDisplay.astVertexList[sstDisplay.au16IndexList[i + 1]]),
+                                         &(sstDisplay.astVertexList[sstDisplay.au16IndexList[i + 2]]),
+                                         sstDisplay.pstBatchBitmap,
+                                         sstDisplay.bBatchSmoothing,
+                                         sstDisplay.eBatchBlendMode);
+    }
+
+    /* Clears buffer */
+    sstDisplay.s32BufferIndex   = 0;
+    sstDisplay.s32ElementNumber = 0;
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxBOOL orxDisplay_Dummy_GetSmoothing(orxDISPLAY_SMOOTHING _eSmoothing)
+{
+  orxBOOL bResult;
+
+  /* Depending on smoothing type */
+  switch(_eSmoothing)
+  {
+    case orxDISPLAY_SMOOTHING_ON:
+    {
+      /* Applies smoothing */
+      bResult = orxTRUE;
+
+      break;
+    }
+
+    case orxDISPLAY_SMOOTHING_OFF:
+    {
+      /* Applies no smoothing */
+      bResult = orxFALSE;
+
+      break;
+    }
+
+    default:
+    case orxDISPLAY_SMOOTHING_DEFAULT:
+    {
+      /* Applies default smoothing */
+      bResult = sstDisplay.bDefaultSmoothing;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static void orxFASTCALL orxDisplay_Dummy_PrepareBitmap(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxBOOL bSmoothing;
+
+  /* Checks */
+  orxASSERT((_pstBitmap != orxNULL) && (_pstBitmap != sstDisplay.pstScreen));
+
+  /* Gets smoothing */
+  bSmoothing = orxDisplay_Dummy_GetSmoothing(_eSmoothing);
+
+  /* New render state? */
+  if((_pstBitmap != sstDisplay.pstBatchBitmap)
+  || (bSmoothing != sstDisplay.bBatchSmoothing)
+  || (_eBlendMode != sstDisplay.eBatchBlendMode))
+  {
+    /* Draws remaining items */
+    orxDisplay_Dummy_DrawArrays();
+
+    /* Stores new state */
+    sstDisplay.pstBatchBitmap   = _pstBitmap;
+    sstDisplay.bBatchSmoothing  = bSmoothing;
+    sstDisplay.eBatchBlendMode  = _eBlendMode;
+  }
+
+  /* End of buffer? */
+  if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+  {
+    /* Draws arrays */
+    orxDisplay_Dummy_DrawArrays();
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxDisplay_Dummy_AddQuad(const orxVECTOR *_pvX, const orxVECTOR *_pvY, orxFLOAT _fX, orxFLOAT _fY, orxFLOAT _fWidth, orxFLOAT _fHeight, orxFLOAT _fLeft, orxFLOAT _fTop, orxFLOAT _fRight, orxFLOAT _fBottom, orxRGBA _stColor)
+{
+  orxDISPLAY_VERTEX *astVertexList;
+
+  /* Gets vertex list */
+  astVertexList = &(sstDisplay.astVertexList[sstDisplay.s32BufferIndex]);
+
+  /* Outputs vertices and texture coordinates */
+  astVertexList[0].fX     = (_pvX->fX * _fX) + (_pvX->fY * (_fY + _fHeight)) + _pvX->fZ;
+  astVertexList[0].fY     = (_pvY->fX * _fX) + (_pvY->fY * (_fY + _fHeight)) + _pvY->fZ;
+  astVertexList[1].fX     = (_pvX->fX * _fX) + (_pvX->fY * _fY) + _pvX->fZ;
+  astVertexList[1].fY     = (_pvY->fX * _fX) + (_pvY->fY * _fY) + _pvY->fZ;
+  astVertexList[2].fX     = (_pvX->fX * (_fX + _fWidth)) + (_pvX->fY * (_fY + _fHeight)) + _pvX->fZ;
+  astVertexList[2].fY     = (_pvY->fX * (_fX + _fWidth)) + (_pvY->fY * (_fY + _fHeight)) + _pvY->fZ;
+  astVertexList[3].fX     = (_pvX->fX * (_fX + _fWidth)) + (_pvX->fY * _fY) + _pvX->fZ;
+  astVertexList[3].fY     = (_pvY->fX * (_fX + _fWidth)) + (_pvY->fY * _fY) + _pvY->fZ;
+
+  astVertexList[0].fU     =
+  astVertexList[1].fU     = _fLeft;
+  astVertexList[2].fU     =
+  astVertexList[3].fU     = _fRight;
+  astVertexList[1].fV     =
+  astVertexList[3].fV     = _fTop;
+  astVertexList[0].fV     =
+  astVertexList[2].fV     = _fBottom;
+
+  /* Fills the color list */
+  astVertexList[0].stRGBA =
+  astVertexList[1].stRGBA =
+  astVertexList[2].stRGBA =
+  astVertexList[3].stRGBA = _stColor;
+
+  /* Updates index & element number */
+  sstDisplay.s32BufferIndex   += 4;
+  sstDisplay.s32ElementNumber += 6;
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxDisplay_Dummy_InitMatrix(orxVECTOR *_pvX, orxVECTOR *_pvY, const orxDISPLAY_TRANSFORM *_pstTransform, const orxBITMAP *_pstBitmap)
+{
+  orxFLOAT fCos, fSin, fSCosX, fSCosY, fSSinX, fSSinY, fTX, fTY, fRotation, fSrcX, fSrcY, fScaleX, fScaleY, fWidth, fHeight;
+
+  /* Updates rotation */
+  fRotation = _pstTransform->fRotation + orxU2F(_pstTransform->eOrientation) * orxMATH_KF_PI_BY_2;
+
+  /* Has rotation? */
+  if(fRotation != orxFLOAT_0)
+  {
+    /* Gets its cos/sin */
+    fCos = orxMath_Cos(fRotation);
+    fSin = orxMath_Sin(fRotation);
+  }
+  else
+  {
+    /* Inits cos/sin */
+    fCos = orxFLOAT_1;
+    fSin = orxFLOAT_0;
+  }
+
+  /* Gets bitmap size */
+  fWidth  = _pstBitmap->stClip.vBR.fX - _pstBitmap->stClip.vTL.fX;
+  fHeight = _pstBitmap->stClip.vBR.fY - _pstBitmap->stClip.vTL.fY;
+
+  /* Depending on orientation */
+  switch(_pstTransform->eOrientation)
+  {
+    default:
+    case orxDISPLAY_ORIENTATION_UP:
+    {
+      fSrcX   = _pstTransform->fSrcX;
+      fSrcY   = _pstTransform->fSrcY;
+      fScaleX = _pstTransform->fScaleX;
+      fScaleY = _pstTransform->fScaleY;
+      break;
+    }
+
+    case orxDISPLAY_ORIENTATION_LEFT:
+    {
+      fSrcX   = _pstTransform->fSrcY;
+      fSrcY   = fHeight - _pstTransform->fSrcX;
+      fScaleX = _pstTransform->fScaleY;
+      fScaleY = _pstTransform->fScaleX;
+      break;
+    }
+
+    case orxDISPLAY_ORIENTATION_DOWN:
+    {
+      fSrcX   = fWidth - _pstTransform->fSrcX;
+      fSrcY   = fHeight - _pstTransform->fSrcY;
+      fScaleX = _pstTransform->fScaleX;
+      fScaleY = _pstTransform->fScaleY;
+      break;
+    }
+
+    case orxDISPLAY_ORIENTATION_RIGHT:
+    {
+      fSrcX   = fWidth - _pstTransform->fSrcY;
+      fSrcY   = _pstTransform->fSrcX;
+      fScaleX = _pstTransform->fScaleY;
+      fScaleY = _pstTransform->fScaleX;
+      break;
+    }
+  }
+
+  /* Computes values */
+  fSCosX  = fScaleX * fCos;
+  fSCosY  = fScaleY * fCos;
+  fSSinX  = fScaleX * fSin;
+  fSSinY  = fScaleY * fSin;
+  fTX     = _pstTransform->fDstX - (fSrcX * fSCosX) + (fSrcY * fSSinY);
+  fTY     = _pstTransform->fDstY - (fSrcX * fSSinX) - (fSrcY * fSCosY);
+
+  /* Updates matrix */
+  orxVector_Set(_pvX, fSCosX, -fSSinY, fTX);
+  orxVector_Set(_pvY, fSSinX, fSCosY, fTY);
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Dummy_DrawPrimitive(const orxDISPLAY_VERTEX *_astVertexList, orxU32 _u32VertexNumber, orxBOOL _bFill, orxBOOL _bOpen)
+{
+  orxDISPLAY_BLEND_MODE eBlendMode;
+  orxU32                i;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxDisplay_DrawPrimitive");
+
+  /* Draws remaining items */
+  orxDisplay_Dummy_DrawArrays();
+
+  /* Gets blend mode */
+  eBlendMode = (orxRGBA_A(_astVertexList[0].stRGBA) != 0xFF) ? orxDISPLAY_BLEND_MODE_ALPHA : orxDISPLAY_BLEND_MODE_NONE;
+
+  /* Only 2 vertices? */
+  if(_u32VertexNumber == 2)
+  {
+    /* Draws it */
+    orxDisplay_Dummy_RasterizeLine(&(_astVertexList[0]), &(_astVertexList[1]), orxNULL, orxFALSE, eBlendMode);
+  }
+  else
+  {
+    /* Should fill? */
+    if(_bFill != orxFALSE)
+    {
+      /* For all triangles of the fan */
+      for(i = 2; i < _u32VertexNumber; i++)
+      {
+        /* Draws it */
+        orxDisplay_Dummy_RasterizeTriangle(&(_astVertexList[0]), &(_astVertexList[i - 1]), &(_astVertexList[i]), orxNULL, orxFALSE, eBlendMode);
+      }
+    }
+    else
+    {
+      /* For all segments */
+      for(i = 1; i < _u32VertexNumber; i++)
+      {
+        /* Draws it */
+        orxDisplay_Dummy_RasterizeLine(&(_astVertexList[i - 1]), &(_astVertexList[i]), orxNULL, orxFALSE, eBlendMode);
+      }
+
+      /* Is closed? */
+      if(_bOpen == orxFALSE)
+      {
+        /* Draws last segment */
+        orxDisplay_Dummy_RasterizeLine(&(_astVertexList[_u32VertexNumber - 1]), &(_astVertexList[0]), orxNULL, orxFALSE, eBlendMode);
+      }
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxBITMAP *orxDisplay_Dummy_AllocateBitmap(orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxBITMAP *pstResult;
+
+  /* Allocates bitmap */
+  pstResult = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+
+  /* Valid? */
+  if(pstResult != orxNULL)
+  {
+    /* Allocates its pixels */
+    pstResult->astData = (orxRGBA *)orxMemory_Allocate(orxMAX(_u32Width * _u32Height, 1) * sizeof(orxRGBA), orxMEMORY_TYPE_VIDEO);
+
+    /* Success? */
+    if(pstResult->astData != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstResult->astData, orxMAX(_u32Width * _u32Height, 1) * sizeof(orxRGBA));
+      pstResult->fWidth       = orxU2F(_u32Width);
+      pstResult->fHeight      = orxU2F(_u32Height);
+      pstResult->u32Width     = _u32Width;
+      pstResult->u32Height    = _u32Height;
+      pstResult->fRecWidth    = (_u32Width != 0) ? orxFLOAT_1 / pstResult->fWidth : orxFLOAT_0;
+      pstResult->fRecHeight   = (_u32Height != 0) ? orxFLOAT_1 / pstResult->fHeight : orxFLOAT_0;
+      pstResult->zLocation    = orxSTRING_EMPTY;
+      pstResult->stFilenameID = orxSTRINGID_UNDEFINED;
+      pstResult->u32ID        = ++sstDisplay.u32BitmapCounter;
+      orxVector_Copy(&(pstResult->stClip.vTL), &orxVECTOR_0);
+      orxVector_Set(&(pstResult->stClip.vBR), pstResult->fWidth, pstResult->fHeight, orxFLOAT_0);
+    }
+    else
+    {
+      /* Deletes it */
+      orxBank_Free(sstDisplay.pstBitmapBank, pstResult);
+
+      /* Updates result */
+      pstResult = orxNULL;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static void orxDisplay_Dummy_WriteResourceCallback(void *_pContext, void *_pData, int _iSize)
+{
+  /* Writes resource synchronously */
+  orxResource_Write((orxHANDLE)_pContext, (orxS64)_iSize, _pData, orxNULL, orxNULL);
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_EncodeBitmapData(orxHANDLE _hResource, orxU32 _u32Width, orxU32 _u32Height, const orxU8 *_au8Data)
+{
+  const orxSTRING zExtension;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL));
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Gets extension */
+  zExtension = orxString_GetExtension(orxResource_GetLocation(_hResource));
+
+  /* PNG? */
+  if(orxString_ICompare(zExtension, "png") == 0)
+  {
+    /* Saves image to disk */
+    eResult = stbi_write_png_to_func(&orxDisplay_Dummy_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+  }
+  /* QOI? */
+  else if(orxString_ICompare(zExtension, "qoi") == 0)
+  {
+    qoi_desc  stDesc;
+    int       iSize;
+    void     *pBuffer;
+
+    /* Inits descriptor */
+    orxMemory_Zero(&stDesc, sizeof(qoi_desc));
+    stDesc.width      = _u32Width;
+    stDesc.height     = _u32Height;
+    stDesc.channels   = 4;
+    stDesc.colorspace = 1;
+
+    /* Encodes it */
+    pBuffer = qoi_encode(_au8Data, &stDesc, &iSize);
+
+    /* Success? */
+    if(pBuffer != NULL)
+    {
+      /* Saves image to disk */
+      if(orxResource_Write(_hResource, (orxS64)iSize, pBuffer, orxNULL, orxNULL) == (orxS64)iSize)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+
+      /* Deletes buffer */
+      orxMemory_Free(pBuffer);
+    }
+  }
+  /* JPG? */
+  else if((orxString_ICompare(zExtension, "jpg") == 0) || (orxString_ICompare(zExtension, "jpeg") == 0))
+  {
+    /* Saves image to disk */
+    eResult = stbi_write_jpg_to_func(&orxDisplay_Dummy_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+  }
+  /* BMP? */
+  else if(orxString_ICompare(zExtension, "bmp") == 0)
+  {
+    /* Saves image to disk */
+    eResult = stbi_write_bmp_to_func(&orxDisplay_Dummy_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+  }
+  /* TGA */
+  else
+  {
+    /* Saves image to disk */
+    eResult = stbi_write_tga_to_func(&orxDisplay_Dummy_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_Dummy_SaveBitmapData(void *_pContext)
+{
+  orxDISPLAY_SAVE_INFO *pstInfo;
+  orxSTATUS             eResult;
+
+  /* Gets save info */
+  pstInfo = (orxDISPLAY_SAVE_INFO *)_pContext;
+
+  /* Encodes data */
+  eResult = orxDisplay_Dummy_EncodeBitmapData(pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, pstInfo->pu8ImageData);
+
+  /* Closes resource */
+  orxResource_Close(pstInfo->hResource);
+
+  /* Deletes data */
+  orxMemory_Free(pstInfo->pu8ImageData);
+
+  /* Deletes save info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return eResult;
+}
+
+static orxU8 *orxFASTCALL orxDisplay_Dummy_DecodeBitmap(const orxU8 *_pu8Buffer, orxS64 _s64Size, orxU32 *_pu32Width, orxU32 *_pu32Height)
+{
+  orxU8  *pu8Result = orxNULL;
+  int     iDummy = 0;
+
+  /* QOI? */
+  if((_s64Size >= QOI_HEADER_SIZE) && (qoi_read_32(_pu8Buffer, &iDummy) == QOI_MAGIC))
+  {
+    qoi_desc stDesc;
+
+    /* Decodes it */
+    pu8Result = (orxU8 *)qoi_decode(_pu8Buffer, (int)_s64Size, &stDesc, 4);
+
+    /* Success? */
+    if(pu8Result != orxNULL)
+    {
+      /* Stores size */
+      *_pu32Width   = (orxU32)stDesc.width;
+      *_pu32Height  = (orxU32)stDesc.height;
+    }
+  }
+  else
+  {
+    int iWidth, iHeight, iChannelNumber;
+
+    /* Decodes it */
+    pu8Result = (orxU8 *)stbi_load_from_memory((const stbi_uc *)_pu8Buffer, (int)_s64Size, &iWidth, &iHeight, &iChannelNumber, STBI_rgb_alpha);
+
+    /* Success? */
+    if(pu8Result != orxNULL)
+    {
+      /* Stores size */
+      *_pu32Width   = (orxU32)iWidth;
+      *_pu32Height  = (orxU32)iHeight;
+    }
+  }
+
+  /* Done! */
+  return pu8Result;
+}
+
+
+/***************************************************************************
+ * Plugin related                                                          *
+ ***************************************************************************/
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_GetScreenBitmap()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstDisplay.pstScreen;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetScreenSize(orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = sstDisplay.pstScreen->fWidth;
+  *_pfHeight  = sstDisplay.pstScreen->fHeight;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_Swap()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Draws remaining items */
+  orxDisplay_Dummy_DrawArrays();
+
+  /* Done! */
+  return eResult;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_CreateBitmap(orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxBITMAP *pstResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Allocates bitmap */
+  pstResult = orxDisplay_Dummy_AllocateBitmap(_u32Width, _u32Height);
+
+  /* Done! */
+  return pstResult;
+}
+
+void orxFASTCALL orxDisplay_Dummy_DeleteBitmap(orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Not screen? */
+  if(_pstBitmap != sstDisplay.pstScreen)
+  {
+    /* Used by current batch? */
+    if(_pstBitmap == sstDisplay.pstBatchBitmap)
+    {
+      /* Draws remaining items */
+      orxDisplay_Dummy_DrawArrays();
+
+      /* Clears batch bitmap */
+      sstDisplay.pstBatchBitmap = orxNULL;
+    }
+
+    /* Is destination? */
+    if(_pstBitmap == sstDisplay.pstDestination)
+    {
+      /* Draws remaining items */
+      orxDisplay_Dummy_DrawArrays();
+
+      /* Clears destination */
+      sstDisplay.pstDestination = orxNULL;
+    }
+
+    /* Deletes its data */
+    orxMemory_Free(_pstBitmap->astData);
+
+    /* Deletes it */
+    orxBank_Free(sstDisplay.pstBitmapBank, _pstBitmap);
+  }
+
+  /* Done! */
+  return;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_LoadBitmap(const orxSTRING _zFileName)
+{
+  const orxSTRING zResourceLocation;
+  orxBITMAP      *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Locates resource */
+  zResourceLocation = orxResource_Locate(orxTEXTURE_KZ_RESOURCE_GROUP, _zFileName);
+
+  /* Success? */
+  if(zResourceLocation != orxNULL)
+  {
+    orxHANDLE hResource;
+
+    /* Opens it */
+    hResource = orxResource_Open(zResourceLocation, orxFALSE);
+
+    /* Success? */
+    if(hResource != orxHANDLE_UNDEFINED)
+    {
+      orxS64  s64Size;
+      orxU8  *pu8Buffer;
+
+      /* Gets its size */
+      s64Size = orxResource_GetSize(hResource);
+
+      /* Checks */
+      orxASSERT((s64Size > 0) && (s64Size < 0xFFFFFFFF));
+
+      /* Allocates buffer */
+      pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP);
+
+      /* Success? */
+      if(pu8Buffer != orxNULL)
+      {
+        /* Loads data from resource */
+        if(orxResource_Read(hResource, s64Size, pu8Buffer, orxNULL, orxNULL) == s64Size)
+        {
+          orxU8  *pu8ImageData;
+          orxU32  u32Width, u32Height;
+
+          /* Decodes it */
+          pu8ImageData = orxDisplay_Dummy_DecodeBitmap(pu8Buffer, s64Size, &u32Width, &u32Height);
+
+          /* Success? */
+          if(pu8ImageData != orxNULL)
+          {
+            /* Allocates bitmap */
+            pstResult = orxDisplay_Dummy_AllocateBitmap(u32Width, u32Height);
+
+            /* Success? */
+            if(pstResult != orxNULL)
+            {
+              orxDISPLAY_EVENT_PAYLOAD stPayload;
+
+              /* Inits it */
+              orxMemory_Copy(pstResult->astData, pu8ImageData, u32Width * u32Height * sizeof(orxRGBA));
+              pstResult->zLocation    = zResourceLocation;
+              pstResult->stFilenameID = orxString_GetID(_zFileName);
+
+              /* Inits payload */
+              orxMemory_Zero(&stPayload, sizeof(orxDISPLAY_EVENT_PAYLOAD));
+              stPayload.stBitmap.zLocation    = pstResult->zLocation;
+              stPayload.stBitmap.stFilenameID = pstResult->stFilenameID;
+              stPayload.stBitmap.u32ID        = pstResult->u32ID;
+
+              /* Sends event */
+              orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_LOAD_BITMAP, pstResult, orxNULL, &stPayload);
+            }
+
+            /* Frees image data */
+            orxMemory_Free(pu8ImageData);
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't process data for bitmap <%s>.", zResourceLocation);
+          }
+        }
+
+        /* Frees buffer */
+        orxMemory_Free(pu8Buffer);
+      }
+
+      /* Closes resource */
+      orxResource_Close(hResource);
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Is size matching? */
+  if(_u32ByteNumber == _pstBitmap->u32Width * _pstBitmap->u32Height * sizeof(orxRGBA))
+  {
+    /* Draws remaining items */
+    orxDisplay_Dummy_DrawArrays();
+
+    /* Copies pixels */
+    orxMemory_Copy(_au8Data, _pstBitmap->astData, _u32ByteNumber);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't get bitmap data for [%s]: buffer size (%u) doesn't match bitmap's (%u).", _pstBitmap->zLocation, _u32ByteNumber, _pstBitmap->u32Width * _pstBitmap->u32Height * (orxU32)sizeof(orxRGBA));
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFileName)
+{
+  orxU32    u32BufferSize;
+  orxU8    *pu8ImageData;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Gets buffer size */
+  u32BufferSize = _pstBitmap->u32Width * _pstBitmap->u32Height * sizeof(orxRGBA);
+
+  /* Allocates buffer */
+  pu8ImageData = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_TEMP);
+
+  /* Valid? */
+  if(pu8ImageData != orxNULL)
+  {
+    orxDISPLAY_SAVE_INFO *pstInfo = orxNULL;
+
+    /* Gets bitmap data */
+    if(orxDisplay_Dummy_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize) != orxSTATUS_FAILURE)
+    {
+      const orxSTRING zResourceLocation;
+      orxHANDLE       hResource;
+
+      /* Valid file to open? */
+      if(((zResourceLocation = orxResource_LocateInStorage(orxTEXTURE_KZ_RESOURCE_GROUP, orxRESOURCE_KZ_DEFAULT_STORAGE, _zFileName)) != orxNULL)
+      && ((hResource = orxResource_Open(zResourceLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+      {
+        /* Allocates save info */
+        pstInfo = (orxDISPLAY_SAVE_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_SAVE_INFO), orxMEMORY_TYPE_TEMP);
+
+        /* Valid? */
+        if(pstInfo != orxNULL)
+        {
+          /* Inits it */
+          pstInfo->pu8ImageData   = pu8ImageData;
+          pstInfo->hResource      = hResource;
+          pstInfo->u32Width       = _pstBitmap->u32Width;
+          pstInfo->u32Height      = _pstBitmap->u32Height;
+
+          /* Runs asynchronous task */
+          eResult = orxThread_RunTask(&orxDisplay_Dummy_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
+        }
+        else
+        {
+          /* Closes resource */
+          orxResource_Close(hResource);
+        }
+      }
+    }
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Frees save info */
+      if(pstInfo != orxNULL)
+      {
+        orxMemory_Free(pstInfo);
+      }
+
+      /* Frees buffer */
+      orxMemory_Free(pu8ImageData);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_LoadFont(const orxSTRING _zFileName, const orxSTRING _zCharacterList, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvCharacterSpacing, const orxVECTOR *_pvCharacterPadding, orxBOOL _bSDF, orxFLOAT *_afCharacterWidthList)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Logs message */
+  orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't load font <%s>: not supported by this display plugin.", _zFileName);
+
+  /* Done! */
+  return orxNULL;
+}
+
+orxHANDLE orxFASTCALL orxDisplay_Dummy_LoadTypeface(const orxSTRING _zFileName, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvCharacterPadding, orxBOOL _bSDF)
+{
+  orxHANDLE hResult = orxHANDLE_UNDEFINED;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFileName != orxNULL);
+  orxASSERT(_pvCharacterSize != orxNULL);
+  orxASSERT(_pvCharacterSize->fY > orxFLOAT_0);
+  orxASSERT(_pvCharacterPadding != orxNULL);
+
+  /* Valid? */
+  if(*_zFileName != orxCHAR_NULL)
+  {
+    const orxSTRING zLocation;
+
+    /* Locates resource */
+    zLocation = orxResource_Locate(orxFONT_KZ_RESOURCE_GROUP, _zFileName);
+
+    /* Success? */
+    if(zLocation != orxNULL)
+    {
+      orxHANDLE hResource;
+
+      /* Opens it */
+      hResource = orxResource_Open(zLocation, orxFALSE);
+
+      /* Success? */
+      if(hResource != orxHANDLE_UNDEFINED)
+      {
+        orxDISPLAY_TYPEFACE  *pstTypeface;
+        orxS64                s64Size;
+
+        /* Gets its size */
+        s64Size = orxResource_GetSize(hResource);
+
+        /* Checks */
+        orxASSERT((s64Size > 0) && (s64Size < (orxS64)(0xFFFFFFFF - sizeof(orxDISPLAY_TYPEFACE))));
+
+        /* Allocates typeface, followed by its source buffer */
+        pstTypeface = (orxDISPLAY_TYPEFACE *)orxMemory_Allocate(sizeof(orxDISPLAY_TYPEFACE) + (orxU32)s64Size, orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(pstTypeface != orxNULL)
+        {
+          orxU8 *pu8Buffer;
+
+          /* Clears it */
+          orxMemory_Zero(pstTypeface, sizeof(orxDISPLAY_TYPEFACE));
+
+          /* Gets its source buffer */
+          pu8Buffer = (orxU8 *)(pstTypeface + 1);
+
+          /* Reads data from resource and initializes font */
+          if((orxResource_Read(hResource, s64Size, pu8Buffer, orxNULL, orxNULL) == s64Size)
+          && (stbtt_InitFont(&(pstTypeface->stFontInfo), pu8Buffer, 0) != 0))
+          {
+            int iX0, iX1, iY0, iY1;
+
+            /* Gets font's bounding box, as glyphs aren't known in advance */
+            stbtt_GetFontBoundingBox(&(pstTypeface->stFontInfo), &iX0, &iY0, &iX1, &iY1);
+
+            /* Updates padding values */
+            pstTypeface->fXPadding = orxMAX(orxFLOAT_0, _pvCharacterPadding->fX);
+            pstTypeface->fYPadding = orxMAX(orxFLOAT_0, _pvCharacterPadding->fY);
+
+            /* Gets font scale */
+            pstTypeface->vFontScale.fY = orxMAX(orxFLOAT_0, (_pvCharacterSize->fY - orx2F(2.0f) * pstTypeface->fYPadding - orxFLOAT_1) / (iY1 - iY0));
+            pstTypeface->vFontScale.fX = (_pvCharacterSize->fX > orxFLOAT_0) ? orxMAX(orxFLOAT_0, ((_pvCharacterSize->fX - orx2F(2.0f) * pstTypeface->fXPadding - orxFLOAT_1) / (iX1 - iX0))) : pstTypeface->vFontScale.fY;
+
+            /* Gets base line */
+            pstTypeface->fBaseLine = orxMath_Ceil(pstTypeface->vFontScale.fY * orxS2F(iY1));
+
+            /* Stores bounding box & size */
+            pstTypeface->s32X0 = (orxS32)iX0;
+            pstTypeface->s32X1 = (orxS32)iX1;
+            orxVector_Copy(&(pstTypeface->vCharacterSize), _pvCharacterSize);
+
+            /* Updates result */
+            hResult = (orxHANDLE)pstTypeface;
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't load typeface <%s>: invalid font data.", _zFileName);
 
+            /* Frees typeface */
+            orxMemory_Free(pstTypeface);
+          }
+        }
 
-#include "orxPluginAPI.h"
+        /* Closes resource */
+        orxResource_Close(hResource);
+      }
+    }
+  }
 
-orxSTATUS orxFASTCALL orxDisplay_Dummy_Init()
-{
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return hResult;
 }
 
-void orxFASTCALL orxDisplay_Dummy_Exit()
+void orxFASTCALL orxDisplay_Dummy_DeleteTypeface(orxHANDLE _hTypeface)
 {
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hTypeface != orxHANDLE_UNDEFINED) && (_hTypeface != orxNULL));
+
+  /* Frees it (its source buffer is part of the same allocation) */
+  orxMemory_Free(_hTypeface);
+
   /* Done! */
   return;
 }
 
-orxSTATUS orxFASTCALL orxDisplay_Dummy_Swap()
+orxSTATUS orxFASTCALL orxDisplay_Dummy_RenderGlyph(const orxHANDLE _hTypeface, orxU32 _u32CharacterCodePoint, orxFLOAT *_pfWidth, orxU8 *_pu8Data)
 {
-  /* Done! */
-  return orxSTATUS_SUCCESS;
-}
+  const orxDISPLAY_TYPEFACE  *pstTypeface;
+  int                         iGlyphWidth, iGlyphX0, iGlyphX1, iGlyphY0, iGlyphY1, iIndex;
+  orxFLOAT                    fWidth, fX, fY;
+  orxSTATUS                   eResult = orxSTATUS_SUCCESS;
 
-orxBITMAP *orxFASTCALL orxDisplay_Dummy_GetScreenBitmap()
-{
-  /* Done! */
-  return (orxBITMAP *)orxHANDLE_UNDEFINED;
-}
+  /* Checks */
+  orxASSERT((_hTypeface != orxHANDLE_UNDEFINED) && (_hTypeface != orxNULL));
+  orxASSERT(_pfWidth != orxNULL);
 
-orxSTATUS orxFASTCALL orxDisplay_Dummy_GetScreenSize(orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
-{
-  /* Clears values */
-  *_pfWidth = *_pfHeight = orxFLOAT_1;
+  /* Gets typeface */
+  pstTypeface = (const orxDISPLAY_TYPEFACE *)_hTypeface;
 
-  /* Done! */
-  return orxSTATUS_SUCCESS;
-}
+  /* Gets glyph index (missing characters will use the font's default glyph) */
+  iIndex = stbtt_FindGlyphIndex(&(pstTypeface->stFontInfo), (int)_u32CharacterCodePoint);
 
-orxBITMAP *orxFASTCALL orxDisplay_Dummy_CreateBitmap(orxU32 _u32Width, orxU32 _u32Height)
-{
-  /* Done! */
-  return (orxBITMAP *)orxHANDLE_UNDEFINED;
-}
+  /* Gets its metrics */
+  stbtt_GetGlyphHMetrics(&(pstTypeface->stFontInfo), iIndex, &iGlyphWidth, NULL);
 
-void orxFASTCALL orxDisplay_Dummy_DeleteBitmap(orxBITMAP *_pstBitmap)
-{
-  /* Done! */
-  return;
-}
+  /* Gets glyph bitmap box */
+  stbtt_GetGlyphBitmapBox(&(pstTypeface->stFontInfo), iIndex, pstTypeface->vFontScale.fX, pstTypeface->vFontScale.fY, &iGlyphX0, &iGlyphY0, &iGlyphX1, &iGlyphY1);
 
-orxBITMAP *orxFASTCALL orxDisplay_Dummy_LoadBitmap(const orxSTRING _zFileName)
-{
-  /* Done! */
-  return (orxBITMAP *)orxHANDLE_UNDEFINED;
-}
+  /* Gets glyph width & offset inside its cell (same layout as the GLFW plugin) */
+  fWidth  = orx2F(2.0f) * pstTypeface->fXPadding + orxMath_Ceil((pstTypeface->vCharacterSize.fX > orxFLOAT_0)
+                                                                 ? pstTypeface->vCharacterSize.fX
+                                                                 : (pstTypeface->vCharacterSize.fX == orxFLOAT_0)
+                                                                   ? orxMAX(pstTypeface->vFontScale.fX * orxS2F(iGlyphWidth), orxS2F(iGlyphX1 - iGlyphX0))
+                                                                   : pstTypeface->vFontScale.fX * (pstTypeface->s32X1 - pstTypeface->s32X0));
+  fX      = pstTypeface->fXPadding + ((pstTypeface->vCharacterSize.fX == orxFLOAT_0)
+                                      ? orxMAX(0, orxS2F(iGlyphX0))
+                                      : orxMath_Floor(orx2F(0.5f) * (fWidth - orx2F(2.0f) * pstTypeface->fXPadding - orxS2F(iGlyphX1 - iGlyphX0))));
+  fY      = pstTypeface->fYPadding + pstTypeface->fBaseLine + orxS2F(iGlyphY0);
 
-orxSTATUS orxFASTCALL orxDisplay_Dummy_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFileName)
-{
-  /* Done! */
-  return orxSTATUS_SUCCESS;
-}
+  /* Stores its width */
+  *_pfWidth = fWidth;
+
+  /* Should render? */
+  if(_pu8Data != orxNULL)
+  {
+    orxU8  *pu8Buffer;
+    orxS32  s32Width, s32Height;
+
+    /* Gets glyph size */
+    s32Width  = orxF2S(fWidth);
+    s32Height = orxF2S(pstTypeface->vCharacterSize.fY);
+
+    /* Allocates coverage buffer */
+    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)(s32Width * s32Height), orxMEMORY_TYPE_TEMP);
+
+    /* Success? */
+    if(pu8Buffer != orxNULL)
+    {
+      orxS32 s32X, s32Y, i;
+
+      /* Gets glyph offset, inside its cell */
+      s32X = orxMAX(0, orxF2S(fX));
+      s32Y = orxMAX(0, orxF2S(fY));
+
+      /* Clears it */
+      orxMemory_Zero(pu8Buffer, (orxU32)(s32Width * s32Height));
+
+      /* Renders the glyph */
+      if((s32X < s32Width) && (s32Y < s32Height))
+      {
+        stbtt_MakeGlyphBitmap(&(pstTypeface->stFontInfo), pu8Buffer + s32X + s32Y * s32Width, s32Width - s32X, s32Height - s32Y, s32Width, pstTypeface->vFontScale.fX, pstTypeface->vFontScale.fY, iIndex);
+      }
+
+      /* For all pixels */
+      for(i = 0; i < s32Width * s32Height; i++)
+      {
+        /* Sets it as white pixel with varying opacity */
+        _pu8Data[i * 4 + 0] =
+        _pu8Data[i * 4 + 1] =
+        _pu8Data[i * 4 + 2] = 0xFF;
+        _pu8Data[i * 4 + 3] = pu8Buffer[i];
+      }
+
+      /* Frees coverage buffer */
+      orxMemory_Free(pu8Buffer);
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
 
-orxBITMAP *orxFASTCALL orxDisplay_Dummy_LoadFont(const orxSTRING _zFileName, const orxSTRING _zCharacterList, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvCharacterSpacing, orxFLOAT _fCharacterPadding, orxBOOL _bSDF, orxFLOAT *_afCharacterWidthList)
-{
   /* Done! */
-  return (orxBITMAP *)orxHANDLE_UNDEFINED;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_SetTempBitmap(const orxBITMAP *_pstBitmap)
 {
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Loading is synchronous: temp bitmap isn't needed */
+
   /* Done! */
   return orxSTATUS_SUCCESS;
 }
 
 const orxBITMAP *orxFASTCALL orxDisplay_Dummy_GetTempBitmap()
 {
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
   /* Done! */
   return orxNULL;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_SetDestinationBitmaps(orxBITMAP **_apstBitmapList, orxU32 _u32Number)
 {
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_apstBitmapList != orxNULL);
+
+  /* Has destinations? */
+  if((_u32Number != 0) && (_apstBitmapList[0] != orxNULL))
+  {
+    /* Too many destinations? */
+    if(_u32Number > 1)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can only attach the first bitmap as destination, out of the <%u> requested.", _u32Number);
+    }
+
+    /* New destination? */
+    if(_apstBitmapList[0] != sstDisplay.pstDestination)
+    {
+      /* Draws remaining items */
+      orxDisplay_Dummy_DrawArrays();
+
+      /* Stores it */
+      sstDisplay.pstDestination = _apstBitmapList[0];
+    }
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_ClearBitmap(orxBITMAP *_pstBitmap, orxRGBA _stColor)
 {
+  orxBITMAP  *pstBitmap;
+  orxSTATUS   eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Draws remaining items */
+  orxDisplay_Dummy_DrawArrays();
+
+  /* Gets bitmap to clear */
+  pstBitmap = (_pstBitmap != orxNULL) ? _pstBitmap : sstDisplay.pstDestination;
+
+  /* Valid? */
+  if(pstBitmap != orxNULL)
+  {
+    orxU32 u32MinX, u32MinY, u32MaxX, u32MaxY, i, j;
+
+    /* Current destination? */
+    if(_pstBitmap == orxNULL)
+    {
+      /* Only clears inside its clipping rectangle */
+      u32MinX = orxF2U(pstBitmap->stClip.vTL.fX);
+      u32MinY = orxF2U(pstBitmap->stClip.vTL.fY);
+      u32MaxX = orxMIN(orxF2U(pstBitmap->stClip.vBR.fX), pstBitmap->u32Width);
+      u32MaxY = orxMIN(orxF2U(pstBitmap->stClip.vBR.fY), pstBitmap->u32Height);
+    }
+    else
+    {
+      /* Clears it entirely */
+      u32MinX = u32MinY = 0;
+      u32MaxX = pstBitmap->u32Width;
+      u32MaxY = pstBitmap->u32Height;
+    }
+
+    /* For all lines */
+    for(j = u32MinY; j < u32MaxY; j++)
+    {
+      orxRGBA *pstPixel;
+
+      /* For all pixels */
+      for(i = u32MinX, pstPixel = &(pstBitmap->astData[j * pstBitmap->u32Width + u32MinX]); i < u32MaxX; i++, pstPixel++)
+      {
+        /* Sets its value */
+        *pstPixel = _stColor;
+      }
+    }
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBlendMode(orxDISPLAY_BLEND_MODE _eBlendMode)
 {
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* New blend mode? */
+  if(_eBlendMode != sstDisplay.eBatchBlendMode)
+  {
+    /* Draws remaining items */
+    orxDisplay_Dummy_DrawArrays();
+
+    /* Stores it */
+    sstDisplay.eBatchBlendMode = _eBlendMode;
+  }
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapClipping(orxBITMAP *_pstBitmap, orxU32 _u32TLX, orxU32 _u32TLY, orxU32 _u32BRX, orxU32 _u32BRY)
 {
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* No destination bitmap? */
+  if(_pstBitmap == orxNULL)
+  {
+    /* Defaults to current destination */
+    _pstBitmap = sstDisplay.pstDestination;
+  }
+
+  /* Valid? */
+  if(_pstBitmap != orxNULL)
+  {
+    /* Used by current batch? */
+    if((_pstBitmap == sstDisplay.pstDestination) || (_pstBitmap == sstDisplay.pstBatchBitmap))
+    {
+      /* Draws remaining items */
+      orxDisplay_Dummy_DrawArrays();
+    }
+
+    /* Stores clip coords, clamped to bitmap */
+    orxVector_Set(&(_pstBitmap->stClip.vTL), orxU2F(orxMIN(_u32TLX, _pstBitmap->u32Width)), orxU2F(orxMIN(_u32TLY, _pstBitmap->u32Height)), orxFLOAT_0);
+    orxVector_Set(&(_pstBitmap->stClip.vBR), orxU2F(orxMIN(_u32BRX, _pstBitmap->u32Width)), orxU2F(orxMIN(_u32BRY, _pstBitmap->u32Height)), orxFLOAT_0);
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32ByteNumber)
 {
-  /* Done! */
-  return orxSTATUS_SUCCESS;
-}
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid? */
+  if((_pstBitmap != sstDisplay.pstScreen) && (_u32ByteNumber == _pstBitmap->u32Width * _pstBitmap->u32Height * sizeof(orxRGBA)))
+  {
+    /* Used by current batch? */
+    if((_pstBitmap == sstDisplay.pstBatchBitmap) || (_pstBitmap == sstDisplay.pstDestination))
+    {
+      /* Draws remaining items */
+      orxDisplay_Dummy_DrawArrays();
+    }
+
+    /* Updates its content */
+    orxMemory_Copy(_pstBitmap->astData, _au8Data, _u32ByteNumber);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Screen? */
+    if(_pstBitmap == sstDisplay.pstScreen)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data: can't use screen as destination bitmap.");
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data for [%s]: format needs to be RGBA.", _pstBitmap->zLocation);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
 
-orxSTATUS orxFASTCALL orxDisplay_Dummy_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
-{
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_SetPartialBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height)
 {
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid? */
+  if((_pstBitmap != sstDisplay.pstScreen) && (_u32X + _u32Width <= _pstBitmap->u32Width) && (_u32Y + _u32Height <= _pstBitmap->u32Height))
+  {
+    orxU32 i;
+
+    /* Used by current batch? */
+    if((_pstBitmap == sstDisplay.pstBatchBitmap) || (_pstBitmap == sstDisplay.pstDestination))
+    {
+      /* Draws remaining items */
+      orxDisplay_Dummy_DrawArrays();
+    }
+
+    /* For all lines */
+    for(i = 0; i < _u32Height; i++)
+    {
+      /* Updates its content */
+      orxMemory_Copy(&(_pstBitmap->astData[(_u32Y + i) * _pstBitmap->u32Width + _u32X]), _au8Data + (i * _u32Width * sizeof(orxRGBA)), _u32Width * sizeof(orxRGBA));
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Screen? */
+    if(_pstBitmap == sstDisplay.pstScreen)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data: can't use screen as destination bitmap.");
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data for [%s]: rectangle coordinates (%u, %u) - (%u, %u) are out of bound [%ux%u].", _pstBitmap->zLocation, _u32X, _u32Y, _u32X + _u32Width, _u32Y + _u32Height, _pstBitmap->u32Width, _pstBitmap->u32Height);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
 {
-  /* Clears values */
-  *_pfWidth = *_pfHeight = orxFLOAT_1;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = _pstBitmap->fWidth;
+  *_pfHeight  = _pstBitmap->fHeight;
 
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxU32 orxFASTCALL orxDisplay_Dummy_GetBitmapID(const orxBITMAP *_pstBitmap)
 {
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_pstBitmap != orxNULL) && (_pstBitmap != sstDisplay.pstScreen));
+
   /* Done! */
-  return orxU32_UNDEFINED;
+  return _pstBitmap->u32ID;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_TransformBitmap(const orxBITMAP *_pstSrc, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
 {
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSrc != sstDisplay.pstScreen);
+  orxASSERT((_pstSrc == orxNULL) || (_pstTransform != orxNULL));
+
+  /* No bitmap? */
+  if(_pstSrc == orxNULL)
+  {
+    /* Full screen shader passes aren't supported: draws remaining items */
+    orxDisplay_Dummy_DrawArrays();
+  }
+  else
+  {
+    orxVECTOR vX, vY;
+    orxFLOAT  fLeft, fTop, fRight, fBottom, fWidth, fHeight;
+
+    /* Inits matrix */
+    orxDisplay_Dummy_InitMatrix(&vX, &vY, _pstTransform, _pstSrc);
+
+    /* Prepares bitmap for drawing */
+    orxDisplay_Dummy_PrepareBitmap(_pstSrc, _eSmoothing, _eBlendMode);
+
+    /* Gets clipped size */
+    fWidth  = _pstSrc->stClip.vBR.fX - _pstSrc->stClip.vTL.fX;
+    fHeight = _pstSrc->stClip.vBR.fY - _pstSrc->stClip.vTL.fY;
+
+    /* Inits texture coords */
+    fLeft   = _pstSrc->fRecWidth * _pstSrc->stClip.vTL.fX;
+    fTop    = _pstSrc->fRecHeight * _pstSrc->stClip.vTL.fY;
+    fRight  = _pstSrc->fRecWidth * _pstSrc->stClip.vBR.fX;
+    fBottom = _pstSrc->fRecHeight * _pstSrc->stClip.vBR.fY;
+
+    /* No repeat? */
+    if((_pstTransform->fRepeatX == orxFLOAT_1) && (_pstTransform->fRepeatY == orxFLOAT_1))
+    {
+      /* Adds quad */
+      orxDisplay_Dummy_AddQuad(&vX, &vY, orxFLOAT_0, orxFLOAT_0, fWidth, fHeight, fLeft, fTop, fRight, fBottom, _stColor);
+    }
+    else
+    {
+      orxFLOAT i, j, fX, fY, fRepeatX, fRepeatY, fTileWidth, fTileHeight, fTileRight, fTileBottom;
+
+      /* Gets oriented repeat values */
+      switch(_pstTransform->eOrientation)
+      {
+        default:
+        case orxDISPLAY_ORIENTATION_UP:
+        case orxDISPLAY_ORIENTATION_DOWN:
+        {
+          fRepeatX = _pstTransform->fRepeatX;
+          fRepeatY = _pstTransform->fRepeatY;
+          break;
+        }
+
+        case orxDISPLAY_ORIENTATION_LEFT:
+        case orxDISPLAY_ORIENTATION_RIGHT:
+        {
+          fRepeatX = _pstTransform->fRepeatY;
+          fRepeatY = _pstTransform->fRepeatX;
+          break;
+        }
+      }
+
+      /* Inits tile height */
+      fTileHeight = fHeight / fRepeatY;
+
+      /* For all lines */
+      for(fY = orxFLOAT_0, i = fRepeatY; i > orxFLOAT_0; i -= orxFLOAT_1, fY += fTileHeight)
+      {
+        /* Partial line? */
+        if(i < orxFLOAT_1)
+        {
+          /* Updates height & bottom coord */
+          fTileHeight  *= i;
+          fTileBottom   = _pstSrc->fRecHeight * (_pstSrc->stClip.vTL.fY + (i * fHeight));
+        }
+        else
+        {
+          /* Resets bottom coord */
+          fTileBottom   = fBottom;
+        }
+
+        /* Resets tile width */
+        fTileWidth = fWidth / fRepeatX;
+
+        /* For all columns */
+        for(fX = orxFLOAT_0, j = fRepeatX; j > orxFLOAT_0; j -= orxFLOAT_1, fX += fTileWidth)
+        {
+          /* Partial column? */
+          if(j < orxFLOAT_1)
+          {
+            /* Updates width & right coord */
+            fTileWidth *= j;
+            fTileRight  = _pstSrc->fRecWidth * (_pstSrc->stClip.vTL.fX + (j * fWidth));
+          }
+          else
+          {
+            /* Resets right coord */
+            fTileRight  = fRight;
+          }
+
+          /* End of buffer? */
+          if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+          {
+            /* Draws arrays */
+            orxDisplay_Dummy_DrawArrays();
+          }
+
+          /* Adds quad */
+          orxDisplay_Dummy_AddQuad(&vX, &vY, fX, fY, fTileWidth, fTileHeight, fLeft, fTop, fTileRight, fTileBottom, _stColor);
+        }
+      }
+    }
+  }
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_TransformText(const orxSTRING _zString, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
 {
+  orxVECTOR       vX, vY;
+  const orxCHAR  *pc;
+  orxU32          u32CharacterCodePoint;
+  orxFLOAT        fX, fY, fHeight;
+  orxSTATUS       eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zString != orxNULL);
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Inits matrix */
+  orxDisplay_Dummy_InitMatrix(&vX, &vY, _pstTransform, _pstFont);
+
+  /* Gets character's height */
+  fHeight = _pstMap->fCharacterHeight;
+
+  /* Prepares font for drawing */
+  orxDisplay_Dummy_PrepareBitmap(_pstFont, _eSmoothing, _eBlendMode);
+
+  /* For all characters */
+  for(u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(_zString, &pc), fX = orxFLOAT_0, fY = orxFLOAT_0;
+      (u32CharacterCodePoint != orxCHAR_NULL) && (u32CharacterCodePoint != orxU32_UNDEFINED);
+      u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(pc, &pc))
+  {
+    /* Depending on character */
+    switch(u32CharacterCodePoint)
+    {
+      case orxCHAR_CR:
+      {
+        /* Half EOL? */
+        if(*pc == orxCHAR_LF)
+        {
+          /* Updates pointer */
+          pc++;
+        }
+
+        /* Falls through */
+      }
+
+      case orxCHAR_LF:
+      {
+        /* Updates Y position */
+        fY += fHeight;
+
+        /* Resets X position */
+        fX = orxFLOAT_0;
+
+        break;
+      }
+
+      default:
+      {
+        const orxCHARACTER_GLYPH *pstGlyph;
+        orxFLOAT                  fWidth;
+
+        /* Gets glyph from UTF-8 table */
+        pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstMap->pstCharacterTable, u32CharacterCodePoint);
+
+        /* Valid? */
+        if(pstGlyph != orxNULL)
+        {
+          /* Gets character width */
+          fWidth = pstGlyph->fWidth;
+
+          /* End of buffer? */
+          if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+          {
+            /* Draws arrays */
+            orxDisplay_Dummy_DrawArrays();
+          }
+
+          /* Adds quad */
+          orxDisplay_Dummy_AddQuad(&vX, &vY, fX, fY, fWidth, fHeight,
+                                   _pstFont->fRecWidth * pstGlyph->fX,
+                                   _pstFont->fRecHeight * pstGlyph->fY,
+                                   _pstFont->fRecWidth * (pstGlyph->fX + fWidth),
+                                   _pstFont->fRecHeight * (pstGlyph->fY + fHeight),
+                                   _stColor);
+        }
+        else
+        {
+          /* Gets default width */
+          fWidth = fHeight;
+        }
+
+        /* Updates X position */
+        fX += fWidth;
+
+        break;
+      }
+    }
+  }
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
 {
+  orxDISPLAY_VERTEX astVertexList[2];
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvStart != orxNULL);
+  orxASSERT(_pvEnd != orxNULL);
+
+  /* Copies vertices */
+  orxMemory_Zero(astVertexList, sizeof(astVertexList));
+  astVertexList[0].fX     = _pvStart->fX;
+  astVertexList[0].fY     = _pvStart->fY;
+  astVertexList[1].fX     = _pvEnd->fX;
+  astVertexList[1].fY     = _pvEnd->fY;
+  astVertexList[0].stRGBA =
+  astVertexList[1].stRGBA = _stColor;
+
+  /* Draws it */
+  orxDisplay_Dummy_DrawPrimitive(astVertexList, 2, orxFALSE, orxTRUE);
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawPolyline(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor)
 {
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_avVertexList != orxNULL);
+  orxASSERT(_u32VertexNumber > 0);
+  orxASSERT(_u32VertexNumber <= orxDISPLAY_KU32_VERTEX_BUFFER_SIZE);
+
+  /* Draws remaining items */
+  orxDisplay_Dummy_DrawArrays();
+
+  /* For all vertices */
+  for(i = 0; i < _u32VertexNumber; i++)
+  {
+    /* Copies its coords */
+    sstDisplay.astVertexList[i].fX = _avVertexList[i].fX;
+    sstDisplay.astVertexList[i].fY = _avVertexList[i].fY;
+
+    /* Copies color */
+    sstDisplay.astVertexList[i].stRGBA = _stColor;
+  }
+
+  /* Draws it */
+  orxDisplay_Dummy_DrawPrimitive(sstDisplay.astVertexList, _u32VertexNumber, orxFALSE, orxTRUE);
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawPolygon(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor, orxBOOL _bFill)
 {
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_avVertexList != orxNULL);
+  orxASSERT(_u32VertexNumber > 0);
+  orxASSERT(_u32VertexNumber <= orxDISPLAY_KU32_VERTEX_BUFFER_SIZE);
+
+  /* Draws remaining items */
+  orxDisplay_Dummy_DrawArrays();
+
+  /* For all vertices */
+  for(i = 0; i < _u32VertexNumber; i++)
+  {
+    /* Copies its coords */
+    sstDisplay.astVertexList[i].fX = _avVertexList[i].fX;
+    sstDisplay.astVertexList[i].fY = _avVertexList[i].fY;
+
+    /* Copies color */
+    sstDisplay.astVertexList[i].stRGBA = _stColor;
+  }
+
+  /* Draws it */
+  orxDisplay_Dummy_DrawPrimitive(sstDisplay.astVertexList, _u32VertexNumber, _bFill, orxFALSE);
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawCircle(const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxRGBA _stColor, orxBOOL _bFill)
 {
+  orxU32    i;
+  orxFLOAT  fAngle;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvCenter != orxNULL);
+  orxASSERT(_fRadius >= orxFLOAT_0);
+
+  /* Draws remaining items */
+  orxDisplay_Dummy_DrawArrays();
+
+  /* For all vertices */
+  for(i = 0, fAngle = orxFLOAT_0; i < orxDISPLAY_KU32_CIRCLE_LINE_NUMBER; i++, fAngle += orxMATH_KF_2_PI / orxDISPLAY_KU32_CIRCLE_LINE_NUMBER)
+  {
+    /* Copies its coords */
+    sstDisplay.astVertexList[i].fX = _fRadius * orxMath_Cos(fAngle) + _pvCenter->fX;
+    sstDisplay.astVertexList[i].fY = _fRadius * orxMath_Sin(fAngle) + _pvCenter->fY;
+
+    /* Copies color */
+    sstDisplay.astVertexList[i].stRGBA = _stColor;
+  }
+
+  /* Draws it */
+  orxDisplay_Dummy_DrawPrimitive(sstDisplay.astVertexList, orxDISPLAY_KU32_CIRCLE_LINE_NUMBER, _bFill, orxFALSE);
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawOBox(const orxOBOX *_pstBox, orxRGBA _stColor, orxBOOL _bFill)
 {
+  orxVECTOR vOrigin;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBox != orxNULL);
+
+  /* Draws remaining items */
+  orxDisplay_Dummy_DrawArrays();
+
+  /* Gets origin */
+  orxVector_Sub(&vOrigin, &(_pstBox->vPosition), &(_pstBox->vPivot));
+
+  /* Sets vertices */
+  sstDisplay.astVertexList[0].fX = vOrigin.fX;
+  sstDisplay.astVertexList[0].fY = vOrigin.fY;
+  sstDisplay.astVertexList[1].fX = vOrigin.fX + _pstBox->vX.fX;
+  sstDisplay.astVertexList[1].fY = vOrigin.fY + _pstBox->vX.fY;
+  sstDisplay.astVertexList[2].fX = vOrigin.fX + _pstBox->vX.fX + _pstBox->vY.fX;
+  sstDisplay.astVertexList[2].fY = vOrigin.fY + _pstBox->vX.fY + _pstBox->vY.fY;
+  sstDisplay.astVertexList[3].fX = vOrigin.fX + _pstBox->vY.fX;
+  sstDisplay.astVertexList[3].fY = vOrigin.fY + _pstBox->vY.fY;
+
+  /* Copies color */
+  sstDisplay.astVertexList[0].stRGBA =
+  sstDisplay.astVertexList[1].stRGBA =
+  sstDisplay.astVertexList[2].stRGBA =
+  sstDisplay.astVertexList[3].stRGBA = _stColor;
+
+  /* Draws it */
+  orxDisplay_Dummy_DrawPrimitive(sstDisplay.astVertexList, 4, _bFill, orxFALSE);
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawMesh(const orxDISPLAY_MESH *_pstMesh, const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
 {
+  const orxBITMAP          *pstBitmap;
+  const orxDISPLAY_VERTEX  *astVertexList;
+  const orxU16             *au16IndexList;
+  orxBOOL                   bSmoothing;
+  orxU32                    u32ElementNumber, i;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstMesh != orxNULL);
+  orxASSERT(_pstMesh->u32VertexNumber > 1);
+  orxASSERT((_pstMesh->au16IndexList == orxNULL) || (_pstMesh->u32IndexNumber > 1));
+  orxASSERT((_pstMesh->ePrimitive < orxDISPLAY_PRIMITIVE_NUMBER) || ((_pstMesh->ePrimitive == orxDISPLAY_PRIMITIVE_NONE) && (_pstMesh->au16IndexList == orxNULL)));
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxDisplay_DrawMesh");
+
+  /* Gets bitmap to use */
+  pstBitmap = (_pstBitmap != orxNULL) ? _pstBitmap : sstDisplay.pstBatchBitmap;
+
+  /* Draws remaining items */
+  orxDisplay_Dummy_DrawArrays();
+
+  /* Updates render state */
+  if(pstBitmap != orxNULL)
+  {
+    orxDisplay_Dummy_PrepareBitmap(pstBitmap, _eSmoothing, _eBlendMode);
+  }
+
+  /* Gets lists */
+  astVertexList     = _pstMesh->astVertexList;
+  bSmoothing        = orxDisplay_Dummy_GetSmoothing(_eSmoothing);
+  au16IndexList     = ((_pstMesh->u32IndexNumber != 0) && (_pstMesh->au16IndexList != orxNULL)) ? _pstMesh->au16IndexList : sstDisplay.au16IndexList;
+
+  /* Gets element number */
+  u32ElementNumber  = ((_pstMesh->u32IndexNumber != 0) && (_pstMesh->au16IndexList != orxNULL)) ? _pstMesh->u32IndexNumber : _pstMesh->u32VertexNumber + (_pstMesh->u32VertexNumber >> 1);
+
+  /* Depending on primitive */
+  switch(_pstMesh->ePrimitive)
+  {
+    case orxDISPLAY_PRIMITIVE_POINTS:
+    {
+      /* For all points */
+      for(i = 0; i < u32ElementNumber; i++)
+      {
+        /* Draws it */
+        orxDisplay_Dummy_RasterizeLine(&(astVertexList[au16IndexList[i]]), &(astVertexList[au16IndexList[i]]), pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+
+    case orxDISPLAY_PRIMITIVE_LINES:
+    {
+      /* For all segments */
+      for(i = 1; i < u32ElementNumber; i += 2)
+      {
+        /* Draws it */
+        orxDisplay_Dummy_RasterizeLine(&(astVertexList[au16IndexList[i - 1]]), &(astVertexList[au16IndexList[i]]), pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+
+    case orxDISPLAY_PRIMITIVE_LINE_LOOP:
+    case orxDISPLAY_PRIMITIVE_LINE_STRIP:
+    {
+      /* For all segments */
+      for(i = 1; i < u32ElementNumber; i++)
+      {
+        /* Draws it */
+        orxDisplay_Dummy_RasterizeLine(&(astVertexList[au16IndexList[i - 1]]), &(astVertexList[au16IndexList[i]]), pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      /* Loop? */
+      if(_pstMesh->ePrimitive == orxDISPLAY_PRIMITIVE_LINE_LOOP)
+      {
+        /* Draws last segment */
+        orxDisplay_Dummy_RasterizeLine(&(astVertexList[au16IndexList[u32ElementNumber - 1]]), &(astVertexList[au16IndexList[0]]), pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+
+    case orxDISPLAY_PRIMITIVE_TRIANGLE_STRIP:
+    {
+      /* For all triangles */
+      for(i = 2; i < u32ElementNumber; i++)
+      {
+        /* Draws it */
+        orxDisplay_Dummy_RasterizeTriangle(&(astVertexList[au16IndexList[i - 2]]), &(astVertexList[au16IndexList[i - 1]]), &(astVertexList[au16IndexList[i]]), pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+
+    case orxDISPLAY_PRIMITIVE_TRIANGLE_FAN:
+    {
+      /* For all triangles */
+      for(i = 2; i < u32ElementNumber; i++)
+      {
+        /* Draws it */
+        orxDisplay_Dummy_RasterizeTriangle(&(astVertexList[au16IndexList[0]]), &(astVertexList[au16IndexList[i - 1]]), &(astVertexList[au16IndexList[i]]), pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+
+    default:
+    case orxDISPLAY_PRIMITIVE_TRIANGLES:
+    {
+      /* For all triangles */
+      for(i = 2; i < u32ElementNumber; i += 3)
+      {
+        /* Draws it */
+        orxDisplay_Dummy_RasterizeTriangle(&(astVertexList[au16IndexList[i - 2]]), &(astVertexList[au16IndexList[i - 1]]), &(astVertexList[au16IndexList[i]]), pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxBOOL orxFASTCALL orxDisplay_Dummy_HasShaderSupport()
@@ -276,26 +2471,44 @@ orxU32 orxFASTCALL orxDisplay_Dummy_GetShaderID(const orxHANDLE _hShader)
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_EnableVSync(orxBOOL _bEnable)
 {
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates status */
+  orxFLAG_SET(sstDisplay.u32Flags, (_bEnable != orxFALSE) ? orxDISPLAY_KU32_STATIC_FLAG_VSYNC : orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_VSYNC);
+
   /* Done! */
   return orxSTATUS_SUCCESS;
 }
 
 orxBOOL orxFASTCALL orxDisplay_Dummy_IsVSyncEnabled()
 {
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
   /* Done! */
-  return orxFALSE;
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC) ? orxTRUE : orxFALSE;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_SetFullScreen(orxBOOL _bFullScreen)
 {
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates status */
+  orxFLAG_SET(sstDisplay.u32Flags, (_bFullScreen != orxFALSE) ? orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN : orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN);
+
   /* Done! */
   return orxSTATUS_SUCCESS;
 }
 
 orxBOOL orxFASTCALL orxDisplay_Dummy_IsFullScreen()
 {
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
   /* Done! */
-  return orxFALSE;
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN) ? orxTRUE : orxFALSE;
 }
 
 orxU32 orxFASTCALL orxDisplay_Dummy_GetVideoModeCount()
@@ -306,20 +2519,289 @@ orxU32 orxFASTCALL orxDisplay_Dummy_GetVideoModeCount()
 
 orxDISPLAY_VIDEO_MODE *orxFASTCALL orxDisplay_Dummy_GetVideoMode(orxU32 _u32Index, orxDISPLAY_VIDEO_MODE *_pstVideoMode)
 {
+  orxDISPLAY_VIDEO_MODE *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Request the default mode? */
+  if(_u32Index == orxU32_UNDEFINED)
+  {
+    /* Stores info */
+    _pstVideoMode->u32Width       = orxDISPLAY_KU32_DEFAULT_WIDTH;
+    _pstVideoMode->u32Height      = orxDISPLAY_KU32_DEFAULT_HEIGHT;
+    _pstVideoMode->u32Depth       = orxDISPLAY_KU32_DEFAULT_DEPTH;
+    _pstVideoMode->u32RefreshRate = orxDISPLAY_KU32_DEFAULT_REFRESH_RATE;
+    _pstVideoMode->bFullScreen    = orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN) ? orxTRUE : orxFALSE;
+
+    /* Updates result */
+    pstResult = _pstVideoMode;
+  }
+  /* Gets current mode */
+  else if(sstDisplay.pstScreen != orxNULL)
+  {
+    /* Stores info */
+    _pstVideoMode->u32Width       = sstDisplay.pstScreen->u32Width;
+    _pstVideoMode->u32Height      = sstDisplay.pstScreen->u32Height;
+    _pstVideoMode->u32Depth       = orxDISPLAY_KU32_DEFAULT_DEPTH;
+    _pstVideoMode->u32RefreshRate = sstDisplay.u32RefreshRate;
+    _pstVideoMode->bFullScreen    = orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN) ? orxTRUE : orxFALSE;
+
+    /* Updates result */
+    pstResult = _pstVideoMode;
+  }
+
   /* Done! */
-  return orxNULL;
+  return pstResult;
 }
 
 orxSTATUS orxFASTCALL orxDisplay_Dummy_SetVideoMode(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
 {
+  orxU32    u32Width, u32Height, u32RefreshRate;
+  orxBOOL   bFullScreen;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Has video mode? */
+  if(_pstVideoMode != orxNULL)
+  {
+    /* Gets its values */
+    u32Width        = _pstVideoMode->u32Width;
+    u32Height       = _pstVideoMode->u32Height;
+    u32RefreshRate  = (_pstVideoMode->u32RefreshRate != 0) ? _pstVideoMode->u32RefreshRate : orxDISPLAY_KU32_DEFAULT_REFRESH_RATE;
+    bFullScreen     = _pstVideoMode->bFullScreen;
+  }
+  else
+  {
+    /* Uses defaults */
+    u32Width        = orxDISPLAY_KU32_DEFAULT_WIDTH;
+    u32Height       = orxDISPLAY_KU32_DEFAULT_HEIGHT;
+    u32RefreshRate  = orxDISPLAY_KU32_DEFAULT_REFRESH_RATE;
+    bFullScreen     = orxFALSE;
+  }
+
+  /* Valid? */
+  if((u32Width != 0) && (u32Height != 0))
+  {
+    orxRGBA  *astData;
+    orxU32    u32PreviousWidth, u32PreviousHeight, u32PreviousRefreshRate;
+
+    /* Gets previous values */
+    u32PreviousWidth        = sstDisplay.pstScreen->u32Width;
+    u32PreviousHeight       = sstDisplay.pstScreen->u32Height;
+    u32PreviousRefreshRate  = sstDisplay.u32RefreshRate;
+
+    /* Draws remaining items */
+    orxDisplay_Dummy_DrawArrays();
+
+    /* New size? */
+    if((u32Width != u32PreviousWidth) || (u32Height != u32PreviousHeight))
+    {
+      /* Allocates new framebuffer */
+      astData = (orxRGBA *)orxMemory_Allocate(u32Width * u32Height * sizeof(orxRGBA), orxMEMORY_TYPE_VIDEO);
+
+      /* Success? */
+      if(astData != orxNULL)
+      {
+        /* Clears it */
+        orxMemory_Zero(astData, u32Width * u32Height * sizeof(orxRGBA));
+
+        /* Deletes previous one */
+        if(sstDisplay.pstScreen->astData != orxNULL)
+        {
+          orxMemory_Free(sstDisplay.pstScreen->astData);
+        }
+
+        /* Updates screen */
+        sstDisplay.pstScreen->astData     = astData;
+        sstDisplay.pstScreen->fWidth      = orxU2F(u32Width);
+        sstDisplay.pstScreen->fHeight     = orxU2F(u32Height);
+        sstDisplay.pstScreen->u32Width    = u32Width;
+        sstDisplay.pstScreen->u32Height   = u32Height;
+        sstDisplay.pstScreen->fRecWidth   = orxFLOAT_1 / sstDisplay.pstScreen->fWidth;
+        sstDisplay.pstScreen->fRecHeight  = orxFLOAT_1 / sstDisplay.pstScreen->fHeight;
+        orxVector_Copy(&(sstDisplay.pstScreen->stClip.vTL), &orxVECTOR_0);
+        orxVector_Set(&(sstDisplay.pstScreen->stClip.vBR), sstDisplay.pstScreen->fWidth, sstDisplay.pstScreen->fHeight, orxFLOAT_0);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't allocate framebuffer of size %ux%u.", u32Width, u32Height);
+
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      orxDISPLAY_EVENT_PAYLOAD stPayload;
+
+      /* Stores refresh rate & full screen status */
+      sstDisplay.u32RefreshRate = u32RefreshRate;
+      orxFLAG_SET(sstDisplay.u32Flags, (bFullScreen != orxFALSE) ? orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN : orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN);
+
+      /* Inits event payload */
+      orxMemory_Zero(&stPayload, sizeof(orxDISPLAY_EVENT_PAYLOAD));
+      stPayload.stVideoMode.u32Width                = u32Width;
+      stPayload.stVideoMode.u32Height               = u32Height;
+      stPayload.stVideoMode.u32Depth                = orxDISPLAY_KU32_DEFAULT_DEPTH;
+      stPayload.stVideoMode.u32RefreshRate          = u32RefreshRate;
+      stPayload.stVideoMode.u32PreviousWidth        = u32PreviousWidth;
+      stPayload.stVideoMode.u32PreviousHeight       = u32PreviousHeight;
+      stPayload.stVideoMode.u32PreviousDepth        = orxDISPLAY_KU32_DEFAULT_DEPTH;
+      stPayload.stVideoMode.u32PreviousRefreshRate  = u32PreviousRefreshRate;
+      stPayload.stVideoMode.bFullScreen             = bFullScreen;
+
+      /* Sends it */
+      orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_SET_VIDEO_MODE, orxNULL, orxNULL, &stPayload);
+    }
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 orxBOOL orxFASTCALL orxDisplay_Dummy_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
 {
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Done! */
+  return ((_pstVideoMode->u32Width != 0) && (_pstVideoMode->u32Height != 0)) ? orxTRUE : orxFALSE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_Init()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Was not already initialized? */
+  if(!(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY))
+  {
+    orxU32 i;
+    orxU16 u16Index;
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+
+    /* For all indices */
+    for(i = 0, u16Index = 0; i < orxDISPLAY_KU32_INDEX_BUFFER_SIZE; i += 6, u16Index += 4)
+    {
+      /* Computes them */
+      sstDisplay.au16IndexList[i]     = u16Index;
+      sstDisplay.au16IndexList[i + 1] = u16Index + 1;
+      sstDisplay.au16IndexList[i + 2] = u16Index + 2;
+      sstDisplay.au16IndexList[i + 3] = u16Index + 1;
+      sstDisplay.au16IndexList[i + 4] = u16Index + 3;
+      sstDisplay.au16IndexList[i + 5] = u16Index + 2;
+    }
+
+    /* Creates bitmap bank */
+    sstDisplay.pstBitmapBank = orxBank_Create(orxDISPLAY_KU32_BITMAP_BANK_SIZE, sizeof(orxBITMAP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Valid? */
+    if(sstDisplay.pstBitmapBank != orxNULL)
+    {
+      orxDISPLAY_VIDEO_MODE stVideoMode;
+
+      /* Allocates screen bitmap */
+      sstDisplay.pstScreen = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+      orxMemory_Zero(sstDisplay.pstScreen, sizeof(orxBITMAP));
+      sstDisplay.pstScreen->zLocation     = orxSTRING_EMPTY;
+      sstDisplay.pstScreen->stFilenameID  = orxSTRINGID_UNDEFINED;
+      sstDisplay.pstScreen->u32ID         = orxU32_UNDEFINED;
+
+      /* Pushes display section */
+      orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+
+      /* Gets resolution from config */
+      stVideoMode.u32Width        = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_WIDTH) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_WIDTH) : orxDISPLAY_KU32_DEFAULT_WIDTH;
+      stVideoMode.u32Height       = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_HEIGHT) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_HEIGHT) : orxDISPLAY_KU32_DEFAULT_HEIGHT;
+      stVideoMode.u32Depth        = orxDISPLAY_KU32_DEFAULT_DEPTH;
+      stVideoMode.u32RefreshRate  = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) : orxDISPLAY_KU32_DEFAULT_REFRESH_RATE;
+      stVideoMode.bFullScreen     = orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_FULLSCREEN);
+
+      /* Inits info */
+      sstDisplay.bDefaultSmoothing  = orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_SMOOTH);
+      sstDisplay.eBatchBlendMode    = orxDISPLAY_BLEND_MODE_NONE;
+      sstDisplay.pstDestination     = sstDisplay.pstScreen;
+
+      /* Sets module as ready */
+      sstDisplay.u32Flags = orxDISPLAY_KU32_STATIC_FLAG_READY;
+
+      /* Sets VSync */
+      orxDisplay_Dummy_EnableVSync(orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_VSYNC) ? orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_VSYNC) : orxTRUE);
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Sets video mode */
+      if((eResult = orxDisplay_Dummy_SetVideoMode(&stVideoMode)) == orxSTATUS_FAILURE)
+      {
+        /* Uses default one */
+        eResult = orxDisplay_Dummy_SetVideoMode(orxNULL);
+      }
+
+      /* Failure? */
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        /* Deletes bank */
+        orxBank_Delete(sstDisplay.pstBitmapBank);
+
+        /* Cleans static controller */
+        orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+      }
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxDisplay_Dummy_Exit()
+{
+  /* Was initialized? */
+  if(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY)
+  {
+    orxBITMAP *pstBitmap;
+
+    /* For all bitmaps */
+    for(pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, orxNULL);
+        pstBitmap != orxNULL;
+        pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, pstBitmap))
+    {
+      /* Has data? */
+      if(pstBitmap->astData != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(pstBitmap->astData);
+      }
+    }
+
+    /* Deletes bank */
+    orxBank_Delete(sstDisplay.pstBitmapBank);
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+  }
+
   /* Done! */
-  return orxFALSE;
+  return;
 }
 
 
@@ -337,7 +2819,11 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_CreateBitmap, DISPLAY, CREATE_
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DeleteBitmap, DISPLAY, DELETE_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_LoadBitmap, DISPLAY, LOAD_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SaveBitmap, DISPLAY, SAVE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_EncodeBitmapData, DISPLAY, ENCODE_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_LoadFont, DISPLAY, LOAD_FONT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_LoadTypeface, DISPLAY, LOAD_TYPEFACE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DeleteTypeface, DISPLAY, DELETE_TYPEFACE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_RenderGlyph, DISPLAY, RENDER_GLYPH);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetTempBitmap, DISPLAY, SET_TEMP_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetTempBitmap, DISPLAY, GET_TEMP_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetDestinationBitmaps, DISPLAY, SET_DESTINATION_BITMAPS);
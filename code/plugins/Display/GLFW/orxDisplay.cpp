@@ -517,6 +517,23 @@ typedef struct __orxDISPLAY_FONT_GLYPH_INFO_t
 
 } orxDISPLAY_FONT_GLYPH_INFO;
 
+/** Internal typeface structure (on-demand glyph rendering)
+ */
+typedef struct __orxDISPLAY_TYPEFACE_t
+{
+  stbtt_fontinfo            stFontInfo;
+  orxVECTOR                 vCharacterSize;
+  orxVECTOR                 vFontScale;
+  orxFLOAT                  fXPadding;
+  orxFLOAT                  fYPadding;
+  orxFLOAT                  fBaseLine;
+  orxS32                    s32X0;
+  orxS32                    s32X1;
+  orxS32                    s32Y0;
+  orxBOOL                   bSDF;
+
+} orxDISPLAY_TYPEFACE;
+
 /** Internal texture info structure
  */
 typedef struct __orxDISPLAY_TEXTURE_INFO_t
@@ -2311,6 +2328,39 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
   return eResult;
 }
 
+static void orxFASTCALL orxDisplay_GLFW_InitGlyph(const stbtt_fontinfo *_pstFontInfo, orxS32 _s32Index, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvFontScale, orxFLOAT _fXPadding, orxFLOAT _fYPadding, orxFLOAT _fBaseLine, orxS32 _s32X0, orxS32 _s32X1, orxS32 _s32Y0, orxBOOL _bSDF, orxCHARACTER_GLYPH *_pstGlyph)
+{
+  int iGlyphWidth, iGlyphX0, iGlyphX1, iGlyphY0, iGlyphY1;
+
+  /* Gets its metrics */
+  stbtt_GetGlyphHMetrics(_pstFontInfo, _s32Index, &iGlyphWidth, NULL);
+
+  /* Gets glyph bitmap box */
+  stbtt_GetGlyphBitmapBox(_pstFontInfo, _s32Index, _pvFontScale->fX, _pvFontScale->fY, &iGlyphX0, &iGlyphY0, &iGlyphX1, &iGlyphY1);
+
+  /* Updates glyph values */
+  _pstGlyph->fWidth = orx2F(2.0f) * _fXPadding + orxMath_Ceil((_pvCharacterSize->fX > orxFLOAT_0)
+                                                              ? _pvCharacterSize->fX
+                                                              : (_pvCharacterSize->fX == orxFLOAT_0)
+                                                                ? orxMAX(_pvFontScale->fX * orxS2F(iGlyphWidth), orxS2F(iGlyphX1 - iGlyphX0))
+                                                                : _pvFontScale->fX * (_s32X1 - _s32X0));
+  _pstGlyph->fX = _fXPadding + ((_pvCharacterSize->fX == orxFLOAT_0)
+                               ? orxMAX(0, orxS2F(iGlyphX0))
+                               : orxMath_Floor(orx2F(0.5f) * (_pstGlyph->fWidth - orx2F(2.0f) * _fXPadding - orxS2F(iGlyphX1 - iGlyphX0))));
+  if(_bSDF != orxFALSE)
+  {
+    _pstGlyph->fX -= iGlyphX0;
+    _pstGlyph->fY = _fYPadding - _pvFontScale->fY * orxS2F(_s32Y0);
+  }
+  else
+  {
+    _pstGlyph->fY = _fYPadding + _fBaseLine + orxS2F(iGlyphY0);
+  }
+
+  /* Done! */
+  return;
+}
+
 static orxSTATUS orxFASTCALL orxDisplay_GLFW_CleanGlyph(void *_pContext)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -2322,27 +2372,19 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_CleanGlyph(void *_pContext)
   return eResult;
 }
 
-static orxSTATUS orxFASTCALL orxDisplay_GLFW_GenerateGlyph(void *_pContext)
+static void orxFASTCALL orxDisplay_GLFW_RenderSDFGlyph(const stbtt_fontinfo *_pstFontInfo, orxS32 _s32Index, const orxCHARACTER_GLYPH *_pstGlyph, const orxVECTOR *_pvFontScale, orxFLOAT _fCharacterHeight, orxU8 *_pu8Data, orxS32 _s32Pitch)
 {
-  orxDISPLAY_FONT_GLYPH_INFO *pstGlyphInfo;
-  stbtt_vertex               *astVertexList = NULL;
-  orxS32                      s32VertexCount;
-  orxSTATUS                   eResult = orxSTATUS_SUCCESS;
-
-  /* Retrieves glyph info */
-  pstGlyphInfo = (orxDISPLAY_FONT_GLYPH_INFO *)_pContext;
+  stbtt_vertex *astVertexList = NULL;
+  orxS32        s32VertexCount;
 
   /* Gets its shape */
-  s32VertexCount = stbtt_GetGlyphShape(&(pstGlyphInfo->pstLoadInfo->stFontInfo), pstGlyphInfo->pstGlyph->s32Index, &astVertexList);
+  s32VertexCount = stbtt_GetGlyphShape(_pstFontInfo, _s32Index, &astVertexList);
 
   /* Valid? */
   if(s32VertexCount > 0)
   {
     msdfgen::Shape  stShape;
-    orxS32          s32TextureWidth, i;
-
-    /* Gets texture width */
-    s32TextureWidth = orxF2S(pstGlyphInfo->pstLoadInfo->stLoadInfo.pstBitmap->fWidth);
+    orxS32          i;
 
     /* Inverses Y axis */
     stShape.inverseYAxis = true;
@@ -2397,12 +2439,12 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_GenerateGlyph(void *_pContext)
     msdfgen::edgeColoringByDistance(stShape, 3.0);
 
     /* Allocates temp bitmap */
-    msdfgen::Bitmap<float, 4> oBitmap((int)pstGlyphInfo->pstGlyph->stGlyph.fWidth, (int)pstGlyphInfo->pstLoadInfo->vCharacterSize.fY);
+    msdfgen::Bitmap<float, 4> oBitmap((int)_pstGlyph->fWidth, (int)_fCharacterHeight);
 
     /* Inits transformation */
-    msdfgen::Vector2 vScale(pstGlyphInfo->pstLoadInfo->vFontScale.fX, pstGlyphInfo->pstLoadInfo->vFontScale.fY);
-    msdfgen::Vector2 vOffset(pstGlyphInfo->pstGlyph->stGlyph.fX / pstGlyphInfo->pstLoadInfo->vFontScale.fX, pstGlyphInfo->pstGlyph->stGlyph.fY / pstGlyphInfo->pstLoadInfo->vFontScale.fY);
-    msdfgen::SDFTransformation stTransformation(msdfgen::Projection(vScale, vOffset), msdfgen::Range(0.25f * pstGlyphInfo->pstLoadInfo->vCharacterSize.fY / pstGlyphInfo->pstLoadInfo->vFontScale.fY));
+    msdfgen::Vector2 vScale(_pvFontScale->fX, _pvFontScale->fY);
+    msdfgen::Vector2 vOffset(_pstGlyph->fX / _pvFontScale->fX, _pstGlyph->fY / _pvFontScale->fY);
+    msdfgen::SDFTransformation stTransformation(msdfgen::Projection(vScale, vOffset), msdfgen::Range(0.25f * _fCharacterHeight / _pvFontScale->fY));
 
     /* Renders the MTSDF glyph */
     msdfgen::generateMTSDF(oBitmap, stShape, stTransformation);
@@ -2412,16 +2454,35 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_GenerateGlyph(void *_pContext)
     {
       for(int x = 0; x < oBitmap.width(); x++)
       {
-        pstGlyphInfo->pu8ImageData[((pstGlyphInfo->s32OffsetX + x) + (pstGlyphInfo->s32OffsetY + y) * s32TextureWidth) * 4 + 0] = msdfgen::pixelFloatToByte(oBitmap(x, y)[0]);
-        pstGlyphInfo->pu8ImageData[((pstGlyphInfo->s32OffsetX + x) + (pstGlyphInfo->s32OffsetY + y) * s32TextureWidth) * 4 + 1] = msdfgen::pixelFloatToByte(oBitmap(x, y)[1]);
-        pstGlyphInfo->pu8ImageData[((pstGlyphInfo->s32OffsetX + x) + (pstGlyphInfo->s32OffsetY + y) * s32TextureWidth) * 4 + 2] = msdfgen::pixelFloatToByte(oBitmap(x, y)[2]);
-        pstGlyphInfo->pu8ImageData[((pstGlyphInfo->s32OffsetX + x) + (pstGlyphInfo->s32OffsetY + y) * s32TextureWidth) * 4 + 3] = msdfgen::pixelFloatToByte(oBitmap(x, y)[3]);
+        _pu8Data[(x + y * _s32Pitch) * 4 + 0] = msdfgen::pixelFloatToByte(oBitmap(x, y)[0]);
+        _pu8Data[(x + y * _s32Pitch) * 4 + 1] = msdfgen::pixelFloatToByte(oBitmap(x, y)[1]);
+        _pu8Data[(x + y * _s32Pitch) * 4 + 2] = msdfgen::pixelFloatToByte(oBitmap(x, y)[2]);
+        _pu8Data[(x + y * _s32Pitch) * 4 + 3] = msdfgen::pixelFloatToByte(oBitmap(x, y)[3]);
       }
     }
   }
 
   /* Frees the shape */
-  stbtt_FreeShape(&(pstGlyphInfo->pstLoadInfo->stFontInfo), astVertexList);
+  stbtt_FreeShape(_pstFontInfo, astVertexList);
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_GenerateGlyph(void *_pContext)
+{
+  orxDISPLAY_FONT_GLYPH_INFO *pstGlyphInfo;
+  orxS32                      s32TextureWidth;
+  orxSTATUS                   eResult = orxSTATUS_SUCCESS;
+
+  /* Retrieves glyph info */
+  pstGlyphInfo = (orxDISPLAY_FONT_GLYPH_INFO *)_pContext;
+
+  /* Gets texture width */
+  s32TextureWidth = orxF2S(pstGlyphInfo->pstLoadInfo->stLoadInfo.pstBitmap->fWidth);
+
+  /* Renders it */
+  orxDisplay_GLFW_RenderSDFGlyph(&(pstGlyphInfo->pstLoadInfo->stFontInfo), pstGlyphInfo->pstGlyph->s32Index, &(pstGlyphInfo->pstGlyph->stGlyph), &(pstGlyphInfo->pstLoadInfo->vFontScale), pstGlyphInfo->pstLoadInfo->vCharacterSize.fY, pstGlyphInfo->pu8ImageData + 4 * (pstGlyphInfo->s32OffsetX + pstGlyphInfo->s32OffsetY * s32TextureWidth), s32TextureWidth);
 
   /* Updates count */
   orxMEMORY_BARRIER();
@@ -2674,23 +2735,23 @@ static void orxDisplay_GLFW_WriteResourceCallback(void *_pContext, void *_pData,
   orxResource_Write((orxHANDLE)_pContext, (orxS64)_iSize, _pData, orxNULL, orxNULL);
 }
 
-static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapData(void *_pContext)
+orxSTATUS orxFASTCALL orxDisplay_GLFW_EncodeBitmapData(orxHANDLE _hResource, orxU32 _u32Width, orxU32 _u32Height, const orxU8 *_au8Data)
 {
-  orxDISPLAY_SAVE_INFO *pstInfo;
-  const orxSTRING       zExtension;
-  orxSTATUS             eResult = orxSTATUS_FAILURE;
+  const orxSTRING zExtension;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
 
-  /* Gets save info */
-  pstInfo = (orxDISPLAY_SAVE_INFO *)_pContext;
+  /* Checks */
+  orxASSERT((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL));
+  orxASSERT(_au8Data != orxNULL);
 
   /* Gets extension */
-  zExtension = orxString_GetExtension(orxResource_GetLocation(pstInfo->hResource));
+  zExtension = orxString_GetExtension(orxResource_GetLocation(_hResource));
 
   /* PNG? */
   if(orxString_ICompare(zExtension, "png") == 0)
   {
     /* Saves image to disk */
-    eResult = stbi_write_png_to_func(&orxDisplay_GLFW_WriteResourceCallback, pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_png_to_func(&orxDisplay_GLFW_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
   /* QOI? */
   else if(orxString_ICompare(zExtension, "qoi") == 0)
@@ -2701,19 +2762,19 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapData(void *_pContext)
 
     /* Inits descriptor */
     orxMemory_Zero(&stDesc, sizeof(qoi_desc));
-    stDesc.width      = pstInfo->u32Width;
-    stDesc.height     = pstInfo->u32Height;
+    stDesc.width      = _u32Width;
+    stDesc.height     = _u32Height;
     stDesc.channels   = 4;
     stDesc.colorspace = 1;
 
     /* Encodes it */
-    pBuffer = qoi_encode(pstInfo->pu8ImageData, &stDesc, &iSize);
+    pBuffer = qoi_encode(_au8Data, &stDesc, &iSize);
 
     /* Success? */
     if(pBuffer != NULL)
     {
       /* Saves image to disk */
-      if(orxResource_Write(pstInfo->hResource, (orxS64)iSize, pBuffer, orxNULL, orxNULL) == (orxS64)iSize)
+      if(orxResource_Write(_hResource, (orxS64)iSize, pBuffer, orxNULL, orxNULL) == (orxS64)iSize)
       {
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
@@ -2727,21 +2788,36 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapData(void *_pContext)
   else if((orxString_ICompare(zExtension, "jpg") == 0) || (orxString_ICompare(zExtension, "jpeg") == 0))
   {
     /* Saves image to disk */
-    eResult = stbi_write_jpg_to_func(&orxDisplay_GLFW_WriteResourceCallback, pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_jpg_to_func(&orxDisplay_GLFW_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
   /* BMP? */
   else if(orxString_ICompare(zExtension, "bmp") == 0)
   {
     /* Saves image to disk */
-    eResult = stbi_write_bmp_to_func(&orxDisplay_GLFW_WriteResourceCallback, pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_bmp_to_func(&orxDisplay_GLFW_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
   /* TGA */
   else
   {
     /* Saves image to disk */
-    eResult = stbi_write_tga_to_func(&orxDisplay_GLFW_WriteResourceCallback, pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_tga_to_func(&orxDisplay_GLFW_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
 
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapData(void *_pContext)
+{
+  orxDISPLAY_SAVE_INFO *pstInfo;
+  orxSTATUS             eResult;
+
+  /* Gets save info */
+  pstInfo = (orxDISPLAY_SAVE_INFO *)_pContext;
+
+  /* Encodes data */
+  eResult = orxDisplay_GLFW_EncodeBitmapData(pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, pstInfo->pu8ImageData);
+
   /* Closes resource */
   orxResource_Close(pstInfo->hResource);
 
@@ -5632,33 +5708,10 @@ orxBITMAP *orxFASTCALL orxDisplay_GLFW_LoadFont(const orxSTRING _zFileName, cons
                           (u32CharacterCodePoint != orxCHAR_NULL) && (u32CharacterCodePoint != orxU32_UNDEFINED);
                           u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(zCharacterList, &zCharacterList), i++)
                       {
-                        int       iGlyphWidth, iGlyphX0, iGlyphX1, iGlyphY0, iGlyphY1;
-                        orxFLOAT  fAdvance;
-
-                        /* Gets its metrics */
-                        stbtt_GetGlyphHMetrics(&(pstLoadInfo->stFontInfo), pstLoadInfo->astGlyphList[i].s32Index, &iGlyphWidth, NULL);
+                        orxFLOAT fAdvance;
 
-                        /* Gets glyph bitmap box */
-                        stbtt_GetGlyphBitmapBox(&(pstLoadInfo->stFontInfo), pstLoadInfo->astGlyphList[i].s32Index, pstLoadInfo->vFontScale.fX, pstLoadInfo->vFontScale.fY, (int *)&iGlyphX0, (int *)&iGlyphY0, (int *)&iGlyphX1, (int *)&iGlyphY1);
-
-                        /* Updates glyph values */
-                        pstLoadInfo->astGlyphList[i].stGlyph.fWidth = orx2F(2.0f) * fXPadding + orxMath_Ceil((_pvCharacterSize->fX > orxFLOAT_0)
-                                                                                                             ? _pvCharacterSize->fX
-                                                                                                             : (_pvCharacterSize->fX == orxFLOAT_0)
-                                                                                                               ? orxMAX(pstLoadInfo->vFontScale.fX * orxS2F(iGlyphWidth), orxS2F(iGlyphX1 - iGlyphX0))
-                                                                                                               : pstLoadInfo->vFontScale.fX * (iX1 - iX0));
-                        pstLoadInfo->astGlyphList[i].stGlyph.fX = fXPadding + ((_pvCharacterSize->fX == orxFLOAT_0)
-                                                                              ? orxMAX(0, orxS2F(iGlyphX0))
-                                                                              : orxMath_Floor(orx2F(0.5f) * (pstLoadInfo->astGlyphList[i].stGlyph.fWidth - orx2F(2.0f) * fXPadding - orxS2F(iGlyphX1 - iGlyphX0))));
-                        if(pstLoadInfo->bSDF != orxFALSE)
-                        {
-                          pstLoadInfo->astGlyphList[i].stGlyph.fX -= iGlyphX0;
-                          pstLoadInfo->astGlyphList[i].stGlyph.fY = fYPadding - pstLoadInfo->vFontScale.fY * orxS2F(iY0);
-                        }
-                        else
-                        {
-                          pstLoadInfo->astGlyphList[i].stGlyph.fY = fYPadding + fBaseLine + orxS2F(iGlyphY0);
-                        }
+                        /* Inits its glyph */
+                        orxDisplay_GLFW_InitGlyph(&(pstLoadInfo->stFontInfo), pstLoadInfo->astGlyphList[i].s32Index, _pvCharacterSize, &(pstLoadInfo->vFontScale), fXPadding, fYPadding, fBaseLine, (orxS32)iX0, (orxS32)iX1, (orxS32)iY0, pstLoadInfo->bSDF, &(pstLoadInfo->astGlyphList[i].stGlyph));
 
                         /* Gets horizontal advance */
                         fAdvance = pstLoadInfo->astGlyphList[i].stGlyph.fWidth + _pvCharacterSpacing->fX;
@@ -5820,6 +5873,213 @@ orxBITMAP *orxFASTCALL orxDisplay_GLFW_LoadFont(const orxSTRING _zFileName, cons
   return pstResult;
 }
 
+orxHANDLE orxFASTCALL orxDisplay_GLFW_LoadTypeface(const orxSTRING _zFileName, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvCharacterPadding, orxBOOL _bSDF)
+{
+  orxHANDLE hResult = orxHANDLE_UNDEFINED;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFileName != orxNULL);
+  orxASSERT(_pvCharacterSize != orxNULL);
+  orxASSERT(_pvCharacterSize->fY > orxFLOAT_0);
+  orxASSERT(_pvCharacterPadding != orxNULL);
+
+  /* Valid? */
+  if(*_zFileName != orxCHAR_NULL)
+  {
+    const orxSTRING zLocation;
+
+    /* Locates resource */
+    zLocation = orxResource_Locate(orxFONT_KZ_RESOURCE_GROUP, _zFileName);
+
+    /* Success? */
+    if(zLocation != orxNULL)
+    {
+      orxHANDLE hResource;
+
+      /* Opens it */
+      hResource = orxResource_Open(zLocation, orxFALSE);
+
+      /* Success? */
+      if(hResource != orxHANDLE_UNDEFINED)
+      {
+        orxDISPLAY_TYPEFACE  *pstTypeface;
+        orxS64                s64Size;
+
+        /* Gets its size */
+        s64Size = orxResource_GetSize(hResource);
+
+        /* Checks */
+        orxASSERT((s64Size > 0) && (s64Size < (orxS64)(0xFFFFFFFF - sizeof(orxDISPLAY_TYPEFACE))));
+
+        /* Allocates typeface, followed by its source buffer */
+        pstTypeface = (orxDISPLAY_TYPEFACE *)orxMemory_Allocate(sizeof(orxDISPLAY_TYPEFACE) + (orxU32)s64Size, orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(pstTypeface != orxNULL)
+        {
+          orxU8 *pu8Buffer;
+
+          /* Clears it */
+          orxMemory_Zero(pstTypeface, sizeof(orxDISPLAY_TYPEFACE));
+
+          /* Gets its source buffer */
+          pu8Buffer = (orxU8 *)(pstTypeface + 1);
+
+          /* Reads data from resource and initializes font */
+          if((orxResource_Read(hResource, s64Size, pu8Buffer, orxNULL, orxNULL) == s64Size)
+          && (stbtt_InitFont(&(pstTypeface->stFontInfo), pu8Buffer, 0) != 0))
+          {
+            int iX0, iX1, iY0, iY1;
+
+            /* Gets font's bounding box, as glyphs aren't known in advance */
+            stbtt_GetFontBoundingBox(&(pstTypeface->stFontInfo), &iX0, &iY0, &iX1, &iY1);
+
+            /* Updates padding values */
+            pstTypeface->fXPadding = orxMAX(orxFLOAT_0, _pvCharacterPadding->fX);
+            pstTypeface->fYPadding = orxMAX(orxFLOAT_0, _pvCharacterPadding->fY);
+
+            /* Gets font scale */
+            pstTypeface->vFontScale.fY = orxMAX(orxFLOAT_0, (_pvCharacterSize->fY - orx2F(2.0f) * pstTypeface->fYPadding - orxFLOAT_1) / (iY1 - iY0));
+            pstTypeface->vFontScale.fX = (_pvCharacterSize->fX > orxFLOAT_0) ? orxMAX(orxFLOAT_0, ((_pvCharacterSize->fX - orx2F(2.0f) * pstTypeface->fXPadding - orxFLOAT_1) / (iX1 - iX0))) : pstTypeface->vFontScale.fY;
+
+            /* Gets base line */
+            pstTypeface->fBaseLine = orxMath_Ceil(pstTypeface->vFontScale.fY * orxS2F(iY1));
+
+            /* Stores bounding box, size & SDF status */
+            pstTypeface->s32X0  = (orxS32)iX0;
+            pstTypeface->s32X1  = (orxS32)iX1;
+            pstTypeface->s32Y0  = (orxS32)iY0;
+            pstTypeface->bSDF   = _bSDF;
+            orxVector_Copy(&(pstTypeface->vCharacterSize), _pvCharacterSize);
+
+            /* Updates result */
+            hResult = (orxHANDLE)pstTypeface;
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't load typeface <%s>: invalid font data.", _zFileName);
+
+            /* Frees typeface */
+            orxMemory_Free(pstTypeface);
+          }
+        }
+
+        /* Closes resource */
+        orxResource_Close(hResource);
+      }
+    }
+  }
+
+  /* Done! */
+  return hResult;
+}
+
+void orxFASTCALL orxDisplay_GLFW_DeleteTypeface(orxHANDLE _hTypeface)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hTypeface != orxHANDLE_UNDEFINED) && (_hTypeface != orxNULL));
+
+  /* Frees it (its source buffer is part of the same allocation) */
+  orxMemory_Free(_hTypeface);
+
+  /* Done! */
+  return;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_GLFW_RenderGlyph(const orxHANDLE _hTypeface, orxU32 _u32CharacterCodePoint, orxFLOAT *_pfWidth, orxU8 *_pu8Data)
+{
+  const orxDISPLAY_TYPEFACE  *pstTypeface;
+  orxCHARACTER_GLYPH          stGlyph;
+  orxS32                      s32Index;
+  orxSTATUS                   eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((_hTypeface != orxHANDLE_UNDEFINED) && (_hTypeface != orxNULL));
+  orxASSERT(_pfWidth != orxNULL);
+
+  /* Gets typeface */
+  pstTypeface = (const orxDISPLAY_TYPEFACE *)_hTypeface;
+
+  /* Gets glyph index (missing characters will use the font's default glyph) */
+  s32Index = stbtt_FindGlyphIndex(&(pstTypeface->stFontInfo), (int)_u32CharacterCodePoint);
+
+  /* Inits glyph */
+  orxDisplay_GLFW_InitGlyph(&(pstTypeface->stFontInfo), s32Index, &(pstTypeface->vCharacterSize), &(pstTypeface->vFontScale), pstTypeface->fXPadding, pstTypeface->fYPadding, pstTypeface->fBaseLine, pstTypeface->s32X0, pstTypeface->s32X1, pstTypeface->s32Y0, pstTypeface->bSDF, &stGlyph);
+
+  /* Stores its width */
+  *_pfWidth = stGlyph.fWidth;
+
+  /* Should render? */
+  if(_pu8Data != orxNULL)
+  {
+    orxS32 s32Width, s32Height;
+
+    /* Gets glyph size */
+    s32Width  = orxF2S(stGlyph.fWidth);
+    s32Height = orxF2S(pstTypeface->vCharacterSize.fY);
+
+    /* SDF? */
+    if(pstTypeface->bSDF != orxFALSE)
+    {
+      /* Clears output */
+      orxMemory_Zero(_pu8Data, (orxU32)(4 * s32Width * s32Height));
+
+      /* Renders it */
+      orxDisplay_GLFW_RenderSDFGlyph(&(pstTypeface->stFontInfo), s32Index, &stGlyph, &(pstTypeface->vFontScale), pstTypeface->vCharacterSize.fY, _pu8Data, s32Width);
+    }
+    else
+    {
+      orxU8 *pu8Buffer;
+
+      /* Allocates coverage buffer */
+      pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)(s32Width * s32Height), orxMEMORY_TYPE_TEMP);
+
+      /* Success? */
+      if(pu8Buffer != orxNULL)
+      {
+        orxS32 s32X, s32Y, i;
+
+        /* Gets glyph offset, inside its cell */
+        s32X = orxMAX(0, orxF2S(stGlyph.fX));
+        s32Y = orxMAX(0, orxF2S(stGlyph.fY));
+
+        /* Clears it */
+        orxMemory_Zero(pu8Buffer, (orxU32)(s32Width * s32Height));
+
+        /* Renders the glyph */
+        if((s32X < s32Width) && (s32Y < s32Height))
+        {
+          stbtt_MakeGlyphBitmap(&(pstTypeface->stFontInfo), pu8Buffer + s32X + s32Y * s32Width, s32Width - s32X, s32Height - s32Y, s32Width, pstTypeface->vFontScale.fX, pstTypeface->vFontScale.fY, s32Index);
+        }
+
+        /* For all pixels */
+        for(i = 0; i < s32Width * s32Height; i++)
+        {
+          /* Sets it as white pixel with varying opacity */
+          _pu8Data[i * 4 + 0] =
+          _pu8Data[i * 4 + 1] =
+          _pu8Data[i * 4 + 2] = 0xFF;
+          _pu8Data[i * 4 + 3] = pu8Buffer[i];
+        }
+
+        /* Frees coverage buffer */
+        orxMemory_Free(pu8Buffer);
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_GLFW_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -8009,7 +8269,11 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_CreateBitmap, DISPLAY, CREATE_B
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DeleteBitmap, DISPLAY, DELETE_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_LoadBitmap, DISPLAY, LOAD_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SaveBitmap, DISPLAY, SAVE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_EncodeBitmapData, DISPLAY, ENCODE_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_LoadFont, DISPLAY, LOAD_FONT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_LoadTypeface, DISPLAY, LOAD_TYPEFACE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DeleteTypeface, DISPLAY, DELETE_TYPEFACE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_RenderGlyph, DISPLAY, RENDER_GLYPH);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetTempBitmap, DISPLAY, SET_TEMP_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetTempBitmap, DISPLAY, GET_TEMP_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetDestinationBitmaps, DISPLAY, SET_DESTINATION_BITMAPS);
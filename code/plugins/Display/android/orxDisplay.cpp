@@ -2121,23 +2121,23 @@ static void orxDisplay_Android_WriteResourceCallback(void *_pContext, void *_pDa
 }
 
 
-static orxSTATUS orxFASTCALL orxDisplay_Android_SaveBitmapData(void *_pContext)
+orxSTATUS orxFASTCALL orxDisplay_Android_EncodeBitmapData(orxHANDLE _hResource, orxU32 _u32Width, orxU32 _u32Height, const orxU8 *_au8Data)
 {
-  orxDISPLAY_SAVE_INFO *pstInfo;
-  const orxSTRING       zExtension;
-  orxSTATUS             eResult = orxSTATUS_FAILURE;
+  const orxSTRING zExtension;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
 
-  /* Gets save info */
-  pstInfo = (orxDISPLAY_SAVE_INFO *)_pContext;
+  /* Checks */
+  orxASSERT((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL));
+  orxASSERT(_au8Data != orxNULL);
 
   /* Gets extension */
-  zExtension = orxString_GetExtension(orxResource_GetLocation(pstInfo->hResource));
+  zExtension = orxString_GetExtension(orxResource_GetLocation(_hResource));
 
   /* PNG? */
   if(orxString_ICompare(zExtension, "png") == 0)
   {
     /* Saves image to disk */
-    eResult = stbi_write_png_to_func(&orxDisplay_Android_WriteResourceCallback, pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_png_to_func(&orxDisplay_Android_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
   /* QOI? */
   else if(orxString_ICompare(zExtension, "qoi") == 0)
@@ -2148,19 +2148,19 @@ static orxSTATUS orxFASTCALL orxDisplay_Android_SaveBitmapData(void *_pContext)
 
     /* Inits descriptor */
     orxMemory_Zero(&stDesc, sizeof(qoi_desc));
-    stDesc.width      = pstInfo->u32Width;
-    stDesc.height     = pstInfo->u32Height;
+    stDesc.width      = _u32Width;
+    stDesc.height     = _u32Height;
     stDesc.channels   = 4;
     stDesc.colorspace = 1;
 
     /* Encodes it */
-    pBuffer = qoi_encode(pstInfo->pu8ImageData, &stDesc, &iSize);
+    pBuffer = qoi_encode(_au8Data, &stDesc, &iSize);
 
     /* Success? */
     if(pBuffer != NULL)
     {
       /* Saves image to disk */
-      if(orxResource_Write(pstInfo->hResource, (orxS64)iSize, pBuffer, orxNULL, orxNULL) == (orxS64)iSize)
+      if(orxResource_Write(_hResource, (orxS64)iSize, pBuffer, orxNULL, orxNULL) == (orxS64)iSize)
       {
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
@@ -2174,21 +2174,36 @@ static orxSTATUS orxFASTCALL orxDisplay_Android_SaveBitmapData(void *_pContext)
   else if((orxString_ICompare(zExtension, "jpg") == 0) || (orxString_ICompare(zExtension, "jpeg") == 0))
   {
     /* Saves image to disk */
-    eResult = stbi_write_jpg_to_func(&orxDisplay_Android_WriteResourceCallback, pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_jpg_to_func(&orxDisplay_Android_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
   /* BMP? */
   else if(orxString_ICompare(zExtension, "bmp") == 0)
   {
     /* Saves image to disk */
-    eResult = stbi_write_bmp_to_func(&orxDisplay_Android_WriteResourceCallback, pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_bmp_to_func(&orxDisplay_Android_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
   /* TGA */
   else
   {
     /* Saves image to disk */
-    eResult = stbi_write_tga_to_func(&orxDisplay_Android_WriteResourceCallback, pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    eResult = stbi_write_tga_to_func(&orxDisplay_Android_WriteResourceCallback, _hResource, _u32Width, _u32Height, 4, _au8Data) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
   }
 
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_Android_SaveBitmapData(void *_pContext)
+{
+  orxDISPLAY_SAVE_INFO *pstInfo;
+  orxSTATUS             eResult;
+
+  /* Gets save info */
+  pstInfo = (orxDISPLAY_SAVE_INFO *)_pContext;
+
+  /* Encodes data */
+  eResult = orxDisplay_Android_EncodeBitmapData(pstInfo->hResource, pstInfo->u32Width, pstInfo->u32Height, pstInfo->pu8ImageData);
+
   /* Closes resource */
   orxResource_Close(pstInfo->hResource);
 
@@ -4689,6 +4704,40 @@ orxBITMAP *orxFASTCALL orxDisplay_Android_LoadFont(const orxSTRING _zFileName, c
   return pstResult;
 }
 
+orxHANDLE orxFASTCALL orxDisplay_Android_LoadTypeface(const orxSTRING _zFileName, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvCharacterPadding, orxBOOL _bSDF)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFileName != orxNULL);
+  orxASSERT(_pvCharacterSize != orxNULL);
+  orxASSERT(_pvCharacterPadding != orxNULL);
+
+  /* Not supported: fonts will be baked at load time instead */
+
+  /* Done! */
+  return orxNULL;
+}
+
+void orxFASTCALL orxDisplay_Android_DeleteTypeface(orxHANDLE _hTypeface)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Android_RenderGlyph(const orxHANDLE _hTypeface, orxU32 _u32CharacterCodePoint, orxFLOAT *_pfWidth, orxU8 *_pu8Data)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pu8Data != orxNULL);
+
+  /* Done! */
+  return orxSTATUS_FAILURE;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_Android_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -6219,6 +6268,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_Swap, DISPLAY, SWAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_CreateBitmap, DISPLAY, CREATE_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DeleteBitmap, DISPLAY, DELETE_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SaveBitmap, DISPLAY, SAVE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_EncodeBitmapData, DISPLAY, ENCODE_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetTempBitmap, DISPLAY, SET_TEMP_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetTempBitmap, DISPLAY, GET_TEMP_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetDestinationBitmaps, DISPLAY, SET_DESTINATION_BITMAPS);
@@ -6226,6 +6276,9 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_TransformBitmap, DISPLAY, TR
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_TransformText, DISPLAY, TRANSFORM_TEXT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_LoadBitmap, DISPLAY, LOAD_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_LoadFont, DISPLAY, LOAD_FONT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_LoadTypeface, DISPLAY, LOAD_TYPEFACE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DeleteTypeface, DISPLAY, DELETE_TYPEFACE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_RenderGlyph, DISPLAY, RENDER_GLYPH);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetScreenSize, DISPLAY, GET_SCREEN_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetScreenBitmap, DISPLAY, GET_SCREEN_BITMAP);
@@ -61,7 +61,15 @@
 
 /** Defines
  */
-#define orxRENDER_KU32_ORDER_BANK_SIZE              1024
+#define orxRENDER_KU32_QUEUE_SIZE                   1024
+
+#define orxRENDER_KU32_SORT_SHIFT_Z                 32
+#define orxRENDER_KU32_SORT_SHIFT_TEXTURE           16
+#define orxRENDER_KU32_SORT_SHIFT_SHADER            5
+#define orxRENDER_KU32_SORT_SHIFT_BLEND_MODE        2
+#define orxRENDER_KU32_SORT_SHIFT_SMOOTHING         0
+#define orxRENDER_KU32_SORT_MAX_TEXTURE             0xFFFF
+#define orxRENDER_KU32_SORT_MAX_SHADER              0x7FF
 #define orxRENDER_KST_DEFAULT_COLOR                 orx2RGBA(255, 0, 0, 255)
 #define orxRENDER_KZ_FPS_FORMAT                     "FPS: %u"
 #define orxRENDER_KF_CONSOLE_BLINK_DELAY            orx2F(0.5f)
@@ -118,34 +126,50 @@
 
 typedef struct __orxRENDER_RENDER_NODE_t
 {
-  orxLINKLIST_NODE        stNode;                   /**< Linklist node : 12 */
-  orxTEXTURE             *pstTexture;               /**< Texture pointer : 16 */
-  const orxSHADER        *pstShader;                /**< Shader pointer : 20 */
-  orxOBJECT              *pstObject;                /**< Object pointer : 24 */
-  orxGRAPHIC             *pstGraphic;               /**< Graphic pointer : 28 */
-  orxFLOAT                fZ;                       /**< Z coordinate : 32 */
-  orxDISPLAY_BLEND_MODE   eBlendMode;               /**< Blend mode : 36 */
-  orxDISPLAY_SMOOTHING    eSmoothing;               /**< Smoothing : 40 */
-  orxFLOAT                fDepthCoef;               /**< Depth coef : 44 */
+  orxU64                  u64SortKey;               /**< Sort key : 8 */
+  orxTEXTURE             *pstTexture;               /**< Texture pointer : 12 */
+  const orxSHADER        *pstShader;                /**< Shader pointer : 16 */
+  orxOBJECT              *pstObject;                /**< Object pointer : 20 */
+  orxGRAPHIC             *pstGraphic;               /**< Graphic pointer : 24 */
+  orxFLOAT                fZ;                       /**< Z coordinate : 28 */
+  orxDISPLAY_BLEND_MODE   eBlendMode;               /**< Blend mode : 32 */
+  orxDISPLAY_SMOOTHING    eSmoothing;               /**< Smoothing : 36 */
+  orxFLOAT                fDepthCoef;               /**< Depth coef : 40 */
 
 } orxRENDER_NODE;
 
+/** Sort entry
+ */
+typedef struct __orxRENDER_SORT_ENTRY_t
+{
+  orxU64                  u64Key;                   /**< Sort key : 8 */
+  orxU32                  u32Index;                 /**< Node index : 12 */
+
+} orxRENDER_SORT_ENTRY;
+
 /** Static structure
  */
 typedef struct __orxRENDER_STATIC_t
 {
-  orxU32        u32Flags;                           /**< Control flags */
-  orxCLOCK     *pstClock;                           /**< Rendering clock pointer */
-  orxFRAME     *pstFrame;                           /**< Conversion frame */
-  orxBANK      *pstRenderBank;                      /**< Rendering bank */
-  orxLINKLIST   stRenderList;                       /**< Rendering list */
-  orxFLOAT      fDefaultConsoleOffset;              /**< Default console offset */
-  orxFLOAT      fConsoleOffset;                     /**< Console offset */
-  orxFLOAT      fConsoleFontScale;                  /**< Console font scale */
-  orxU32        u32SelectedFrame;                   /**< Selected frame */
-  orxU32        u32SelectedThread;                  /**< Selected thread */
-  orxU32        u32SelectedMarkerDepth;             /**< Selected marker depth */
-  orxU32        u32MaxMarkerDepth;                  /**< Maximum marker depth */
+  orxU32                u32Flags;                   /**< Control flags */
+  orxCLOCK             *pstClock;                   /**< Rendering clock pointer */
+  orxFRAME             *pstFrame;                   /**< Conversion frame */
+  orxRENDER_NODE       *astNodeList;                /**< Render queue node list */
+  orxRENDER_SORT_ENTRY *astSortList;                /**< Render queue sort list */
+  orxRENDER_SORT_ENTRY *astSortBuffer;              /**< Render queue sort buffer */
+  orxU32                u32NodeCount;               /**< Render queue node count */
+  orxU32                u32NodeSize;                /**< Render queue size */
+  orxFLOAT              fDefaultConsoleOffset;      /**< Default console offset */
+  orxFLOAT              fConsoleOffset;             /**< Console offset */
+  orxFLOAT              fConsoleFontScale;          /**< Console font scale */
+  orxU32                u32SelectedFrame;           /**< Selected frame */
+  orxU32                u32SelectedThread;          /**< Selected thread */
+  orxU32                u32SelectedMarkerDepth;     /**< Selected marker depth */
+  orxU32                u32MaxMarkerDepth;          /**< Maximum marker depth */
+  const orxSHADER      *pstActiveShader;            /**< Active object shader, kept started across consecutive objects */
+  orxU32                u32ObjectCount;             /**< Rendered object count, current frame */
+  orxU32                u32ShaderSwitchCount;       /**< Object shader switch count, current frame */
+  orxU32                u32ParamUploadCount;        /**< Shader param upload count, current frame */
 
 } orxRENDER_STATIC;
 
@@ -163,6 +187,24 @@ static orxRENDER_STATIC sstRender;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Stops active object shader, if any
+ */
+static orxINLINE void orxRender_Home_StopShader()
+{
+  /* Has active shader? */
+  if(sstRender.pstActiveShader != orxNULL)
+  {
+    /* Stops it */
+    orxShader_Stop(sstRender.pstActiveShader);
+
+    /* Clears it */
+    sstRender.pstActiveShader = orxNULL;
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Updates console
  */
 static orxINLINE void orxRender_Home_UpdateConsole(orxFLOAT _fScreenWidth, orxFLOAT _fScreenHeight)
@@ -1207,6 +1249,23 @@ static orxINLINE void orxRender_Home_RenderProfiler()
     }
   }
 
+  /* Draws render stats */
+  {
+    /* Updates position */
+    if(bLandscape != orxFALSE)
+    {
+      stTransform.fDstY += 20.0f;
+    }
+    else
+    {
+      stTransform.fDstX += 20.0f;
+    }
+
+    /* Draws them */
+    orxString_NPrint(acLabel, sizeof(acLabel), "%-12s[%u object] [%u shader] [%u param]", "RENDER", sstRender.u32ObjectCount, sstRender.u32ShaderSwitchCount, sstRender.u32ParamUploadCount);
+    orxDisplay_TransformText(acLabel, pstFontBitmap, orxFont_GetMap(pstFont), &stTransform, orx2RGBA(0xFF, 0xFF, 0xFF, 0xCC), orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_ALPHA);
+  }
+
 #endif /* __orxPROFILER__ */
 
   /* Re-enables marker operations */
@@ -1461,6 +1520,307 @@ static orxINLINE void orxRender_Home_RenderConsole()
   return;
 }
 
+/** Resizes the render queue
+ * @param[in]   _u32Size          New size
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_Home_ResizeQueue(orxU32 _u32Size)
+{
+  orxRENDER_NODE       *astNodeList;
+  orxRENDER_SORT_ENTRY *astSortList, *astSortBuffer;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(_u32Size >= sstRender.u32NodeCount);
+
+  /* Reallocates all lists */
+  astNodeList = (orxRENDER_NODE *)orxMemory_Reallocate(sstRender.astNodeList, _u32Size * sizeof(orxRENDER_NODE), orxMEMORY_TYPE_MAIN);
+  if(astNodeList != orxNULL)
+  {
+    /* Stores it */
+    sstRender.astNodeList = astNodeList;
+
+    /* Reallocates sort list */
+    astSortList = (orxRENDER_SORT_ENTRY *)orxMemory_Reallocate(sstRender.astSortList, _u32Size * sizeof(orxRENDER_SORT_ENTRY), orxMEMORY_TYPE_MAIN);
+    if(astSortList != orxNULL)
+    {
+      /* Stores it */
+      sstRender.astSortList = astSortList;
+
+      /* Reallocates sort buffer */
+      astSortBuffer = (orxRENDER_SORT_ENTRY *)orxMemory_Reallocate(sstRender.astSortBuffer, _u32Size * sizeof(orxRENDER_SORT_ENTRY), orxMEMORY_TYPE_MAIN);
+      if(astSortBuffer != orxNULL)
+      {
+        /* Stores it */
+        sstRender.astSortBuffer = astSortBuffer;
+
+        /* Updates size */
+        sstRender.u32NodeSize = _u32Size;
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Deletes the render queue
+ */
+static void orxFASTCALL orxRender_Home_DeleteQueue()
+{
+  /* Frees all lists */
+  if(sstRender.astNodeList != orxNULL)
+  {
+    orxMemory_Free(sstRender.astNodeList);
+  }
+  if(sstRender.astSortList != orxNULL)
+  {
+    orxMemory_Free(sstRender.astSortList);
+  }
+  if(sstRender.astSortBuffer != orxNULL)
+  {
+    orxMemory_Free(sstRender.astSortBuffer);
+  }
+
+  /* Cleans queue */
+  sstRender.astNodeList   = orxNULL;
+  sstRender.astSortList   = orxNULL;
+  sstRender.astSortBuffer = orxNULL;
+  sstRender.u32NodeCount  = 0;
+  sstRender.u32NodeSize   = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Adds a node to the render queue
+ * @return      orxRENDER_NODE / orxNULL
+ */
+static orxINLINE orxRENDER_NODE *orxRender_Home_AddQueueNode()
+{
+  orxRENDER_NODE *pstResult;
+
+  /* Full? */
+  if(sstRender.u32NodeCount == sstRender.u32NodeSize)
+  {
+    /* Grows queue */
+    if(orxRender_Home_ResizeQueue(sstRender.u32NodeSize << 1) == orxSTATUS_FAILURE)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Couldn't grow render queue to %u nodes.", sstRender.u32NodeSize << 1);
+
+      /* Done! */
+      return orxNULL;
+    }
+  }
+
+  /* Gets next node */
+  pstResult = &(sstRender.astNodeList[sstRender.u32NodeCount++]);
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Sorts entries using a stable LSD radix sort on their 64-bit keys, ascending
+ * @param[in]   _astEntryList     Entries to sort
+ * @param[in]   _astBuffer        Buffer of the same size, used for ping-ponging
+ * @param[in]   _u32Count         Number of entries
+ * @return      Sorted entries, either _astEntryList or _astBuffer
+ */
+static orxRENDER_SORT_ENTRY *orxFASTCALL orxRender_Home_RadixSort(orxRENDER_SORT_ENTRY *_astEntryList, orxRENDER_SORT_ENTRY *_astBuffer, orxU32 _u32Count)
+{
+  orxU32                au32Histogram[sizeof(orxU64)][256];
+  orxRENDER_SORT_ENTRY *astSrc, *astDst;
+  orxU32                i, u32Pass;
+
+  /* Clears histograms */
+  orxMemory_Zero(au32Histogram, sizeof(au32Histogram));
+
+  /* Computes all histograms in a single pass */
+  for(i = 0; i < _u32Count; i++)
+  {
+    orxU64 u64Key;
+
+    /* Gets key */
+    u64Key = _astEntryList[i].u64Key;
+
+    /* Updates histograms */
+    for(u32Pass = 0; u32Pass < sizeof(orxU64); u32Pass++, u64Key >>= 8)
+    {
+      au32Histogram[u32Pass][u64Key & 0xFF]++;
+    }
+  }
+
+  /* For all passes */
+  for(u32Pass = 0, astSrc = _astEntryList, astDst = _astBuffer; u32Pass < sizeof(orxU64); u32Pass++)
+  {
+    orxU32 *au32Offset, u32Shift, u32Offset;
+
+    /* Gets pass info */
+    au32Offset  = au32Histogram[u32Pass];
+    u32Shift    = u32Pass << 3;
+
+    /* Not all entries sharing the same digit? */
+    if((_u32Count != 0) && (au32Offset[(astSrc[0].u64Key >> u32Shift) & 0xFF] != _u32Count))
+    {
+      orxRENDER_SORT_ENTRY *astSwap;
+
+      /* Turns counts into offsets */
+      for(i = 0, u32Offset = 0; i < 256; i++)
+      {
+        orxU32 u32Digit;
+
+        u32Digit      = au32Offset[i];
+        au32Offset[i] = u32Offset;
+        u32Offset    += u32Digit;
+      }
+
+      /* Scatters entries */
+      for(i = 0; i < _u32Count; i++)
+      {
+        astDst[au32Offset[(astSrc[i].u64Key >> u32Shift) & 0xFF]++] = astSrc[i];
+      }
+
+      /* Swaps lists */
+      astSwap = astSrc;
+      astSrc  = astDst;
+      astDst  = astSwap;
+    }
+  }
+
+  /* Done! */
+  return astSrc;
+}
+
+/** Stores dense ranks of sorted pointer keys into the render node sort keys
+ * @param[in]   _astEntryList     Entries sorted by pointer
+ * @param[in]   _u32Shift         Shift of the rank inside the node sort key
+ * @param[in]   _u32MaxRank       Maximum rank
+ */
+static void orxFASTCALL orxRender_Home_RankQueue(const orxRENDER_SORT_ENTRY *_astEntryList, orxU32 _u32Shift, orxU32 _u32MaxRank)
+{
+  orxU32 i, u32Rank;
+
+  /* For all entries */
+  for(i = 0, u32Rank = 0; i < sstRender.u32NodeCount; i++)
+  {
+    /* New pointer? */
+    if((i != 0) && (_astEntryList[i].u64Key != _astEntryList[i - 1].u64Key))
+    {
+      /* Below maximum? */
+      if(u32Rank < _u32MaxRank)
+      {
+        /* Updates rank */
+        u32Rank++;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Too many different textures/shaders in a single render queue (> %u): sorting won't be accurate.", _u32MaxRank + 1);
+      }
+    }
+
+    /* Stores it */
+    sstRender.astNodeList[_astEntryList[i].u32Index].u64SortKey |= ((orxU64)u32Rank << _u32Shift);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Sorts the render queue
+ * @param[in]   _bSorting         Sorting enabled
+ * @return      Sorted entries, to be rendered from last to first
+ */
+static const orxRENDER_SORT_ENTRY *orxFASTCALL orxRender_Home_SortQueue(orxBOOL _bSorting)
+{
+  orxRENDER_SORT_ENTRY *astResult;
+  orxU32                i;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_SortQueue");
+
+  /* Sorting? */
+  if((_bSorting != orxFALSE) && (sstRender.u32NodeCount > 1))
+  {
+    /* For all nodes */
+    for(i = 0; i < sstRender.u32NodeCount; i++)
+    {
+      orxRENDER_NODE *pstNode;
+      orxU32          u32BlendMode, u32Smoothing;
+      union
+      {
+        orxFLOAT      fValue;
+        orxU32        u32Value;
+      } stZ;
+
+      /* Gets node */
+      pstNode = &(sstRender.astNodeList[i]);
+
+      /* Gets Z bits (-0 -> +0) & flips them so that they sort as unsigned integers */
+      stZ.fValue = (pstNode->fZ != orxFLOAT_0) ? pstNode->fZ : orxFLOAT_0;
+      stZ.u32Value = (stZ.u32Value & 0x80000000) ? ~stZ.u32Value : (stZ.u32Value | 0x80000000);
+
+      /* Gets blend mode & smoothing (none sort after all valid values) */
+      u32BlendMode  = (pstNode->eBlendMode < orxDISPLAY_BLEND_MODE_NUMBER) ? (orxU32)pstNode->eBlendMode : (orxU32)orxDISPLAY_BLEND_MODE_NUMBER;
+      u32Smoothing  = (pstNode->eSmoothing < orxDISPLAY_SMOOTHING_NUMBER) ? (orxU32)pstNode->eSmoothing : (orxU32)orxDISPLAY_SMOOTHING_NUMBER;
+
+      /* Inits its sort key */
+      pstNode->u64SortKey = ((orxU64)stZ.u32Value << orxRENDER_KU32_SORT_SHIFT_Z) | ((orxU64)u32BlendMode << orxRENDER_KU32_SORT_SHIFT_BLEND_MODE) | ((orxU64)u32Smoothing << orxRENDER_KU32_SORT_SHIFT_SMOOTHING);
+
+      /* Inits texture entry */
+      sstRender.astSortList[i].u64Key   = (orxU64)(orxUPTR)pstNode->pstTexture;
+      sstRender.astSortList[i].u32Index = i;
+    }
+
+    /* Ranks textures */
+    orxRender_Home_RankQueue(orxRender_Home_RadixSort(sstRender.astSortList, sstRender.astSortBuffer, sstRender.u32NodeCount), orxRENDER_KU32_SORT_SHIFT_TEXTURE, orxRENDER_KU32_SORT_MAX_TEXTURE);
+
+    /* For all nodes */
+    for(i = 0; i < sstRender.u32NodeCount; i++)
+    {
+      /* Inits shader entry */
+      sstRender.astSortList[i].u64Key   = (orxU64)(orxUPTR)sstRender.astNodeList[i].pstShader;
+      sstRender.astSortList[i].u32Index = i;
+    }
+
+    /* Ranks shaders */
+    orxRender_Home_RankQueue(orxRender_Home_RadixSort(sstRender.astSortList, sstRender.astSortBuffer, sstRender.u32NodeCount), orxRENDER_KU32_SORT_SHIFT_SHADER, orxRENDER_KU32_SORT_MAX_SHADER);
+
+    /* For all nodes */
+    for(i = 0; i < sstRender.u32NodeCount; i++)
+    {
+      /* Inits final entry */
+      sstRender.astSortList[i].u64Key   = sstRender.astNodeList[i].u64SortKey;
+      sstRender.astSortList[i].u32Index = i;
+    }
+
+    /* Sorts them */
+    astResult = orxRender_Home_RadixSort(sstRender.astSortList, sstRender.astSortBuffer, sstRender.u32NodeCount);
+  }
+  else
+  {
+    /* For all nodes */
+    for(i = 0; i < sstRender.u32NodeCount; i++)
+    {
+      /* Keeps insertion order */
+      sstRender.astSortList[i].u32Index = i;
+    }
+
+    /* Updates result */
+    astResult = sstRender.astSortList;
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return astResult;
+}
+
 /** Renders a viewport
  * @param[in]   _pstRenderNode    Render node
  * @param[in]   _pstTransform     Rendering transform
@@ -1511,11 +1871,26 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
     orxDisplay_SetBitmapClipping(pstBitmap, orxF2U(vClipTL.fX), orxF2U(vClipTL.fY), orxF2U(vClipBR.fX), orxF2U(vClipBR.fY));
   }
 
-  /* Inits event */
-  orxEVENT_INIT(stEvent, orxEVENT_TYPE_RENDER, orxRENDER_EVENT_OBJECT_START, (orxHANDLE)pstObject, (orxHANDLE)pstObject, &stPayload);
+  /* Has start event handlers? */
+  if(orxEvent_IsHandled(orxEVENT_TYPE_RENDER, orxRENDER_EVENT_OBJECT_START) != orxFALSE)
+  {
+    /* Stops active shader as handlers might render */
+    orxRender_Home_StopShader();
+
+    /* Inits event */
+    orxEVENT_INIT(stEvent, orxEVENT_TYPE_RENDER, orxRENDER_EVENT_OBJECT_START, (orxHANDLE)pstObject, (orxHANDLE)pstObject, &stPayload);
+
+    /* Sends it */
+    eResult = orxEvent_Send(&stEvent);
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
 
   /* Should render? */
-  if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
+  if(eResult != orxSTATUS_FAILURE)
   {
     orxGRAPHIC *pstGraphic;
     orxTEXTURE *pstTexture;
@@ -1579,6 +1954,9 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
 
           /* Gets its bitmap */
           pstBitmap = orxTexture_GetBitmap(pstTexture);
+
+          /* Keeps its glyphs cached (dynamic fonts only) */
+          orxFont_CacheCharacters(pstFont, orxText_GetString(pstText));
         }
       }
     }
@@ -1605,13 +1983,37 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
         /* Valid? */
         if(pstShader != orxNULL)
         {
-          /* Starts it */
-          if(orxShader_Start(pstShader, orxSTRUCTURE(pstObject)) == orxSTATUS_FAILURE)
+          /* Already active? */
+          if(pstShader == sstRender.pstActiveShader)
           {
-            /* Cancels it */
-            pstShader = orxNULL;
+            /* Restarts it for this object, only uploading modified params */
+            if(orxShader_Restart(pstShader, orxSTRUCTURE(pstObject)) == orxSTATUS_FAILURE)
+            {
+              /* Clears it */
+              sstRender.pstActiveShader = orxNULL;
+            }
+          }
+          else
+          {
+            /* Stops previous shader */
+            orxRender_Home_StopShader();
+
+            /* Starts it */
+            if(orxShader_Start(pstShader, orxSTRUCTURE(pstObject)) != orxSTATUS_FAILURE)
+            {
+              /* Stores it */
+              sstRender.pstActiveShader = pstShader;
+
+              /* Updates count */
+              sstRender.u32ShaderSwitchCount++;
+            }
           }
         }
+        else
+        {
+          /* Stops previous shader */
+          orxRender_Home_StopShader();
+        }
 
         /* Has graphic color? */
         if(orxGraphic_HasColor(pstGraphic) != orxFALSE)
@@ -1643,12 +2045,8 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
           eResult = orxDisplay_TransformText(orxText_GetString(pstText), pstBitmap, orxFont_GetMap(pstFont), stPayload.stObject.pstTransform, orxColor_ToRGBA(&stColor), _pstRenderNode->eSmoothing, _pstRenderNode->eBlendMode);
         }
 
-        /* Has shader? */
-        if(pstShader != orxNULL)
-        {
-          /* Stops it */
-          orxShader_Stop(pstShader);
-        }
+        /* Updates count */
+        sstRender.u32ObjectCount++;
       }
       else
       {
@@ -1660,6 +2058,9 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
     {
       /* Logs message */
       orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "No valid bitmap found when rendering object [%s].", orxObject_GetName(_pstRenderNode->pstObject));
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
     }
 
     /* Profiles */
@@ -1671,8 +2072,15 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
     eResult = orxSTATUS_SUCCESS;
   }
 
-  /* Sends stop event */
-  orxEVENT_SEND(orxEVENT_TYPE_RENDER, orxRENDER_EVENT_OBJECT_STOP, (orxHANDLE)pstObject, (orxHANDLE)pstObject, &stPayload);
+  /* Has stop event handlers? */
+  if(orxEvent_IsHandled(orxEVENT_TYPE_RENDER, orxRENDER_EVENT_OBJECT_STOP) != orxFALSE)
+  {
+    /* Stops active shader as handlers might render */
+    orxRender_Home_StopShader();
+
+    /* Sends stop event */
+    orxEVENT_SEND(orxEVENT_TYPE_RENDER, orxRENDER_EVENT_OBJECT_STOP, (orxHANDLE)pstObject, (orxHANDLE)pstObject, &stPayload);
+  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -1839,12 +2247,13 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
             if((fCameraWidth > orxFLOAT_0)
             && (fCameraHeight > orxFLOAT_0))
             {
-              orxU32          u32Number;
-              orxOBJECT      *pstObject;
-              orxFRAME       *pstCameraFrame;
-              orxRENDER_NODE *pstRenderNode;
-              orxVECTOR       vCameraScale, vCameraCenter, vCameraPosition;
-              orxFLOAT        fCameraDepth, fRenderScaleX, fRenderScaleY, fRecZoom, fRenderRotation, fCameraBoundingRadius;
+              orxU32                      u32Number, j;
+              orxOBJECT                  *pstObject;
+              orxFRAME                   *pstCameraFrame;
+              orxRENDER_NODE             *pstRenderNode;
+              const orxRENDER_SORT_ENTRY *astSortList;
+              orxVECTOR                   vCameraScale, vCameraCenter, vCameraPosition;
+              orxFLOAT                    fCameraDepth, fRenderScaleX, fRenderScaleY, fRecZoom, fRenderRotation, fCameraBoundingRadius;
 
               /* Gets camera frame */
               pstCameraFrame = orxCamera_GetFrame(pstCamera);
@@ -2062,59 +2471,21 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                             eBlendMode = orxDISPLAY_BLEND_MODE_ALPHA;
                           }
 
-                          /* Creates a render node */
-                          pstRenderNode = (orxRENDER_NODE *)orxBank_Allocate(sstRender.pstRenderBank);
-
-                          /* Cleans its internal node */
-                          orxMemory_Zero(pstRenderNode, sizeof(orxLINKLIST_NODE));
-
-                          /* Updates render node */
-                          pstRenderNode->pstObject    = pstObject;
-                          pstRenderNode->pstTexture   = pstTexture;
-                          pstRenderNode->pstShader    = pstShader;
-                          pstRenderNode->pstGraphic   = pstGraphic;
-                          pstRenderNode->eSmoothing   = eSmoothing;
-                          pstRenderNode->eBlendMode   = eBlendMode;
-                          pstRenderNode->fZ           = vObjectPos.fZ;
-                          pstRenderNode->fDepthCoef   = fDepthCoef;
-
-                          /* No sorting or empty list? */
-                          if((bSorting == orxFALSE)
-                          || (orxLinkList_GetCount(&(sstRender.stRenderList)) == 0))
-                          {
-                            /* Adds node at beginning */
-                            orxLinkList_AddStart(&(sstRender.stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
-                          }
-                          else
+                          /* Adds a render node */
+                          pstRenderNode = orxRender_Home_AddQueueNode();
+
+                          /* Valid? */
+                          if(pstRenderNode != orxNULL)
                           {
-                            orxRENDER_NODE *pstNode;
-
-                            /* Finds correct node position */
-                            for(pstNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                                (pstNode != orxNULL)
-                             && ((vObjectPos.fZ < pstNode->fZ)
-                              || ((vObjectPos.fZ == pstNode->fZ)
-                               && ((pstTexture < pstNode->pstTexture)
-                                || ((pstTexture == pstNode->pstTexture)
-                                 && ((pstShader < pstNode->pstShader)
-                                  || ((pstShader == pstNode->pstShader)
-                                   && ((eBlendMode < pstNode->eBlendMode)
-                                    || ((eBlendMode == pstNode->eBlendMode)
-                                     && (eSmoothing < pstNode->eSmoothing)))))))));
-                                pstNode = (orxRENDER_NODE *)orxLinkList_GetNext(&(pstNode->stNode)))
-                              ;
-
-                            /* End of list reached? */
-                            if(pstNode == orxNULL)
-                            {
-                              /* Adds it at end */
-                              orxLinkList_AddEnd(&(sstRender.stRenderList), &(pstRenderNode->stNode));
-                            }
-                            else
-                            {
-                              /* Adds it before found node */
-                              orxLinkList_AddBefore(&(pstNode->stNode), &(pstRenderNode->stNode));
-                            }
+                            /* Updates render node */
+                            pstRenderNode->pstObject    = pstObject;
+                            pstRenderNode->pstTexture   = pstTexture;
+                            pstRenderNode->pstShader    = pstShader;
+                            pstRenderNode->pstGraphic   = pstGraphic;
+                            pstRenderNode->eSmoothing   = eSmoothing;
+                            pstRenderNode->eBlendMode   = eBlendMode;
+                            pstRenderNode->fZ           = vObjectPos.fZ;
+                            pstRenderNode->fDepthCoef   = fDepthCoef;
                           }
                         }
                       }
@@ -2122,10 +2493,11 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                   }
                 }
 
-                /* For all render nodes */
-                for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                    pstRenderNode != orxNULL;
-                    pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetNext((orxLINKLIST_NODE *)pstRenderNode))
+                /* Sorts render queue */
+                astSortList = orxRender_Home_SortQueue(bSorting);
+
+                /* For all render nodes, back to front */
+                for(j = sstRender.u32NodeCount; j > 0; j--)
                 {
                   orxFRAME             *pstFrame;
                   orxVECTOR             vObjectPos, vRenderPos, vObjectScale, vPivot;
@@ -2133,6 +2505,9 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                   orxBOOL               bFlipX, bFlipY;
                   orxDISPLAY_TRANSFORM  stTransform;
 
+                  /* Gets render node */
+                  pstRenderNode = &(sstRender.astNodeList[astSortList[j - 1].u32Index]);
+
                   /* Gets object */
                   pstObject = pstRenderNode->pstObject;
 
@@ -2255,11 +2630,11 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                   }
                 }
 
-                /* Cleans rendering bank */
-                orxBank_Clear(sstRender.pstRenderBank);
+                /* Stops last object shader */
+                orxRender_Home_StopShader();
 
-                /* Cleans rendering list */
-                orxMemory_Zero(&(sstRender.stRenderList), sizeof(orxLINKLIST));
+                /* Clears render queue */
+                sstRender.u32NodeCount = 0;
               }
             }
             else
@@ -2356,6 +2731,11 @@ static void orxFASTCALL orxRender_Home_RenderAll(const orxCLOCK_INFO *_pstClockI
     /* Profiles */
     orxPROFILER_PUSH_MARKER("orxRender_RenderAll");
 
+    /* Resets stats */
+    sstRender.u32ObjectCount        = 0;
+    sstRender.u32ShaderSwitchCount  = 0;
+    sstRender.u32ParamUploadCount   = orxShader_GetParamUploadCount();
+
     /* For all viewports */
     for(pstViewport = orxVIEWPORT(orxStructure_GetFirst(orxSTRUCTURE_ID_VIEWPORT));
         pstViewport != orxNULL;
@@ -2365,6 +2745,9 @@ static void orxFASTCALL orxRender_Home_RenderAll(const orxCLOCK_INFO *_pstClockI
       orxRender_Home_RenderViewport(pstViewport);
     }
 
+    /* Updates param upload count */
+    sstRender.u32ParamUploadCount   = orxShader_GetParamUploadCount() - sstRender.u32ParamUploadCount;
+
     /* Increases FPS count */
     orxFPS_IncreaseFrameCount();
 
@@ -3006,11 +3389,8 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     /* Cleans static controller */
     orxMemory_Zero(&sstRender, sizeof(orxRENDER_STATIC));
 
-    /* Creates rendering bank */
-    sstRender.pstRenderBank = orxBank_Create(orxRENDER_KU32_ORDER_BANK_SIZE, sizeof(orxRENDER_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-
-    /* Valid? */
-    if(sstRender.pstRenderBank != orxNULL)
+    /* Creates render queue */
+    if(orxRender_Home_ResizeQueue(orxRENDER_KU32_QUEUE_SIZE) != orxSTATUS_FAILURE)
     {
       /* Gets core clock */
       sstRender.pstClock = orxClock_Get(orxCLOCK_KZ_CORE);
@@ -3092,14 +3472,14 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
             /* Deletes frame */
             orxFrame_Delete(sstRender.pstFrame);
 
-            /* Deletes bank */
-            orxBank_Delete(sstRender.pstRenderBank);
+            /* Deletes render queue */
+            orxRender_Home_DeleteQueue();
           }
         }
         else
         {
-          /* Deletes bank */
-          orxBank_Delete(sstRender.pstRenderBank);
+          /* Deletes render queue */
+          orxRender_Home_DeleteQueue();
 
           /* Updates result */
           eResult = orxSTATUS_FAILURE;
@@ -3107,8 +3487,8 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
       }
       else
       {
-        /* Deletes bank */
-        orxBank_Delete(sstRender.pstRenderBank);
+        /* Deletes render queue */
+        orxRender_Home_DeleteQueue();
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
@@ -3116,6 +3496,9 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     }
     else
     {
+      /* Deletes render queue */
+      orxRender_Home_DeleteQueue();
+
       /* Updates result */
       eResult = orxSTATUS_FAILURE;
     }
@@ -3158,8 +3541,8 @@ void orxFASTCALL orxRender_Home_Exit()
     /* Deletes conversion frame */
     orxFrame_Delete(sstRender.pstFrame);
 
-    /* Deletes rendering bank */
-    orxBank_Delete(sstRender.pstRenderBank);
+    /* Deletes render queue */
+    orxRender_Home_DeleteQueue();
 
     /* Updates flags */
     sstRender.u32Flags &= ~(orxRENDER_KU32_STATIC_FLAG_READY | orxRENDER_KU32_STATIC_FLAG_REGISTERED);
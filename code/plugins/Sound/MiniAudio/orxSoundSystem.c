@@ -163,6 +163,19 @@
 #define orxSOUNDSYSTEM_KF_DEFAULT_THREAD_SLEEP_TIME       orx2F(0.001f)
 #define orxSOUNDSYSTEM_KF_DEVICE_STOP_DELAY               orx2F(1.0f)
 #define orxSOUNDSYSTEM_KU32_TASK_PARAM_LIST_SIZE          512
+#define orxSOUNDSYSTEM_KU32_COMMAND_BATCH_SIZE            64
+
+
+/** Command flags
+ */
+#define orxSOUNDSYSTEM_KU32_COMMAND_FLAG_NONE             0x00000000 /**< No flags */
+
+#define orxSOUNDSYSTEM_KU32_COMMAND_FLAG_VOLUME           0x00000001 /**< Volume flag */
+#define orxSOUNDSYSTEM_KU32_COMMAND_FLAG_PITCH            0x00000002 /**< Pitch flag */
+#define orxSOUNDSYSTEM_KU32_COMMAND_FLAG_POSITION         0x00000004 /**< Position flag */
+#define orxSOUNDSYSTEM_KU32_COMMAND_FLAG_SPATIALIZATION   0x00000008 /**< Spatialization flag */
+#define orxSOUNDSYSTEM_KU32_COMMAND_FLAG_PANNING          0x00000010 /**< Panning flag */
+#define orxSOUNDSYSTEM_KU32_COMMAND_FLAG_LOOP             0x00000020 /**< Loop flag */
 #define orxSOUNDSYSTEM_KZ_THREAD_NAME                     "Sound"
 
 
@@ -226,6 +239,8 @@ struct __orxSOUNDSYSTEM_SOUND_t
   ma_node_base                   *pstFilterNode;
   orxU32                          u32ChannelNumber;
   orxU32                          u32SampleRate;
+  orxU32                          u32CommandIndex;
+  volatile orxU32                 u32CommandCount;
 
   union
   {
@@ -344,6 +359,39 @@ typedef struct __orxSOUNDSYSTEM_TASK_PARAM_t
 
 } orxSOUNDSYSTEM_TASK_PARAM;
 
+/** Internal command structure (coalesced setters of a sound that isn't ready yet)
+ */
+typedef struct __orxSOUNDSYSTEM_COMMAND_t
+{
+  orxVECTOR                 vPosition;
+  struct {
+    orxFLOAT                fMinDistance;
+    orxFLOAT                fMaxDistance;
+    orxFLOAT                fMinGain;
+    orxFLOAT                fMaxGain;
+    orxFLOAT                fRollOff;
+  } stSpatialization;
+  struct {
+    orxFLOAT                fPanning;
+    orxBOOL                 bMix;
+  } stPanning;
+  orxSOUNDSYSTEM_SOUND     *pstSound;
+  orxFLOAT                  fVolume;
+  orxFLOAT                  fPitch;
+  orxBOOL                   bLoop;
+  orxU32                    u32Flags;
+
+} orxSOUNDSYSTEM_COMMAND;
+
+/** Internal command batch structure, followed by its commands
+ */
+typedef struct __orxSOUNDSYSTEM_COMMAND_BATCH_t
+{
+  orxU32                    u32Count;
+  orxU32                    u32Size;
+
+} orxSOUNDSYSTEM_COMMAND_BATCH;
+
 /** Static structure
  */
 typedef struct __orxSOUNDSYSTEM_STATIC_t
@@ -370,6 +418,7 @@ typedef struct __orxSOUNDSYSTEM_STATIC_t
   orxBANK                        *pstBusBank;             /**< Bus bank */
   orxBANK                        *pstFilterBank;          /**< Filter bank */
   volatile orxHANDLE              hRecordingResource;     /**< Recording resource */
+  orxSOUNDSYSTEM_COMMAND_BATCH   *pstCommandBatch;        /**< Pending command batch */
   orxSOUNDSYSTEM_TASK_PARAM       astTaskParamList[orxSOUNDSYSTEM_KU32_TASK_PARAM_LIST_SIZE]; /**< Task parameters */
   orxFLOAT                        fDimensionRatio;        /**< Dimension ration */
   orxFLOAT                        fRecDimensionRatio;     /**< Reciprocal dimension ratio */
@@ -458,6 +507,213 @@ static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_EventHandler(const orxEVEN
   return eResult;
 }
 
+static orxINLINE orxSOUNDSYSTEM_COMMAND *orxSoundSystem_MiniAudio_GetCommandList(orxSOUNDSYSTEM_COMMAND_BATCH *_pstBatch)
+{
+  /* Done! */
+  return (orxSOUNDSYSTEM_COMMAND *)(_pstBatch + 1);
+}
+
+static orxSOUNDSYSTEM_COMMAND *orxFASTCALL orxSoundSystem_MiniAudio_GetCommand(orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  orxSOUNDSYSTEM_COMMAND_BATCH *pstBatch;
+  orxSOUNDSYSTEM_COMMAND       *pstResult = orxNULL;
+
+  /* Gets current batch */
+  pstBatch = sstSoundSystem.pstCommandBatch;
+
+  /* Has a pending command for this sound? */
+  if((pstBatch != orxNULL)
+  && (_pstSound->u32CommandIndex < pstBatch->u32Count)
+  && (orxSoundSystem_MiniAudio_GetCommandList(pstBatch)[_pstSound->u32CommandIndex].pstSound == _pstSound))
+  {
+    /* Updates result */
+    pstResult = &(orxSoundSystem_MiniAudio_GetCommandList(pstBatch)[_pstSound->u32CommandIndex]);
+  }
+  else
+  {
+    /* Needs more room? */
+    if((pstBatch == orxNULL) || (pstBatch->u32Count == pstBatch->u32Size))
+    {
+      orxU32 u32Size;
+
+      /* Gets new size */
+      u32Size = (pstBatch != orxNULL) ? pstBatch->u32Size << 1 : orxSOUNDSYSTEM_KU32_COMMAND_BATCH_SIZE;
+
+      /* Grows batch */
+      pstBatch = (orxSOUNDSYSTEM_COMMAND_BATCH *)orxMemory_Reallocate(sstSoundSystem.pstCommandBatch, sizeof(orxSOUNDSYSTEM_COMMAND_BATCH) + u32Size * sizeof(orxSOUNDSYSTEM_COMMAND), orxMEMORY_TYPE_AUDIO);
+
+      /* Success? */
+      if(pstBatch != orxNULL)
+      {
+        /* New batch? */
+        if(sstSoundSystem.pstCommandBatch == orxNULL)
+        {
+          /* Inits it */
+          pstBatch->u32Count = 0;
+        }
+
+        /* Stores it */
+        pstBatch->u32Size               = u32Size;
+        sstSoundSystem.pstCommandBatch  = pstBatch;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "[%s] Couldn't allocate sound command batch: ignoring command.", _pstSound->zName);
+      }
+    }
+
+    /* Valid? */
+    if(pstBatch != orxNULL)
+    {
+      /* Adds new command */
+      _pstSound->u32CommandIndex  = pstBatch->u32Count++;
+      pstResult                   = &(orxSoundSystem_MiniAudio_GetCommandList(pstBatch)[_pstSound->u32CommandIndex]);
+      pstResult->pstSound         = _pstSound;
+      pstResult->u32Flags         = orxSOUNDSYSTEM_KU32_COMMAND_FLAG_NONE;
+
+      /* Updates sound's pending command count */
+      orxMEMORY_ATOMIC_INC32(&(_pstSound->u32CommandCount));
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_ProcessCommandsTask(void *_pContext)
+{
+  orxSOUNDSYSTEM_COMMAND_BATCH *pstBatch;
+  orxSOUNDSYSTEM_COMMAND       *pstCommand;
+  orxU32                        i;
+
+  /* Gets batch */
+  pstBatch = (orxSOUNDSYSTEM_COMMAND_BATCH *)_pContext;
+
+  /* For all commands */
+  for(i = 0, pstCommand = orxSoundSystem_MiniAudio_GetCommandList(pstBatch); i < pstBatch->u32Count; i++, pstCommand++)
+  {
+    orxSOUNDSYSTEM_SOUND *pstSound;
+
+    /* Gets sound */
+    pstSound = pstCommand->pstSound;
+
+    /* Ready? */
+    if(pstSound->bReady != orxFALSE)
+    {
+      /* Volume? */
+      if(orxFLAG_TEST(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_VOLUME))
+      {
+        /* Sets volume */
+        ma_sound_set_volume(&(pstSound->stSound), pstCommand->fVolume);
+      }
+
+      /* Pitch? */
+      if(orxFLAG_TEST(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_PITCH))
+      {
+        /* Sets pitch */
+        ma_sound_set_pitch(&(pstSound->stSound), pstCommand->fPitch);
+      }
+
+      /* Position? */
+      if(orxFLAG_TEST(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_POSITION))
+      {
+        /* Updates position */
+        ma_sound_set_position(&(pstSound->stSound), sstSoundSystem.fDimensionRatio * pstCommand->vPosition.fX, sstSoundSystem.fDimensionRatio * pstCommand->vPosition.fY, sstSoundSystem.fDimensionRatio * pstCommand->vPosition.fZ);
+      }
+
+      /* Spatialization? */
+      if(orxFLAG_TEST(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_SPATIALIZATION))
+      {
+        /* Enable? */
+        if((pstCommand->stSpatialization.fMinDistance >= orxFLOAT_0) && (pstCommand->stSpatialization.fMaxDistance > pstCommand->stSpatialization.fMinDistance))
+        {
+          /* Updates status */
+          ma_sound_set_spatialization_enabled(&(pstSound->stSound), orxTRUE);
+          ma_sound_set_attenuation_model(&(pstSound->stSound), ma_attenuation_model_linear);
+
+          /* Updates properties */
+          ma_sound_set_min_distance(&(pstSound->stSound), sstSoundSystem.fDimensionRatio * pstCommand->stSpatialization.fMinDistance);
+          ma_sound_set_max_distance(&(pstSound->stSound), sstSoundSystem.fDimensionRatio * pstCommand->stSpatialization.fMaxDistance);
+          ma_sound_set_min_gain(&(pstSound->stSound), pstCommand->stSpatialization.fMinGain);
+          ma_sound_set_max_gain(&(pstSound->stSound), pstCommand->stSpatialization.fMaxGain);
+          ma_sound_set_rolloff(&(pstSound->stSound), pstCommand->stSpatialization.fRollOff);
+        }
+        else
+        {
+          /* Updates status */
+          ma_sound_set_spatialization_enabled(&(pstSound->stSound), orxFALSE);
+        }
+      }
+
+      /* Panning? */
+      if(orxFLAG_TEST(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_PANNING))
+      {
+        /* Updates sound */
+        ma_sound_set_pan(&(pstSound->stSound), pstCommand->stPanning.fPanning);
+        ma_sound_set_pan_mode(&(pstSound->stSound), (pstCommand->stPanning.bMix != orxFALSE) ? ma_pan_mode_pan : ma_pan_mode_balance);
+      }
+
+      /* Loop? */
+      if(orxFLAG_TEST(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_LOOP))
+      {
+        /* Updates sound's status */
+        ma_sound_set_looping(&(pstSound->stSound), (pstCommand->bLoop != orxFALSE) ? MA_TRUE : MA_FALSE);
+      }
+    }
+
+    /* Updates sound's pending command count */
+    orxMEMORY_ATOMIC_DEC32(&(pstSound->u32CommandCount));
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_FreeCommands(void *_pContext)
+{
+  /* Frees batch */
+  orxMemory_Free(_pContext);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+static void orxFASTCALL orxSoundSystem_MiniAudio_FlushCommands()
+{
+  orxSOUNDSYSTEM_COMMAND_BATCH *pstBatch;
+
+  /* Gets current batch */
+  pstBatch = sstSoundSystem.pstCommandBatch;
+
+  /* Has pending commands? */
+  if((pstBatch != orxNULL) && (pstBatch->u32Count != 0))
+  {
+    /* Detaches it */
+    sstSoundSystem.pstCommandBatch = orxNULL;
+
+    /* Runs process commands task (on the linear worker, to keep the order with all the other sound tasks) */
+    if(orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_ProcessCommandsTask, &orxSoundSystem_MiniAudio_FreeCommands, &orxSoundSystem_MiniAudio_FreeCommands, pstBatch) == orxSTATUS_FAILURE)
+    {
+      orxSOUNDSYSTEM_COMMAND *pstCommand;
+      orxU32                  i;
+
+      /* For all dropped commands */
+      for(i = 0, pstCommand = orxSoundSystem_MiniAudio_GetCommandList(pstBatch); i < pstBatch->u32Count; i++, pstCommand++)
+      {
+        /* Updates sound's pending command count */
+        orxMEMORY_ATOMIC_DEC32(&(pstCommand->pstSound->u32CommandCount));
+      }
+
+      /* Frees batch */
+      orxMemory_Free(pstBatch);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 static void orxFASTCALL orxSoundSystem_MiniAudio_Update(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
   orxEVENT                stEvent;
@@ -786,6 +1042,9 @@ static void orxFASTCALL orxSoundSystem_MiniAudio_Update(const orxCLOCK_INFO *_ps
     }
   }
 
+  /* Flushes pending sound commands */
+  orxSoundSystem_MiniAudio_FlushCommands();
+
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
@@ -2955,66 +3214,6 @@ static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetBusTask(void *_pContext
   return eResult;
 }
 
-static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetVolumeTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_TASK_PARAM  *pstTaskParam;
-  orxSOUNDSYSTEM_SOUND       *pstSound;
-  orxSTATUS                   eResult = orxSTATUS_FAILURE;
-
-  /* Gets task param */
-  pstTaskParam = (orxSOUNDSYSTEM_TASK_PARAM *)_pContext;
-
-  /* Gets sound */
-  pstSound = pstTaskParam->pstSound;
-
-  /* Ready? */
-  if(pstSound->bReady != orxFALSE)
-  {
-    /* Sets volume */
-    ma_sound_set_volume(&(pstSound->stSound), pstTaskParam->fVolume);
-
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
-  }
-
-  /* Updates task param */
-  orxMEMORY_BARRIER();
-  pstTaskParam->pstSound = orxNULL;
-
-  /* Done! */
-  return eResult;
-}
-
-static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetPitchTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_TASK_PARAM  *pstTaskParam;
-  orxSOUNDSYSTEM_SOUND       *pstSound;
-  orxSTATUS                   eResult = orxSTATUS_FAILURE;
-
-  /* Gets task param */
-  pstTaskParam = (orxSOUNDSYSTEM_TASK_PARAM *)_pContext;
-
-  /* Gets sound */
-  pstSound = pstTaskParam->pstSound;
-
-  /* Ready? */
-  if(pstSound->bReady != orxFALSE)
-  {
-    /* Sets pitch */
-    ma_sound_set_pitch(&(pstSound->stSound), pstTaskParam->fPitch);
-
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
-  }
-
-  /* Updates task param */
-  orxMEMORY_BARRIER();
-  pstTaskParam->pstSound = orxNULL;
-
-  /* Done! */
-  return eResult;
-}
-
 static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetTimeTask(void *_pContext)
 {
   orxSOUNDSYSTEM_TASK_PARAM  *pstTaskParam;
@@ -3055,144 +3254,6 @@ static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetTimeTask(void *_pContex
   return eResult;
 }
 
-static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetPositionTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_TASK_PARAM  *pstTaskParam;
-  orxSOUNDSYSTEM_SOUND       *pstSound;
-  orxSTATUS                   eResult = orxSTATUS_FAILURE;
-
-  /* Gets task param */
-  pstTaskParam = (orxSOUNDSYSTEM_TASK_PARAM *)_pContext;
-
-  /* Gets sound */
-  pstSound = pstTaskParam->pstSound;
-
-  /* Ready? */
-  if(pstSound->bReady != orxFALSE)
-  {
-    /* Updates position */
-    ma_sound_set_position(&(pstSound->stSound), sstSoundSystem.fDimensionRatio * pstTaskParam->vPosition.fX, sstSoundSystem.fDimensionRatio * pstTaskParam->vPosition.fY, sstSoundSystem.fDimensionRatio * pstTaskParam->vPosition.fZ);
-
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
-  }
-
-  /* Updates task param */
-  orxMEMORY_BARRIER();
-  pstTaskParam->pstSound = orxNULL;
-
-  /* Done! */
-  return eResult;
-}
-
-static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetSpatializationTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_TASK_PARAM  *pstTaskParam;
-  orxSOUNDSYSTEM_SOUND       *pstSound;
-  orxSTATUS                   eResult = orxSTATUS_FAILURE;
-
-  /* Gets task param */
-  pstTaskParam = (orxSOUNDSYSTEM_TASK_PARAM *)_pContext;
-
-  /* Gets sound */
-  pstSound = pstTaskParam->pstSound;
-
-  /* Ready? */
-  if(pstSound->bReady != orxFALSE)
-  {
-    /* Enable? */
-    if((pstTaskParam->stSpatialization.fMinDistance >= orxFLOAT_0) && (pstTaskParam->stSpatialization.fMaxDistance > pstTaskParam->stSpatialization.fMinDistance))
-    {
-      /* Updates status */
-      ma_sound_set_spatialization_enabled(&(pstSound->stSound), orxTRUE);
-      ma_sound_set_attenuation_model(&(pstSound->stSound), ma_attenuation_model_linear);
-
-      /* Updates properties */
-      ma_sound_set_min_distance(&(pstSound->stSound), sstSoundSystem.fDimensionRatio * pstTaskParam->stSpatialization.fMinDistance);
-      ma_sound_set_max_distance(&(pstSound->stSound), sstSoundSystem.fDimensionRatio * pstTaskParam->stSpatialization.fMaxDistance);
-      ma_sound_set_min_gain(&(pstSound->stSound), pstTaskParam->stSpatialization.fMinGain);
-      ma_sound_set_max_gain(&(pstSound->stSound), pstTaskParam->stSpatialization.fMaxGain);
-      ma_sound_set_rolloff(&(pstSound->stSound), pstTaskParam->stSpatialization.fRollOff);
-    }
-    else
-    {
-      /* Updates status */
-      ma_sound_set_spatialization_enabled(&(pstSound->stSound), orxFALSE);
-    }
-
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
-  }
-
-  /* Updates task param */
-  orxMEMORY_BARRIER();
-  pstTaskParam->pstSound = orxNULL;
-
-  /* Done! */
-  return eResult;
-}
-
-static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetPanningTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_TASK_PARAM  *pstTaskParam;
-  orxSOUNDSYSTEM_SOUND       *pstSound;
-  orxSTATUS                   eResult = orxSTATUS_FAILURE;
-
-  /* Gets task param */
-  pstTaskParam = (orxSOUNDSYSTEM_TASK_PARAM *)_pContext;
-
-  /* Gets sound */
-  pstSound = pstTaskParam->pstSound;
-
-  /* Ready? */
-  if(pstSound->bReady != orxFALSE)
-  {
-    /* Updates sound */
-    ma_sound_set_pan(&(pstSound->stSound), pstTaskParam->stPanning.fPanning);
-    ma_sound_set_pan_mode(&(pstSound->stSound), (pstTaskParam->stPanning.bMix != orxFALSE) ? ma_pan_mode_pan : ma_pan_mode_balance);
-
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
-  }
-
-  /* Updates task param */
-  orxMEMORY_BARRIER();
-  pstTaskParam->pstSound = orxNULL;
-
-  /* Done! */
-  return eResult;
-}
-
-static orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_LoopTask(void *_pContext)
-{
-  orxSOUNDSYSTEM_TASK_PARAM  *pstTaskParam;
-  orxSOUNDSYSTEM_SOUND       *pstSound;
-  orxSTATUS                   eResult = orxSTATUS_FAILURE;
-
-  /* Gets task param */
-  pstTaskParam = (orxSOUNDSYSTEM_TASK_PARAM *)_pContext;
-
-  /* Gets sound */
-  pstSound = pstTaskParam->pstSound;
-
-  /* Ready? */
-  if(pstSound->bReady != orxFALSE)
-  {
-    /* Updates sound's status */
-    ma_sound_set_looping(&(pstSound->stSound), (pstTaskParam->bLoop != orxFALSE) ? MA_TRUE : MA_FALSE);
-
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
-  }
-
-  /* Updates task param */
-  orxMEMORY_BARRIER();
-  pstTaskParam->pstSound = orxNULL;
-
-  /* Done! */
-  return eResult;
-}
-
 orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_Init()
 {
   orxSTATUS eResult = orxSTATUS_FAILURE;
@@ -3493,10 +3554,20 @@ void orxFASTCALL orxSoundSystem_MiniAudio_Exit()
   /* Was initialized? */
   if(sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY)
   {
+    /* Flushes pending sound commands */
+    orxSoundSystem_MiniAudio_FlushCommands();
+
     /* Waits for all pending operations */
     while(orxThread_GetTaskCount() != 0)
       ;
 
+    /* Has command batch? */
+    if(sstSoundSystem.pstCommandBatch != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(sstSoundSystem.pstCommandBatch);
+    }
+
     /* Updates status */
     orxFLAG_SET(sstSoundSystem.u32Flags, orxSOUNDSYSTEM_KU32_STATIC_FLAG_EXIT, orxSOUNDSYSTEM_KU32_STATIC_FLAG_NONE);
 
@@ -4174,6 +4245,9 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_Delete(orxSOUNDSYSTEM_SOUND *_pst
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
+  /* Flushes pending sound commands */
+  orxSoundSystem_MiniAudio_FlushCommands();
+
   /* Runs delete task */
   eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_DeleteTask, &orxSoundSystem_MiniAudio_FreeSound, &orxSoundSystem_MiniAudio_FreeSound, _pstSound);
 
@@ -4213,6 +4287,9 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_Play(orxSOUNDSYSTEM_SOUND *_pstSo
   }
   else
   {
+    /* Flushes pending sound commands */
+    orxSoundSystem_MiniAudio_FlushCommands();
+
     /* Runs play task */
     eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_PlayTask, orxNULL, orxNULL, _pstSound);
   }
@@ -4237,6 +4314,9 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_Pause(orxSOUNDSYSTEM_SOUND *_pstS
   }
   else
   {
+    /* Flushes pending sound commands */
+    orxSoundSystem_MiniAudio_FlushCommands();
+
     /* Runs pause task */
     eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_PauseTask, orxNULL, orxNULL, _pstSound);
   }
@@ -4287,6 +4367,9 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_Stop(orxSOUNDSYSTEM_SOUND *_pstSo
   }
   else
   {
+    /* Flushes pending sound commands */
+    orxSoundSystem_MiniAudio_FlushCommands();
+
     /* Runs stop task */
     eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_StopTask, orxNULL, orxNULL, _pstSound);
   }
@@ -4324,6 +4407,9 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_AddFilter(orxSOUNDSYSTEM_SOUND *_
     pstFilter->pstSound         = _pstSound;
     orxMemory_Copy(&(pstFilter->stData), _pstFilterData, sizeof(orxSOUND_FILTER_DATA));
 
+    /* Flushes pending sound commands */
+    orxSoundSystem_MiniAudio_FlushCommands();
+
     /* Runs add filter task */
     eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_AddFilterTask, orxNULL, orxNULL, pstTaskParam);
   }
@@ -4351,6 +4437,9 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_RemoveLastFilter(orxSOUNDSYSTEM_S
     }
   }
 
+  /* Flushes pending sound commands */
+  orxSoundSystem_MiniAudio_FlushCommands();
+
   /* Runs remove last filter task */
   eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_RemoveLastFilterTask, orxNULL, orxNULL, _pstSound);
 
@@ -4384,6 +4473,9 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_RemoveAllFilters(orxSOUNDSYSTEM_S
       }
     }
 
+    /* Flushes pending sound commands */
+    orxSoundSystem_MiniAudio_FlushCommands();
+
     /* Runs remove all filters task */
     eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_RemoveAllFiltersTask, orxNULL, orxNULL, _pstSound);
   }
@@ -4534,6 +4626,9 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetBus(orxSOUNDSYSTEM_SOUND *_pst
       pstTaskParam          = orxSoundSystem_MiniAudio_GetTaskParam(_pstSound);
       pstTaskParam->pstBus  = (orxSOUNDSYSTEM_BUS *)_hBus;
 
+      /* Flushes pending sound commands */
+      orxSoundSystem_MiniAudio_FlushCommands();
+
       /* Runs set bus task */
       eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_SetBusTask, orxNULL, orxNULL, pstTaskParam);
     }
@@ -5014,22 +5109,31 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetVolume(orxSOUNDSYSTEM_SOUND *_
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Ready? */
-  if(_pstSound->bReady != orxFALSE)
+  /* Ready without any pending command? */
+  if((_pstSound->bReady != orxFALSE) && (_pstSound->u32CommandCount == 0))
   {
     /* Sets volume */
     ma_sound_set_volume(&(_pstSound->stSound), orxCLAMP(_fVolume, orxFLOAT_0, orxFLOAT_1));
   }
   else
   {
-    orxSOUNDSYSTEM_TASK_PARAM *pstTaskParam;
+    orxSOUNDSYSTEM_COMMAND *pstCommand;
 
-    /* Prepares task parameter */
-    pstTaskParam          = orxSoundSystem_MiniAudio_GetTaskParam(_pstSound);
-    pstTaskParam->fVolume = orxCLAMP(_fVolume, orxFLOAT_0, orxFLOAT_1);
+    /* Gets pending command */
+    pstCommand = orxSoundSystem_MiniAudio_GetCommand(_pstSound);
 
-    /* Runs set volume task */
-    eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_SetVolumeTask, orxNULL, orxNULL, pstTaskParam);
+    /* Valid? */
+    if(pstCommand != orxNULL)
+    {
+      /* Stores volume */
+      pstCommand->fVolume = orxCLAMP(_fVolume, orxFLOAT_0, orxFLOAT_1);
+      orxFLAG_SET(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_VOLUME, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
   }
 
   /* Done! */
@@ -5044,22 +5148,31 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetPitch(orxSOUNDSYSTEM_SOUND *_p
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Ready? */
-  if(_pstSound->bReady != orxFALSE)
+  /* Ready without any pending command? */
+  if((_pstSound->bReady != orxFALSE) && (_pstSound->u32CommandCount == 0))
   {
     /* Sets pitch */
     ma_sound_set_pitch(&(_pstSound->stSound), _fPitch);
   }
   else
   {
-    orxSOUNDSYSTEM_TASK_PARAM *pstTaskParam;
+    orxSOUNDSYSTEM_COMMAND *pstCommand;
 
-    /* Prepares task parameter */
-    pstTaskParam          = orxSoundSystem_MiniAudio_GetTaskParam(_pstSound);
-    pstTaskParam->fPitch  = _fPitch;
+    /* Gets pending command */
+    pstCommand = orxSoundSystem_MiniAudio_GetCommand(_pstSound);
 
-    /* Runs set pitch task */
-    eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_SetPitchTask, orxNULL, orxNULL, pstTaskParam);
+    /* Valid? */
+    if(pstCommand != orxNULL)
+    {
+      /* Stores pitch */
+      pstCommand->fPitch  = _fPitch;
+      orxFLAG_SET(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_PITCH, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
   }
 
   /* Done! */
@@ -5100,6 +5213,9 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetTime(orxSOUNDSYSTEM_SOUND *_ps
     pstTaskParam        = orxSoundSystem_MiniAudio_GetTaskParam(_pstSound);
     pstTaskParam->fTime = _fTime;
 
+    /* Flushes pending sound commands */
+    orxSoundSystem_MiniAudio_FlushCommands();
+
     /* Runs set time task */
     eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_SetTimeTask, orxNULL, orxNULL, pstTaskParam);
   }
@@ -5117,22 +5233,31 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetPosition(orxSOUNDSYSTEM_SOUND
   orxASSERT(_pstSound != orxNULL);
   orxASSERT(_pvPosition != orxNULL);
 
-  /* Ready? */
-  if(_pstSound->bReady != orxFALSE)
+  /* Ready without any pending command? */
+  if((_pstSound->bReady != orxFALSE) && (_pstSound->u32CommandCount == 0))
   {
     /* Updates position */
     ma_sound_set_position(&(_pstSound->stSound), sstSoundSystem.fDimensionRatio * _pvPosition->fX, sstSoundSystem.fDimensionRatio * _pvPosition->fY, sstSoundSystem.fDimensionRatio * _pvPosition->fZ);
   }
   else
   {
-    orxSOUNDSYSTEM_TASK_PARAM *pstTaskParam;
+    orxSOUNDSYSTEM_COMMAND *pstCommand;
 
-    /* Prepares task parameter */
-    pstTaskParam = orxSoundSystem_MiniAudio_GetTaskParam(_pstSound);
-    orxVector_Copy(&(pstTaskParam->vPosition), _pvPosition);
+    /* Gets pending command */
+    pstCommand = orxSoundSystem_MiniAudio_GetCommand(_pstSound);
 
-    /* Runs set position task */
-    eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_SetPositionTask, orxNULL, orxNULL, pstTaskParam);
+    /* Valid? */
+    if(pstCommand != orxNULL)
+    {
+      /* Stores position */
+      orxVector_Copy(&(pstCommand->vPosition), _pvPosition);
+      orxFLAG_SET(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_POSITION, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
   }
 
   /* Done! */
@@ -5155,8 +5280,8 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetSpatialization(orxSOUNDSYSTEM_
   /* Is spatialization enabled? */
   if(sstSoundSystem.u32ListenerCount > 0)
   {
-    /* Ready? */
-    if(_pstSound->bReady != orxFALSE)
+    /* Ready without any pending command? */
+    if((_pstSound->bReady != orxFALSE) && (_pstSound->u32CommandCount == 0))
     {
       /* Enable? */
       if((_fMinDistance >= orxFLOAT_0) && (_fMaxDistance > _fMinDistance))
@@ -5183,18 +5308,30 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetSpatialization(orxSOUNDSYSTEM_
     }
     else
     {
-      orxSOUNDSYSTEM_TASK_PARAM *pstTaskParam;
+      orxSOUNDSYSTEM_COMMAND *pstCommand;
 
-      /* Prepares task parameter */
-      pstTaskParam                                = orxSoundSystem_MiniAudio_GetTaskParam(_pstSound);
-      pstTaskParam->stSpatialization.fMinDistance = _fMinDistance;
-      pstTaskParam->stSpatialization.fMaxDistance = _fMaxDistance;
-      pstTaskParam->stSpatialization.fMinGain     = _fMinGain;
-      pstTaskParam->stSpatialization.fMaxGain     = _fMaxGain;
-      pstTaskParam->stSpatialization.fRollOff     = _fRollOff;
-
-      /* Runs set spatialization task */
-      eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_SetSpatializationTask, orxNULL, orxNULL, pstTaskParam);
+      /* Gets pending command */
+      pstCommand = orxSoundSystem_MiniAudio_GetCommand(_pstSound);
+
+      /* Valid? */
+      if(pstCommand != orxNULL)
+      {
+        /* Stores spatialization */
+        pstCommand->stSpatialization.fMinDistance = _fMinDistance;
+        pstCommand->stSpatialization.fMaxDistance = _fMaxDistance;
+        pstCommand->stSpatialization.fMinGain     = _fMinGain;
+        pstCommand->stSpatialization.fMaxGain     = _fMaxGain;
+        pstCommand->stSpatialization.fRollOff     = _fRollOff;
+        orxFLAG_SET(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_SPATIALIZATION, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_NONE);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
     }
   }
   else
@@ -5215,8 +5352,8 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetPanning(orxSOUNDSYSTEM_SOUND *
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Ready? */
-  if(_pstSound->bReady != orxFALSE)
+  /* Ready without any pending command? */
+  if((_pstSound->bReady != orxFALSE) && (_pstSound->u32CommandCount == 0))
   {
     /* Updates sound */
     ma_sound_set_pan(&(_pstSound->stSound), _fPanning);
@@ -5224,15 +5361,24 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_SetPanning(orxSOUNDSYSTEM_SOUND *
   }
   else
   {
-    orxSOUNDSYSTEM_TASK_PARAM *pstTaskParam;
+    orxSOUNDSYSTEM_COMMAND *pstCommand;
 
-    /* Prepares task parameter */
-    pstTaskParam                      = orxSoundSystem_MiniAudio_GetTaskParam(_pstSound);
-    pstTaskParam->stPanning.fPanning  = _fPanning;
-    pstTaskParam->stPanning.bMix      = _bMix;
+    /* Gets pending command */
+    pstCommand = orxSoundSystem_MiniAudio_GetCommand(_pstSound);
 
-    /* Runs set panning task */
-    eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_SetPanningTask, orxNULL, orxNULL, pstTaskParam);
+    /* Valid? */
+    if(pstCommand != orxNULL)
+    {
+      /* Stores panning */
+      pstCommand->stPanning.fPanning  = _fPanning;
+      pstCommand->stPanning.bMix      = _bMix;
+      orxFLAG_SET(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_PANNING, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
   }
 
   /* Done! */
@@ -5247,22 +5393,31 @@ orxSTATUS orxFASTCALL orxSoundSystem_MiniAudio_Loop(orxSOUNDSYSTEM_SOUND *_pstSo
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSound != orxNULL);
 
-  /* Ready? */
-  if(_pstSound->bReady != orxFALSE)
+  /* Ready without any pending command? */
+  if((_pstSound->bReady != orxFALSE) && (_pstSound->u32CommandCount == 0))
   {
     /* Updates sound's status */
     ma_sound_set_looping(&(_pstSound->stSound), (_bLoop != orxFALSE) ? MA_TRUE : MA_FALSE);
   }
   else
   {
-    orxSOUNDSYSTEM_TASK_PARAM *pstTaskParam;
+    orxSOUNDSYSTEM_COMMAND *pstCommand;
 
-    /* Prepares task parameter */
-    pstTaskParam        = orxSoundSystem_MiniAudio_GetTaskParam(_pstSound);
-    pstTaskParam->bLoop =_bLoop;
+    /* Gets pending command */
+    pstCommand = orxSoundSystem_MiniAudio_GetCommand(_pstSound);
 
-    /* Runs loop task */
-    eResult = orxThread_RunTaskLinear(&orxSoundSystem_MiniAudio_LoopTask, orxNULL, orxNULL, pstTaskParam);
+    /* Valid? */
+    if(pstCommand != orxNULL)
+    {
+      /* Stores loop status */
+      pstCommand->bLoop   = _bLoop;
+      orxFLAG_SET(pstCommand->u32Flags, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_LOOP, orxSOUNDSYSTEM_KU32_COMMAND_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
   }
 
   /* Done! */
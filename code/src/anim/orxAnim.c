@@ -119,9 +119,10 @@ static orxANIM_STATIC sstAnim;
 /** Finds a key index given a timestamp
  * @param[in]   _pstAnim        Concerned animation
  * @param[in]   _fTimeStamp     Desired timestamp
+ * @param[in]   _u32HintIndex   Index of the previously found key, orxU32_UNDEFINED for none
  * @return      Key index / orxU32_UNDEFINED
  */
-static orxINLINE orxU32 orxAnim_FindKeyIndex(const orxANIM *_pstAnim, orxFLOAT _fTimeStamp)
+static orxINLINE orxU32 orxAnim_FindKeyIndex(const orxANIM *_pstAnim, orxFLOAT _fTimeStamp, orxU32 _u32HintIndex)
 {
   orxU32 u32Count, u32Index;
 
@@ -131,8 +132,25 @@ static orxINLINE orxU32 orxAnim_FindKeyIndex(const orxANIM *_pstAnim, orxFLOAT _
   /* Gets count */
   u32Count = orxAnim_GetKeyCount(_pstAnim);
 
+  /* Is hint still the current key? */
+  if((_u32HintIndex < u32Count)
+  && (_fTimeStamp <= _pstAnim->astKeyList[_u32HintIndex].fTimeStamp)
+  && ((_u32HintIndex == 0) || (_fTimeStamp > _pstAnim->astKeyList[_u32HintIndex - 1].fTimeStamp)))
+  {
+    /* Updates result */
+    u32Index = _u32HintIndex;
+  }
+  /* Is it the next one? */
+  else if((u32Count != 0)
+       && (_u32HintIndex < u32Count - 1)
+       && (_fTimeStamp <= _pstAnim->astKeyList[_u32HintIndex + 1].fTimeStamp)
+       && (_fTimeStamp > _pstAnim->astKeyList[_u32HintIndex].fTimeStamp))
+  {
+    /* Updates result */
+    u32Index = _u32HintIndex + 1;
+  }
   /* Is animation not empty? */
-  if(u32Count != 0)
+  else if(u32Count != 0)
   {
     orxU32 u32MaxIndex, u32MinIndex;
 
@@ -1056,17 +1074,18 @@ const orxANIM_CUSTOM_EVENT *orxFASTCALL orxAnim_GetNextEvent(const orxANIM *_pst
     /* Has valid event? */
     if(_pstEvent != orxNULL)
     {
-      orxU32 i = 0;
+      orxU32 u32Index;
 
-      /* Finds event */
-      for(i = 0; (i < u32Count - 1) && (&(_pstAnim->astEventList[i]) != _pstEvent); i++)
-        ;
+      /* Gets its index */
+      u32Index = (orxU32)(((orxUPTR)_pstEvent - (orxUPTR)_pstAnim->astEventList) / sizeof(orxANIM_CUSTOM_EVENT));
 
-      /* Valid? */
-      if(i < u32Count - 1)
+      /* Valid and not last? */
+      if(((orxUPTR)_pstEvent >= (orxUPTR)_pstAnim->astEventList)
+      && (u32Index < u32Count - 1)
+      && (&(_pstAnim->astEventList[u32Index]) == _pstEvent))
       {
         /* Updates result */
-        pstResult = &(_pstAnim->astEventList[i + 1]);
+        pstResult = &(_pstAnim->astEventList[u32Index + 1]);
       }
     }
     else
@@ -1095,29 +1114,29 @@ const orxANIM_CUSTOM_EVENT *orxFASTCALL orxAnim_GetEventAfter(const orxANIM *_ps
   orxSTRUCTURE_ASSERT(_pstAnim);
 
   /* Has events and request is in range? */
-  if((u32Count = orxAnim_GetEventCount(_pstAnim)) > 0)
+  if(((u32Count = orxAnim_GetEventCount(_pstAnim)) > 0)
+  && (_pstAnim->astEventList[u32Count - 1].fTimeStamp > _fTimeStamp))
   {
-    orxU32 i;
+    orxU32 u32MaxIndex, u32MinIndex, u32Index;
 
-    /* For all events */
-    for(i = 0; i < u32Count; i++)
+    /* Dichotomic search for the first event strictly after time stamp (events are sorted) */
+    for(u32MinIndex = 0, u32MaxIndex = u32Count - 1, u32Index = u32MaxIndex >> 1;
+        u32MinIndex < u32MaxIndex;
+        u32Index = (u32MinIndex + u32MaxIndex) >> 1)
     {
-      orxANIM_CUSTOM_EVENT *pstEvent;
-
-      /* Gets it */
-      pstEvent = &_pstAnim->astEventList[i];
-
-      /* In range? */
-      if(pstEvent->fTimeStamp > _fTimeStamp)
+      /* Updates search range */
+      if(_fTimeStamp >= _pstAnim->astEventList[u32Index].fTimeStamp)
       {
-        /* No selection or better one? */
-        if((pstResult == orxNULL) || (pstEvent->fTimeStamp < pstResult->fTimeStamp))
-        {
-          /* Selects it */
-          pstResult = pstEvent;
-        }
+        u32MinIndex = u32Index + 1;
+      }
+      else
+      {
+        u32MaxIndex = u32Index;
       }
     }
+
+    /* Updates result */
+    pstResult = &(_pstAnim->astEventList[u32Index]);
   }
 
   /* Done! */
@@ -1139,7 +1158,29 @@ orxU32 orxFASTCALL orxAnim_GetKey(const orxANIM *_pstAnim, orxFLOAT _fTimeStamp)
   orxASSERT(orxStructure_TestFlags(_pstAnim, orxANIM_KU32_FLAG_2D) != orxFALSE);
 
   /* Updates result */
-  u32Result = orxAnim_FindKeyIndex(_pstAnim, _fTimeStamp);
+  u32Result = orxAnim_FindKeyIndex(_pstAnim, _fTimeStamp, orxU32_UNDEFINED);
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets animation's key index from a time stamp, starting from a previously found key
+ * @param[in]   _pstAnim        Concerned animation
+ * @param[in]   _fTimeStamp     TimeStamp of the desired animation key
+ * @param[in]   _u32HintIndex   Index of the previously found key (checked first, along with the following one), orxU32_UNDEFINED for none
+ * @return      Animation key index / orxU32_UNDEFINED
+ */
+orxU32 orxFASTCALL orxAnim_GetKeyFromHint(const orxANIM *_pstAnim, orxFLOAT _fTimeStamp, orxU32 _u32HintIndex)
+{
+  orxU32    u32Result;
+
+  /* Checks */
+  orxASSERT(sstAnim.u32Flags & orxANIM_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstAnim);
+  orxASSERT(orxStructure_TestFlags(_pstAnim, orxANIM_KU32_FLAG_2D) != orxFALSE);
+
+  /* Updates result */
+  u32Result = orxAnim_FindKeyIndex(_pstAnim, _fTimeStamp, _u32HintIndex);
 
   /* Done! */
   return u32Result;
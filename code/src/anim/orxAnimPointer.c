@@ -420,8 +420,8 @@ static orxINLINE orxSTATUS orxAnimPointer_Compute(orxANIMPOINTER *_pstAnimPointe
         /* Gets current anim */
         pstAnim = orxAnimSet_GetAnim(_pstAnimPointer->pstAnimSet, _pstAnimPointer->u32CurrentAnim);
 
-        /* Gets current key */
-        u32CurrentKey = orxAnim_GetKey(pstAnim, _pstAnimPointer->fCurrentAnimTime);
+        /* Gets current key, starting from the previous one */
+        u32CurrentKey = orxAnim_GetKeyFromHint(pstAnim, _pstAnimPointer->fCurrentAnimTime, _pstAnimPointer->u32CurrentKey);
 
         /* Keeps current time for comparison */
         fTimeCompare = _pstAnimPointer->fCurrentAnimTime;
@@ -50,6 +50,16 @@
   #include <windows.h>
   #undef NO_WIN32_LEAN_AND_MEAN
 
+  #if defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0600)
+
+    #define orxCLOCK_HIGH_RESOLUTION_TIMER
+
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+      #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+    #endif /* !CREATE_WAITABLE_TIMER_HIGH_RESOLUTION */
+
+  #endif /* _WIN32_WINNT >= 0x0600 */
+
 #endif /* __orxWINDOWS__ */
 
 
@@ -60,6 +70,7 @@
 #define orxCLOCK_KU32_STATIC_FLAG_READY         0x00000001  /**< Ready flag */
 
 #define orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK   0x10000000  /**< Lock update flag */
+#define orxCLOCK_KU32_STATIC_FLAG_PACED         0x20000000  /**< Paced update flag */
 
 #define orxCLOCK_KU32_STATIC_MASK_ALL           0xFFFFFFFF  /**< All mask */
 
@@ -95,8 +106,10 @@
 
 #define orxCLOCK_KU32_BANK_SIZE                 8           /**< Bank size */
 
-#define orxCLOCK_KF_DELAY_THRESHOLD             orx2F(0.005f)
-#define orxCLOCK_KF_DELAY                       orx2F(0.001f)
+#define orxCLOCK_KD_SPIN_THRESHOLD_MIN          orx2D(0.0002)
+#define orxCLOCK_KD_SPIN_THRESHOLD_MAX          orx2D(0.004)
+#define orxCLOCK_KD_SPIN_THRESHOLD_DEFAULT      orx2D(0.001)
+#define orxCLOCK_KD_SLEEP_CALIBRATION_RATE      orx2D(0.0625)
 #define orxCLOCK_KF_DEFAULT_MODIFIER_FIXED      (-orxFLOAT_1)
 #define orxCLOCK_KF_DEFAULT_MODIFIER_MULTIPLY   orxFLOAT_0
 #define orxCLOCK_KF_DEFAULT_MODIFIER_MAXED      orx2F(0.1f)
@@ -156,8 +169,18 @@ typedef struct __orxCLOCK_STATIC_t
   orxDOUBLE         dNextTime;                  /**< Next time */
   orxHASHTABLE     *pstReferenceTable;          /**< Table to avoid clock duplication when creating through config file */
   orxFLOAT          fDisplayTickSize;           /**< Display tick size */
+  orxDOUBLE         dSpinThreshold;             /**< Calibrated spin threshold (final part of the wait that isn't slept) */
+  orxDOUBLE         dOverSleepMean;             /**< Over sleep mean */
+  orxDOUBLE         dOverSleepVariance;         /**< Over sleep variance */
+  orxDOUBLE         dCumulatedJitter;           /**< Cumulated jitter */
+  orxCLOCK_PACING_INFO stPacingInfo;            /**< Pacing info */
+  orxU32            u32ConfigRevision;          /**< Config revision of the cached values */
   orxU32            u32Flags;                   /**< Control flags */
 
+#ifdef orxCLOCK_HIGH_RESOLUTION_TIMER
+  HANDLE            hTimer;                     /**< High resolution waitable timer */
+#endif /* orxCLOCK_HIGH_RESOLUTION_TIMER */
+
 } orxCLOCK_STATIC;
 
 
@@ -174,6 +197,89 @@ static orxCLOCK_STATIC sstClock;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Sleeps for the given delay, using a high resolution timer when available
+ * @param[in]   _dDelay                       Delay, in seconds
+ */
+static orxINLINE void orxClock_Sleep(orxDOUBLE _dDelay)
+{
+#ifdef __orxWINDOWS__
+
+#ifdef orxCLOCK_HIGH_RESOLUTION_TIMER
+
+  /* Has high resolution timer? */
+  if(sstClock.hTimer != NULL)
+  {
+    LARGE_INTEGER stDueTime;
+
+    /* Sets relative due time, in 100ns units */
+    stDueTime.QuadPart = -(LONGLONG)(_dDelay * orx2D(1.0e7));
+
+    /* Waits for it */
+    if(SetWaitableTimer(sstClock.hTimer, &stDueTime, 0, NULL, NULL, FALSE) != FALSE)
+    {
+      WaitForSingleObject(sstClock.hTimer, INFINITE);
+    }
+  }
+  else
+
+#endif /* orxCLOCK_HIGH_RESOLUTION_TIMER */
+
+  {
+    /* Sleeps */
+    timeBeginPeriod(1);
+    orxSystem_Delay((orxFLOAT)_dDelay);
+    timeEndPeriod(1);
+  }
+
+#else /* __orxWINDOWS__ */
+
+  /* Sleeps */
+  orxSystem_Delay((orxFLOAT)_dDelay);
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return;
+}
+
+/** Sleeps until the calibrated spin threshold before the next tick
+ */
+static orxINLINE void orxClock_Pace()
+{
+  orxDOUBLE dTime, dRemaining;
+
+  /* While there's enough time left to sleep */
+  for(dTime = orxSystem_GetTime(), dRemaining = sstClock.dNextTime - dTime;
+      dRemaining > sstClock.dSpinThreshold;
+      dRemaining = sstClock.dNextTime - dTime)
+  {
+    orxDOUBLE dRequest, dSleep, dDelta;
+
+    /* Sleeps for all but the final slice */
+    dRequest = dRemaining - sstClock.dSpinThreshold;
+    orxClock_Sleep(dRequest);
+
+    /* Gets actual sleep time */
+    dSleep  = orxSystem_GetTime() - dTime;
+    dTime  += dSleep;
+
+    /* Updates over sleep running mean & variance */
+    dDelta                    = (dSleep - dRequest) - sstClock.dOverSleepMean;
+    sstClock.dOverSleepMean  += orxCLOCK_KD_SLEEP_CALIBRATION_RATE * dDelta;
+    sstClock.dOverSleepVariance = (orx2D(1.0) - orxCLOCK_KD_SLEEP_CALIBRATION_RATE) * (sstClock.dOverSleepVariance + orxCLOCK_KD_SLEEP_CALIBRATION_RATE * dDelta * dDelta);
+
+    /* Updates spin threshold (mean + 2 standard deviations) */
+    sstClock.dSpinThreshold   = sstClock.dOverSleepMean + orx2D(2.0) * (orxDOUBLE)orxMath_Sqrt((orxFLOAT)sstClock.dOverSleepVariance);
+    sstClock.dSpinThreshold   = orxCLAMP(sstClock.dSpinThreshold, orxCLOCK_KD_SPIN_THRESHOLD_MIN, orxCLOCK_KD_SPIN_THRESHOLD_MAX);
+
+    /* Updates pacing info */
+    sstClock.stPacingInfo.dSleepTime += dSleep;
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Event handler
  * @param[in]   _pstEvent                     Sent event
  * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
@@ -665,6 +771,18 @@ orxSTATUS orxFASTCALL orxClock_Init()
             /* Gets init time */
             sstClock.dTime = orxSystem_GetTime();
 
+            /* Inits pacing */
+            sstClock.dSpinThreshold     = orxCLOCK_KD_SPIN_THRESHOLD_DEFAULT;
+            sstClock.dOverSleepMean     = orxCLOCK_KD_SPIN_THRESHOLD_DEFAULT;
+            sstClock.u32ConfigRevision  = orxU32_UNDEFINED;
+
+#ifdef orxCLOCK_HIGH_RESOLUTION_TIMER
+
+            /* Creates high resolution timer (Windows 10 1803+, falls back to Sleep otherwise) */
+            sstClock.hTimer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+#endif /* orxCLOCK_HIGH_RESOLUTION_TIMER */
+
             /* Inits Flags */
             sstClock.u32Flags = orxCLOCK_KU32_STATIC_FLAG_READY;
 
@@ -812,6 +930,18 @@ void orxFASTCALL orxClock_Exit()
     /* Deletes reference table */
     orxHashTable_Delete(sstClock.pstReferenceTable);
 
+#ifdef orxCLOCK_HIGH_RESOLUTION_TIMER
+
+    /* Has high resolution timer? */
+    if(sstClock.hTimer != NULL)
+    {
+      /* Deletes it */
+      CloseHandle(sstClock.hTimer);
+      sstClock.hTimer = NULL;
+    }
+
+#endif /* orxCLOCK_HIGH_RESOLUTION_TIMER */
+
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_CLOCK);
 
@@ -907,30 +1037,52 @@ orxSTATUS orxFASTCALL orxClock_Update()
   /* Not already locked? */
   if(!(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK))
   {
-    orxDOUBLE dNewTime;
+    orxDOUBLE dNewTime, dWaitTime;
     orxCLOCK *pstClock;
     orxFLOAT  fDT, fDelay;
 
     /* Lock clocks */
     sstClock.u32Flags |= orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK;
 
-    /* Updates allow sleep status */
-    orxConfig_PushSection(orxCLOCK_KZ_CORE);
-    if((orxConfig_HasValue(orxCLOCK_KZ_CONFIG_ALLOW_SLEEP) == orxFALSE)
-    || (orxConfig_GetBool(orxCLOCK_KZ_CONFIG_ALLOW_SLEEP) != orxFALSE))
+    /* Config has changed? */
+    if(orxConfig_GetRevision() != sstClock.u32ConfigRevision)
     {
-      sstClock.u32Flags |= orxCLOCK_KU32_FLAG_ALLOW_SLEEP;
-    }
-    else
-    {
-      sstClock.u32Flags &= ~orxCLOCK_KU32_FLAG_ALLOW_SLEEP;
+      /* Updates allow sleep status */
+      orxConfig_PushSection(orxCLOCK_KZ_CORE);
+      if((orxConfig_HasValue(orxCLOCK_KZ_CONFIG_ALLOW_SLEEP) == orxFALSE)
+      || (orxConfig_GetBool(orxCLOCK_KZ_CONFIG_ALLOW_SLEEP) != orxFALSE))
+      {
+        sstClock.u32Flags |= orxCLOCK_KU32_FLAG_ALLOW_SLEEP;
+      }
+      else
+      {
+        sstClock.u32Flags &= ~orxCLOCK_KU32_FLAG_ALLOW_SLEEP;
+      }
+      orxConfig_PopSection();
+
+      /* Stores config revision */
+      sstClock.u32ConfigRevision = orxConfig_GetRevision();
     }
-    orxConfig_PopSection();
 
-    /* Actively waits until next update */
-    while((dNewTime = orxSystem_GetTime()) < sstClock.dNextTime)
+    /* Actively waits until next update (only the final slice when sleeping is allowed) */
+    for(dWaitTime = dNewTime = orxSystem_GetTime(); dNewTime < sstClock.dNextTime; dNewTime = orxSystem_GetTime())
       ;
 
+    /* Paced update? */
+    if(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_PACED)
+    {
+      orxDOUBLE dJitter;
+
+      /* Gets jitter (including updates that were already late, without any active wait) */
+      dJitter = dNewTime - sstClock.dNextTime;
+
+      /* Updates pacing info */
+      sstClock.stPacingInfo.dSpinTime  += dNewTime - dWaitTime;
+      sstClock.dCumulatedJitter        += dJitter;
+      sstClock.stPacingInfo.dMaxJitter  = orxMAX(sstClock.stPacingInfo.dMaxJitter, dJitter);
+      sstClock.stPacingInfo.u32FrameCount++;
+    }
+
     /* Computes natural DT */
     fDT = (orxFLOAT)(dNewTime - sstClock.dTime);
 
@@ -1071,21 +1223,21 @@ orxSTATUS orxFASTCALL orxClock_Update()
     /* Sets next tick time */
     sstClock.dNextTime = sstClock.dTime + (orxDOUBLE)fDelay;
 
+    /* Updates paced status */
+    if(fDelay > orxFLOAT_0)
+    {
+      sstClock.u32Flags |= orxCLOCK_KU32_STATIC_FLAG_PACED;
+    }
+    else
+    {
+      sstClock.u32Flags &= ~orxCLOCK_KU32_STATIC_FLAG_PACED;
+    }
+
     /* Can sleep? */
     if(sstClock.u32Flags & orxCLOCK_KU32_FLAG_ALLOW_SLEEP)
     {
-      /* Should delay? */
-      while(orx2F(sstClock.dNextTime - orxSystem_GetTime()) > orxCLOCK_KF_DELAY_THRESHOLD)
-      {
-        /* Sleeps */
-#ifdef __orxWINDOWS__
-      timeBeginPeriod(1);
-#endif /* __orxWINDOWS__ */
-        orxSystem_Delay(orxCLOCK_KF_DELAY);
-#ifdef __orxWINDOWS__
-      timeEndPeriod(1);
-#endif /* __orxWINDOWS__ */
-      }
+      /* Sleeps until the final slice */
+      orxClock_Pace();
     }
   }
 
@@ -1988,3 +2140,37 @@ orxSTATUS orxFASTCALL orxClock_RemoveGlobalTimer(const orxCLOCK_FUNCTION _pfnCal
   /* Done! */
   return eResult;
 }
+
+/** Gets frame pacing info (sleep & active wait times, wake up jitter), accumulated since the last reset
+ * @param[out]  _pstPacingInfo                        Pacing info to fill
+ * @return      orxCLOCK_PACING_INFO
+ */
+orxCLOCK_PACING_INFO *orxFASTCALL orxClock_GetPacingInfo(orxCLOCK_PACING_INFO *_pstPacingInfo)
+{
+  /* Checks */
+  orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstPacingInfo != orxNULL);
+
+  /* Updates result */
+  orxMemory_Copy(_pstPacingInfo, &(sstClock.stPacingInfo), sizeof(orxCLOCK_PACING_INFO));
+  _pstPacingInfo->dMeanJitter     = (sstClock.stPacingInfo.u32FrameCount != 0) ? sstClock.dCumulatedJitter / (orxDOUBLE)sstClock.stPacingInfo.u32FrameCount : orxDOUBLE_0;
+  _pstPacingInfo->dSpinThreshold  = sstClock.dSpinThreshold;
+
+  /* Done! */
+  return _pstPacingInfo;
+}
+
+/** Resets frame pacing info
+ */
+void orxFASTCALL orxClock_ResetPacingInfo()
+{
+  /* Checks */
+  orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
+
+  /* Resets it */
+  orxMemory_Zero(&(sstClock.stPacingInfo), sizeof(orxCLOCK_PACING_INFO));
+  sstClock.dCumulatedJitter = orxDOUBLE_0;
+
+  /* Done! */
+  return;
+}
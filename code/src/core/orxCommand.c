@@ -61,6 +61,7 @@
 #define orxCOMMAND_KU32_STATIC_FLAG_NONE              0x00000000                      /**< No flags */
 
 #define orxCOMMAND_KU32_STATIC_FLAG_READY             0x00000001                      /**< Ready flag */
+#define orxCOMMAND_KU32_STATIC_FLAG_CLEAR_CACHE       0x00000002                      /**< Clear cache flag */
 
 #define orxCOMMAND_KU32_STATIC_MASK_ALL               0xFFFFFFFF                      /**< All mask */
 
@@ -80,6 +81,15 @@
 #define orxCOMMAND_KU32_STRING_BUFFER_SIZE            65536
 #define orxCOMMAND_KU32_PROTOTYPE_BUFFER_SIZE         512
 
+#define orxCOMMAND_KU32_COMPILED_CACHE_SIZE           1024
+#define orxCOMMAND_KU32_COMPILED_STEP_NUMBER          16
+#define orxCOMMAND_KU32_COMPILED_ARG_NUMBER           64
+#define orxCOMMAND_KU32_COMPILED_BUFFER_SIZE          1024
+
+#define orxCOMMAND_KU8_ARG_SOURCE_LITERAL             0
+#define orxCOMMAND_KU8_ARG_SOURCE_GUID                1
+#define orxCOMMAND_KU8_ARG_SOURCE_POP                 2
+
 #define orxCOMMAND_KC_CONFIG_SECTION_SEPARATOR        '.'
 #define orxCOMMAND_KC_CONFIG_INHERITANCE_MARKER       '@'
 
@@ -147,6 +157,29 @@ typedef struct __orxCOMMAND_TRIE_NODE_t
 
 } orxCOMMAND_TRIE_NODE;
 
+/** Compiled command step
+ */
+typedef struct __orxCOMMAND_COMPILED_STEP_t
+{
+  const orxCOMMAND         *pstCommand;                                               /**< Command : 4 */
+  orxU32                    u32ArgIndex;                                              /**< First argument index : 8 */
+  orxU32                    u32ArgNumber;                                             /**< Argument number : 12 */
+  orxU32                    u32PushCount;                                             /**< Push count : 16 */
+  orxU32                    u32Offset;                                                /**< Offset in command line : 20 */
+
+} orxCOMMAND_COMPILED_STEP;
+
+/** Compiled command line
+ */
+typedef struct __orxCOMMAND_COMPILED_t
+{
+  orxCOMMAND_VAR           *astArgList;                                               /**< Pre-parsed arguments : 4 */
+  orxU8                    *au8SourceList;                                            /**< Argument sources (literal / placeholders) : 8 */
+  orxU32                    u32StepNumber;                                            /**< Step number : 12 */
+  orxCOMMAND_COMPILED_STEP  astStepList[1];                                           /**< Steps : 32 */
+
+} orxCOMMAND_COMPILED;
+
 /** Static structure
  */
 typedef struct __orxCOMMAND_STATIC_t
@@ -155,6 +188,8 @@ typedef struct __orxCOMMAND_STATIC_t
   orxBANK                  *pstTrieBank;                                              /**< Command trie bank */
   orxTREE                   stCommandTrie;                                            /**< Command trie */
   orxBANK                  *pstResultBank;                                            /**< Command result bank */
+  orxHASHTABLE             *pstCompiledTable;                                         /**< Compiled command table */
+  orxU32                    u32CompiledRunCount;                                      /**< Compiled command run count */
   orxCHAR                   acEvaluateBuffer[orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE];   /**< Evaluate buffer */
   orxCHAR                   acProcessBuffer[orxCOMMAND_KU32_PROCESS_BUFFER_SIZE];     /**< Process buffer */
   orxCHAR                   acPrototypeBuffer[orxCOMMAND_KU32_PROTOTYPE_BUFFER_SIZE]; /**< Prototype buffer */
@@ -382,10 +417,56 @@ static orxINLINE orxCOMMAND *orxCommand_FindNoAlias(const orxSTRING _zCommand)
   return pstResult;
 }
 
+/** Clears compiled command cache (deferred if compiled commands are running)
+ */
+static void orxFASTCALL orxCommand_ClearCache()
+{
+  /* Has cache? */
+  if(sstCommand.pstCompiledTable != orxNULL)
+  {
+    /* No compiled command running? */
+    if(sstCommand.u32CompiledRunCount == 0)
+    {
+      orxHANDLE hIterator;
+      void     *pData;
+
+      /* For all compiled commands */
+      for(hIterator = orxHashTable_GetNext(sstCommand.pstCompiledTable, orxHANDLE_UNDEFINED, orxNULL, &pData);
+          hIterator != orxHANDLE_UNDEFINED;
+          hIterator = orxHashTable_GetNext(sstCommand.pstCompiledTable, hIterator, orxNULL, &pData))
+      {
+        /* Not a rejected command line? */
+        if(pData != orxHANDLE_UNDEFINED)
+        {
+          /* Deletes it */
+          orxMemory_Free(pData);
+        }
+      }
+
+      /* Clears table */
+      orxHashTable_Clear(sstCommand.pstCompiledTable);
+
+      /* Updates status */
+      orxFLAG_SET(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_NONE, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_CACHE);
+    }
+    else
+    {
+      /* Defers it */
+      orxFLAG_SET(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_CACHE, orxCOMMAND_KU32_STATIC_FLAG_NONE);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 static orxINLINE void orxCommand_InsertInTrie(orxCOMMAND *_pstCommand)
 {
   orxCOMMAND_TRIE_NODE *pstNode;
 
+  /* Clears cache */
+  orxCommand_ClearCache();
+
   /* Gets command trie node */
   pstNode = orxCommand_FindTrieNode(orxString_GetFromID(_pstCommand->stNameID), orxTRUE);
 
@@ -404,6 +485,9 @@ static orxINLINE void orxCommand_RemoveFromTrie(orxCOMMAND *_pstCommand)
 {
   orxCOMMAND_TRIE_NODE *pstNode;
 
+  /* Clears cache */
+  orxCommand_ClearCache();
+
   /* Finds command trie node */
   pstNode = orxCommand_FindTrieNode(orxString_GetFromID(_pstCommand->stNameID), orxFALSE);
 
@@ -572,6 +656,342 @@ static orxSTATUS orxFASTCALL orxCommand_PopValue(orxSTRING *_pzDestination, orxU
   return eResult;
 }
 
+/** Pushes a command result on the stack
+ * @param[in]   _pstResult                    Result to push
+ * @param[in]   _u32PushCount                 Number of times it should be pushed
+ */
+static void orxFASTCALL orxCommand_PushResult(const orxCOMMAND_VAR *_pstResult, orxU32 _u32PushCount)
+{
+  /* For all requested pushes */
+  while(_u32PushCount > 0)
+  {
+    orxCOMMAND_STACK_ENTRY *pstEntry;
+
+    /* Allocates stack entry */
+    pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
+
+    /* Checks */
+    orxASSERT(pstEntry != orxNULL);
+
+    /* Is a string or numeric value? */
+    if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
+    || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+    {
+      /* Checks */
+      orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
+
+      /* Duplicates it */
+      pstEntry->stValue.eType   = _pstResult->eType;
+      pstEntry->stValue.zValue  = pstEntry->acBuffer;
+      orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, sizeof(pstEntry->acBuffer) - 1);
+      pstEntry->acBuffer[sizeof(pstEntry->acBuffer) - 1] = orxCHAR_NULL;
+    }
+    else
+    {
+      /* Stores value */
+      orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
+    }
+
+    /* Updates push count */
+    _u32PushCount--;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Parses a command argument
+ * @param[in]   _eType                        Argument type
+ * @param[in,out] _ppcSrc                     Argument start (non white space), updated to its end
+ * @param[out]  _pstArg                       Parsed argument
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxCommand_ParseArg(orxCOMMAND_VAR_TYPE _eType, const orxCHAR **_ppcSrc, orxCOMMAND_VAR *_pstArg)
+{
+  const orxCHAR  *pcSrc;
+  const orxSTRING zArg;
+  orxS32          s32VectorDepth;
+  orxBOOL         bInBlock = orxFALSE, bUseDefault = orxFALSE;
+  orxSTATUS       eStatus = orxSTATUS_SUCCESS;
+
+  /* Gets source */
+  pcSrc = *_ppcSrc;
+
+
+  /* Inits vector depth */
+  s32VectorDepth = ((*pcSrc == orxSTRING_KC_VECTOR_START) || (*pcSrc == orxSTRING_KC_VECTOR_START_ALT)) ? 0 : -1;
+
+  /* Gets arg's beginning */
+  zArg = pcSrc;
+
+  /* Is a block marker? */
+  if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+  {
+    /* Updates arg pointer */
+    zArg++;
+    pcSrc++;
+
+    /* Is an empty block? */
+    if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+    && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
+    {
+      /* Uses default */
+      bUseDefault = orxTRUE;
+
+      /* Updates arg pointer */
+      zArg++;
+      pcSrc++;
+    }
+    else
+    {
+      /* Updates block status */
+      bInBlock = orxTRUE;
+    }
+  }
+
+  /* Stores its type */
+  _pstArg->eType = _eType;
+
+  /* Depending on its type */
+  switch(_eType)
+  {
+    case orxCOMMAND_VAR_TYPE_NUMERIC:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Replaces block end marker with 0 */
+        pcSrc--;
+        zArg--;
+        *((orxCHAR *)pcSrc) = '0';
+
+        /* Falls through */
+      }
+      /* Not in block? */
+      else if(bInBlock == orxFALSE)
+      {
+        orxVECTOR vValue;
+
+        /* Is a vector */
+        if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
+        {
+          /* Stores its value */
+          _pstArg->zValue = zArg;
+
+          /* Stops */
+          break;
+        }
+        else
+        {
+          /* Falls through */
+        }
+      }
+    }
+
+    default:
+    case orxCOMMAND_VAR_TYPE_STRING:
+    {
+      /* For all argument characters */
+      for(; *pcSrc != orxCHAR_NULL; pcSrc++)
+      {
+        orxCHAR *pcTemp;
+
+        /* Depending on character */
+        switch(*pcSrc)
+        {
+          case orxSTRING_KC_VECTOR_START:
+          case orxSTRING_KC_VECTOR_START_ALT:
+          {
+            /* Should update? */
+            if(s32VectorDepth >= 0)
+            {
+              /* Increments vector depth */
+              s32VectorDepth++;
+            }
+            break;
+          }
+
+          case orxSTRING_KC_VECTOR_END:
+          case orxSTRING_KC_VECTOR_END_ALT:
+          {
+            /* Should update? */
+            if(s32VectorDepth >= 0)
+            {
+              /* Decrements vector depth */
+              s32VectorDepth--;
+            }
+            break;
+          }
+
+          case orxCOMMAND_KC_BLOCK_MARKER:
+          {
+            /* Erases it */
+            for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
+            {
+              *pcTemp = *(pcTemp + 1);
+            }
+
+            /* Not double marker? */
+            if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
+            {
+              /* Updates block status */
+              bInBlock = !bInBlock;
+
+              /* Handles current character in new mode */
+              pcSrc--;
+            }
+            continue;
+          }
+          default:
+          {
+            break;
+          }
+        }
+
+        /* Not in block or in vector? */
+        if((bInBlock == orxFALSE) && (s32VectorDepth <= 0))
+        {
+          /* End of string? */
+          if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
+          {
+            /* Stops */
+            break;
+          }
+        }
+      }
+
+      /* Stores its value */
+      _pstArg->zValue = zArg;
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_FLOAT:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->fValue = orxFLOAT_0;
+      }
+      else
+      {
+        /* Gets its value */
+        eStatus = orxString_ToFloat(zArg, &(_pstArg->fValue), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_S32:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->s32Value = 0;
+      }
+      else
+      {
+        /* Gets its value */
+        eStatus = orxString_ToS32(zArg, &(_pstArg->s32Value), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_U32:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->u32Value = 0;
+      }
+      else
+      {
+        /* Gets its value */
+        eStatus = orxString_ToU32(zArg, &(_pstArg->u32Value), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_S64:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->s64Value = 0;
+      }
+      else
+      {
+        /* Gets its value */
+        eStatus = orxString_ToS64(zArg, &(_pstArg->s64Value), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_U64:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->u64Value = 0;
+      }
+      else
+      {
+        /* Gets its value */
+        eStatus = orxString_ToU64(zArg, &(_pstArg->u64Value), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_BOOL:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->bValue = orxFALSE;
+      }
+      else
+      {
+        /* Gets its value */
+        eStatus = orxString_ToBool(zArg, &(_pstArg->bValue), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_VECTOR:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        orxVector_Copy(&(_pstArg->vValue), &orxVECTOR_0);
+      }
+      else
+      {
+        /* Gets its value */
+        eStatus = orxString_ToVector(zArg, &(_pstArg->vValue), &pcSrc);
+      }
+
+      break;
+    }
+  }
+  /* Updates source */
+  *_ppcSrc = pcSrc;
+
+  /* Done! */
+  return eStatus;
+}
+
 static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandLine, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
 {
   const orxSTRING zCommand;
@@ -725,7 +1145,6 @@ static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandL
       orxCOMMAND_TRIE_NODE *pstCommandNode;
       const orxCHAR        *pcSrc;
       orxCHAR              *pcDst;
-      const orxSTRING       zArg;
       const orxSTRING       azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
       orxU32                u32ArgNumber, u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
       orxCOMMAND_VAR       *astArgList = (orxCOMMAND_VAR *)orxMemory_StackAllocate(u32ParamNumber * sizeof(orxCOMMAND_VAR));
@@ -1086,7 +1505,7 @@ static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandL
       zCommand = orxString_SkipWhiteSpaces(pcSrc);
 
       /* For all characters in the buffer */
-      for(pcSrc = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset, eStatus = orxSTATUS_SUCCESS, zArg = orxSTRING_EMPTY, u32ArgNumber = 0;
+      for(pcSrc = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset, eStatus = orxSTATUS_SUCCESS, u32ArgNumber = 0;
           (u32ArgNumber < u32ParamNumber) && (pcSrc - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE) && (*pcSrc != orxCHAR_NULL);
           pcSrc++, u32ArgNumber++)
       {
@@ -1096,461 +1515,754 @@ static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandL
         /* Valid? */
         if(*pcSrc != orxCHAR_NULL)
         {
-          orxBOOL bInBlock = orxFALSE, bUseDefault = orxFALSE;
-
-          /* Inits vector depth */
-          s32VectorDepth = ((*pcSrc == orxSTRING_KC_VECTOR_START) || (*pcSrc == orxSTRING_KC_VECTOR_START_ALT)) ? 0 : -1;
-
-          /* Gets arg's beginning */
-          zArg = pcSrc;
+          /* Parses it */
+          eStatus = orxCommand_ParseArg(pstCommand->astParamList[u32ArgNumber].eType, &pcSrc, &(astArgList[u32ArgNumber]));
 
-          /* Is a block marker? */
-          if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+          /* Interrupted? */
+          if((eStatus == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
           {
-            /* Updates arg pointer */
-            zArg++;
-            pcSrc++;
-
-            /* Is an empty block? */
-            if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
-            && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
-            {
-              /* Uses default */
-              bUseDefault = orxTRUE;
+            /* Updates argument count */
+            u32ArgNumber++;
 
-              /* Updates arg pointer */
-              zArg++;
-              pcSrc++;
-            }
-            else
-            {
-              /* Updates block status */
-              bInBlock = orxTRUE;
-            }
+            /* Stops processing */
+            break;
           }
-
-          /* Stores its type */
-          astArgList[u32ArgNumber].eType = pstCommand->astParamList[u32ArgNumber].eType;
-
-          /* Depending on its type */
-          switch(pstCommand->astParamList[u32ArgNumber].eType)
+          else
           {
-            case orxCOMMAND_VAR_TYPE_NUMERIC:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Replaces block end marker with 0 */
-                pcSrc--;
-                zArg--;
-                *((orxCHAR *)pcSrc) = '0';
-
-                /* Falls through */
-              }
-              /* Not in block? */
-              else if(bInBlock == orxFALSE)
-              {
-                orxVECTOR vValue;
+            /* Ends current argument */
+            *(orxCHAR *)pcSrc = orxCHAR_NULL;
+          }
+        }
+        else
+        {
+          /* Stops */
+          break;
+        }
+      }
 
-                /* Is a vector */
-                if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
-                {
-                  /* Stores its value */
-                  astArgList[u32ArgNumber].zValue = zArg;
+      /* Error? */
+      if((eStatus == orxSTATUS_FAILURE) || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
+      {
+        /* Incorrect parameter? */
+        if(eStatus == orxSTATUS_FAILURE)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], invalid argument #%d for command [%s].", _zCommandLine, u32ArgNumber, orxString_GetFromID(pstCommand->stNameID));
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], expected %d[+%d] arguments for command [%s], found %d.", _zCommandLine, (orxU32)pstCommand->u16RequiredParamNumber, (orxU32)pstCommand->u16OptionalParamNumber, orxString_GetFromID(pstCommand->stNameID), u32ArgNumber);
+        }
+      }
+      else
+      {
+        /* Runs it */
+        sstCommand.s32ProcessOffset += s32Offset;
+        pstResult = orxCommand_Run(pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
+        sstCommand.s32ProcessOffset -= s32Offset;
+      }
+#undef orxCOMMAND_KU32_ALIAS_MAX_DEPTH
+    }
+    else
+    {
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
 
-                  /* Stops */
-                  break;
-                }
-                else
-                {
-                  /* Falls through */
-                }
-              }
-            }
+      /* Not silent? */
+      if(_bSilent == orxFALSE)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+      }
 
-            default:
-            case orxCOMMAND_VAR_TYPE_STRING:
-            {
-              /* For all argument characters */
-              for(; *pcSrc != orxCHAR_NULL; pcSrc++)
-              {
-                orxCHAR *pcTemp;
+      /* Stops */
+      zCommand = orxSTRING_EMPTY;
+    }
 
-                /* Depending on character */
-                switch(*pcSrc)
-                {
-                  case orxSTRING_KC_VECTOR_START:
-                  case orxSTRING_KC_VECTOR_START_ALT:
-                  {
-                    /* Should update? */
-                    if(s32VectorDepth >= 0)
-                    {
-                      /* Increments vector depth */
-                      s32VectorDepth++;
-                    }
-                    break;
-                  }
+    /* Failure? */
+    if(pstResult == orxNULL)
+    {
+      /* Stores error */
+      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
+      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
+    }
 
-                  case orxSTRING_KC_VECTOR_END:
-                  case orxSTRING_KC_VECTOR_END_ALT:
-                  {
-                    /* Should update? */
-                    if(s32VectorDepth >= 0)
-                    {
-                      /* Decrements vector depth */
-                      s32VectorDepth--;
-                    }
-                    break;
-                  }
+    /* Has named push? */
+    if(pcValue != orxNULL)
+    {
+      /* Pushes section */
+      orxConfig_PushSection((pcSection != orxNULL) ? pcSection : orxCOMMAND_KZ_PUSH_SECTION);
 
-                  case orxCOMMAND_KC_BLOCK_MARKER:
-                  {
-                    /* Erases it */
-                    for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
-                    {
-                      *pcTemp = *(pcTemp + 1);
-                    }
+      /* Depending on type */
+      switch(_pstResult->eType)
+      {
+        default:
+        case orxCOMMAND_VAR_TYPE_STRING:
+        case orxCOMMAND_VAR_TYPE_NUMERIC:
+        {
+          /* Stores it */
+          orxConfig_SetString(pcValue, _pstResult->zValue);
 
-                    /* Not double marker? */
-                    if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
-                    {
-                      /* Updates block status */
-                      bInBlock = !bInBlock;
+          break;
+        }
+        case orxCOMMAND_VAR_TYPE_FLOAT:
+        {
+          /* Stores it */
+          orxConfig_SetFloat(pcValue, _pstResult->fValue);
 
-                      /* Handles current character in new mode */
-                      pcSrc--;
-                    }
-                    continue;
-                  }
-                  default:
-                  {
-                    break;
-                  }
-                }
+          break;
+        }
+        case orxCOMMAND_VAR_TYPE_S32:
+        {
+          /* Stores it */
+          orxConfig_SetS32(pcValue, _pstResult->s32Value);
 
-                /* Not in block or in vector? */
-                if((bInBlock == orxFALSE) && (s32VectorDepth <= 0))
-                {
-                  /* End of string? */
-                  if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
-                  {
-                    /* Stops */
-                    break;
-                  }
-                }
-              }
+          break;
+        }
+        case orxCOMMAND_VAR_TYPE_U32:
+        {
+          /* Stores it */
+          orxConfig_SetU32(pcValue, _pstResult->u32Value);
 
-              /* Stores its value */
-              astArgList[u32ArgNumber].zValue = zArg;
+          break;
+        }
+        case orxCOMMAND_VAR_TYPE_S64:
+        {
+          /* Stores it */
+          orxConfig_SetS64(pcValue, _pstResult->s64Value);
 
-              break;
-            }
+          break;
+        }
+        case orxCOMMAND_VAR_TYPE_U64:
+        {
+          /* Stores it */
+          orxConfig_SetU64(pcValue, _pstResult->u64Value);
 
-            case orxCOMMAND_VAR_TYPE_FLOAT:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].fValue = orxFLOAT_0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToFloat(zArg, &(astArgList[u32ArgNumber].fValue), &pcSrc);
-              }
+          break;
+        }
+        case orxCOMMAND_VAR_TYPE_BOOL:
+        {
+          /* Stores it */
+          orxConfig_SetBool(pcValue, _pstResult->bValue);
 
-              break;
-            }
+          break;
+        }
+        case orxCOMMAND_VAR_TYPE_VECTOR:
+        {
+          /* Stores it */
+          orxConfig_SetVector(pcValue, &(_pstResult->vValue));
 
-            case orxCOMMAND_VAR_TYPE_S32:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s32Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToS32(zArg, &(astArgList[u32ArgNumber].s32Value), &pcSrc);
-              }
+          break;
+        }
+      }
 
-              break;
-            }
+      /* Pops section */
+      orxConfig_PopSection();
+    }
+    else
+    {
+      /* Pushes result */
+      orxCommand_PushResult(_pstResult, u32PushCount);
+    }
+  }
 
-            case orxCOMMAND_VAR_TYPE_U32:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u32Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToU32(zArg, &(astArgList[u32ArgNumber].u32Value), &pcSrc);
-              }
+  /* Unprocessed? */
+  if(bProcessed == orxFALSE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+  }
 
-              break;
-            }
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
 
-            case orxCOMMAND_VAR_TYPE_S64:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s64Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToS64(zArg, &(astArgList[u32ArgNumber].s64Value), &pcSrc);
-              }
+  /* Done! */
+  return pstResult;
+}
 
-              break;
-            }
+/** Compiles a command line: resolves commands & aliases, pre-parses literal arguments and stores placeholders for GUID/pop markers
+ * @param[in]   _zCommandLine                 Command line to compile
+ * @return      orxCOMMAND_COMPILED / orxNULL if the command line can't be compiled (variables, named pushes, partial markers, ...)
+ */
+static orxCOMMAND_COMPILED *orxFASTCALL orxCommand_Compile(const orxSTRING _zCommandLine)
+{
+#define orxCOMMAND_KU32_ALIAS_MAX_DEPTH             32
+  orxCOMMAND_COMPILED_STEP  astStepList[orxCOMMAND_KU32_COMPILED_STEP_NUMBER];
+  orxCOMMAND_VAR            astArgList[orxCOMMAND_KU32_COMPILED_ARG_NUMBER];
+  orxU8                     au8SourceList[orxCOMMAND_KU32_COMPILED_ARG_NUMBER];
+  orxCHAR                   acBuffer[orxCOMMAND_KU32_COMPILED_BUFFER_SIZE];
+  const orxCHAR            *pcSrc;
+  orxCHAR                  *pcDst;
+  orxU32                    u32StepNumber = 0, u32ArgCount = 0;
+  orxBOOL                   bValid = orxTRUE;
+  orxCOMMAND_COMPILED      *pstResult = orxNULL;
 
-            case orxCOMMAND_VAR_TYPE_U64:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u64Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToU64(zArg, &(astArgList[u32ArgNumber].u64Value), &pcSrc);
-              }
+  /* For all commands */
+  for(pcSrc = orxString_SkipWhiteSpaces(_zCommandLine), pcDst = acBuffer;
+      (bValid != orxFALSE) && (*pcSrc != orxCHAR_NULL);
+      pcSrc = orxString_SkipWhiteSpaces(pcSrc))
+  {
+    orxCOMMAND_COMPILED_STEP *pstStep;
+    const orxCOMMAND         *pstCommand;
+    orxCOMMAND_TRIE_NODE     *pstCommandNode;
+    const orxCHAR            *pcCommandEnd;
+    orxCHAR                  *pcArg;
+    const orxSTRING           azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
+    orxCHAR                   acNameBuffer[orxCOMMAND_KU32_NAME_BUFFER_SIZE];
+    orxS32                    s32BufferCount = 0, s32VectorDepth = 0, i;
+    orxU32                    u32PushCount, u32MarkerCount, u32PlaceholderCount, u32ArgNumber, u32ParamNumber;
+    orxBOOL                   bInBlock = orxFALSE;
+    orxSTATUS                 eStatus;
+
+    /* Too many steps or named push? */
+    if((u32StepNumber == orxCOMMAND_KU32_COMPILED_STEP_NUMBER)
+    || ((*pcSrc == orxCOMMAND_KC_PUSH_MARKER)
+     && (*(pcSrc + 1) != orxCOMMAND_KC_PUSH_MARKER)
+     && (orxCommand_IsWhiteSpace(*(pcSrc + 1)) == orxFALSE)))
+    {
+      /* Rejects it */
+      bValid = orxFALSE;
+      break;
+    }
 
-              break;
-            }
+    /* Gets step */
+    pstStep             = &(astStepList[u32StepNumber]);
+    pstStep->u32Offset  = (orxU32)(pcSrc - _zCommandLine);
 
-            case orxCOMMAND_VAR_TYPE_BOOL:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].bValue = orxFALSE;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToBool(zArg, &(astArgList[u32ArgNumber].bValue), &pcSrc);
-              }
+    /* For all push markers / spaces */
+    for(u32PushCount = 0; (*pcSrc == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE); pcSrc++)
+    {
+      /* Is a push marker? */
+      if(*pcSrc == orxCOMMAND_KC_PUSH_MARKER)
+      {
+        /* Updates push count */
+        u32PushCount++;
+      }
+    }
 
-              break;
-            }
+    /* Finds end of command */
+    for(pcCommandEnd = pcSrc + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF) && (*pcCommandEnd != orxCOMMAND_KC_SEPARATOR); pcCommandEnd++)
+      ;
+
+    /* Name too long? */
+    if(pcCommandEnd - pcSrc >= orxCOMMAND_KU32_NAME_BUFFER_SIZE)
+    {
+      /* Rejects it */
+      bValid = orxFALSE;
+      break;
+    }
+
+    /* Gets command name */
+    orxMemory_Copy(acNameBuffer, pcSrc, (orxU32)(pcCommandEnd - pcSrc));
+    acNameBuffer[pcCommandEnd - pcSrc] = orxCHAR_NULL;
+
+    /* Gets command */
+    pstCommand = orxCommand_FindNoAlias(acNameBuffer);
+
+    /* Not found? */
+    if(pstCommand == orxNULL)
+    {
+      /* Rejects it */
+      bValid = orxFALSE;
+      break;
+    }
+
+    /* Adds input to the buffer list */
+    azBufferList[s32BufferCount++] = pcCommandEnd;
 
-            case orxCOMMAND_VAR_TYPE_VECTOR:
+    /* For all alias nodes */
+    for(pstCommandNode = orxCommand_FindTrieNode(acNameBuffer, orxFALSE);
+        (pstCommandNode->pstCommand->bIsAlias != orxFALSE) && (s32BufferCount < orxCOMMAND_KU32_ALIAS_MAX_DEPTH);
+        pstCommandNode = orxCommand_FindTrieNode(pstCommandNode->pstCommand->zAliasedCommandName, orxFALSE))
+    {
+      /* Has args? */
+      if(pstCommandNode->pstCommand->zArgs != orxNULL)
+      {
+        /* Adds it to the buffer list */
+        azBufferList[s32BufferCount++] = pstCommandNode->pstCommand->zArgs;
+      }
+    }
+
+    /* For all stacked buffers */
+    for(i = s32BufferCount - 1, pcArg = pcDst, u32MarkerCount = 0; (bValid != orxFALSE) && (i >= 0); i--)
+    {
+      const orxCHAR  *pc;
+      orxBOOL         bStop;
+
+      /* Has room for next buffer? */
+      if((i != s32BufferCount - 1) && (*azBufferList[i] != orxCHAR_NULL) && (pcDst - acBuffer < orxCOMMAND_KU32_COMPILED_BUFFER_SIZE - 2))
+      {
+        /* Inserts space */
+        *pcDst++ = ' ';
+      }
+
+      /* For all characters */
+      for(pc = azBufferList[i], bStop = orxFALSE; (bStop == orxFALSE) && (*pc != orxCHAR_NULL) && (pcDst - acBuffer < orxCOMMAND_KU32_COMPILED_BUFFER_SIZE - 2); pc++)
+      {
+        /* Depending on character */
+        switch(*pc)
+        {
+          case orxCOMMAND_KC_VARIABLE_MARKER:
+          {
+            /* Doubled? */
+            if(*(pc + 1) == orxCOMMAND_KC_VARIABLE_MARKER)
             {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                orxVector_Copy(&(astArgList[u32ArgNumber].vValue), &orxVECTOR_0);
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToVector(zArg, &(astArgList[u32ArgNumber].vValue), &pcSrc);
-              }
+              /* Copies it */
+              *pcDst++ = *pc++;
+            }
+            else
+            {
+              /* Rejects it */
+              bValid = orxFALSE;
+              bStop  = orxTRUE;
+            }
 
-              break;
+            break;
+          }
+
+          case orxCOMMAND_KC_SEPARATOR:
+          case orxCHAR_CR:
+          case orxCHAR_LF:
+          {
+            /* Not in block or in vector? */
+            if((bInBlock == orxFALSE)
+            && (s32VectorDepth == 0))
+            {
+              /* Stops */
+              bStop = orxTRUE;
             }
+            else
+            {
+              /* Copies it */
+              *pcDst++ = *pc;
+            }
+
+            break;
           }
 
-          /* Interrupted? */
-          if((eStatus == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
-          {
-            /* Updates argument count */
-            u32ArgNumber++;
+          case orxSTRING_KC_VECTOR_START:
+          case orxSTRING_KC_VECTOR_START_ALT:
+          {
+            /* Increments vector depth */
+            s32VectorDepth++;
+
+            /* Copies it */
+            *pcDst++ = *pc;
+
+            break;
+          }
+
+          case orxSTRING_KC_VECTOR_END:
+          case orxSTRING_KC_VECTOR_END_ALT:
+          {
+            /* Decrements vector depth */
+            s32VectorDepth--;
+
+            /* Copies it */
+            *pcDst++ = *pc;
+
+            break;
+          }
+
+          case orxCOMMAND_KC_GUID_MARKER:
+          case orxCOMMAND_KC_POP_MARKER:
+          {
+            /* Updates marker count */
+            u32MarkerCount++;
+
+            /* Copies it */
+            *pcDst++ = *pc;
+
+            break;
+          }
+
+          case orxCOMMAND_KC_BLOCK_MARKER:
+          {
+            /* Toggles block status */
+            bInBlock = !bInBlock;
+
+            /* Falls through */
+          }
+
+          default:
+          {
+            /* Copies it */
+            *pcDst++ = *pc;
+
+            break;
+          }
+        }
+      }
+
+      /* Ran out of room? */
+      if((bStop == orxFALSE) && (*pc != orxCHAR_NULL))
+      {
+        /* Rejects it */
+        bValid = orxFALSE;
+      }
+
+      /* Input buffer? */
+      if(i == 0)
+      {
+        /* Updates next command expression */
+        pcSrc = pc;
+      }
+    }
+
+    /* Invalid or too many arguments? */
+    u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
+    if((bValid == orxFALSE) || (u32ArgCount + u32ParamNumber > orxCOMMAND_KU32_COMPILED_ARG_NUMBER))
+    {
+      /* Rejects it */
+      bValid = orxFALSE;
+      break;
+    }
+
+    /* Copies end of string */
+    *pcDst = orxCHAR_NULL;
+
+    /* For all arguments */
+    for(eStatus = orxSTATUS_SUCCESS, u32ArgNumber = 0, u32PlaceholderCount = 0;
+        (u32ArgNumber < u32ParamNumber) && (*pcArg != orxCHAR_NULL);
+        pcArg++, u32ArgNumber++)
+    {
+      /* Skips all whitespaces */
+      pcArg = (orxCHAR *)orxString_SkipWhiteSpaces(pcArg);
 
-            /* Stops processing */
-            break;
-          }
-          else
-          {
-            /* Ends current argument */
-            *(orxCHAR *)pcSrc = orxCHAR_NULL;
-          }
+      /* Valid? */
+      if(*pcArg != orxCHAR_NULL)
+      {
+        /* Is a standalone GUID or pop marker? */
+        if(((*pcArg == orxCOMMAND_KC_GUID_MARKER) || (*pcArg == orxCOMMAND_KC_POP_MARKER))
+        && ((*(pcArg + 1) == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*(pcArg + 1)) != orxFALSE)))
+        {
+          /* Stores placeholder */
+          au8SourceList[u32ArgCount + u32ArgNumber]       = (*pcArg == orxCOMMAND_KC_GUID_MARKER) ? orxCOMMAND_KU8_ARG_SOURCE_GUID : orxCOMMAND_KU8_ARG_SOURCE_POP;
+          astArgList[u32ArgCount + u32ArgNumber].eType    = pstCommand->astParamList[u32ArgNumber].eType;
+          astArgList[u32ArgCount + u32ArgNumber].zValue   = orxSTRING_EMPTY;
+          u32PlaceholderCount++;
+          pcArg++;
         }
         else
         {
-          /* Stops */
-          break;
+          /* Parses it */
+          au8SourceList[u32ArgCount + u32ArgNumber] = orxCOMMAND_KU8_ARG_SOURCE_LITERAL;
+          eStatus = orxCommand_ParseArg(pstCommand->astParamList[u32ArgNumber].eType, (const orxCHAR **)&pcArg, &(astArgList[u32ArgCount + u32ArgNumber]));
         }
-      }
 
-      /* Error? */
-      if((eStatus == orxSTATUS_FAILURE) || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
-      {
-        /* Incorrect parameter? */
-        if(eStatus == orxSTATUS_FAILURE)
+        /* Interrupted? */
+        if((eStatus == orxSTATUS_FAILURE) || (*pcArg == orxCHAR_NULL))
         {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], invalid argument #%d for command [%s].", _zCommandLine, u32ArgNumber, orxString_GetFromID(pstCommand->stNameID));
+          /* Updates argument count */
+          u32ArgNumber++;
+
+          /* Stops processing */
+          break;
         }
         else
         {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], expected %d[+%d] arguments for command [%s], found %d.", _zCommandLine, (orxU32)pstCommand->u16RequiredParamNumber, (orxU32)pstCommand->u16OptionalParamNumber, orxString_GetFromID(pstCommand->stNameID), u32ArgNumber);
+          /* Ends current argument */
+          *pcArg = orxCHAR_NULL;
         }
       }
       else
       {
-        /* Runs it */
-        sstCommand.s32ProcessOffset += s32Offset;
-        pstResult = orxCommand_Run(pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
-        sstCommand.s32ProcessOffset -= s32Offset;
+        /* Stops */
+        break;
       }
-#undef orxCOMMAND_KU32_ALIAS_MAX_DEPTH
     }
-    else
+
+    /* Invalid arguments or markers that aren't standalone arguments? */
+    if((eStatus == orxSTATUS_FAILURE)
+    || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber)
+    || (u32PlaceholderCount != u32MarkerCount))
     {
-      /* Restores command end */
-      *(orxCHAR *)pcCommandEnd = cBackupChar;
+      /* Rejects it (will be processed & reported by the regular path) */
+      bValid = orxFALSE;
+      break;
+    }
 
-      /* Not silent? */
-      if(_bSilent == orxFALSE)
-      {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
-      }
+    /* Stores step */
+    pstStep->pstCommand   = pstCommand;
+    pstStep->u32ArgIndex  = u32ArgCount;
+    pstStep->u32ArgNumber = u32ArgNumber;
+    pstStep->u32PushCount = u32PushCount;
 
-      /* Stops */
-      zCommand = orxSTRING_EMPTY;
-    }
+    /* Updates counts */
+    u32StepNumber++;
+    u32ArgCount += u32ArgNumber;
 
-    /* Failure? */
-    if(pstResult == orxNULL)
-    {
-      /* Stores error */
-      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
-      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
-    }
+    /* Skips argument string */
+    pcDst++;
+  }
+#undef orxCOMMAND_KU32_ALIAS_MAX_DEPTH
 
-    /* Has named push? */
-    if(pcValue != orxNULL)
+  /* Valid? */
+  if((bValid != orxFALSE) && (u32StepNumber > 0))
+  {
+    orxU32 u32StepSize, u32ArgSize, u32BufferSize;
+
+    /* Gets sizes */
+    u32StepSize   = (orxU32)orxALIGN16(sizeof(orxCOMMAND_COMPILED) + (u32StepNumber - 1) * sizeof(orxCOMMAND_COMPILED_STEP));
+    u32ArgSize    = u32ArgCount * sizeof(orxCOMMAND_VAR);
+    u32BufferSize = (orxU32)(pcDst - acBuffer);
+
+    /* Allocates compiled command */
+    pstResult = (orxCOMMAND_COMPILED *)orxMemory_Allocate(u32StepSize + u32ArgSize + u32ArgCount + u32BufferSize, orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(pstResult != orxNULL)
     {
-      /* Pushes section */
-      orxConfig_PushSection((pcSection != orxNULL) ? pcSection : orxCOMMAND_KZ_PUSH_SECTION);
+      orxCHAR  *acStorage;
+      orxU32    i;
+
+      /* Inits it */
+      pstResult->astArgList     = (orxCOMMAND_VAR *)((orxU8 *)pstResult + u32StepSize);
+      pstResult->au8SourceList  = (orxU8 *)pstResult->astArgList + u32ArgSize;
+      pstResult->u32StepNumber  = u32StepNumber;
+      acStorage                 = (orxCHAR *)pstResult->au8SourceList + u32ArgCount;
+      orxMemory_Copy(pstResult->astStepList, astStepList, u32StepNumber * sizeof(orxCOMMAND_COMPILED_STEP));
+      orxMemory_Copy(pstResult->astArgList, astArgList, u32ArgSize);
+      orxMemory_Copy(pstResult->au8SourceList, au8SourceList, u32ArgCount);
+      orxMemory_Copy(acStorage, acBuffer, u32BufferSize);
 
-      /* Depending on type */
-      switch(_pstResult->eType)
+      /* For all arguments */
+      for(i = 0; i < u32ArgCount; i++)
       {
-        default:
-        case orxCOMMAND_VAR_TYPE_STRING:
-        case orxCOMMAND_VAR_TYPE_NUMERIC:
+        /* Literal string or numeric? */
+        if((pstResult->au8SourceList[i] == orxCOMMAND_KU8_ARG_SOURCE_LITERAL)
+        && ((pstResult->astArgList[i].eType == orxCOMMAND_VAR_TYPE_STRING)
+         || (pstResult->astArgList[i].eType == orxCOMMAND_VAR_TYPE_NUMERIC)))
         {
-          /* Stores it */
-          orxConfig_SetString(pcValue, _pstResult->zValue);
-
-          break;
+          /* Relocates it */
+          pstResult->astArgList[i].zValue = acStorage + (pstResult->astArgList[i].zValue - acBuffer);
         }
-        case orxCOMMAND_VAR_TYPE_FLOAT:
-        {
-          /* Stores it */
-          orxConfig_SetFloat(pcValue, _pstResult->fValue);
+      }
+    }
+  }
 
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_S32:
-        {
-          /* Stores it */
-          orxConfig_SetS32(pcValue, _pstResult->s32Value);
+  /* Done! */
+  return pstResult;
+}
 
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_U32:
-        {
-          /* Stores it */
-          orxConfig_SetU32(pcValue, _pstResult->u32Value);
+/** Gets a compiled command line, compiling it if needed
+ * @param[in]   _zCommandLine                 Command line
+ * @return      orxCOMMAND_COMPILED / orxNULL if the command line can't be compiled
+ */
+static orxCOMMAND_COMPILED *orxFASTCALL orxCommand_GetCompiled(const orxSTRING _zCommandLine)
+{
+  orxCOMMAND_COMPILED *pstResult = orxNULL;
 
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_S64:
-        {
-          /* Stores it */
-          orxConfig_SetS64(pcValue, _pstResult->s64Value);
+  /* Cache available? */
+  if(!orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_CACHE))
+  {
+    orxSTRINGID stID;
+    void      **ppBucket;
 
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_U64:
-        {
-          /* Stores it */
-          orxConfig_SetU64(pcValue, _pstResult->u64Value);
+    /* Gets command line ID */
+    stID = orxString_Hash(_zCommandLine);
 
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_BOOL:
-        {
-          /* Stores it */
-          orxConfig_SetBool(pcValue, _pstResult->bValue);
+    /* Gets its compiled version */
+    pstResult = (orxCOMMAND_COMPILED *)orxHashTable_Get(sstCommand.pstCompiledTable, stID);
 
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_VECTOR:
-        {
-          /* Stores it */
-          orxConfig_SetVector(pcValue, &(_pstResult->vValue));
+    /* Not found? */
+    if(pstResult == orxNULL)
+    {
+      /* Cache full? */
+      if(orxHashTable_GetCount(sstCommand.pstCompiledTable) >= orxCOMMAND_KU32_COMPILED_CACHE_SIZE)
+      {
+        /* Clears it */
+        orxCommand_ClearCache();
+      }
 
-          break;
-        }
+      /* Compiles command line */
+      pstResult = orxCommand_Compile(_zCommandLine);
+
+      /* Gets its bucket */
+      ppBucket = orxHashTable_Retrieve(sstCommand.pstCompiledTable, stID);
+
+      /* Valid? */
+      if(ppBucket != orxNULL)
+      {
+        /* Stores it (rejected command lines are remembered too) */
+        *ppBucket = (pstResult != orxNULL) ? (void *)pstResult : (void *)orxHANDLE_UNDEFINED;
+      }
+      else if(pstResult != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(pstResult);
+        pstResult = orxNULL;
       }
+    }
+    /* Rejected? */
+    else if(pstResult == (orxCOMMAND_COMPILED *)orxHANDLE_UNDEFINED)
+    {
+      /* Clears it */
+      pstResult = orxNULL;
+    }
+  }
 
-      /* Pops section */
-      orxConfig_PopSection();
+  /* Done! */
+  return pstResult;
+}
+
+/** Runs a compiled command line
+ * @param[in]   _pstCompiled                  Compiled command line
+ * @param[in]   _zCommandLine                 Source command line
+ * @param[in]   _u64GUID                      GUID to use in place of the GUID markers
+ * @param[out]  _pstResult                    Variable that will contain the result
+ * @return      Command result if found, orxNULL otherwise
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_RunCompiled(const orxCOMMAND_COMPILED *_pstCompiled, const orxSTRING _zCommandLine, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult)
+{
+  orxU32          i;
+  orxCOMMAND_VAR *pstResult = orxNULL;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxCommand_RunCompiled");
+
+  /* Updates run count */
+  sstCommand.u32CompiledRunCount++;
+
+  /* For all steps */
+  for(i = 0; i < _pstCompiled->u32StepNumber; i++)
+  {
+    const orxCOMMAND_COMPILED_STEP *pstStep;
+    orxCOMMAND_VAR                 *astArgList;
+    orxCHAR                        *pcDst;
+    orxS32                          s32Offset;
+    orxU32                          j;
+    orxSTATUS                       eStatus = orxSTATUS_SUCCESS;
+
+    /* Gets it */
+    pstStep = &(_pstCompiled->astStepList[i]);
+
+    /* Commands have changed while running? */
+    if(orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_CACHE))
+    {
+      /* Evaluates remaining commands from source */
+      pstResult = orxCommand_EvaluateWithGUID(_zCommandLine + pstStep->u32Offset, _u64GUID, _pstResult);
+
+      break;
     }
-    else
+
+    /* Copies pre-parsed arguments */
+    astArgList = (orxCOMMAND_VAR *)orxMemory_StackAllocate(orxMAX(pstStep->u32ArgNumber, 1) * sizeof(orxCOMMAND_VAR));
+    orxMemory_Copy(astArgList, _pstCompiled->astArgList + pstStep->u32ArgIndex, pstStep->u32ArgNumber * sizeof(orxCOMMAND_VAR));
+
+    /* For all arguments */
+    for(j = 0, pcDst = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset; j < pstStep->u32ArgNumber; j++)
     {
-      /* For all requested pushes */
-      while(u32PushCount > 0)
-      {
-        orxCOMMAND_STACK_ENTRY *pstEntry;
+      orxU8 u8Source;
 
-        /* Allocates stack entry */
-        pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
+      /* Gets its source */
+      u8Source = _pstCompiled->au8SourceList[pstStep->u32ArgIndex + j];
 
-        /* Checks */
-        orxASSERT(pstEntry != orxNULL);
+      /* Placeholder? */
+      if(u8Source != orxCOMMAND_KU8_ARG_SOURCE_LITERAL)
+      {
+        const orxCHAR  *pcArg;
+        orxU32          u32Size;
 
-        /* Is a string or numeric value? */
-        if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
-        || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+        /* Gets remaining size */
+        pcArg   = pcDst;
+        u32Size = orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer);
+
+        /* GUID? */
+        if(u8Source == orxCOMMAND_KU8_ARG_SOURCE_GUID)
         {
-          /* Checks */
-          orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
-
-          /* Duplicates it */
-          pstEntry->stValue.eType   = _pstResult->eType;
-          pstEntry->stValue.zValue  = pstEntry->acBuffer;
-          orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, sizeof(pstEntry->acBuffer) - 1);
-          pstEntry->acBuffer[sizeof(pstEntry->acBuffer) - 1] = orxCHAR_NULL;
+          /* Is GUID valid? */
+          if(_u64GUID != orxU64_UNDEFINED)
+          {
+            /* Prints it */
+            pcDst += orxString_NPrint(pcDst, u32Size, "0x%016llX", _u64GUID);
+          }
+          else
+          {
+            /* Copies marker */
+            *pcDst++ = orxCOMMAND_KC_GUID_MARKER;
+          }
         }
         else
         {
-          /* Stores value */
-          orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
+          /* Pops value */
+          if(orxCommand_PopValue(&pcDst, u32Size, orxFALSE) == orxSTATUS_FAILURE)
+          {
+            orxU32 u32Length;
+
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
+
+            /* Gets error length */
+            u32Length = orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+
+            /* Has room? */
+            if(u32Length <= u32Size)
+            {
+              /* Replaces marker with stack error */
+              orxString_NCopy(pcDst, orxCOMMAND_KZ_STACK_ERROR_VALUE, u32Size);
+
+              /* Updates pointers */
+              pcDst += u32Length;
+            }
+          }
+        }
+
+        /* Terminates it */
+        *pcDst = orxCHAR_NULL;
+
+        /* Parses it */
+        pcArg = orxString_SkipWhiteSpaces(pcArg);
+        if(orxCommand_ParseArg(pstStep->pstCommand->astParamList[j].eType, &pcArg, &(astArgList[j])) == orxSTATUS_FAILURE)
+        {
+          /* First failure? (remaining placeholders still get consumed) */
+          if(eStatus != orxSTATUS_FAILURE)
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], invalid argument #%d for command [%s].", _zCommandLine, j + 1, orxString_GetFromID(pstStep->pstCommand->stNameID));
+
+            /* Updates status */
+            eStatus = orxSTATUS_FAILURE;
+          }
         }
+        *(orxCHAR *)pcArg = orxCHAR_NULL;
 
-        /* Updates push count */
-        u32PushCount--;
+        /* Updates pointer */
+        pcDst++;
       }
     }
+
+    /* Valid? */
+    if(eStatus != orxSTATUS_FAILURE)
+    {
+      /* Runs it while protecting placeholder values */
+      s32Offset = (orxS32)(pcDst - sstCommand.acProcessBuffer - sstCommand.s32ProcessOffset);
+      sstCommand.s32ProcessOffset += s32Offset;
+      pstResult = orxCommand_Run(pstStep->pstCommand, orxFALSE, pstStep->u32ArgNumber, astArgList, _pstResult);
+      sstCommand.s32ProcessOffset -= s32Offset;
+    }
+
+    /* Failure? */
+    if(pstResult == orxNULL)
+    {
+      /* Stores error */
+      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
+      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
+    }
+
+    /* Pushes result */
+    orxCommand_PushResult(_pstResult, pstStep->u32PushCount);
   }
 
-  /* Unprocessed? */
-  if(bProcessed == orxFALSE)
+  /* Updates run count */
+  sstCommand.u32CompiledRunCount--;
+
+  /* Was cache clear deferred? */
+  if((sstCommand.u32CompiledRunCount == 0) && orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_CACHE))
   {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+    /* Clears it */
+    orxCommand_ClearCache();
   }
 
   /* Profiles */
@@ -1622,10 +2334,23 @@ static orxSTATUS orxFASTCALL orxCommand_EventHandler(const orxEVENT *_pstEvent)
   /* Has command? */
   if(zCommand != orxNULL)
   {
-    orxCOMMAND_VAR stResult;
+    const orxCOMMAND_COMPILED  *pstCompiled;
+    orxCOMMAND_VAR              stResult;
 
-    /* Processes it */
-    orxCommand_Process(zCommand, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
+    /* Gets its compiled version */
+    pstCompiled = orxCommand_GetCompiled(zCommand);
+
+    /* Valid? */
+    if(pstCompiled != orxNULL)
+    {
+      /* Runs it */
+      orxCommand_RunCompiled(pstCompiled, zCommand, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult);
+    }
+    else
+    {
+      /* Processes it */
+      orxCommand_Process(zCommand, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
+    }
   }
 
   /* Done! */
@@ -4328,8 +5053,11 @@ orxSTATUS orxFASTCALL orxCommand_Init()
       sstCommand.pstTrieBank    = orxBank_Create(orxCOMMAND_KU32_TRIE_BANK_SIZE, sizeof(orxCOMMAND_TRIE_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
       sstCommand.pstResultBank  = orxBank_Create(orxCOMMAND_KU32_RESULT_BANK_SIZE, sizeof(orxCOMMAND_STACK_ENTRY), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates compiled command table */
+      sstCommand.pstCompiledTable = orxHashTable_Create(orxCOMMAND_KU32_COMPILED_CACHE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
       /* Valid? */
-      if((sstCommand.pstBank != orxNULL) && (sstCommand.pstTrieBank != orxNULL) && (sstCommand.pstResultBank != orxNULL))
+      if((sstCommand.pstBank != orxNULL) && (sstCommand.pstTrieBank != orxNULL) && (sstCommand.pstResultBank != orxNULL) && (sstCommand.pstCompiledTable != orxNULL))
       {
         orxCOMMAND_TRIE_NODE *pstTrieRoot;
 
@@ -4379,6 +5107,11 @@ orxSTATUS orxFASTCALL orxCommand_Init()
           orxBank_Delete(sstCommand.pstTrieBank);
           orxBank_Delete(sstCommand.pstResultBank);
 
+          /* Deletes compiled command table */
+          orxCommand_ClearCache();
+          orxHashTable_Delete(sstCommand.pstCompiledTable);
+          sstCommand.pstCompiledTable = orxNULL;
+
           /* Logs message */
           orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Failed to create command trie.");
         }
@@ -4399,6 +5132,21 @@ orxSTATUS orxFASTCALL orxCommand_Init()
           orxBank_Delete(sstCommand.pstBank);
         }
 
+        /* Partly initialized? */
+        if(sstCommand.pstResultBank != orxNULL)
+        {
+          /* Deletes bank */
+          orxBank_Delete(sstCommand.pstResultBank);
+        }
+
+        /* Partly initialized? */
+        if(sstCommand.pstCompiledTable != orxNULL)
+        {
+          /* Deletes table */
+          orxHashTable_Delete(sstCommand.pstCompiledTable);
+          sstCommand.pstCompiledTable = orxNULL;
+        }
+
         /* Removes event handlers */
         orxEvent_RemoveHandler(orxEVENT_TYPE_TIMELINE, orxCommand_EventHandler);
         orxEvent_RemoveHandler(orxEVENT_TYPE_TRIGGER, orxCommand_EventHandler);
@@ -4478,6 +5226,10 @@ void orxFASTCALL orxCommand_Exit()
     orxBank_Delete(sstCommand.pstTrieBank);
     orxBank_Delete(sstCommand.pstResultBank);
 
+    /* Deletes compiled command table */
+    orxCommand_ClearCache();
+    orxHashTable_Delete(sstCommand.pstCompiledTable);
+
     /* Removes event handlers */
     orxEvent_RemoveHandler(orxEVENT_TYPE_TIMELINE, orxCommand_EventHandler);
     orxEvent_RemoveHandler(orxEVENT_TYPE_TRIGGER, orxCommand_EventHandler);
@@ -4748,6 +5500,9 @@ orxSTATUS orxFASTCALL orxCommand_AddAlias(const orxSTRING _zAlias, const orxSTRI
           /* Success? */
           if(eResult != orxSTATUS_FAILURE)
           {
+            /* Clears cache */
+            orxCommand_ClearCache();
+
             /* Updates aliased name */
             pstAliasNode->pstCommand->zAliasedCommandName = orxString_Duplicate(_zCommand);
             pstAliasNode->pstCommand->zArgs               = (_zArgs != orxNULL) ? orxString_Duplicate(_zArgs) : orxNULL;
@@ -4801,6 +5556,9 @@ orxSTATUS orxFASTCALL orxCommand_RemoveAlias(const orxSTRING _zAlias)
       /* Is an alias? */
       if((pstNode->pstCommand != orxNULL) && (pstNode->pstCommand->bIsAlias != orxFALSE))
       {
+        /* Clears cache */
+        orxCommand_ClearCache();
+
         /* Deletes its aliased name */
         orxString_Delete(pstNode->pstCommand->zAliasedCommandName);
 
@@ -5137,17 +5895,31 @@ orxCOMMAND_VAR *orxFASTCALL orxCommand_EvaluateWithGUID(const orxSTRING _zComman
   /* Valid? */
   if((_zCommandLine != orxNULL) && (*_zCommandLine != orxCHAR_NULL))
   {
-    orxS32 s32Offset;
+    const orxCOMMAND_COMPILED *pstCompiled;
 
-    /* Stores it in buffer */
-    s32Offset = orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, sizeof(sstCommand.acEvaluateBuffer) - sstCommand.s32EvaluateOffset, "%s", _zCommandLine) + 1;
-    sstCommand.s32EvaluateOffset += s32Offset;
+    /* Gets its compiled version */
+    pstCompiled = orxCommand_GetCompiled(_zCommandLine);
 
-    /* Processes it */
-    pstResult = orxCommand_Process(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset - s32Offset, _u64GUID, _pstResult, orxFALSE);
+    /* Valid? */
+    if(pstCompiled != orxNULL)
+    {
+      /* Runs it */
+      pstResult = orxCommand_RunCompiled(pstCompiled, _zCommandLine, _u64GUID, _pstResult);
+    }
+    else
+    {
+      orxS32 s32Offset;
+
+      /* Stores it in buffer */
+      s32Offset = orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, sizeof(sstCommand.acEvaluateBuffer) - sstCommand.s32EvaluateOffset, "%s", _zCommandLine) + 1;
+      sstCommand.s32EvaluateOffset += s32Offset;
 
-    /* Restores buffer offset */
-    sstCommand.s32EvaluateOffset -= s32Offset;
+      /* Processes it */
+      pstResult = orxCommand_Process(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset - s32Offset, _u64GUID, _pstResult, orxFALSE);
+
+      /* Restores buffer offset */
+      sstCommand.s32EvaluateOffset -= s32Offset;
+    }
   }
 
   /* Done! */
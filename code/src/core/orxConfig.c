@@ -45,6 +45,10 @@
 #include "utils/orxLinkList.h"
 #include "utils/orxString.h"
 
+#define XXH_INLINE_ALL
+#include "xxhash.h"
+#undef XXH_INLINE_ALL
+
 #ifdef __orxMSVC__
 
 #include <direct.h>
@@ -95,6 +99,8 @@
 #define orxCONFIG_KU32_ENTRY_BANK_SIZE            16384       /**< Default entry bank size */
 #define orxCONFIG_KU32_HISTORY_BANK_SIZE          32          /**< Default history bank size */
 #define orxCONFIG_KU32_KEY_TABLE_SIZE             128         /**< Default key table size */
+#define orxCONFIG_KU32_ENTRY_INDEX_THRESHOLD      16          /**< Entry count above which a section gets a key index */
+#define orxCONFIG_KU32_VALUE_CACHE_SIZE           1024        /**< Inherited value lookup cache size (power of 2) */
 #define orxCONFIG_KU32_BASE_FILENAME_LENGTH       256         /**< Base file name length */
 #define orxCONFIG_KU32_STACK_SIZE                 64          /**< Section stack size */
 
@@ -105,6 +111,13 @@
 
 #define orxCONFIG_KU32_KEY_MAX_EDIT_DISTANCE      2UL         /**< Key max edit distance */
 
+#define orxCONFIG_KZ_SNAPSHOT_TAG                 "OCSS"      /**< Snapshot file tag */
+#define orxCONFIG_KU32_SNAPSHOT_VERSION           1           /**< Snapshot format version */
+#define orxCONFIG_KU32_SNAPSHOT_PARENT_NONE       0xFFFFFFFE  /**< Snapshot 'no default parent' marker */
+#define orxCONFIG_KU32_SNAPSHOT_ALIGNMENT         8           /**< Snapshot data alignment */
+#define orxCONFIG_KU32_SNAPSHOT_CACHE_SIZE        (offsetof(orxCONFIG_VALUE, au32ListIndexTable) - offsetof(orxCONFIG_VALUE, vValue)) /**< Snapshot cached typed values size */
+#define orxCONFIG_KU64_SNAPSHOT_HASH_SEED         0x4F43535300000001ULL /**< Snapshot hash seed */
+
 #define orxCONFIG_KC_SECTION_START                '['         /**< Section start character */
 #define orxCONFIG_KC_SECTION_END                  ']'         /**< Section end character */
 #define orxCONFIG_KC_SECTION_CLEAR                '!'         /**< Section clear character */
@@ -357,9 +370,98 @@ typedef struct __orxCONFIG_SECTION_t
   orxLINKLIST       stEntryList;            /**< Entry list : 32 */
   orxS32            s32ProtectionCount;     /**< Protection count : 36 */
   orxSTRINGID       stOriginID;             /**< Origin : 40 */
+  orxCONFIG_ENTRY **apstEntryIndex;         /**< Entry index (open addressing) : 44 */
+  orxU32            u32EntryIndexSize;      /**< Entry index size : 48 */
 
 } orxCONFIG_SECTION;
 
+/** Value cache entry structure
+ */
+typedef struct __orxCONFIG_VALUE_CACHE_ENTRY_t
+{
+  orxSTRINGID         stKeyID;              /**< Key ID : 8 */
+  orxCONFIG_SECTION  *pstSection;           /**< Queried section : 12 */
+  orxCONFIG_SECTION  *pstSource;            /**< Source section : 16 */
+  orxCONFIG_VALUE    *pstValue;             /**< Resolved value : 20 */
+  orxU32              u32Stamp;             /**< Stamp : 24 */
+
+} orxCONFIG_VALUE_CACHE_ENTRY;
+
+/** Snapshot header structure
+ */
+typedef struct __orxCONFIG_SNAPSHOT_HEADER_t
+{
+  orxCHAR             acTag[4];             /**< Tag : 4 */
+  orxU32              u32Version;           /**< Format version : 8 */
+  orxU32              u32Layout;            /**< Memory layout (value size & pointer size) : 12 */
+  orxU32              u32SourceCount;       /**< Source file count : 16 */
+  orxU32              u32SectionCount;      /**< Section count : 20 */
+  orxU32              u32EntryCount;        /**< Entry count : 24 */
+  orxU32              u32DataSize;          /**< Value data size : 28 */
+  orxU32              u32StringSize;        /**< String table size : 32 */
+  orxU32              u32DefaultParent;     /**< Default parent name : 36 */
+  orxU32              u32Padding;           /**< Padding : 40 */
+  orxU64              u64Hash;              /**< Hash of everything after the header : 48 */
+
+} orxCONFIG_SNAPSHOT_HEADER;
+
+/** Snapshot source structure
+ */
+typedef struct __orxCONFIG_SNAPSHOT_SOURCE_t
+{
+  orxU32              u32Name;              /**< Name : 4 */
+  orxU32              u32Size;              /**< Size, orxU32_UNDEFINED if not found : 8 */
+  orxU64              u64Hash;              /**< Content hash : 16 */
+
+} orxCONFIG_SNAPSHOT_SOURCE;
+
+/** Snapshot section structure
+ */
+typedef struct __orxCONFIG_SNAPSHOT_SECTION_t
+{
+  orxU32              u32Name;              /**< Name : 4 */
+  orxU32              u32Parent;            /**< Parent name, orxU32_UNDEFINED / orxCONFIG_KU32_SNAPSHOT_PARENT_NONE : 8 */
+  orxU32              u32Origin;            /**< Origin name, orxU32_UNDEFINED if none : 12 */
+  orxU32              u32EntryCount;        /**< Entry count : 16 */
+
+} orxCONFIG_SNAPSHOT_SECTION;
+
+/** Snapshot entry structure
+ */
+typedef struct __orxCONFIG_SNAPSHOT_ENTRY_t
+{
+  orxU32              u32Key;               /**< Key name : 4 */
+  orxU32              u32Origin;            /**< Origin name, orxU32_UNDEFINED if none : 8 */
+  orxU32              u32Data;              /**< Literal value (+ list index table, + cached typed values if not a string) offset : 12 */
+  orxU32              u32Size;              /**< Literal value size : 16 */
+  orxU16              u16Type;              /**< Value type : 18 */
+  orxU16              u16Flags;             /**< Value flags : 20 */
+  orxU16              u16ListCount;         /**< List count : 22 */
+  orxU16              u16CacheIndex;        /**< Cache index : 24 */
+
+} orxCONFIG_SNAPSHOT_ENTRY;
+
+/** Snapshot buffer structure
+ */
+typedef struct __orxCONFIG_SNAPSHOT_BUFFER_t
+{
+  orxU8              *pu8Data;              /**< Data : 4 */
+  orxU32              u32Size;              /**< Used size : 8 */
+  orxU32              u32Capacity;          /**< Capacity : 12 */
+
+} orxCONFIG_SNAPSHOT_BUFFER;
+
+/** Snapshot target structure
+ */
+typedef struct __orxCONFIG_SNAPSHOT_TARGET_t
+{
+  orxCONFIG_ENTRY    *pstEntry;             /**< Entry : 4 */
+  orxSTRING           zValue;               /**< Allocated literal value : 8 */
+  orxU32             *au32ListIndexTable;   /**< Allocated list index table : 12 */
+  orxBOOL             bNew;                 /**< Is a new entry : 16 */
+
+} orxCONFIG_SNAPSHOT_TARGET;
+
 /** Static structure
  */
 typedef struct __orxCONFIG_STATIC_t
@@ -382,6 +484,8 @@ typedef struct __orxCONFIG_STATIC_t
   orxHASHTABLE       *pstKeyTable;          /**< Key table */
   orxCONFIG_SECTION  *pstDefaultParent;     /**< Default parent section */
   orxU32              u32CurrentStackEntry; /**< Current stack entry */
+  orxU32              u32CacheStamp;        /**< Value cache stamp */
+  orxCONFIG_VALUE_CACHE_ENTRY astValueCache[orxCONFIG_KU32_VALUE_CACHE_SIZE]; /**< Value cache */
   orxCONFIG_SECTION*  apstSectionStack[orxCONFIG_KU32_STACK_SIZE]; /**< Section stack */
   orxCHAR             acCommandBuffer[orxCONFIG_KU32_COMMAND_BUFFER_SIZE]; /**< Command buffer */
   orxCHAR             zBaseFile[orxCONFIG_KU32_BASE_FILENAME_LENGTH]; /**< Base file name */
@@ -699,6 +803,117 @@ static orxINLINE void orxConfig_CleanValue(orxCONFIG_VALUE *_pstValue)
   return;
 }
 
+/** Invalidates all cached value lookups
+ */
+static orxINLINE void orxConfig_InvalidateCache()
+{
+  /* Updates stamp, wrapping around? */
+  if(++sstConfig.u32CacheStamp == 0)
+  {
+    /* Clears cache */
+    orxMemory_Zero(sstConfig.astValueCache, sizeof(sstConfig.astValueCache));
+
+    /* Skips null stamp */
+    sstConfig.u32CacheStamp = 1;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets an entry index slot
+ * @param[in] _stKeyID          Entry key ID
+ * @param[in] _u32Size          Index size (power of 2)
+ * @return                      Slot
+ */
+static orxINLINE orxU32 orxConfig_GetEntryIndexSlot(orxSTRINGID _stKeyID, orxU32 _u32Size)
+{
+  /* Done! */
+  return ((orxU32)_stKeyID ^ (orxU32)(_stKeyID >> 32)) & (_u32Size - 1);
+}
+
+/** Adds an entry to its section's index
+ * @param[in] _pstSection       Concerned section
+ * @param[in] _pstEntry         Entry to add
+ */
+static orxINLINE void orxConfig_AddToEntryIndex(orxCONFIG_SECTION *_pstSection, orxCONFIG_ENTRY *_pstEntry)
+{
+  orxU32 u32Slot;
+
+  /* Checks */
+  orxASSERT(_pstSection->apstEntryIndex != orxNULL);
+
+  /* Finds first free slot (linear probing) */
+  for(u32Slot = orxConfig_GetEntryIndexSlot(_pstEntry->stID, _pstSection->u32EntryIndexSize);
+      _pstSection->apstEntryIndex[u32Slot] != orxNULL;
+      u32Slot = (u32Slot + 1) & (_pstSection->u32EntryIndexSize - 1))
+    ;
+
+  /* Stores entry */
+  _pstSection->apstEntryIndex[u32Slot] = _pstEntry;
+
+  /* Done! */
+  return;
+}
+
+/** Deletes a section's entry index
+ * @param[in] _pstSection       Concerned section
+ */
+static orxINLINE void orxConfig_DeleteEntryIndex(orxCONFIG_SECTION *_pstSection)
+{
+  /* Has index? */
+  if(_pstSection->apstEntryIndex != orxNULL)
+  {
+    /* Deletes it */
+    orxMemory_Free(_pstSection->apstEntryIndex);
+    _pstSection->apstEntryIndex     = orxNULL;
+    _pstSection->u32EntryIndexSize  = 0;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Creates a section's entry index
+ * @param[in] _pstSection       Concerned section
+ */
+static void orxFASTCALL orxConfig_CreateEntryIndex(orxCONFIG_SECTION *_pstSection)
+{
+  orxU32 u32Size;
+
+  /* Checks */
+  orxASSERT(_pstSection->apstEntryIndex == orxNULL);
+
+  /* Gets size, keeping load factor under 50% */
+  for(u32Size = orxCONFIG_KU32_ENTRY_INDEX_THRESHOLD << 1; u32Size < (orxLinkList_GetCount(&(_pstSection->stEntryList)) << 1); u32Size <<= 1)
+    ;
+
+  /* Allocates index */
+  _pstSection->apstEntryIndex = (orxCONFIG_ENTRY **)orxMemory_Allocate(u32Size * sizeof(orxCONFIG_ENTRY *), orxMEMORY_TYPE_CONFIG);
+
+  /* Success? */
+  if(_pstSection->apstEntryIndex != orxNULL)
+  {
+    orxCONFIG_ENTRY *pstEntry;
+
+    /* Inits it */
+    orxMemory_Zero(_pstSection->apstEntryIndex, u32Size * sizeof(orxCONFIG_ENTRY *));
+    _pstSection->u32EntryIndexSize = u32Size;
+
+    /* For all entries */
+    for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(_pstSection->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Adds it to index */
+      orxConfig_AddToEntryIndex(_pstSection, pstEntry);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Deletes an entry
  * @param[in] _pstEntry         Entry to delete
  */
@@ -707,6 +922,12 @@ static orxINLINE void orxConfig_DeleteEntry(orxCONFIG_ENTRY *_pstEntry)
   /* Checks */
   orxASSERT(_pstEntry != orxNULL);
 
+  /* Deletes its section's index (will be rebuilt on demand) */
+  orxConfig_DeleteEntryIndex(orxSTRUCT_GET_FROM_FIELD(orxCONFIG_SECTION, stEntryList, orxLinkList_GetList(&(_pstEntry->stNode))));
+
+  /* Invalidates cache */
+  orxConfig_InvalidateCache();
+
   /* Deletes value */
   orxConfig_CleanValue(&(_pstEntry->stValue));
 
@@ -1363,23 +1584,58 @@ static orxINLINE void orxConfig_CryptBuffer(orxCHAR *_acBuffer, orxU32 _u32Buffe
  */
 static orxINLINE orxCONFIG_ENTRY *orxConfig_GetEntry(orxSTRINGID _stKeyID)
 {
-  orxCONFIG_ENTRY *pstResult = orxNULL, *pstEntry;
+  orxCONFIG_SECTION  *pstSection;
+  orxCONFIG_ENTRY    *pstResult = orxNULL, *pstEntry;
 
   /* Checks */
   orxASSERT(sstConfig.pstCurrentSection != orxNULL);
 
-  /* For all entries */
-  for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(sstConfig.pstCurrentSection->stEntryList));
-      pstEntry != orxNULL;
-      pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+  /* Gets current section */
+  pstSection = sstConfig.pstCurrentSection;
+
+  /* Large section without index? */
+  if((pstSection->apstEntryIndex == orxNULL)
+  && (orxLinkList_GetCount(&(pstSection->stEntryList)) >= orxCONFIG_KU32_ENTRY_INDEX_THRESHOLD))
   {
-    /* Found? */
-    if(_stKeyID == pstEntry->stID)
+    /* Creates it */
+    orxConfig_CreateEntryIndex(pstSection);
+  }
+
+  /* Has index? */
+  if(pstSection->apstEntryIndex != orxNULL)
+  {
+    orxU32 u32Slot;
+
+    /* For all probed slots */
+    for(u32Slot = orxConfig_GetEntryIndexSlot(_stKeyID, pstSection->u32EntryIndexSize);
+        (pstEntry = pstSection->apstEntryIndex[u32Slot]) != orxNULL;
+        u32Slot = (u32Slot + 1) & (pstSection->u32EntryIndexSize - 1))
     {
-      /* Updates result */
-      pstResult = pstEntry;
+      /* Found? */
+      if(_stKeyID == pstEntry->stID)
+      {
+        /* Updates result */
+        pstResult = pstEntry;
 
-      break;
+        break;
+      }
+    }
+  }
+  else
+  {
+    /* For all entries */
+    for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Found? */
+      if(_stKeyID == pstEntry->stID)
+      {
+        /* Updates result */
+        pstResult = pstEntry;
+
+        break;
+      }
     }
   }
 
@@ -1596,6 +1852,55 @@ static orxCONFIG_VALUE *orxFASTCALL orxConfig_GetValueFromKey(orxSTRINGID _stKey
   return pstResult;
 }
 
+/** Gets a value from the current section, using inheritance and the lookup cache
+ * @param[in] _stKeyID          Entry key ID
+ * @param[out] _ppstSource      Source section where the value was found
+ * @return                      orxCONFIG_VALUE / orxNULL
+ */
+static orxINLINE orxCONFIG_VALUE *orxConfig_GetCachedValueFromKey(orxSTRINGID _stKeyID, orxCONFIG_SECTION **_ppstSource)
+{
+  orxCONFIG_VALUE_CACHE_ENTRY  *pstCacheEntry;
+  orxCONFIG_VALUE              *pstResult;
+
+  /* Checks */
+  orxASSERT(sstConfig.pstCurrentSection != orxNULL);
+
+  /* Gets cache entry */
+  pstCacheEntry = &(sstConfig.astValueCache[orxConfig_GetEntryIndexSlot(_stKeyID ^ (orxSTRINGID)((orxUPTR)sstConfig.pstCurrentSection >> 4) * 0x9E3779B97F4A7C15ULL, orxCONFIG_KU32_VALUE_CACHE_SIZE)]);
+
+  /* Hit? */
+  if((pstCacheEntry->u32Stamp == sstConfig.u32CacheStamp)
+  && (pstCacheEntry->stKeyID == _stKeyID)
+  && (pstCacheEntry->pstSection == sstConfig.pstCurrentSection))
+  {
+    /* Updates result */
+    pstResult     = pstCacheEntry->pstValue;
+    *_ppstSource  = pstCacheEntry->pstSource;
+  }
+  else
+  {
+    orxCONFIG_SECTION  *pstSection;
+    orxU32              u32Stamp;
+
+    /* Backups current section & stamp (a lookup that modifies config, ie. creates sections, won't be cached) */
+    pstSection  = sstConfig.pstCurrentSection;
+    u32Stamp    = sstConfig.u32CacheStamp;
+
+    /* Gets value */
+    pstResult = orxConfig_GetValueFromKey(_stKeyID, pstSection, _ppstSource);
+
+    /* Stores it */
+    pstCacheEntry->stKeyID    = _stKeyID;
+    pstCacheEntry->pstSection = pstSection;
+    pstCacheEntry->pstSource  = *_ppstSource;
+    pstCacheEntry->pstValue   = pstResult;
+    pstCacheEntry->u32Stamp   = u32Stamp;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Checks for typo
  */
 static orxBOOL orxFASTCALL orxConfig_CheckTypo(const orxSTRING _zKeyName, const orxSTRING _zSectionName, void *_pContext)
@@ -1675,7 +1980,7 @@ static orxINLINE orxCONFIG_VALUE *orxConfig_GetValue(const orxSTRING _zKey)
     stID = orxString_Hash(_zKey);
 
     /* Gets value */
-    pstResult = orxConfig_GetValueFromKey(stID, sstConfig.pstCurrentSection, &pstDummy);
+    pstResult = orxConfig_GetCachedValueFromKey(stID, &pstDummy);
 
 #ifdef __orxDEBUG__
 
@@ -1730,6 +2035,9 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
     /* Gets key ID */
     stKeyID = orxString_GetID(_zKey);
 
+    /* Invalidates cache */
+    orxConfig_InvalidateCache();
+
     /* Gets existing entry */
     pstEntry = orxConfig_GetEntry(stKeyID);
 
@@ -1839,6 +2147,22 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
 
           /* Sets its ID */
           pstEntry->stID = stKeyID;
+
+          /* Has index? */
+          if(sstConfig.pstCurrentSection->apstEntryIndex != orxNULL)
+          {
+            /* Enough room left? */
+            if((orxLinkList_GetCount(&(sstConfig.pstCurrentSection->stEntryList)) << 1) <= sstConfig.pstCurrentSection->u32EntryIndexSize)
+            {
+              /* Adds it to index */
+              orxConfig_AddToEntryIndex(sstConfig.pstCurrentSection, pstEntry);
+            }
+            else
+            {
+              /* Deletes index (will be rebuilt on demand) */
+              orxConfig_DeleteEntryIndex(sstConfig.pstCurrentSection);
+            }
+          }
         }
 
         /* Inits its type */
@@ -1855,6 +2179,9 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
           /* Reusing entry? */
           if(bReuse != orxFALSE)
           {
+            /* Deletes index (will be rebuilt on demand) */
+            orxConfig_DeleteEntryIndex(sstConfig.pstCurrentSection);
+
             /* Removes it from list */
             orxLinkList_Remove(&(pstEntry->stNode));
           }
@@ -1890,8 +2217,10 @@ static orxINLINE orxCONFIG_SECTION *orxConfig_CreateSection(const orxSTRING _zSe
     /* Creates origin */
     pstSection->stOriginID = sstConfig.stLoadFileID;
 
-    /* Clears its entry list */
+    /* Clears its entry list & index */
     orxMemory_Zero(&(pstSection->stEntryList), sizeof(orxLINKLIST));
+    pstSection->apstEntryIndex    = orxNULL;
+    pstSection->u32EntryIndexSize = 0;
 
     /* Adds it to list */
     orxMemory_Zero(&(pstSection->stNode), sizeof(orxLINKLIST_NODE));
@@ -2017,6 +2346,12 @@ static orxINLINE orxSTATUS orxConfig_DeleteSection(orxCONFIG_SECTION *_pstSectio
         /* Removes it from table */
         orxHashTable_Remove(sstConfig.pstSectionTable, orxString_Hash(_pstSection->zName));
 
+        /* Deletes its index */
+        orxConfig_DeleteEntryIndex(_pstSection);
+
+        /* Invalidates cache */
+        orxConfig_InvalidateCache();
+
         /* Removes section */
         orxBank_Free(sstConfig.pstSectionBank, _pstSection);
 
@@ -3763,6 +4098,9 @@ static orxSTATUS orxConfig_SelectSectionInternal(const orxSTRING _zSectionName)
 
           /* Updates parent ID */
           pstSection->pstParent = pstParent;
+
+          /* Invalidates cache */
+          orxConfig_InvalidateCache();
         }
       }
     }
@@ -3794,106 +4132,771 @@ static orxSTATUS orxConfig_SelectSectionInternal(const orxSTRING _zSectionName)
   return eResult;
 }
 
-/** Origin save callback
+/** Hashes a buffer (snapshot validation)
+ * @param[in] _u64Hash          Current hash, used as seed
+ * @param[in] _pBuffer          Buffer to hash
+ * @param[in] _u32Size          Size of the buffer
+ * @return                      Updated hash
  */
-static orxBOOL orxFASTCALL orxConfig_OriginSaveCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+static orxINLINE orxU64 orxConfig_HashSnapshotBuffer(orxU64 _u64Hash, const void *_pBuffer, orxU32 _u32Size)
 {
-  orxBOOL bResult;
+  /* Done! */
+  return (_u32Size != 0) ? (orxU64)XXH3_64bits_withSeed(_pBuffer, (size_t)_u32Size, (XXH64_hash_t)_u64Hash) : _u64Hash;
+}
 
-#ifdef __orxWINDOWS__
+/** Hashes a source file (snapshot validation)
+ * @param[in] _zName            Name of the source file
+ * @param[out] _pu32Size        Size of the source file, orxU32_UNDEFINED if not found
+ * @return                      Content hash
+ */
+static orxU64 orxFASTCALL orxConfig_HashSnapshotSource(const orxSTRING _zName, orxU32 *_pu32Size)
+{
+  const orxSTRING zResourceLocation;
+  orxHANDLE       hResource;
+  orxU64          u64Result = orxCONFIG_KU64_SNAPSHOT_HASH_SEED;
 
-  /* Updates result */
-  bResult = ((_zKeyName != orxNULL) || (orxString_ICompare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+  /* Clears size */
+  *_pu32Size = orxU32_UNDEFINED;
 
-#else /* __orxWINDOWS__ */
+  /* Valid source? */
+  if((*_zName != orxCHAR_NULL)
+  && ((zResourceLocation = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, _zName)) != orxNULL)
+  && ((hResource = orxResource_Open(zResourceLocation, orxFALSE)) != orxHANDLE_UNDEFINED))
+  {
+    orxCHAR acBuffer[orxCONFIG_KU32_BUFFER_SIZE];
+    orxU32  u32Size, u32TotalSize;
 
-  /* Updates result */
-  bResult = ((_zKeyName != orxNULL) || (orxString_Compare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+    /* For all chunks */
+    for(u32TotalSize = 0;
+        (u32Size = (orxU32)orxResource_Read(hResource, orxCONFIG_KU32_BUFFER_SIZE, acBuffer, orxNULL, orxNULL)) > 0;
+        u32TotalSize += u32Size)
+    {
+      /* Updates hash */
+      u64Result = orxConfig_HashSnapshotBuffer(u64Result, acBuffer, u32Size);
+    }
 
-#endif /* __orxWINDOWS__ */
+    /* Closes it */
+    orxResource_Close(hResource);
+
+    /* Stores size */
+    *_pu32Size = u32TotalSize;
+  }
 
   /* Done! */
-  return bResult;
+  return u64Result;
 }
 
-/** Origin clear callback
+/** Appends data to a snapshot buffer
+ * @param[in] _pstBuffer        Concerned buffer
+ * @param[in] _pData            Data to append, orxNULL to only reserve room
+ * @param[in] _u32Size          Size of the data
+ * @return                      Offset of the data in the buffer, orxU32_UNDEFINED if failed
  */
-static orxBOOL orxFASTCALL orxConfig_OriginClearCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName)
+static orxU32 orxFASTCALL orxConfig_AppendSnapshotBuffer(orxCONFIG_SNAPSHOT_BUFFER *_pstBuffer, const void *_pData, orxU32 _u32Size)
 {
-  orxBOOL bResult;
+  orxU32 u32Result = orxU32_UNDEFINED, u32Size;
 
-  /* Updates result */
-  bResult = (orxConfig_GetOriginID(_zSectionName) != orxSTRINGID_UNDEFINED) ? orxTRUE : orxFALSE;
+  /* Gets aligned size */
+  u32Size = orxALIGN(_u32Size, orxCONFIG_KU32_SNAPSHOT_ALIGNMENT);
 
-  /* Done! */
-  return bResult;
-}
+  /* Not enough room? */
+  if(_pstBuffer->u32Size + u32Size > _pstBuffer->u32Capacity)
+  {
+    orxU32  u32Capacity;
+    orxU8  *pu8Data;
 
-/** Transforms a string to Pascal case
- */
-static void orxFASTCALL orxConfig_ToPascalCase(orxSTRING _zDst, const orxSTRING _zSrc)
-{
-  const orxCHAR  *pcSrc;
-  orxCHAR        *pcDst;
-  orxBOOL         bUpper;
+    /* Gets new capacity */
+    for(u32Capacity = orxMAX(_pstBuffer->u32Capacity, orxCONFIG_KU32_BUFFER_SIZE); _pstBuffer->u32Size + u32Size > u32Capacity; u32Capacity <<= 1)
+      ;
 
-  /* For all characters */
-  for(pcSrc = _zSrc, pcDst = _zDst, bUpper = orxTRUE; *pcSrc != orxCHAR_NULL; pcSrc++, pcDst++)
-  {
-    /* Is an underscore? */
-    if(*pcSrc == '_')
-    {
-      /* Replaces it with a space */
-      *pcDst = ' ';
+    /* Grows buffer */
+    pu8Data = (orxU8 *)orxMemory_Reallocate(_pstBuffer->pu8Data, u32Capacity, orxMEMORY_TYPE_TEMP);
 
-      /* Updates status */
-      bUpper = orxTRUE;
-    }
-    /* Is a space? */
-    else if(*pcSrc == ' ')
+    /* Success? */
+    if(pu8Data != orxNULL)
     {
-      /* Skips it */
-      pcDst--;
-
-      /* Updates status */
-      bUpper = orxTRUE;
+      /* Stores it */
+      _pstBuffer->pu8Data     = pu8Data;
+      _pstBuffer->u32Capacity = u32Capacity;
     }
-    else
-    {
-      /* Updates character */
-      *pcDst = ((bUpper != orxFALSE) && (*pcSrc >= 'a') && (*pcSrc <= 'z'))
-               ? *pcSrc & ~0x20
-               : ((bUpper == orxFALSE) && (*pcSrc >= 'A') && (*pcSrc <= 'Z'))
-                 ? *pcSrc | 0x20
-                 : *pcSrc;
+  }
 
-      /* Updates status */
-      bUpper = orxFALSE;
+  /* Enough room? */
+  if(_pstBuffer->u32Size + u32Size <= _pstBuffer->u32Capacity)
+  {
+    /* Updates result */
+    u32Result = _pstBuffer->u32Size;
+
+    /* Copies data */
+    if(_pData != orxNULL)
+    {
+      orxMemory_Copy(_pstBuffer->pu8Data + u32Result, _pData, _u32Size);
     }
-  }
 
-  /* Ends string */
-  *pcDst = orxCHAR_NULL;
+    /* Clears padding */
+    orxMemory_Zero(_pstBuffer->pu8Data + u32Result + _u32Size, u32Size - _u32Size);
+
+    /* Updates size */
+    _pstBuffer->u32Size += u32Size;
+  }
 
   /* Done! */
-  return;
+  return u32Result;
 }
 
-/** Set default color list
+/** Adds a string to a snapshot string table
+ * @param[in] _pstBuffer        String table buffer
+ * @param[in] _pstTable         String table index
+ * @param[in] _zString          String to add
+ * @return                      Offset of the string in the table, orxU32_UNDEFINED if failed
  */
-static void orxFASTCALL orxConfig_SetDefaultColorList()
+static orxU32 orxFASTCALL orxConfig_AddSnapshotString(orxCONFIG_SNAPSHOT_BUFFER *_pstBuffer, orxHASHTABLE *_pstTable, const orxSTRING _zString)
 {
-  orxCHAR acParentBuffer[128];
-  orxS32  s32Offset;
-  orxU32  i, iCount;
+  orxSTRINGID stID;
+  orxU32      u32Result;
+  void      **ppBucket;
 
-#define orxCOLOR_DECLARE(NAME, R, G, B) {#NAME, &orxVECTOR_##NAME},
+  /* Gets string ID */
+  stID = orxString_Hash(_zString);
 
-  struct
-  {
-    const orxSTRING   zName;
-    const orxVECTOR  *pvColor;
-  } astColorList[] =
+  /* Gets its bucket */
+  ppBucket = orxHashTable_Retrieve(_pstTable, stID);
+
+  /* Already stored? */
+  if((ppBucket != orxNULL) && (*ppBucket != orxNULL))
+  {
+    /* Updates result (offsets are stored with a +1 bias) */
+    u32Result = (orxU32)((orxUPTR)*ppBucket - 1);
+  }
+  else
+  {
+    /* Adds it */
+    u32Result = orxConfig_AppendSnapshotBuffer(_pstBuffer, _zString, orxString_GetLength(_zString) + 1);
+
+    /* Success? */
+    if((u32Result != orxU32_UNDEFINED) && (ppBucket != orxNULL))
+    {
+      /* Stores it */
+      *ppBucket = (void *)(orxUPTR)(u32Result + 1);
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Adds an origin to a snapshot
+ * @param[in] _pstStringBuffer  String table buffer
+ * @param[in] _pstStringTable   String table index
+ * @param[in] _pstSourceTable   Source table
+ * @param[in] _stOriginID       Origin ID
+ * @return                      Offset of the origin name in the string table, orxU32_UNDEFINED if none
+ */
+static orxU32 orxFASTCALL orxConfig_AddSnapshotOrigin(orxCONFIG_SNAPSHOT_BUFFER *_pstStringBuffer, orxHASHTABLE *_pstStringTable, orxHASHTABLE *_pstSourceTable, orxSTRINGID _stOriginID)
+{
+  orxU32 u32Result = orxU32_UNDEFINED;
+
+  /* Valid? */
+  if(_stOriginID != orxSTRINGID_UNDEFINED)
+  {
+    const orxSTRING zOrigin;
+
+    /* Gets its name */
+    zOrigin = orxString_GetFromID(_stOriginID);
+
+    /* Valid? */
+    if(*zOrigin != orxCHAR_NULL)
+    {
+      /* Adds it */
+      u32Result = orxConfig_AddSnapshotString(_pstStringBuffer, _pstStringTable, zOrigin);
+
+      /* Success? */
+      if(u32Result != orxU32_UNDEFINED)
+      {
+        /* Tracks it as a source */
+        orxHashTable_Set(_pstSourceTable, _stOriginID, (void *)(orxUPTR)(u32Result + 1));
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Deletes a snapshot buffer
+ * @param[in] _pstBuffer        Concerned buffer
+ */
+static orxINLINE void orxConfig_DeleteSnapshotBuffer(orxCONFIG_SNAPSHOT_BUFFER *_pstBuffer)
+{
+  /* Has data? */
+  if(_pstBuffer->pu8Data != orxNULL)
+  {
+    /* Deletes it */
+    orxMemory_Free(_pstBuffer->pu8Data);
+    _pstBuffer->pu8Data = orxNULL;
+  }
+
+  /* Clears it */
+  _pstBuffer->u32Size = _pstBuffer->u32Capacity = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Gets snapshot memory layout (a snapshot can only be loaded by a build sharing the same layout)
+ * @return                      Snapshot memory layout
+ */
+static orxINLINE orxU32 orxConfig_GetSnapshotLayout()
+{
+  /* Done! */
+  return ((orxU32)sizeof(orxCONFIG_SNAPSHOT_ENTRY) << 16) | ((orxU32)sizeof(orxCONFIG_VALUE) << 8) | (orxU32)sizeof(void *);
+}
+
+/** Checks a snapshot: header, content hash, bounds & source files
+ * @param[in] _pu8Buffer        Snapshot buffer
+ * @param[in] _u32Size          Snapshot size
+ * @return                      orxTRUE if the snapshot can be applied, orxFALSE otherwise
+ */
+static orxBOOL orxFASTCALL orxConfig_CheckSnapshot(const orxU8 *_pu8Buffer, orxU32 _u32Size)
+{
+  const orxCONFIG_SNAPSHOT_HEADER *pstHeader;
+  orxU64                          au64PartSize[5], u64Size, u64Hash;
+  orxU32                          i;
+  orxBOOL                         bResult = orxFALSE;
+
+  /* Gets header */
+  pstHeader = (const orxCONFIG_SNAPSHOT_HEADER *)_pu8Buffer;
+
+  /* Gets part sizes (in file order) */
+  au64PartSize[0] = (orxU64)pstHeader->u32SourceCount * sizeof(orxCONFIG_SNAPSHOT_SOURCE);
+  au64PartSize[1] = (orxU64)pstHeader->u32SectionCount * sizeof(orxCONFIG_SNAPSHOT_SECTION);
+  au64PartSize[2] = (orxU64)pstHeader->u32EntryCount * sizeof(orxCONFIG_SNAPSHOT_ENTRY);
+  au64PartSize[3] = (orxU64)pstHeader->u32DataSize;
+  au64PartSize[4] = (orxU64)pstHeader->u32StringSize;
+
+  /* Gets expected size */
+  for(i = 0, u64Size = (orxU64)sizeof(orxCONFIG_SNAPSHOT_HEADER); i < orxARRAY_GET_ITEM_COUNT(au64PartSize); i++)
+  {
+    u64Size += au64PartSize[i];
+  }
+
+  /* Valid header & size? */
+  if((orxMemory_Compare(pstHeader->acTag, orxCONFIG_KZ_SNAPSHOT_TAG, sizeof(pstHeader->acTag)) == 0)
+  && (pstHeader->u32Version == orxCONFIG_KU32_SNAPSHOT_VERSION)
+  && (pstHeader->u32Layout == orxConfig_GetSnapshotLayout())
+  && (u64Size == (orxU64)_u32Size)
+  && (pstHeader->u32StringSize != 0)
+  && (_pu8Buffer[_u32Size - 1] == orxCHAR_NULL))
+  {
+    /* For all parts */
+    for(i = 0, u64Size = (orxU64)sizeof(orxCONFIG_SNAPSHOT_HEADER), u64Hash = orxCONFIG_KU64_SNAPSHOT_HASH_SEED; i < orxARRAY_GET_ITEM_COUNT(au64PartSize); u64Size += au64PartSize[i++])
+    {
+      /* Updates hash */
+      u64Hash = orxConfig_HashSnapshotBuffer(u64Hash, _pu8Buffer + u64Size, (orxU32)au64PartSize[i]);
+    }
+
+    /* Updates result */
+    bResult = (u64Hash == pstHeader->u64Hash) ? orxTRUE : orxFALSE;
+  }
+
+  /* Valid content? */
+  if(bResult != orxFALSE)
+  {
+    const orxCONFIG_SNAPSHOT_SOURCE  *pstSource;
+    const orxSTRING                   zStringTable;
+
+    /* Gets source list & string table */
+    pstSource     = (const orxCONFIG_SNAPSHOT_SOURCE *)(_pu8Buffer + sizeof(orxCONFIG_SNAPSHOT_HEADER));
+    zStringTable  = (const orxSTRING)(_pu8Buffer + _u32Size - pstHeader->u32StringSize);
+
+    /* For all sources */
+    for(i = 0; (i < pstHeader->u32SourceCount) && (bResult != orxFALSE); i++, pstSource++)
+    {
+      orxU32 u32Size;
+
+      /* Unchanged? */
+      bResult = ((pstSource->u32Name < pstHeader->u32StringSize)
+              && (orxConfig_HashSnapshotSource(zStringTable + pstSource->u32Name, &u32Size) == pstSource->u64Hash)
+              && (u32Size == pstSource->u32Size)) ? orxTRUE : orxFALSE;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Applies a (checked) snapshot to the current config: everything that can fail is allocated first, so that the config is left untouched on failure
+ * @param[in] _pu8Buffer        Snapshot buffer
+ * @return                      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxConfig_ApplySnapshot(const orxU8 *_pu8Buffer)
+{
+  const orxCONFIG_SNAPSHOT_HEADER  *pstHeader;
+  const orxCONFIG_SNAPSHOT_SECTION *astSectionList, *pstSnapshotSection;
+  const orxCONFIG_SNAPSHOT_ENTRY   *astEntryList, *pstSnapshotEntry;
+  const orxU8                      *pu8Data;
+  const orxCHAR                    *zStringTable;
+  orxCONFIG_SNAPSHOT_TARGET        *astTargetList, *pstTarget;
+  orxCONFIG_SECTION               **apstSectionList, **apstCreatedList;
+  orxCONFIG_SECTION                *pstPreviousSection;
+  orxSTRINGID                       stOriginID = orxSTRINGID_UNDEFINED;
+  orxU32                            u32Origin = orxU32_UNDEFINED, u32CreatedCount = 0, i;
+  orxSTATUS                         eResult = orxSTATUS_SUCCESS;
+
+  /* Gets all parts */
+  pstHeader         = (const orxCONFIG_SNAPSHOT_HEADER *)_pu8Buffer;
+  astSectionList    = (const orxCONFIG_SNAPSHOT_SECTION *)(_pu8Buffer + sizeof(orxCONFIG_SNAPSHOT_HEADER) + pstHeader->u32SourceCount * sizeof(orxCONFIG_SNAPSHOT_SOURCE));
+  astEntryList      = (const orxCONFIG_SNAPSHOT_ENTRY *)(astSectionList + pstHeader->u32SectionCount);
+  pu8Data           = (const orxU8 *)(astEntryList + pstHeader->u32EntryCount);
+  zStringTable      = (const orxCHAR *)(pu8Data + pstHeader->u32DataSize);
+
+  /* Allocates targets, followed by section & created section lists */
+  astTargetList = (orxCONFIG_SNAPSHOT_TARGET *)orxMemory_Allocate(pstHeader->u32EntryCount * sizeof(orxCONFIG_SNAPSHOT_TARGET) + (2 * pstHeader->u32SectionCount + 1) * sizeof(orxCONFIG_SECTION *), orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if(astTargetList != orxNULL)
+  {
+    /* Clears targets */
+    orxMemory_Zero(astTargetList, pstHeader->u32EntryCount * sizeof(orxCONFIG_SNAPSHOT_TARGET));
+
+    /* Gets section lists */
+    apstSectionList = (orxCONFIG_SECTION **)(astTargetList + pstHeader->u32EntryCount);
+    apstCreatedList = apstSectionList + pstHeader->u32SectionCount;
+
+    /* Backups current section */
+    pstPreviousSection = sstConfig.pstCurrentSection;
+
+    /* For all sections */
+    for(i = 0, pstSnapshotSection = astSectionList, pstSnapshotEntry = astEntryList, pstTarget = astTargetList;
+        (i < pstHeader->u32SectionCount) && (eResult != orxSTATUS_FAILURE);
+        i++, pstSnapshotSection++)
+    {
+      orxCONFIG_SECTION  *pstSection;
+      orxU32              j;
+
+      /* Gets existing section */
+      pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_Hash(zStringTable + pstSnapshotSection->u32Name));
+
+      /* Not found? */
+      if(pstSection == orxNULL)
+      {
+        /* Creates it (parents will be linked once all sections exist) */
+        pstSection = orxConfig_CreateSection(orxString_Store(zStringTable + pstSnapshotSection->u32Name), orxNULL);
+
+        /* Success? */
+        if(pstSection != orxNULL)
+        {
+          /* Stores its origin */
+          pstSection->stOriginID = (pstSnapshotSection->u32Origin != orxU32_UNDEFINED) ? orxString_GetID(zStringTable + pstSnapshotSection->u32Origin) : orxSTRINGID_UNDEFINED;
+
+          /* Remembers it */
+          apstCreatedList[u32CreatedCount++] = pstSection;
+        }
+        else
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+          break;
+        }
+      }
+
+      /* Stores it */
+      apstSectionList[i] = pstSection;
+
+      /* Selects it */
+      sstConfig.pstCurrentSection = pstSection;
+
+      /* For all its entries */
+      for(j = 0; j < pstSnapshotSection->u32EntryCount; j++, pstSnapshotEntry++, pstTarget++)
+      {
+        /* Gets existing entry */
+        pstTarget->pstEntry = orxConfig_GetEntry(orxString_GetID(zStringTable + pstSnapshotEntry->u32Key));
+
+        /* Not found? */
+        if(pstTarget->pstEntry == orxNULL)
+        {
+          /* Creates entry (will be added to its section when applied) */
+          pstTarget->pstEntry = (orxCONFIG_ENTRY *)orxBank_Allocate(sstConfig.pstEntryBank);
+          pstTarget->bNew     = orxTRUE;
+        }
+
+        /* Valid? */
+        if(pstTarget->pstEntry != orxNULL)
+        {
+          const orxU8 *pu8Value;
+
+          /* Gets its data (literal, list index table & cached typed values) */
+          pu8Value = pu8Data + pstSnapshotEntry->u32Data;
+
+          /* Is a duplicate? */
+          if(orxFLAG_TEST(pstSnapshotEntry->u16Flags, orxCONFIG_VALUE_KU16_FLAG_ALLOCATION))
+          {
+            /* Allocates it (list items are null-separated) */
+            pstTarget->zValue = (orxSTRING)orxMemory_Allocate(pstSnapshotEntry->u32Size, orxMEMORY_TYPE_TEXT);
+
+            /* Success? */
+            if(pstTarget->zValue != orxNULL)
+            {
+              /* Copies it */
+              orxMemory_Copy(pstTarget->zValue, pu8Value, pstSnapshotEntry->u32Size);
+            }
+            else
+            {
+              /* Updates result */
+              eResult = orxSTATUS_FAILURE;
+              break;
+            }
+          }
+
+          /* Skips literal */
+          pu8Value += orxALIGN(pstSnapshotEntry->u32Size, orxCONFIG_KU32_SNAPSHOT_ALIGNMENT);
+
+          /* Has list index table? */
+          if(orxFLAG_TEST(pstSnapshotEntry->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST)
+          && !orxFLAG_TEST(pstSnapshotEntry->u16Flags, orxCONFIG_VALUE_KU16_FLAG_BLOCK_MODE))
+          {
+            /* Allocates it */
+            pstTarget->au32ListIndexTable = (orxU32 *)orxMemory_Allocate((orxU32)(pstSnapshotEntry->u16ListCount - 1) * sizeof(orxU32), orxMEMORY_TYPE_CONFIG);
+
+            /* Success? */
+            if(pstTarget->au32ListIndexTable != orxNULL)
+            {
+              /* Copies it */
+              orxMemory_Copy(pstTarget->au32ListIndexTable, pu8Value, (orxU32)(pstSnapshotEntry->u16ListCount - 1) * sizeof(orxU32));
+            }
+            else
+            {
+              /* Updates result */
+              eResult = orxSTATUS_FAILURE;
+              break;
+            }
+          }
+        }
+        else
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+          break;
+        }
+      }
+    }
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Invalidates cache */
+      orxConfig_InvalidateCache();
+
+      /* For all sections */
+      for(i = 0, pstSnapshotSection = astSectionList, pstSnapshotEntry = astEntryList, pstTarget = astTargetList;
+          i < pstHeader->u32SectionCount;
+          i++, pstSnapshotSection++)
+      {
+        orxCONFIG_SECTION  *pstSection;
+        orxU32              j;
+
+        /* Gets section */
+        pstSection = apstSectionList[i];
+
+        /* For all its entries */
+        for(j = 0; j < pstSnapshotSection->u32EntryCount; j++, pstSnapshotEntry++, pstTarget++)
+        {
+          orxCONFIG_ENTRY  *pstEntry;
+          orxCONFIG_VALUE  *pstValue;
+          const orxU8      *pu8Value;
+
+          /* Gets entry & its value */
+          pstEntry = pstTarget->pstEntry;
+          pstValue = &(pstEntry->stValue);
+
+          /* Reusing entry? */
+          if(pstTarget->bNew == orxFALSE)
+          {
+            /* Deletes value */
+            orxConfig_CleanValue(pstValue);
+          }
+
+          /* Restores its status */
+          pstValue->u16Type             = pstSnapshotEntry->u16Type;
+          pstValue->u16Flags            = pstSnapshotEntry->u16Flags;
+          pstValue->u16ListCount        = pstSnapshotEntry->u16ListCount;
+          pstValue->u16CacheIndex       = pstSnapshotEntry->u16CacheIndex;
+          pstValue->au32ListIndexTable  = pstTarget->au32ListIndexTable;
+
+          /* Gets its data (literal, list index table & cached typed values) */
+          pu8Value = pu8Data + pstSnapshotEntry->u32Data;
+
+          /* Stores literal */
+          pstValue->zValue = orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_ALLOCATION)
+                             ? pstTarget->zValue
+                             : (pstSnapshotEntry->u32Size > 1)
+                               ? (orxSTRING)orxString_Store((const orxSTRING)pu8Value)
+                               : (orxSTRING)orxSTRING_EMPTY;
+
+          /* Has cached typed values? */
+          if(pstValue->u16Type != (orxU16)orxCONFIG_VALUE_TYPE_STRING)
+          {
+            /* Skips literal */
+            pu8Value += orxALIGN(pstSnapshotEntry->u32Size, orxCONFIG_KU32_SNAPSHOT_ALIGNMENT);
+
+            /* Has list index table? */
+            if(pstValue->au32ListIndexTable != orxNULL)
+            {
+              /* Skips it */
+              pu8Value += orxALIGN((orxU32)(pstValue->u16ListCount - 1) * sizeof(orxU32), orxCONFIG_KU32_SNAPSHOT_ALIGNMENT);
+            }
+
+            /* Restores them */
+            orxMemory_Copy(&(pstValue->vValue), pu8Value, orxCONFIG_KU32_SNAPSHOT_CACHE_SIZE);
+          }
+
+          /* New origin? */
+          if(pstSnapshotEntry->u32Origin != u32Origin)
+          {
+            /* Updates it (entries from the same file are contiguous) */
+            u32Origin   = pstSnapshotEntry->u32Origin;
+            stOriginID  = (u32Origin != orxU32_UNDEFINED) ? orxString_GetID(zStringTable + u32Origin) : orxSTRINGID_UNDEFINED;
+          }
+
+          /* Stores origin */
+          pstEntry->stOriginID = stOriginID;
+
+          /* New entry? */
+          if(pstTarget->bNew != orxFALSE)
+          {
+            /* Adds it to list */
+            orxMemory_Zero(&(pstEntry->stNode), sizeof(orxLINKLIST_NODE));
+            orxLinkList_AddEnd(&(pstSection->stEntryList), &(pstEntry->stNode));
+
+            /* Sets its ID */
+            pstEntry->stID = orxString_GetID(zStringTable + pstSnapshotEntry->u32Key);
+
+            /* Has index? */
+            if(pstSection->apstEntryIndex != orxNULL)
+            {
+              /* Enough room left? */
+              if((orxLinkList_GetCount(&(pstSection->stEntryList)) << 1) <= pstSection->u32EntryIndexSize)
+              {
+                /* Adds it to index */
+                orxConfig_AddToEntryIndex(pstSection, pstEntry);
+              }
+              else
+              {
+                /* Deletes index (will be rebuilt on demand) */
+                orxConfig_DeleteEntryIndex(pstSection);
+              }
+            }
+          }
+        }
+      }
+
+      /* For all sections */
+      for(i = 0, pstSnapshotSection = astSectionList; i < pstHeader->u32SectionCount; i++, pstSnapshotSection++)
+      {
+        orxCONFIG_SECTION *pstSection, *pstParent;
+
+        /* Gets section */
+        pstSection = apstSectionList[i];
+
+        /* Gets its parent */
+        if(pstSnapshotSection->u32Parent == orxU32_UNDEFINED)
+        {
+          pstParent = orxNULL;
+        }
+        else if(pstSnapshotSection->u32Parent == orxCONFIG_KU32_SNAPSHOT_PARENT_NONE)
+        {
+          pstParent = (orxCONFIG_SECTION *)orxHANDLE_UNDEFINED;
+        }
+        else
+        {
+          pstParent = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_Hash(zStringTable + pstSnapshotSection->u32Parent));
+
+          /* Checks */
+          orxASSERT(pstParent != orxNULL);
+        }
+
+        /* Changed? */
+        if(pstParent != pstSection->pstParent)
+        {
+          /* Had a parent? */
+          if((pstSection->pstParent != orxNULL) && (pstSection->pstParent != orxHANDLE_UNDEFINED))
+          {
+            /* Unprotects it */
+            pstSection->pstParent->s32ProtectionCount--;
+
+            /* Checks */
+            orxASSERT(pstSection->pstParent->s32ProtectionCount >= 0);
+          }
+
+          /* Stores new parent */
+          pstSection->pstParent = pstParent;
+
+          /* Has parent? */
+          if((pstParent != orxNULL) && (pstParent != orxHANDLE_UNDEFINED))
+          {
+            /* Protects it */
+            pstParent->s32ProtectionCount++;
+          }
+        }
+      }
+
+      /* Restores previous section */
+      sstConfig.pstCurrentSection = pstPreviousSection;
+
+      /* Updates default parent (its section is part of the snapshot, hence already exists) */
+      eResult = orxConfig_SetDefaultParent((pstHeader->u32DefaultParent != orxU32_UNDEFINED) ? zStringTable + pstHeader->u32DefaultParent : orxNULL);
+    }
+    else
+    {
+      /* For all targets */
+      for(i = 0, pstTarget = astTargetList; i < pstHeader->u32EntryCount; i++, pstTarget++)
+      {
+        /* Has literal? */
+        if(pstTarget->zValue != orxNULL)
+        {
+          /* Deletes it */
+          orxMemory_Free(pstTarget->zValue);
+        }
+
+        /* Has list index table? */
+        if(pstTarget->au32ListIndexTable != orxNULL)
+        {
+          /* Deletes it */
+          orxMemory_Free(pstTarget->au32ListIndexTable);
+        }
+
+        /* Is a new entry? */
+        if((pstTarget->bNew != orxFALSE) && (pstTarget->pstEntry != orxNULL))
+        {
+          /* Deletes it */
+          orxBank_Free(sstConfig.pstEntryBank, pstTarget->pstEntry);
+        }
+      }
+
+      /* For all created sections */
+      for(i = 0; i < u32CreatedCount; i++)
+      {
+        /* Deletes it (empty & unprotected) */
+        orxConfig_DeleteSection(apstCreatedList[i], orxNULL);
+      }
+
+      /* Restores previous section */
+      sstConfig.pstCurrentSection = pstPreviousSection;
+    }
+
+    /* Deletes targets */
+    orxMemory_Free(astTargetList);
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Origin save callback
+ */
+static orxBOOL orxFASTCALL orxConfig_OriginSaveCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+{
+  orxBOOL bResult;
+
+#ifdef __orxWINDOWS__
+
+  /* Updates result */
+  bResult = ((_zKeyName != orxNULL) || (orxString_ICompare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+
+#else /* __orxWINDOWS__ */
+
+  /* Updates result */
+  bResult = ((_zKeyName != orxNULL) || (orxString_Compare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return bResult;
+}
+
+/** Origin clear callback
+ */
+static orxBOOL orxFASTCALL orxConfig_OriginClearCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName)
+{
+  orxBOOL bResult;
+
+  /* Updates result */
+  bResult = (orxConfig_GetOriginID(_zSectionName) != orxSTRINGID_UNDEFINED) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Transforms a string to Pascal case
+ */
+static void orxFASTCALL orxConfig_ToPascalCase(orxSTRING _zDst, const orxSTRING _zSrc)
+{
+  const orxCHAR  *pcSrc;
+  orxCHAR        *pcDst;
+  orxBOOL         bUpper;
+
+  /* For all characters */
+  for(pcSrc = _zSrc, pcDst = _zDst, bUpper = orxTRUE; *pcSrc != orxCHAR_NULL; pcSrc++, pcDst++)
+  {
+    /* Is an underscore? */
+    if(*pcSrc == '_')
+    {
+      /* Replaces it with a space */
+      *pcDst = ' ';
+
+      /* Updates status */
+      bUpper = orxTRUE;
+    }
+    /* Is a space? */
+    else if(*pcSrc == ' ')
+    {
+      /* Skips it */
+      pcDst--;
+
+      /* Updates status */
+      bUpper = orxTRUE;
+    }
+    else
+    {
+      /* Updates character */
+      *pcDst = ((bUpper != orxFALSE) && (*pcSrc >= 'a') && (*pcSrc <= 'z'))
+               ? *pcSrc & ~0x20
+               : ((bUpper == orxFALSE) && (*pcSrc >= 'A') && (*pcSrc <= 'Z'))
+                 ? *pcSrc | 0x20
+                 : *pcSrc;
+
+      /* Updates status */
+      bUpper = orxFALSE;
+    }
+  }
+
+  /* Ends string */
+  *pcDst = orxCHAR_NULL;
+
+  /* Done! */
+  return;
+}
+
+/** Set default color list
+ */
+static void orxFASTCALL orxConfig_SetDefaultColorList()
+{
+  orxCHAR acParentBuffer[128];
+  orxS32  s32Offset;
+  orxU32  i, iCount;
+
+#define orxCOLOR_DECLARE(NAME, R, G, B) {#NAME, &orxVECTOR_##NAME},
+
+  struct
+  {
+    const orxSTRING   zName;
+    const orxVECTOR  *pvColor;
+  } astColorList[] =
   {
     #include "display/orxColorList.inc"
   };
@@ -5036,6 +6039,19 @@ void orxFASTCALL orxConfig_Exit()
     /* Clears all data */
     orxConfig_Clear(orxNULL);
 
+    /* For all remaining sections */
+    {
+      orxCONFIG_SECTION *pstSection;
+
+      for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+          pstSection != orxNULL;
+          pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+      {
+        /* Deletes its index */
+        orxConfig_DeleteEntryIndex(pstSection);
+      }
+    }
+
     /* Clears section list */
     orxLinkList_Clean(&(sstConfig.stSectionList));
 
@@ -5105,6 +6121,23 @@ orxBOOL orxFASTCALL orxConfig_IsTypoCheckEnabled()
   return bResult;
 }
 
+/** Gets config revision: it changes whenever any value, section or inheritance gets modified (including reloads)
+ * @return Current config revision
+ */
+orxU32 orxFASTCALL orxConfig_GetRevision()
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Updates result */
+  u32Result = sstConfig.u32CacheStamp;
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Sets encryption key
  * @param[in] _zEncryption key  Encryption key to use, orxNULL to clear
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
@@ -5836,6 +6869,333 @@ orxSTATUS orxFASTCALL orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEn
   return eResult;
 }
 
+/** Saves a binary snapshot of the whole config (sections, entries & cached values), to be loaded with orxConfig_LoadSnapshot
+ * @param[in] _zFileName        File name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SaveSnapshot(const orxSTRING _zFileName)
+{
+  orxCONFIG_SNAPSHOT_BUFFER stSourceBuffer, stSectionBuffer, stEntryBuffer, stDataBuffer, stStringBuffer;
+  orxHASHTABLE             *pstStringTable, *pstSourceTable;
+  orxSTATUS                 eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_SaveSnapshot");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Clears buffers */
+  orxMemory_Zero(&stSourceBuffer, sizeof(orxCONFIG_SNAPSHOT_BUFFER));
+  orxMemory_Zero(&stSectionBuffer, sizeof(orxCONFIG_SNAPSHOT_BUFFER));
+  orxMemory_Zero(&stEntryBuffer, sizeof(orxCONFIG_SNAPSHOT_BUFFER));
+  orxMemory_Zero(&stDataBuffer, sizeof(orxCONFIG_SNAPSHOT_BUFFER));
+  orxMemory_Zero(&stStringBuffer, sizeof(orxCONFIG_SNAPSHOT_BUFFER));
+
+  /* Creates tables */
+  pstStringTable = orxHashTable_Create(orxCONFIG_KU32_ENTRY_BANK_SIZE, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_TEMP);
+  pstSourceTable = orxHashTable_Create(orxCONFIG_KU32_SECTION_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+  /* Valid? */
+  if((*_zFileName != orxCHAR_NULL) && (pstStringTable != orxNULL) && (pstSourceTable != orxNULL))
+  {
+    orxCONFIG_SNAPSHOT_HEADER stHeader;
+    orxCONFIG_SECTION        *pstSection;
+    orxBOOL                   bValid = orxTRUE;
+
+    /* Inits header */
+    orxMemory_Zero(&stHeader, sizeof(orxCONFIG_SNAPSHOT_HEADER));
+    orxMemory_Copy(stHeader.acTag, orxCONFIG_KZ_SNAPSHOT_TAG, sizeof(stHeader.acTag));
+    stHeader.u32Version       = orxCONFIG_KU32_SNAPSHOT_VERSION;
+    stHeader.u32Layout        = orxConfig_GetSnapshotLayout();
+    stHeader.u32DefaultParent = orxU32_UNDEFINED;
+
+    /* For all sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        (pstSection != orxNULL) && (bValid != orxFALSE);
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      orxCONFIG_SNAPSHOT_SECTION  stSection;
+      orxCONFIG_ENTRY            *pstEntry;
+
+      /* Inits it */
+      orxMemory_Zero(&stSection, sizeof(orxCONFIG_SNAPSHOT_SECTION));
+      stSection.u32Name       = orxConfig_AddSnapshotString(&stStringBuffer, pstStringTable, pstSection->zName);
+      stSection.u32Parent     = (pstSection->pstParent == orxNULL)
+                                ? orxU32_UNDEFINED
+                                : (pstSection->pstParent == orxHANDLE_UNDEFINED)
+                                  ? orxCONFIG_KU32_SNAPSHOT_PARENT_NONE
+                                  : orxConfig_AddSnapshotString(&stStringBuffer, pstStringTable, pstSection->pstParent->zName);
+      stSection.u32Origin     = orxConfig_AddSnapshotOrigin(&stStringBuffer, pstStringTable, pstSourceTable, pstSection->stOriginID);
+      stSection.u32EntryCount = orxLinkList_GetCount(&(pstSection->stEntryList));
+
+      /* Stores it */
+      bValid = ((stSection.u32Name != orxU32_UNDEFINED) && ((stSection.u32Parent != orxU32_UNDEFINED) || (pstSection->pstParent == orxNULL)) && (orxConfig_AppendSnapshotBuffer(&stSectionBuffer, &stSection, sizeof(orxCONFIG_SNAPSHOT_SECTION)) != orxU32_UNDEFINED)) ? orxTRUE : orxFALSE;
+
+      /* Updates count */
+      stHeader.u32SectionCount++;
+
+      /* For all its entries */
+      for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+          (pstEntry != orxNULL) && (bValid != orxFALSE);
+          pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+      {
+        orxCONFIG_SNAPSHOT_ENTRY  stEntry;
+        const orxCONFIG_VALUE    *pstValue;
+        orxBOOL                   bHasTable;
+
+        /* Gets its value */
+        pstValue = &(pstEntry->stValue);
+
+        /* Has list index table? */
+        bHasTable = (orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST) && !orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_BLOCK_MODE)) ? orxTRUE : orxFALSE;
+
+        /* Inits it */
+        orxMemory_Zero(&stEntry, sizeof(orxCONFIG_SNAPSHOT_ENTRY));
+        stEntry.u32Key        = orxConfig_AddSnapshotString(&stStringBuffer, pstStringTable, orxString_GetFromID(pstEntry->stID));
+        stEntry.u32Origin     = orxConfig_AddSnapshotOrigin(&stStringBuffer, pstStringTable, pstSourceTable, pstEntry->stOriginID);
+        stEntry.u16Type       = pstValue->u16Type;
+        stEntry.u16Flags      = pstValue->u16Flags;
+        stEntry.u16ListCount  = pstValue->u16ListCount;
+        stEntry.u16CacheIndex = pstValue->u16CacheIndex;
+
+        /* Gets literal size (list items are null-separated) */
+        stEntry.u32Size       = (bHasTable != orxFALSE)
+                                ? pstValue->au32ListIndexTable[pstValue->u16ListCount - 2] + orxString_GetLength(pstValue->zValue + pstValue->au32ListIndexTable[pstValue->u16ListCount - 2]) + 1
+                                : orxString_GetLength(pstValue->zValue) + 1;
+
+        /* Stores literal */
+        stEntry.u32Data       = orxConfig_AppendSnapshotBuffer(&stDataBuffer, pstValue->zValue, stEntry.u32Size);
+
+        /* Stores everything */
+        bValid = ((stEntry.u32Key != orxU32_UNDEFINED)
+               && (stEntry.u32Data != orxU32_UNDEFINED)
+               && ((bHasTable == orxFALSE) || (orxConfig_AppendSnapshotBuffer(&stDataBuffer, pstValue->au32ListIndexTable, (orxU32)(pstValue->u16ListCount - 1) * sizeof(orxU32)) != orxU32_UNDEFINED))
+               && ((pstValue->u16Type == (orxU16)orxCONFIG_VALUE_TYPE_STRING) || (orxConfig_AppendSnapshotBuffer(&stDataBuffer, &(pstValue->vValue), orxCONFIG_KU32_SNAPSHOT_CACHE_SIZE) != orxU32_UNDEFINED))
+               && (orxConfig_AppendSnapshotBuffer(&stEntryBuffer, &stEntry, sizeof(orxCONFIG_SNAPSHOT_ENTRY)) != orxU32_UNDEFINED)) ? orxTRUE : orxFALSE;
+
+        /* Updates count */
+        stHeader.u32EntryCount++;
+      }
+    }
+
+    /* Has default parent? */
+    if((bValid != orxFALSE) && (sstConfig.pstDefaultParent != orxNULL))
+    {
+      /* Stores it */
+      stHeader.u32DefaultParent = orxConfig_AddSnapshotString(&stStringBuffer, pstStringTable, sstConfig.pstDefaultParent->zName);
+      bValid = (stHeader.u32DefaultParent != orxU32_UNDEFINED) ? orxTRUE : orxFALSE;
+    }
+
+    /* Valid? */
+    if(bValid != orxFALSE)
+    {
+      orxHANDLE hIterator;
+      orxU64    u64Key;
+      void     *pData;
+
+      /* For all sources */
+      for(hIterator = orxHashTable_GetNext(pstSourceTable, orxHANDLE_UNDEFINED, &u64Key, &pData);
+          (hIterator != orxHANDLE_UNDEFINED) && (bValid != orxFALSE);
+          hIterator = orxHashTable_GetNext(pstSourceTable, hIterator, &u64Key, &pData))
+      {
+        orxCONFIG_SNAPSHOT_SOURCE stSource;
+
+        /* Inits it (name offsets are stored with a +1 bias) */
+        orxMemory_Zero(&stSource, sizeof(orxCONFIG_SNAPSHOT_SOURCE));
+        stSource.u32Name  = (orxU32)((orxUPTR)pData - 1);
+        stSource.u64Hash  = orxConfig_HashSnapshotSource((const orxSTRING)stStringBuffer.pu8Data + stSource.u32Name, &(stSource.u32Size));
+
+        /* Stores it */
+        bValid = (orxConfig_AppendSnapshotBuffer(&stSourceBuffer, &stSource, sizeof(orxCONFIG_SNAPSHOT_SOURCE)) != orxU32_UNDEFINED) ? orxTRUE : orxFALSE;
+
+        /* Updates count */
+        stHeader.u32SourceCount++;
+      }
+    }
+
+    /* Valid? */
+    if(bValid != orxFALSE)
+    {
+      const orxCONFIG_SNAPSHOT_BUFFER  *apstBufferList[5];
+      const orxSTRING                   zResourceLocation;
+      orxHANDLE                         hResource;
+      orxU32                            i;
+
+      /* Inits buffer list (in file order) */
+      apstBufferList[0] = &stSourceBuffer;
+      apstBufferList[1] = &stSectionBuffer;
+      apstBufferList[2] = &stEntryBuffer;
+      apstBufferList[3] = &stDataBuffer;
+      apstBufferList[4] = &stStringBuffer;
+
+      /* Completes header */
+      stHeader.u32DataSize    = stDataBuffer.u32Size;
+      stHeader.u32StringSize  = stStringBuffer.u32Size;
+      stHeader.u64Hash        = orxCONFIG_KU64_SNAPSHOT_HASH_SEED;
+      for(i = 0; i < orxARRAY_GET_ITEM_COUNT(apstBufferList); i++)
+      {
+        stHeader.u64Hash = orxConfig_HashSnapshotBuffer(stHeader.u64Hash, apstBufferList[i]->pu8Data, apstBufferList[i]->u32Size);
+      }
+
+      /* Valid file to open? */
+      if(((zResourceLocation = orxResource_LocateInStorage(orxCONFIG_KZ_RESOURCE_GROUP, orxRESOURCE_KZ_DEFAULT_STORAGE, _zFileName)) != orxNULL)
+      && ((hResource = orxResource_Open(zResourceLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+      {
+        /* Writes header */
+        bValid = (orxResource_Write(hResource, sizeof(orxCONFIG_SNAPSHOT_HEADER), &stHeader, orxNULL, orxNULL) == (orxS64)sizeof(orxCONFIG_SNAPSHOT_HEADER)) ? orxTRUE : orxFALSE;
+
+        /* For all buffers */
+        for(i = 0; (i < orxARRAY_GET_ITEM_COUNT(apstBufferList)) && (bValid != orxFALSE); i++)
+        {
+          /* Not empty? */
+          if(apstBufferList[i]->u32Size != 0)
+          {
+            /* Writes it */
+            bValid = (orxResource_Write(hResource, (orxS64)apstBufferList[i]->u32Size, apstBufferList[i]->pu8Data, orxNULL, orxNULL) == (orxS64)apstBufferList[i]->u32Size) ? orxTRUE : orxFALSE;
+          }
+        }
+
+        /* Flushes & closes the resource */
+        orxResource_Close(hResource);
+
+        /* Success? */
+        if(bValid != orxFALSE)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save snapshot, write error!", _zFileName);
+        }
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save snapshot, can't open file on disk!", _zFileName);
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save snapshot, out of memory!", _zFileName);
+    }
+  }
+
+  /* Deletes tables */
+  if(pstStringTable != orxNULL)
+  {
+    orxHashTable_Delete(pstStringTable);
+  }
+  if(pstSourceTable != orxNULL)
+  {
+    orxHashTable_Delete(pstSourceTable);
+  }
+
+  /* Deletes buffers */
+  orxConfig_DeleteSnapshotBuffer(&stSourceBuffer);
+  orxConfig_DeleteSnapshotBuffer(&stSectionBuffer);
+  orxConfig_DeleteSnapshotBuffer(&stEntryBuffer);
+  orxConfig_DeleteSnapshotBuffer(&stDataBuffer);
+  orxConfig_DeleteSnapshotBuffer(&stStringBuffer);
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Loads a binary snapshot previously saved with orxConfig_SaveSnapshot. The snapshot is rejected, leaving the config untouched,
+ * if it has been saved by an incompatible build or if any of the config files it was built from has changed since
+ * @param[in] _zFileName        File name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE (in which case orxConfig_Load should be used instead)
+ */
+orxSTATUS orxFASTCALL orxConfig_LoadSnapshot(const orxSTRING _zFileName)
+{
+  const orxSTRING zResourceLocation;
+  orxHANDLE       hResource;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_LoadSnapshot");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Valid file to open? */
+  if((*_zFileName != orxCHAR_NULL)
+  && ((zResourceLocation = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, _zFileName)) != orxNULL)
+  && ((hResource = orxResource_Open(zResourceLocation, orxFALSE)) != orxHANDLE_UNDEFINED))
+  {
+    orxU8  *pu8Buffer = orxNULL;
+    orxS64  s64Size;
+
+    /* Gets its size */
+    s64Size = orxResource_GetSize(hResource);
+
+    /* Valid? */
+    if((s64Size >= (orxS64)sizeof(orxCONFIG_SNAPSHOT_HEADER)) && (s64Size <= (orxS64)orxU32_UNDEFINED))
+    {
+      /* Allocates buffer */
+      pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP);
+
+      /* Reads whole file in one go */
+      if((pu8Buffer != orxNULL)
+      && (orxResource_Read(hResource, s64Size, pu8Buffer, orxNULL, orxNULL) != s64Size))
+      {
+        /* Deletes buffer */
+        orxMemory_Free(pu8Buffer);
+        pu8Buffer = orxNULL;
+      }
+    }
+
+    /* Closes resource */
+    orxResource_Close(hResource);
+
+    /* Valid? */
+    if(pu8Buffer != orxNULL)
+    {
+      /* Checks it */
+      if(orxConfig_CheckSnapshot(pu8Buffer, (orxU32)s64Size) != orxFALSE)
+      {
+        /* Applies it */
+        eResult = orxConfig_ApplySnapshot(pu8Buffer);
+
+        /* Failure? */
+        if(eResult == orxSTATUS_FAILURE)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Couldn't apply snapshot, config has been left untouched.", _zFileName);
+        }
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Ignoring snapshot, it's either invalid, incompatible or outdated.", _zFileName);
+      }
+
+      /* Deletes buffer */
+      orxMemory_Free(pu8Buffer);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't read snapshot.", _zFileName);
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
@@ -6139,6 +7499,9 @@ orxSTATUS orxFASTCALL orxConfig_RenameSection(const orxSTRING _zSectionName, con
         /* Adds it again with the new ID */
         orxHashTable_Add(sstConfig.pstSectionTable, orxString_Hash(_zNewSectionName), pstSection);
 
+        /* Invalidates cache */
+        orxConfig_InvalidateCache();
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
@@ -6195,6 +7558,9 @@ orxSTATUS orxFASTCALL orxConfig_SetParent(const orxSTRING _zSectionName, const o
   /* Success? */
   if(eResult != orxSTATUS_FAILURE)
   {
+    /* Invalidates cache */
+    orxConfig_InvalidateCache();
+
     /* Already has a parent? */
     if((sstConfig.pstCurrentSection->pstParent != orxNULL) && (sstConfig.pstCurrentSection->pstParent != orxHANDLE_UNDEFINED))
     {
@@ -6340,6 +7706,9 @@ orxSTATUS orxFASTCALL orxConfig_SetDefaultParent(const orxSTRING _zSectionName)
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
 
+  /* Invalidates cache */
+  orxConfig_InvalidateCache();
+
   /* Has current default parent? */
   if(sstConfig.pstDefaultParent != orxNULL)
   {
@@ -7106,7 +8475,7 @@ const orxSTRING orxFASTCALL orxConfig_GetValueSource(const orxSTRING _zKey)
     orxCONFIG_SECTION *pstSource = orxNULL;
 
     /* Gets value from key */
-    if(orxConfig_GetValueFromKey(stKeyID, sstConfig.pstCurrentSection, &pstSource) != orxNULL)
+    if(orxConfig_GetCachedValueFromKey(stKeyID, &pstSource) != orxNULL)
     {
       /* Updates result */
       zResult = pstSource->zName;
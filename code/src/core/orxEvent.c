@@ -32,6 +32,9 @@
 
 #include "core/orxEvent.h"
 
+#include "core/orxClock.h"
+#include "core/orxConfig.h"
+#include "core/orxSystem.h"
 #include "core/orxThread.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
@@ -42,11 +45,13 @@
 
 /** Module flags
  */
-#define orxEVENT_KU32_STATIC_FLAG_NONE    0x00000000  /**< No flags */
+#define orxEVENT_KU32_STATIC_FLAG_NONE        0x00000000  /**< No flags */
 
-#define orxEVENT_KU32_STATIC_FLAG_READY   0x00000001  /**< Ready flag */
+#define orxEVENT_KU32_STATIC_FLAG_READY       0x00000001  /**< Ready flag */
+#define orxEVENT_KU32_STATIC_FLAG_DRAINING    0x00000002  /**< Draining flag */
+#define orxEVENT_KU32_STATIC_FLAG_REGISTERED  0x80000000  /**< Registered flag */
 
-#define orxEVENT_KU32_STATIC_MASK_ALL     0xFFFFFFFF  /**< All mask */
+#define orxEVENT_KU32_STATIC_MASK_ALL         0xFFFFFFFF  /**< All mask */
 
 
 /** Misc defines
@@ -55,6 +60,19 @@
 #define orxEVENT_KU32_HANDLER_BANK_SIZE   32
 #define orxEVENT_KU32_STORAGE_BANK_SIZE   32
 
+#define orxEVENT_KU32_POST_QUEUE_SIZE     1024        /**< Needs to be a power of 2 */
+#define orxEVENT_KU32_POST_QUEUE_MASK     (orxEVENT_KU32_POST_QUEUE_SIZE - 1)
+#define orxEVENT_KU32_POST_TABLE_SIZE     64
+
+#define orxEVENT_KU32_POST_FLAG_COPY      0x10000000  /**< Payload has been copied */
+#define orxEVENT_KU32_POST_FLAG_SKIP      0x20000000  /**< Superseded by a more recent post */
+#define orxEVENT_KU32_POST_MASK_USER      0x0000FFFF  /**< User flags mask */
+
+#define orxEVENT_KZ_CONFIG_SECTION        "Event"
+#define orxEVENT_KZ_CONFIG_POST_PRIORITY  "PostPriority"
+#define orxEVENT_KZ_CONFIG_POST_MAX_COUNT "PostMaxCount"
+#define orxEVENT_KZ_CONFIG_POST_MAX_TIME  "PostMaxTime"
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -81,6 +99,17 @@ typedef struct __orxEVENT_HANDLER_STORAGE_t
 
 } orxEVENT_HANDLER_STORAGE;
 
+/** Posted event slot
+ */
+typedef struct __orxEVENT_POST_SLOT_t
+{
+  orxEVENT          stEvent;
+  orxU64            au64Payload[orxEVENT_KU32_POST_PAYLOAD_SIZE / sizeof(orxU64)];
+  volatile orxU32   u32Sequence;
+  orxU32            u32Flags;
+
+} orxEVENT_POST_SLOT;
+
 /** Static structure
  */
 typedef struct __orxEVENT_STATIC_t
@@ -90,6 +119,16 @@ typedef struct __orxEVENT_STATIC_t
   orxHASHTABLE             *pstHandlerStorageTable;   /**< Handler storage table */
   orxBANK                  *pstHandlerStorageBank;    /**< Handler storage bank */
   orxEVENT_HANDLER_STORAGE *astCoreHandlerStorageList[orxEVENT_TYPE_CORE_NUMBER]; /**< Core handler storage list */
+  orxEVENT_POST_SLOT       *astPostQueue;             /**< Posted event queue */
+  orxHASHTABLE             *pstPostTable;             /**< Posted event coalescing table */
+  volatile orxU32           u32PostHead;              /**< Posted event queue head (producers) */
+  volatile orxU32           u32PostTail;              /**< Posted event queue tail (consumer) */
+  volatile orxU32           u32PostCount;             /**< Posted event count */
+  volatile orxU32           u32DropCount;             /**< Dropped event count */
+  orxEVENT_POST_INFO        stPostInfo;               /**< Posted event info */
+  orxU32                    u32PostMaxCount;          /**< Max number of posted events dispatched per drain */
+  orxFLOAT                  fPostMaxTime;             /**< Max time spent dispatching posted events per drain */
+  orxU32                    u32ConfigRevision;        /**< Config revision */
 
 } orxEVENT_STATIC;
 
@@ -105,6 +144,126 @@ static orxEVENT_STATIC sstEvent;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Gets a posted event coalescing key
+ * @param[in] _pstEvent             Concerned event
+ * @return Coalescing key
+ */
+static orxINLINE orxU64 orxEvent_GetPostKey(const orxEVENT *_pstEvent)
+{
+  orxU64 u64Result;
+
+  /* Mixes sender, type & ID */
+  u64Result = ((orxU64)(orxUPTR)_pstEvent->hSender * 0x9E3779B97F4A7C15ULL) ^ (((orxU64)_pstEvent->eType << 5) | (orxU64)_pstEvent->eID);
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Updates posted events config values
+ */
+static void orxFASTCALL orxEvent_UpdatePostConfig()
+{
+  /* Is config module initialized and has config changed? */
+  if((orxModule_IsInitialized(orxMODULE_ID_CONFIG) != orxFALSE)
+  && (orxConfig_GetRevision() != sstEvent.u32ConfigRevision))
+  {
+    /* Pushes config section */
+    orxConfig_PushSection(orxEVENT_KZ_CONFIG_SECTION);
+
+    /* Updates budgets */
+    sstEvent.u32PostMaxCount  = orxConfig_GetU32(orxEVENT_KZ_CONFIG_POST_MAX_COUNT);
+    sstEvent.fPostMaxTime     = orxConfig_GetFloat(orxEVENT_KZ_CONFIG_POST_MAX_TIME);
+
+    /* Pops config section */
+    orxConfig_PopSection();
+
+    /* Stores config revision */
+    sstEvent.u32ConfigRevision = orxConfig_GetRevision();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Drains posted events, on core clock
+ * @param[in] _pstClockInfo         Clock info of the clock used upon registration
+ * @param[in] _pContext             Context sent when registering callback to the clock
+ */
+static void orxFASTCALL orxEvent_DrainPosted(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Updates config values */
+  orxEvent_UpdatePostConfig();
+
+  /* Processes posted events */
+  orxEvent_ProcessPosted(sstEvent.u32PostMaxCount, sstEvent.fPostMaxTime);
+
+  /* Done! */
+  return;
+}
+
+/** Registers posted events drain callback, if possible
+ */
+static void orxFASTCALL orxEvent_RegisterPostDrain()
+{
+  /* Are we on main thread and is clock module initialized? */
+  if((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+  && (orxModule_IsInitialized(orxMODULE_ID_CLOCK) != orxFALSE))
+  {
+    orxCLOCK_PRIORITY ePriority = orxCLOCK_PRIORITY_NORMAL;
+
+    /* Is config module initialized? */
+    if(orxModule_IsInitialized(orxMODULE_ID_CONFIG) != orxFALSE)
+    {
+      const orxSTRING zPriority;
+
+      /* Pushes config section */
+      orxConfig_PushSection(orxEVENT_KZ_CONFIG_SECTION);
+
+      /* Gets priority */
+      zPriority = orxConfig_GetString(orxEVENT_KZ_CONFIG_POST_PRIORITY);
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Valid? */
+      if(*zPriority != orxCHAR_NULL)
+      {
+        static const orxSTRING sazPriorityList[orxCLOCK_PRIORITY_NUMBER] = {"lowest", "lower", "low", "normal", "high", "higher", "highest"};
+        orxU32 i;
+
+        /* For all priorities */
+        for(i = 0; i < orxCLOCK_PRIORITY_NUMBER; i++)
+        {
+          /* Found? */
+          if(orxString_ICompare(zPriority, sazPriorityList[i]) == 0)
+          {
+            /* Stores it */
+            ePriority = (orxCLOCK_PRIORITY)i;
+            break;
+          }
+        }
+
+        /* Not found? */
+        if(i == orxCLOCK_PRIORITY_NUMBER)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[" orxEVENT_KZ_CONFIG_SECTION "] " orxEVENT_KZ_CONFIG_POST_PRIORITY ": invalid priority <%s>, using <normal> instead.", zPriority);
+        }
+      }
+    }
+
+    /* Registers drain callback */
+    if(orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), orxEvent_DrainPosted, orxNULL, orxMODULE_ID_EVENT, ePriority) != orxSTATUS_FAILURE)
+    {
+      /* Updates status */
+      orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_REGISTERED, orxEVENT_KU32_STATIC_FLAG_NONE);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -146,9 +305,25 @@ orxSTATUS orxFASTCALL orxEvent_Init()
       /* Creates handler storage bank */
       sstEvent.pstHandlerStorageBank = orxBank_Create(orxEVENT_KU32_STORAGE_BANK_SIZE, sizeof(orxEVENT_HANDLER_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates posted event queue & coalescing table */
+      sstEvent.astPostQueue = (orxEVENT_POST_SLOT *)orxMemory_Allocate(orxEVENT_KU32_POST_QUEUE_SIZE * sizeof(orxEVENT_POST_SLOT), orxMEMORY_TYPE_MAIN);
+      sstEvent.pstPostTable = orxHashTable_Create(orxEVENT_KU32_POST_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
       /* Success? */
-      if(sstEvent.pstHandlerStorageBank != orxNULL)
+      if((sstEvent.pstHandlerStorageBank != orxNULL) && (sstEvent.astPostQueue != orxNULL) && (sstEvent.pstPostTable != orxNULL))
       {
+        orxU32 i;
+
+        /* For all posted event slots */
+        for(i = 0; i < orxEVENT_KU32_POST_QUEUE_SIZE; i++)
+        {
+          /* Inits its sequence */
+          sstEvent.astPostQueue[i].u32Sequence = i;
+        }
+
+        /* Inits config revision */
+        sstEvent.u32ConfigRevision = orxU32_UNDEFINED;
+
         /* Inits Flags */
         orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY, orxEVENT_KU32_STATIC_MASK_ALL);
 
@@ -160,6 +335,24 @@ orxSTATUS orxFASTCALL orxEvent_Init()
         /* Deletes table */
         orxHashTable_Delete(sstEvent.pstHandlerStorageTable);
 
+        /* Deletes bank */
+        if(sstEvent.pstHandlerStorageBank != orxNULL)
+        {
+          orxBank_Delete(sstEvent.pstHandlerStorageBank);
+        }
+
+        /* Deletes posted event queue */
+        if(sstEvent.astPostQueue != orxNULL)
+        {
+          orxMemory_Free(sstEvent.astPostQueue);
+        }
+
+        /* Deletes posted event table */
+        if(sstEvent.pstPostTable != orxNULL)
+        {
+          orxHashTable_Delete(sstEvent.pstPostTable);
+        }
+
         /* Logs message */
         orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Event module failed to create bank.");
 
@@ -198,6 +391,21 @@ void orxFASTCALL orxEvent_Exit()
   {
     orxEVENT_HANDLER_STORAGE *pstStorage;
 
+    /* Was drain callback registered? */
+    if(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_REGISTERED))
+    {
+      /* Is clock module still initialized? */
+      if(orxModule_IsInitialized(orxMODULE_ID_CLOCK) != orxFALSE)
+      {
+        /* Unregisters it */
+        orxClock_Unregister(orxClock_Get(orxCLOCK_KZ_CORE), orxEvent_DrainPosted, orxNULL);
+      }
+    }
+
+    /* Deletes posted event queue & table (pending events are discarded) */
+    orxMemory_Free(sstEvent.astPostQueue);
+    orxHashTable_Delete(sstEvent.pstPostTable);
+
     /* Deletes hashtable */
     orxHashTable_Delete(sstEvent.pstHandlerStorageTable);
 
@@ -251,6 +459,13 @@ orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType,
   orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
   orxASSERT(_pfnEventHandler != orxNULL);
 
+  /* Is posted events drain callback not registered? */
+  if(!orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_REGISTERED))
+  {
+    /* Tries to register it */
+    orxEvent_RegisterPostDrain();
+  }
+
   /* Gets corresponding storage */
   pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
 
@@ -666,6 +881,30 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
   return eResult;
 }
 
+/** Is an event handled, ie. is there at least one handler registered for it? Can be used to skip preparing events nobody listens to
+ * @param[in] _eEventType           Event type
+ * @param[in] _eEventID             Event ID
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxEvent_IsHandled(orxEVENT_TYPE _eEventType, orxENUM _eEventID)
+{
+  orxEVENT_HANDLER_STORAGE *pstStorage;
+  orxBOOL                   bResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_eEventID < 32);
+
+  /* Gets corresponding storage */
+  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+
+  /* Updates result */
+  bResult = ((pstStorage != orxNULL) && (pstStorage->au8HandledIDList[_eEventID] != 0)) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
 /** Sends a simple event
  * @param[in] _eEventType           Event type
  * @param[in] _eEventID             Event ID
@@ -691,6 +930,329 @@ orxSTATUS orxFASTCALL orxEvent_SendShort(orxEVENT_TYPE _eEventType, orxENUM _eEv
   return eResult;
 }
 
+/** Posts an event: it will be sent from the main thread when the core clock drains posted events, can be called from any thread
+ * @param[in] _pstEvent             Event to post, its fields are copied
+ * @param[in] _u32PayloadSize       Size of the payload to copy along with the event (up to orxEVENT_KU32_POST_PAYLOAD_SIZE), 0 to keep the payload pointer as is
+ * @param[in] _u32Flags             Post flags (orxEVENT_KU32_POST_FLAG_*)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the queue is full
+ */
+orxSTATUS orxFASTCALL orxEvent_Post(const orxEVENT *_pstEvent, orxU32 _u32PayloadSize, orxU32 _u32Flags)
+{
+  orxEVENT_POST_SLOT *pstSlot;
+  orxU32              u32Position;
+  orxSTATUS           eResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstEvent != orxNULL);
+  orxASSERT(_pstEvent->eID < 32);
+  orxASSERT(_u32PayloadSize <= orxEVENT_KU32_POST_PAYLOAD_SIZE);
+  orxASSERT((_u32PayloadSize == 0) || (_pstEvent->pstPayload != orxNULL));
+  orxASSERT((_u32Flags & ~orxEVENT_KU32_POST_MASK_USER) == 0);
+
+  /* Is drain callback not registered? */
+  if(!orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_REGISTERED))
+  {
+    /* Tries to register it */
+    orxEvent_RegisterPostDrain();
+  }
+
+  /* Reserves a slot */
+  for(u32Position = sstEvent.u32PostHead;; u32Position = sstEvent.u32PostHead)
+  {
+    orxS32 s32Delta;
+
+    /* Gets slot */
+    pstSlot   = &(sstEvent.astPostQueue[u32Position & orxEVENT_KU32_POST_QUEUE_MASK]);
+    s32Delta  = (orxS32)(pstSlot->u32Sequence - u32Position);
+
+    /* Free? */
+    if(s32Delta == 0)
+    {
+      /* Claimed it? */
+      if(orxMEMORY_ATOMIC_CAS32(&(sstEvent.u32PostHead), u32Position, u32Position + 1) != orxFALSE)
+      {
+        break;
+      }
+    }
+    /* Queue full? */
+    else if(s32Delta < 0)
+    {
+      /* Clears slot */
+      pstSlot = orxNULL;
+      break;
+    }
+  }
+
+  /* Valid? */
+  if(pstSlot != orxNULL)
+  {
+    /* Stores event */
+    orxMemory_Copy(&(pstSlot->stEvent), _pstEvent, sizeof(orxEVENT));
+    pstSlot->stEvent.pContext = orxNULL;
+    pstSlot->u32Flags         = _u32Flags;
+
+    /* Has payload to copy? */
+    if(_u32PayloadSize != 0)
+    {
+      /* Copies it */
+      orxMemory_Copy(pstSlot->au64Payload, _pstEvent->pstPayload, _u32PayloadSize);
+      pstSlot->stEvent.pstPayload = pstSlot->au64Payload;
+      orxFLAG_SET(pstSlot->u32Flags, orxEVENT_KU32_POST_FLAG_COPY, orxEVENT_KU32_POST_FLAG_NONE);
+    }
+
+    /* Publishes it */
+    orxMEMORY_BARRIER();
+    pstSlot->u32Sequence = u32Position + 1;
+
+    /* Updates post count */
+    orxMEMORY_ATOMIC_INC32(&(sstEvent.u32PostCount));
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates drop count */
+    orxMEMORY_ATOMIC_INC32(&(sstEvent.u32DropCount));
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Posts a simple event, can be called from any thread
+ * @param[in] _eEventType           Event type
+ * @param[in] _eEventID             Event ID
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the queue is full
+ */
+orxSTATUS orxFASTCALL orxEvent_PostShort(orxEVENT_TYPE _eEventType, orxENUM _eEventID)
+{
+  orxEVENT  stEvent;
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+
+  /* Inits event */
+  orxMemory_Zero(&stEvent, sizeof(orxEVENT));
+  stEvent.eType = _eEventType;
+  stEvent.eID   = _eEventID;
+
+  /* Posts it */
+  eResult = orxEvent_Post(&stEvent, 0, orxEVENT_KU32_POST_FLAG_NONE);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Sends pending posted events, from the main thread. This is done automatically on the core clock, using the budgets defined in config
+ * @param[in] _u32MaxCount          Max number of events to send, 0 for no limit besides the queue size
+ * @param[in] _fMaxTime             Max time to spend sending events (in seconds), <= 0 for no limit; remaining events are kept for the next drain
+ * @return Number of sent events
+ */
+orxU32 orxFASTCALL orxEvent_ProcessPosted(orxU32 _u32MaxCount, orxFLOAT _fMaxTime)
+{
+  orxU32 u32Result = 0;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+
+  /* Not already draining? */
+  if(!orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_DRAINING))
+  {
+    orxEVENT_POST_SLOT *pstSlot;
+    orxDOUBLE           dStartTime, dTime;
+    orxU32              u32Tail, u32Count, u32Depth, i;
+    orxBOOL             bCoalesce = orxFALSE;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxEvent_ProcessPosted");
+
+    /* Updates status */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_DRAINING, orxEVENT_KU32_STATIC_FLAG_NONE);
+
+    /* Gets start time */
+    dStartTime = orxSystem_GetTime();
+
+    /* Gets tail & max count */
+    u32Tail = sstEvent.u32PostTail;
+    if((_u32MaxCount == 0) || (_u32MaxCount > orxEVENT_KU32_POST_QUEUE_SIZE))
+    {
+      _u32MaxCount = orxEVENT_KU32_POST_QUEUE_SIZE;
+    }
+
+    /* Updates queue depth */
+    u32Depth = sstEvent.u32PostHead - u32Tail;
+    sstEvent.stPostInfo.u32MaxQueueDepth = orxMAX(sstEvent.stPostInfo.u32MaxQueueDepth, u32Depth);
+
+    /* For all published slots within budget */
+    for(u32Count = 0; u32Count < _u32MaxCount; u32Count++)
+    {
+      /* Gets slot */
+      pstSlot = &(sstEvent.astPostQueue[(u32Tail + u32Count) & orxEVENT_KU32_POST_QUEUE_MASK]);
+
+      /* Not published yet? */
+      if(pstSlot->u32Sequence != u32Tail + u32Count + 1)
+      {
+        break;
+      }
+
+      /* Acquires published content */
+      orxMEMORY_BARRIER();
+
+      /* Clears skip status (from a previous partial drain) */
+      orxFLAG_SET(pstSlot->u32Flags, orxEVENT_KU32_POST_FLAG_NONE, orxEVENT_KU32_POST_FLAG_SKIP);
+
+      /* Should coalesce? */
+      if(orxFLAG_TEST(pstSlot->u32Flags, orxEVENT_KU32_POST_FLAG_COALESCE))
+      {
+        /* Updates status */
+        bCoalesce = orxTRUE;
+      }
+    }
+
+    /* Should coalesce? */
+    if(bCoalesce != orxFALSE)
+    {
+      /* For all gathered slots, from the most recent one */
+      for(i = u32Count; i > 0; i--)
+      {
+        /* Gets slot */
+        pstSlot = &(sstEvent.astPostQueue[(u32Tail + i - 1) & orxEVENT_KU32_POST_QUEUE_MASK]);
+
+        /* Should coalesce? */
+        if(orxFLAG_TEST(pstSlot->u32Flags, orxEVENT_KU32_POST_FLAG_COALESCE))
+        {
+          const orxEVENT_POST_SLOT *pstLatest;
+          orxU64                    u64Key;
+
+          /* Gets its key & latest matching slot */
+          u64Key    = orxEvent_GetPostKey(&(pstSlot->stEvent));
+          pstLatest = (const orxEVENT_POST_SLOT *)orxHashTable_Get(sstEvent.pstPostTable, u64Key);
+
+          /* First one? */
+          if(pstLatest == orxNULL)
+          {
+            /* Stores it */
+            orxHashTable_Add(sstEvent.pstPostTable, u64Key, pstSlot);
+          }
+          /* Superseded? */
+          else if((pstLatest->stEvent.eType == pstSlot->stEvent.eType)
+               && (pstLatest->stEvent.eID == pstSlot->stEvent.eID)
+               && (pstLatest->stEvent.hSender == pstSlot->stEvent.hSender))
+          {
+            /* Updates status */
+            orxFLAG_SET(pstSlot->u32Flags, orxEVENT_KU32_POST_FLAG_SKIP, orxEVENT_KU32_POST_FLAG_NONE);
+          }
+        }
+      }
+
+      /* Clears coalescing table */
+      orxHashTable_Clear(sstEvent.pstPostTable);
+    }
+
+    /* For all gathered slots */
+    for(i = 0, dTime = dStartTime; i < u32Count;)
+    {
+      /* Gets slot */
+      pstSlot = &(sstEvent.astPostQueue[(u32Tail + i) & orxEVENT_KU32_POST_QUEUE_MASK]);
+
+      /* Not superseded? */
+      if(!orxFLAG_TEST(pstSlot->u32Flags, orxEVENT_KU32_POST_FLAG_SKIP))
+      {
+        /* Sends it */
+        orxEvent_Send(&(pstSlot->stEvent));
+
+        /* Updates result */
+        u32Result++;
+      }
+      else
+      {
+        /* Updates coalesce count */
+        sstEvent.stPostInfo.u32CoalesceCount++;
+      }
+
+      /* Releases slot */
+      orxMEMORY_BARRIER();
+      pstSlot->u32Sequence = u32Tail + i + orxEVENT_KU32_POST_QUEUE_SIZE;
+      i++;
+
+      /* Has time budget? */
+      if(_fMaxTime > orxFLOAT_0)
+      {
+        /* Updates time */
+        dTime = orxSystem_GetTime();
+
+        /* Out of budget? */
+        if(dTime - dStartTime >= (orxDOUBLE)_fMaxTime)
+        {
+          break;
+        }
+      }
+    }
+
+    /* Updates tail */
+    sstEvent.u32PostTail = u32Tail + i;
+
+    /* Updates info */
+    dTime = orxSystem_GetTime() - dStartTime;
+    sstEvent.stPostInfo.u32DispatchCount += u32Result;
+    sstEvent.stPostInfo.dDrainTime       += dTime;
+    sstEvent.stPostInfo.dMaxDrainTime     = orxMAX(sstEvent.stPostInfo.dMaxDrainTime, dTime);
+    sstEvent.stPostInfo.u32DrainCount++;
+
+    /* Updates status */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_FLAG_DRAINING);
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets posted events info
+ * @param[out] _pstPostInfo         Post info to fill
+ * @return orxEVENT_POST_INFO
+ */
+orxEVENT_POST_INFO *orxFASTCALL orxEvent_GetPostInfo(orxEVENT_POST_INFO *_pstPostInfo)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstPostInfo != orxNULL);
+
+  /* Stores info */
+  orxMemory_Copy(_pstPostInfo, &(sstEvent.stPostInfo), sizeof(orxEVENT_POST_INFO));
+  _pstPostInfo->u32QueueDepth = sstEvent.u32PostHead - sstEvent.u32PostTail;
+  _pstPostInfo->u32PostCount  = sstEvent.u32PostCount;
+  _pstPostInfo->u32DropCount  = sstEvent.u32DropCount;
+
+  /* Done! */
+  return _pstPostInfo;
+}
+
+/** Resets posted events info
+ */
+void orxFASTCALL orxEvent_ResetPostInfo()
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+
+  /* Resets info */
+  orxMemory_Zero(&(sstEvent.stPostInfo), sizeof(orxEVENT_POST_INFO));
+  sstEvent.u32PostCount = 0;
+  sstEvent.u32DropCount = 0;
+
+  /* Done! */
+  return;
+}
+
 /** Is currently sending an event?
  * @return orxTRUE / orxFALSE
  */
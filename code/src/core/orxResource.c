@@ -53,6 +53,16 @@
 
 #endif /* __orxANDROID__ */
 
+#if defined(__orxLINUX__)
+
+  #define orxRESOURCE_NATIVE_WATCH
+
+  #include <sys/inotify.h>
+  #include <errno.h>
+  #include <unistd.h>
+
+#endif /* __orxLINUX__ */
+
 /** Module flags
  */
 #define orxRESOURCE_KU32_STATIC_FLAG_NONE             0x00000000                      /**< No flags */
@@ -85,6 +95,16 @@
 #define orxRESOURCE_KU32_WATCH_TIME_UNINITIALIZED     -1                              /**< Watch time uninitialized */
 #define orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY       0.2                             /**< Watch notification delay */
 
+#ifdef orxRESOURCE_NATIVE_WATCH
+
+#define orxRESOURCE_KU32_WATCH_VISIT_LIMIT            256                             /**< Watch visit limit (per update) */
+#define orxRESOURCE_KU32_WATCH_TABLE_SIZE             64                              /**< Native watch table size */
+#define orxRESOURCE_KU32_WATCH_EVENT_LIST_SIZE        64                              /**< Native watch event list size (per update) */
+#define orxRESOURCE_KU32_WATCH_EVENT_BUFFER_SIZE      4096                            /**< Native watch event buffer size */
+#define orxRESOURCE_KU32_WATCH_MASK                   (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_ATTRIB) /**< Native watch mask */
+
+#endif /* orxRESOURCE_NATIVE_WATCH */
+
 #define orxRESOURCE_KU32_BUFFER_SIZE                  256                             /**< Buffer size */
 #define orxRESOURCE_KU32_REQUEST_LIST_SIZE            8192                            /**< Request list size */
 
@@ -136,6 +156,13 @@ typedef struct __orxRESOURCE_INFO_t
   orxSTRINGID               stNameID;                                                 /**< Name ID */
   orxBOOL                   bPendingWatch;                                            /**< Pending watch */
 
+#ifdef orxRESOURCE_NATIVE_WATCH
+
+  orxSTRINGID               stWatchID;                                                /**< Native watch ID */
+  orxU32                    u32WatchRevision;                                         /**< Native watch revision */
+
+#endif /* orxRESOURCE_NATIVE_WATCH */
+
 } orxRESOURCE_INFO;
 
 /** Open resource info
@@ -221,6 +248,14 @@ typedef struct __orxRESOURCE_STATIC_t
   orxU32                    u32RequestThreadID;                                       /**< Request thread ID */
   orxU32                    u32Flags;                                                 /**< Control flags */
 
+#ifdef orxRESOURCE_NATIVE_WATCH
+
+  orxHASHTABLE             *pstWatchTable;                                            /**< Native watch table (descriptor -> directory) */
+  orxU32                    u32WatchRevision;                                         /**< Native watch revision */
+  int                       iWatchFD;                                                 /**< Native watch file descriptor */
+
+#endif /* orxRESOURCE_NATIVE_WATCH */
+
 } orxRESOURCE_STATIC;
 
 
@@ -1021,12 +1056,244 @@ static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s
   return;
 }
 
+#ifdef orxRESOURCE_NATIVE_WATCH
+
+static void orxFASTCALL orxResource_RegisterNativeWatch(orxRESOURCE_INFO *_pstResourceInfo)
+{
+  /* Updates its revision */
+  _pstResourceInfo->u32WatchRevision = sstResource.u32WatchRevision;
+
+  /* Clears its watch ID */
+  _pstResourceInfo->stWatchID = orxSTRINGID_UNDEFINED;
+
+  /* Is a file resource and is native watch available? */
+  if((_pstResourceInfo->pstTypeInfo->pfnGetTime == &orxResource_File_GetTime)
+  && (sstResource.iWatchFD >= 0))
+  {
+    orxCHAR         acBuffer[orxRESOURCE_KU32_BUFFER_SIZE];
+    const orxCHAR  *pcPath, *pcName, *pc;
+    orxS32          s32DirLength;
+
+    /* Gets its path */
+    pcPath = _pstResourceInfo->zLocation + orxString_GetLength(orxRESOURCE_KZ_TYPE_TAG_FILE) + 1;
+
+    /* Finds its name */
+    for(pc = pcName = pcPath; *pc != orxCHAR_NULL; pc++)
+    {
+      /* Directory separator? */
+      if(*pc == orxCHAR_DIRECTORY_SEPARATOR_LINUX)
+      {
+        /* Updates name */
+        pcName = pc + 1;
+      }
+    }
+
+    /* Gets directory */
+    s32DirLength = (orxS32)(pcName - pcPath);
+    if(s32DirLength == 0)
+    {
+      orxString_NCopy(acBuffer, ".", sizeof(acBuffer) - 1);
+    }
+    else
+    {
+      orxString_NCopy(acBuffer, pcPath, (orxU32)orxMIN(s32DirLength, (orxS32)sizeof(acBuffer) - 1));
+      acBuffer[orxMIN(s32DirLength, (orxS32)sizeof(acBuffer) - 1)] = orxCHAR_NULL;
+    }
+    acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
+
+    /* Valid name? */
+    if((*pcName != orxCHAR_NULL) && (s32DirLength < (orxS32)sizeof(acBuffer) - 1))
+    {
+      int iWD;
+
+      /* Adds watch on its directory (returns the existing descriptor if already watched) */
+      iWD = inotify_add_watch(sstResource.iWatchFD, acBuffer, orxRESOURCE_KU32_WATCH_MASK);
+
+      /* Success? */
+      if(iWD >= 0)
+      {
+        const orxSTRING zDirectory;
+
+        /* Gets its stored directory */
+        zDirectory = (const orxSTRING)orxHashTable_Get(sstResource.pstWatchTable, (orxU64)iWD);
+
+        /* New directory? */
+        if(zDirectory == orxNULL)
+        {
+          /* Stores it */
+          zDirectory = orxString_Store(acBuffer);
+          orxHashTable_Add(sstResource.pstWatchTable, (orxU64)iWD, (void *)zDirectory);
+        }
+
+        /* Gets watch ID, using the directory as seen by the descriptor */
+        orxString_NPrint(acBuffer, sizeof(acBuffer), "%s%c%s", zDirectory, orxCHAR_DIRECTORY_SEPARATOR_LINUX, pcName);
+        _pstResourceInfo->stWatchID = orxString_Hash(acBuffer);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't natively watch directory <%s> (%s), falling back to polling for <%s>.", acBuffer, strerror(errno), _pstResourceInfo->zLocation);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxResource_ProcessNativeWatch()
+{
+  union
+  {
+    struct inotify_event      stEvent;
+    orxCHAR                   acBuffer[orxRESOURCE_KU32_WATCH_EVENT_BUFFER_SIZE];
+  }                           uBuffer;
+  orxSTRINGID                 astIDList[orxRESOURCE_KU32_WATCH_EVENT_LIST_SIZE];
+  orxU32                      u32IDCount = 0;
+  orxBOOL                     bRefresh = orxFALSE;
+  ssize_t                     sSize;
+
+  /* Checks */
+  orxASSERT(sstResource.iWatchFD >= 0);
+
+  /* While there are pending events */
+  while((sSize = read(sstResource.iWatchFD, &uBuffer, sizeof(uBuffer))) > 0)
+  {
+    const orxCHAR *pc;
+
+    /* For all events */
+    for(pc = uBuffer.acBuffer;
+        pc < uBuffer.acBuffer + sSize;
+        pc += sizeof(struct inotify_event) + ((const struct inotify_event *)pc)->len)
+    {
+      const struct inotify_event *pstEvent;
+
+      /* Gets it */
+      pstEvent = (const struct inotify_event *)pc;
+
+      /* Overflow or removed watch? */
+      if(pstEvent->mask & (IN_Q_OVERFLOW | IN_IGNORED))
+      {
+        /* Removed watch? */
+        if(pstEvent->mask & IN_IGNORED)
+        {
+          /* Forgets its directory */
+          orxHashTable_Remove(sstResource.pstWatchTable, (orxU64)pstEvent->wd);
+        }
+
+        /* Asks for refresh */
+        bRefresh = orxTRUE;
+      }
+      /* Has name? */
+      else if((pstEvent->len > 0) && (bRefresh == orxFALSE))
+      {
+        const orxSTRING zDirectory;
+
+        /* Gets its directory */
+        zDirectory = (const orxSTRING)orxHashTable_Get(sstResource.pstWatchTable, (orxU64)pstEvent->wd);
+
+        /* Valid? */
+        if(zDirectory != orxNULL)
+        {
+          orxCHAR     acBuffer[orxRESOURCE_KU32_BUFFER_SIZE];
+          orxSTRINGID stID;
+          orxU32      i;
+
+          /* Gets its ID */
+          orxString_NPrint(acBuffer, sizeof(acBuffer), "%s%c%s", zDirectory, orxCHAR_DIRECTORY_SEPARATOR_LINUX, pstEvent->name);
+          stID = orxString_Hash(acBuffer);
+
+          /* Already listed? */
+          for(i = 0; (i < u32IDCount) && (astIDList[i] != stID); i++);
+
+          /* New? */
+          if(i == u32IDCount)
+          {
+            /* Full? */
+            if(u32IDCount == orxRESOURCE_KU32_WATCH_EVENT_LIST_SIZE)
+            {
+              /* Asks for refresh */
+              bRefresh = orxTRUE;
+            }
+            else
+            {
+              /* Stores it */
+              astIDList[u32IDCount++] = stID;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /* Should refresh? */
+  if(bRefresh != orxFALSE)
+  {
+    /* Updates revision: all file resources will be registered & polled again when visited */
+    sstResource.u32WatchRevision++;
+  }
+  /* Has changes? */
+  else if(u32IDCount != 0)
+  {
+    orxS32 i, s32ListCount;
+
+    /* For all watched groups */
+    for(i = 0, s32ListCount = orxConfig_GetListCount(orxRESOURCE_KZ_CONFIG_WATCH_LIST); i < s32ListCount; i++)
+    {
+      orxRESOURCE_GROUP *pstGroup;
+
+      /* Gets group */
+      pstGroup = orxResource_FindGroup(orxString_Hash(orxConfig_GetListString(orxRESOURCE_KZ_CONFIG_WATCH_LIST, i)));
+
+      /* Found? */
+      if(pstGroup != orxNULL)
+      {
+        orxRESOURCE_INFO *pstResourceInfo;
+        orxHANDLE         hIterator;
+
+        /* For all its cached resources */
+        for(hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
+            hIterator != orxHANDLE_UNDEFINED;
+            hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
+        {
+          /* Natively watched and not already queued? */
+          if((pstResourceInfo->stWatchID != orxSTRINGID_UNDEFINED)
+          && (pstResourceInfo->u32WatchRevision == sstResource.u32WatchRevision)
+          && (pstResourceInfo->bPendingWatch == orxFALSE))
+          {
+            orxU32 j;
+
+            /* Is in changed list? */
+            for(j = 0; (j < u32IDCount) && (astIDList[j] != pstResourceInfo->stWatchID); j++);
+            if(j < u32IDCount)
+            {
+              /* Updates its status */
+              pstResourceInfo->bPendingWatch = orxTRUE;
+
+              /* Adds request */
+              orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+#endif /* orxRESOURCE_NATIVE_WATCH */
+
 static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
   static orxS32 ss32GroupIndex = 0;
   orxS32        s32ListCount;
   orxU32        u32WatchCount = 0;
   orxBOOL       bAbort = orxFALSE;
+#ifdef orxRESOURCE_NATIVE_WATCH
+  orxU32        u32VisitCount = 0;
+#endif /* orxRESOURCE_NATIVE_WATCH */
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxResource_Watch");
@@ -1034,6 +1301,17 @@ static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, vo
   /* Pushes config section */
   orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
 
+#ifdef orxRESOURCE_NATIVE_WATCH
+
+  /* Is native watch available? */
+  if(sstResource.iWatchFD >= 0)
+  {
+    /* Processes its events */
+    orxResource_ProcessNativeWatch();
+  }
+
+#endif /* orxRESOURCE_NATIVE_WATCH */
+
   /* For all watched groups */
   for(s32ListCount = orxConfig_GetListCount(orxRESOURCE_KZ_CONFIG_WATCH_LIST); ss32GroupIndex < s32ListCount; ss32GroupIndex++)
   {
@@ -1070,6 +1348,35 @@ static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, vo
         /* Does its type support time? */
         if(pstResourceInfo->pstTypeInfo->pfnGetTime != orxNULL)
         {
+#ifdef orxRESOURCE_NATIVE_WATCH
+
+          /* Outdated native watch? */
+          if(pstResourceInfo->u32WatchRevision != sstResource.u32WatchRevision)
+          {
+            /* Registers it (and polls it once, to catch up on any missed change) */
+            orxResource_RegisterNativeWatch(pstResourceInfo);
+          }
+          /* Natively watched? */
+          else if(pstResourceInfo->stWatchID != orxSTRINGID_UNDEFINED)
+          {
+            /* Updates visit count */
+            u32VisitCount++;
+
+            /* Reached limit? */
+            if(u32VisitCount >= orxRESOURCE_KU32_WATCH_VISIT_LIMIT)
+            {
+              /* Aborts */
+              bAbort = orxTRUE;
+
+              break;
+            }
+
+            /* Skips polling */
+            continue;
+          }
+
+#endif /* orxRESOURCE_NATIVE_WATCH */
+
           /* Not already queued? */
           if(pstResourceInfo->bPendingWatch == orxFALSE)
           {
@@ -1169,6 +1476,26 @@ static void orxResource_UpdatePostInit()
         /* Has watch list? */
         if(orxConfig_HasValue(orxRESOURCE_KZ_CONFIG_WATCH_LIST) != orxFALSE)
         {
+#ifdef orxRESOURCE_NATIVE_WATCH
+
+          /* Creates native watch */
+          sstResource.iWatchFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+          /* Success? */
+          if(sstResource.iWatchFD >= 0)
+          {
+            /* Creates its table */
+            sstResource.pstWatchTable = orxHashTable_Create(orxRESOURCE_KU32_WATCH_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+            orxASSERT(sstResource.pstWatchTable != orxNULL);
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Native watch unavailable (%s), falling back to polling.", strerror(errno));
+          }
+
+#endif /* orxRESOURCE_NATIVE_WATCH */
+
           /* Registers watch callbacks */
           orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), orxResource_Watch, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST);
 
@@ -1559,6 +1886,10 @@ orxSTATUS orxFASTCALL orxResource_Init()
 
               /* Inits vars */
               sstResource.stLastWatchedGroupID = orxSTRINGID_UNDEFINED;
+#ifdef orxRESOURCE_NATIVE_WATCH
+              sstResource.iWatchFD          = -1;
+              sstResource.u32WatchRevision  = 1;
+#endif /* orxRESOURCE_NATIVE_WATCH */
 
 #ifdef __orxANDROID__
 
@@ -1701,6 +2032,22 @@ void orxFASTCALL orxResource_Exit()
       }
     }
 
+#ifdef orxRESOURCE_NATIVE_WATCH
+
+    /* Has native watch? */
+    if(sstResource.iWatchFD >= 0)
+    {
+      /* Closes it */
+      close(sstResource.iWatchFD);
+      sstResource.iWatchFD = -1;
+
+      /* Deletes its table */
+      orxHashTable_Delete(sstResource.pstWatchTable);
+      sstResource.pstWatchTable = orxNULL;
+    }
+
+#endif /* orxRESOURCE_NATIVE_WATCH */
+
     /* Has uncached location? */
     if(sstResource.zLastUncachedLocation != orxNULL)
     {
@@ -2168,6 +2515,10 @@ const orxSTRING orxFASTCALL orxResource_Locate(const orxSTRING _zGroup, const or
               pstResourceInfo->stGroupID    = stGroupID;
               pstResourceInfo->stStorageID  = pstStorage->stID;
               pstResourceInfo->stNameID     = stKey;
+#ifdef orxRESOURCE_NATIVE_WATCH
+              pstResourceInfo->stWatchID        = orxSTRINGID_UNDEFINED;
+              pstResourceInfo->u32WatchRevision = 0;
+#endif /* orxRESOURCE_NATIVE_WATCH */
               orxMEMORY_BARRIER();
 
               /* Adds it to cache */
@@ -90,6 +90,8 @@
  */
 #define orxTHREAD_KU32_TASK_LIST_SIZE                 1024
 #define orxTHREAD_KU32_MAX_WORKER_NUMBER              (orxTHREAD_KU32_MAX_THREAD_NUMBER >> 1)
+#define orxTHREAD_KU32_LINEAR_WORKER_ID               0
+#define orxTHREAD_KU32_JOB_CHUNK_PER_WORKER           4
 
 #define orxTHREAD_KZ_THREAD_NAME_MAIN                 "Main"
 #define orxTHREAD_KZ_THREAD_NAME_WORKER               "Task Runner"
@@ -132,6 +134,7 @@ typedef struct __orxTHREAD_TASK_t
   orxTHREAD_FUNCTION      pfnElse;
   void                   *pContext;
   orxSTATUS               eResult;
+  orxU32                  u32Done;
 
 } orxTHREAD_TASK;
 
@@ -145,10 +148,27 @@ typedef struct __orxTHREAD_WORKER_t
   volatile orxU32         u32TaskInIndex;
   volatile orxU32         u32TaskProcessIndex;
   volatile orxU32         u32TaskOutIndex;
+  volatile orxU32         u32Idle;
   volatile orxTHREAD_TASK astTaskList[orxTHREAD_KU32_TASK_LIST_SIZE];
 
 } orxTHREAD_WORKER;
 
+/** Parallel job
+ */
+struct __orxTHREAD_JOB_t
+{
+  orxTHREAD_PARALLEL_FUNCTION pfnRun;
+  void                   *pContext;
+  orxU32                  u32Count;
+  orxU32                  u32Grain;
+  orxU32                  u32ChunkCount;
+  volatile orxU32         u32NextChunk;
+  volatile orxU32         u32DoneCount;
+  volatile orxU32         u32RefCount;
+  volatile orxU32         u32Failed;
+
+};
+
 /** Static structure
  */
 typedef struct __orxTHREAD_STATIC_t
@@ -285,12 +305,14 @@ static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo,
   for(u32WorkerID = 0; u32WorkerID < sstThread.u32WorkerCount; u32WorkerID++)
   {
     /* While there are processed tasks */
-    while(sstThread.astWorkerList[u32WorkerID].u32TaskOutIndex != sstThread.astWorkerList[u32WorkerID].u32TaskProcessIndex)
+    while((sstThread.astWorkerList[u32WorkerID].u32TaskOutIndex != sstThread.astWorkerList[u32WorkerID].u32TaskProcessIndex)
+       && (sstThread.astWorkerList[u32WorkerID].astTaskList[sstThread.astWorkerList[u32WorkerID].u32TaskOutIndex].u32Done != 0))
     {
       volatile orxTHREAD_TASK *pstTask;
 
       /* Gets Task */
       pstTask = &(sstThread.astWorkerList[u32WorkerID].astTaskList[sstThread.astWorkerList[u32WorkerID].u32TaskOutIndex]);
+      orxMEMORY_BARRIER();
 
       /* Succeeded? */
       if(pstTask->eResult != orxSTATUS_FAILURE)
@@ -313,6 +335,7 @@ static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo,
       }
 
       /* Updates task out index */
+      pstTask->u32Done = 0;
       orxMEMORY_BARRIER();
       sstThread.astWorkerList[u32WorkerID].u32TaskOutIndex = (sstThread.astWorkerList[u32WorkerID].u32TaskOutIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
     }
@@ -322,32 +345,89 @@ static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo,
   return;
 }
 
+static orxINLINE orxBOOL orxThread_ProcessTask(volatile orxTHREAD_WORKER *_pstWorker)
+{
+  volatile orxTHREAD_TASK  *pstTask;
+  orxU32                    u32TaskIndex;
+  orxBOOL                   bClaimed = orxFALSE, bResult = orxFALSE;
+
+  /* Claims next pending task, if any (owner and thieves race for it) */
+  do
+  {
+    /* Gets its index */
+    u32TaskIndex = _pstWorker->u32TaskProcessIndex;
+
+    /* Is there a pending task? */
+    if(u32TaskIndex != _pstWorker->u32TaskInIndex)
+    {
+      /* Tries to claim it */
+      bClaimed = orxMEMORY_ATOMIC_CAS32(&(_pstWorker->u32TaskProcessIndex), u32TaskIndex, (u32TaskIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1));
+    }
+    else
+    {
+      /* Stops */
+      break;
+    }
+  } while(bClaimed == orxFALSE);
+
+  /* Claimed? */
+  if(bClaimed != orxFALSE)
+  {
+    /* Gets task */
+    orxMEMORY_BARRIER();
+    pstTask = &(_pstWorker->astTaskList[u32TaskIndex]);
+
+    /* Runs it */
+    pstTask->eResult = (pstTask->pfnRun != orxNULL) ? pstTask->pfnRun(pstTask->pContext) : orxSTATUS_SUCCESS;
+
+    /* Marks it as done */
+    orxMEMORY_BARRIER();
+    pstTask->u32Done = 1;
+
+    /* Updates result */
+    bResult = orxTRUE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
 static orxSTATUS orxFASTCALL orxThread_Work(void *_pContext)
 {
   orxU32    u32WorkerID;
+  orxBOOL   bStolen;
   orxSTATUS eResult = orxSTATUS_SUCCESS;
 
   /* Gets worker ID */
   u32WorkerID = (orxU32)(orxUPTR)_pContext;
 
   /* Waits for worker semaphore */
+  sstThread.astWorkerList[u32WorkerID].u32Idle = 1;
   orxThread_WaitSemaphore(sstThread.astWorkerList[u32WorkerID].pstWorkSemaphore);
+  sstThread.astWorkerList[u32WorkerID].u32Idle = 0;
 
-  /* While there are pending requests */
-  while(sstThread.astWorkerList[u32WorkerID].u32TaskProcessIndex != sstThread.astWorkerList[u32WorkerID].u32TaskInIndex)
+  do
   {
-    volatile orxTHREAD_TASK *pstTask;
+    /* While there are pending requests */
+    while(orxThread_ProcessTask(&(sstThread.astWorkerList[u32WorkerID])) != orxFALSE)
+      ;
 
-    /* Gets task */
-    pstTask = &(sstThread.astWorkerList[u32WorkerID].astTaskList[sstThread.astWorkerList[u32WorkerID].u32TaskProcessIndex]);
+    /* Clears steal status */
+    bStolen = orxFALSE;
 
-    /* Runs it */
-    pstTask->eResult = (pstTask->pfnRun != orxNULL) ? pstTask->pfnRun(pstTask->pContext) : orxSTATUS_SUCCESS;
+    /* Not the linear worker? */
+    if(u32WorkerID != orxTHREAD_KU32_LINEAR_WORKER_ID)
+    {
+      orxU32 i;
 
-    /* Updates task process index */
-    orxMEMORY_BARRIER();
-    sstThread.astWorkerList[u32WorkerID].u32TaskProcessIndex = (sstThread.astWorkerList[u32WorkerID].u32TaskProcessIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
-  }
+      /* For all other non-linear workers */
+      for(i = 1; (i < sstThread.u32WorkerCount - 1) && (bStolen == orxFALSE); i++)
+      {
+        /* Tries to steal one of their pending tasks */
+        bStolen = orxThread_ProcessTask(&(sstThread.astWorkerList[((u32WorkerID - 1 + i) % (sstThread.u32WorkerCount - 1)) + 1]));
+      }
+    }
+  } while(bStolen != orxFALSE);
 
   /* Done! */
   return eResult;
@@ -398,11 +478,34 @@ static orxSTATUS orxFASTCALL orxThread_RunTaskInternal(const orxTHREAD_FUNCTION
     }
     else
     {
+      orxU32 i, u32WorkerID, u32MinPending = orxU32_UNDEFINED;
+
       /* Updates current worker ID */
       sstThread.u32CurrentWorkerID = sstThread.u32CurrentWorkerID % (sstThread.u32WorkerCount - 1) + 1;
 
-      /* Gets worker */
-      pstWorker = &(sstThread.astWorkerList[sstThread.u32CurrentWorkerID]);
+      /* For all non-linear workers, starting with the current one */
+      for(i = 0, u32WorkerID = sstThread.u32CurrentWorkerID, pstWorker = orxNULL; i < sstThread.u32WorkerCount - 1; i++, u32WorkerID = u32WorkerID % (sstThread.u32WorkerCount - 1) + 1)
+      {
+        orxU32 u32Pending;
+
+        /* Gets its pending task count */
+        u32Pending = (sstThread.astWorkerList[u32WorkerID].u32TaskInIndex - sstThread.astWorkerList[u32WorkerID].u32TaskProcessIndex) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+
+        /* Less loaded? */
+        if(u32Pending < u32MinPending)
+        {
+          /* Selects it */
+          pstWorker     = &(sstThread.astWorkerList[u32WorkerID]);
+          u32MinPending = u32Pending;
+
+          /* Idle? */
+          if((u32Pending == 0) && (pstWorker->u32Idle != 0))
+          {
+            /* Stops */
+            break;
+          }
+        }
+      }
     }
 
     /* Waits for task semaphore */
@@ -439,12 +542,87 @@ static orxSTATUS orxFASTCALL orxThread_RunTaskInternal(const orxTHREAD_FUNCTION
 
     /* Signals worker semaphore */
     orxThread_SignalSemaphore(pstWorker->pstWorkSemaphore);
+
+    /* Not linear and worker is busy? */
+    if((_u32WorkerID == orxU32_UNDEFINED) && (pstWorker->u32Idle == 0))
+    {
+      orxU32 i;
+
+      /* For all non-linear workers */
+      for(i = 1; i < sstThread.u32WorkerCount; i++)
+      {
+        /* Idle? */
+        if((&(sstThread.astWorkerList[i]) != pstWorker) && (sstThread.astWorkerList[i].u32Idle != 0))
+        {
+          /* Wakes it up so that it can steal the task */
+          orxThread_SignalSemaphore(sstThread.astWorkerList[i].pstWorkSemaphore);
+          break;
+        }
+      }
+    }
   }
 
   /* Done! */
   return eResult;
 }
 
+static void orxFASTCALL orxThread_ProcessJob(orxTHREAD_JOB *_pstJob)
+{
+  orxU32 u32Chunk;
+
+  /* While there are chunks left */
+  while((u32Chunk = orxMEMORY_ATOMIC_INC32(&(_pstJob->u32NextChunk)) - 1) < _pstJob->u32ChunkCount)
+  {
+    orxU32 u32Index;
+
+    /* Gets its first index */
+    u32Index = u32Chunk * _pstJob->u32Grain;
+
+    /* Runs it */
+    if(_pstJob->pfnRun(u32Index, orxMIN(_pstJob->u32Grain, _pstJob->u32Count - u32Index), _pstJob->pContext) == orxSTATUS_FAILURE)
+    {
+      /* Updates status */
+      _pstJob->u32Failed = 1;
+    }
+
+    /* Updates done count */
+    orxMEMORY_ATOMIC_INC32(&(_pstJob->u32DoneCount));
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxThread_ReleaseJob(orxTHREAD_JOB *_pstJob)
+{
+  /* Last reference? */
+  if(orxMEMORY_ATOMIC_DEC32(&(_pstJob->u32RefCount)) == 0)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstJob);
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxThread_RunJob(void *_pContext)
+{
+  orxTHREAD_JOB *pstJob;
+
+  /* Gets job */
+  pstJob = (orxTHREAD_JOB *)_pContext;
+
+  /* Processes it */
+  orxThread_ProcessJob(pstJob);
+
+  /* Releases it */
+  orxThread_ReleaseJob(pstJob);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -1283,6 +1461,101 @@ orxSTATUS orxFASTCALL orxThread_RunTaskLinear(const orxTHREAD_FUNCTION _pfnRun,
   return eResult;
 }
 
+/** Runs a function in parallel over [0, _u32Count[, split in ranges of _u32Grain indices, on the task workers. Queued
+ * ranges are shared between all the workers and the thread calling orxThread_WaitJob(), which must be called exactly once per job.
+ * @param[in]   _u32Count                             Number of indices to process
+ * @param[in]   _u32Grain                             Number of indices per range, 0 for automatic
+ * @param[in]   _pfnRun                               Function to run for each range, can be run concurrently from any thread
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ * @return      orxTHREAD_JOB / orxNULL
+ */
+orxTHREAD_JOB *orxFASTCALL orxThread_ParallelFor(orxU32 _u32Count, orxU32 _u32Grain, const orxTHREAD_PARALLEL_FUNCTION _pfnRun, void *_pContext)
+{
+  orxTHREAD_JOB *pstResult;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfnRun != orxNULL);
+
+  /* Allocates job */
+  pstResult = (orxTHREAD_JOB *)orxMemory_Allocate(sizeof(orxTHREAD_JOB), orxMEMORY_TYPE_SYSTEM);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    orxU32 i, u32TaskCount;
+
+    /* Inits it */
+    orxMemory_Zero(pstResult, sizeof(orxTHREAD_JOB));
+    pstResult->pfnRun       = _pfnRun;
+    pstResult->pContext     = _pContext;
+    pstResult->u32Count     = _u32Count;
+    pstResult->u32Grain     = (_u32Grain != 0) ? _u32Grain : orxMAX(_u32Count / (sstThread.u32WorkerCount * orxTHREAD_KU32_JOB_CHUNK_PER_WORKER), 1);
+    pstResult->u32ChunkCount= (_u32Count + pstResult->u32Grain - 1) / pstResult->u32Grain;
+    pstResult->u32RefCount  = 1;
+
+    /* Gets task count (the waiting thread will also process chunks) */
+    u32TaskCount = (pstResult->u32ChunkCount > 1) ? orxMIN(pstResult->u32ChunkCount - 1, sstThread.u32WorkerCount - 1) : 0;
+
+    /* For all tasks */
+    for(i = 0; i < u32TaskCount; i++)
+    {
+      /* Adds a reference */
+      orxMEMORY_ATOMIC_INC32(&(pstResult->u32RefCount));
+
+      /* Runs it */
+      if(orxThread_RunTaskInternal(orxThread_RunJob, orxNULL, orxNULL, pstResult, orxU32_UNDEFINED) == orxSTATUS_FAILURE)
+      {
+        /* Removes reference */
+        orxMEMORY_ATOMIC_DEC32(&(pstResult->u32RefCount));
+
+        /* Stops, remaining chunks will be processed when waiting */
+        break;
+      }
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't allocate parallel job for %u indices.", _u32Count);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Waits for a parallel job to complete, processing its remaining ranges on the calling thread. The job is released and becomes invalid.
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS if no range returned orxSTATUS_FAILURE, orxSTATUS_FAILURE otherwise
+ */
+orxSTATUS orxFASTCALL orxThread_WaitJob(orxTHREAD_JOB *_pstJob)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+
+  /* Processes remaining chunks */
+  orxThread_ProcessJob(_pstJob);
+
+  /* Waits for chunks processed by workers */
+  while(_pstJob->u32DoneCount != _pstJob->u32ChunkCount)
+  {
+    orxThread_Yield();
+  }
+  orxMEMORY_BARRIER();
+
+  /* Updates result */
+  eResult = (_pstJob->u32Failed != 0) ? orxSTATUS_FAILURE : orxSTATUS_SUCCESS;
+
+  /* Releases job (workers that haven't started yet will release it later) */
+  orxThread_ReleaseJob(_pstJob);
+
+  /* Done! */
+  return eResult;
+}
+
 /** Gets number of pending asynchronous tasks awaiting full completion (might pump task notifications if called from main thread)
  * @return      Number of pending asynchronous tasks
  */
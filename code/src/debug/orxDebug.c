@@ -32,8 +32,10 @@
 
 #include "debug/orxDebug.h"
 #include "core/orxConsole.h"
+#include "memory/orxMemory.h"
 
 #include <stdlib.h>
+#include <stddef.h>
 
 #if defined(__orxANDROID__)
 
@@ -62,6 +64,21 @@
 #include <stdarg.h>
 #include <time.h>
 
+#if defined(orxHAS_ATOMICS) && !defined(__orxWEB__)
+
+  #define orxDEBUG_HAS_ASYNC
+
+  #ifndef __orxWINDOWS__
+
+    #include <pthread.h>
+    #include <sched.h>
+    #include <signal.h>
+    #include <unistd.h>
+
+  #endif /* !__orxWINDOWS__ */
+
+#endif /* orxHAS_ATOMICS && !__orxWEB__ */
+
 
 /** Platform independent defines
  */
@@ -70,7 +87,9 @@
 
 #define orxDEBUG_KU32_STATIC_FLAG_READY         0x10000000
 #define orxDEBUG_KU32_STATIC_FLAG_ANSI          0x20000000
-#define orxDEBUG_KU32_STATIC_FLAG_LOGGING       0x40000000
+#define orxDEBUG_KU32_STATIC_FLAG_ASYNC         0x01000000
+#define orxDEBUG_KU32_STATIC_FLAG_COMPACT       0x02000000
+#define orxDEBUG_KU32_STATIC_FLAG_STOP          0x04000000
 
 #define orxDEBUG_KU32_STATIC_MASK_ALL           0xFFFFFFFF
 
@@ -84,10 +103,97 @@
 
 #endif /* __orxDEBUG__ */
 
+#define orxDEBUG_KU32_FILE_NAME_SIZE            512
+
+#define orxDEBUG_KU32_ASYNC_SLOT_NUMBER         256                 /**< Needs to be a power of 2 */
+#define orxDEBUG_KU32_ASYNC_SLOT_MASK           (orxDEBUG_KU32_ASYNC_SLOT_NUMBER - 1)
+#define orxDEBUG_KU32_ASYNC_SLOT_SIZE           orxDEBUG_KS32_BUFFER_OUTPUT_SIZE
+#define orxDEBUG_KU32_ASYNC_IDLE_DELAY          1                   /**< Writer's sleep when idle, in milliseconds */
+#define orxDEBUG_KU32_CRASH_LOCK_TRY_NUMBER     100
+
+#define orxDEBUG_KU32_DICTIONARY_SIZE           4096                /**< Needs to be a power of 2 */
+#define orxDEBUG_KU32_DICTIONARY_MASK           (orxDEBUG_KU32_DICTIONARY_SIZE - 1)
+#define orxDEBUG_KU32_DICTIONARY_PROBE          32
+#define orxDEBUG_KU32_DICTIONARY_PENDING        0xFFFFFFFF          /**< Entry being registered */
+#define orxDEBUG_KU32_DICTIONARY_OVERFLOW       0x80000000          /**< ID flag of strings that couldn't be registered */
+
+#define orxDEBUG_KU32_DEFINITION_FLAG_LOG       0x00000001
+#define orxDEBUG_KU32_DEFINITION_FLAG_DEBUG     0x00000002
+
+#define orxDEBUG_KZ_COMPACT_SUFFIX              ".bin"
+#define orxDEBUG_KZ_COMPACT_MAGIC               "orxLOG\x01\n"
+#define orxDEBUG_KU32_COMPACT_MAGIC_SIZE        8
+#define orxDEBUG_KU32_COMPACT_MESSAGE_SIZE      28
+#define orxDEBUG_KC_COMPACT_DEFINITION          'D'
+#define orxDEBUG_KC_COMPACT_MESSAGE             'M'
+#define orxDEBUG_KC_COMPACT_SIGNED              'i'
+#define orxDEBUG_KC_COMPACT_UNSIGNED            'u'
+#define orxDEBUG_KC_COMPACT_FLOAT               'f'
+#define orxDEBUG_KC_COMPACT_POINTER             'p'
+#define orxDEBUG_KC_COMPACT_STRING              's'
+
+
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Log ring slot
+ */
+typedef struct __orxDEBUG_SLOT_t
+{
+  /* Sequence */
+  volatile orxU32 u32Sequence;
+
+  /* Debug level */
+  orxU32 u32Level;
+
+  /* Data size */
+  orxU32 u32Size;
+
+  /* Data: formatted text or compact record */
+  orxU8 au8Data[orxDEBUG_KU32_ASYNC_SLOT_SIZE];
+
+} orxDEBUG_SLOT;
+
+/** Compact string definition
+ */
+typedef struct __orxDEBUG_DEFINITION_t
+{
+  /* ID */
+  orxU32 u32ID;
+
+  /* Size */
+  orxU32 u32Size;
+
+  /* Files it's been written to */
+  orxU32 u32FileFlags;
+
+  /* Content */
+  orxCHAR *zString;
+
+} orxDEBUG_DEFINITION;
+
+/** Printf conversion specification
+ */
+typedef struct __orxDEBUG_SPEC_t
+{
+  /* Start (after the %) */
+  const orxCHAR *pcStart;
+
+  /* Length modifier */
+  const orxCHAR *pcLength;
+
+  /* Conversion */
+  const orxCHAR *pcConversion;
+
+  /* Number of * (width/precision) */
+  orxU32 u32StarCount;
+
+  /* Normalized length modifier */
+  orxCHAR cLength;
+
+} orxDEBUG_SPEC;
+
 /** Static structure
  */
 typedef struct __orxDEBUG_STATIC_t
@@ -111,11 +217,55 @@ typedef struct __orxDEBUG_STATIC_t
   orxU32 u32LevelFlags;
 
   /* Control flags */
-  orxU32 u32Flags;
+  volatile orxU32 u32Flags;
 
   /* Log callback function */
   orxDEBUG_CALLBACK_FUNCTION pfnLogCallback;
 
+  /* Debug file size */
+  orxU32 u32DebugFileSize;
+
+  /* Log file size */
+  orxU32 u32LogFileSize;
+
+  /* Rotation size */
+  orxU32 u32RotationSize;
+
+  /* Rotation file number */
+  orxU32 u32RotationNumber;
+
+#ifdef orxDEBUG_HAS_ASYNC
+
+  /* Log ring */
+  orxDEBUG_SLOT *astSlotList;
+
+  /* Registered string hashes (producer side) */
+  volatile orxU32 *au32StringTable;
+
+  /* Registered strings (producer side) */
+  orxCHAR **azStringList;
+
+  /* String definitions (writer side) */
+  orxDEBUG_DEFINITION *astDefinitionList;
+
+  /* Enqueue position */
+  volatile orxU32 u32EnqueuePosition;
+
+  /* Dequeue position */
+  orxU32 u32DequeuePosition;
+
+  /* Consumer lock */
+  volatile orxU32 u32ConsumerLock;
+
+  /* Writer thread */
+#ifdef __orxWINDOWS__
+  HANDLE hWriterThread;
+#else /* __orxWINDOWS__ */
+  pthread_t hWriterThread;
+#endif /* __orxWINDOWS__ */
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
 } orxDEBUG_STATIC;
 
 
@@ -127,6 +277,29 @@ typedef struct __orxDEBUG_STATIC_t
  */
 static orxDEBUG_STATIC sstDebug;
 
+/** Is current thread logging?
+ */
+static orxTHREAD_LOCAL orxBOOL sbLogging;
+
+#ifdef orxDEBUG_HAS_ASYNC
+
+#ifdef __orxWINDOWS__
+
+/** Previous exception filter
+ */
+static LPTOP_LEVEL_EXCEPTION_FILTER spfnPreviousExceptionFilter = NULL;
+
+#else /* __orxWINDOWS__ */
+
+/** Crash signals & their previous handlers
+ */
+static const int sasCrashSignalList[] = {SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT};
+static struct sigaction sastPreviousActionList[orxARRAY_GET_ITEM_COUNT(sasCrashSignalList)];
+
+#endif /* __orxWINDOWS__ */
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
 
 /***************************************************************************
  * Private functions                                                       *
@@ -260,28 +433,1727 @@ static orxINLINE void orxDebug_ClearANSICodes(orxSTRING _zBuffer)
           pc++)
         ;
 
-      /* Valid? */
-      if(*pc != orxCHAR_NULL)
-      {
-        /* Skips end of code */
-        continue;
+      /* Valid? */
+      if(*pc != orxCHAR_NULL)
+      {
+        /* Skips end of code */
+        continue;
+      }
+      else
+      {
+        /* Stops */
+        break;
+      }
+    }
+    else
+    {
+      /* Should copy? */
+      if(pcDst != pc)
+      {
+        *pcDst = *pc;
+      }
+
+      /* Updates destination */
+      pcDst++;
+    }
+  }
+
+  /* Ends string */
+  *pcDst = orxCHAR_NULL;
+
+  /* Done! */
+  return;
+}
+
+/** Has ANSI codes>
+ * @param[in]   _zBuffer                      Concerned buffer
+ */
+static orxINLINE orxBOOL orxDebug_HasANSICodes(orxSTRING _zBuffer)
+{
+  orxCHAR  *pc;
+  orxBOOL   bResult = orxFALSE;
+
+  /* For all characters */
+  for(pc = _zBuffer; *pc != orxCHAR_NULL; pc++)
+  {
+    /* ANSI escape code? */
+    if(*pc == orxANSI_KC_MARKER)
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Writes data to an already prepared log/debug file
+ * @param[in]   _bLog                         Log file (orxTRUE) or debug file (orxFALSE)
+ * @param[in]   _pData                        Data to write
+ * @param[in]   _u32Size                      Size of the data, in bytes
+ */
+static orxINLINE void orxDebug_WriteFile(orxBOOL _bLog, const void *_pData, orxU32 _u32Size)
+{
+  FILE *pstFile;
+
+  /* Gets file */
+  pstFile = (_bLog != orxFALSE) ? sstDebug.pstLogFile : sstDebug.pstDebugFile;
+
+  /* Valid? */
+  if(pstFile != orxNULL)
+  {
+    /* Writes data */
+    fwrite(_pData, 1, (size_t)_u32Size, pstFile);
+
+    /* Updates file size */
+    if(_bLog != orxFALSE)
+    {
+      sstDebug.u32LogFileSize += _u32Size;
+    }
+    else
+    {
+      sstDebug.u32DebugFileSize += _u32Size;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Flushes log & debug files
+ */
+static orxINLINE void orxDebug_FlushFiles()
+{
+  /* Flushes files */
+  if(sstDebug.pstLogFile != orxNULL)
+  {
+    fflush(sstDebug.pstLogFile);
+  }
+  if(sstDebug.pstDebugFile != orxNULL)
+  {
+    fflush(sstDebug.pstDebugFile);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Closes log & debug files
+ */
+static orxINLINE void orxDebug_CloseFiles()
+{
+  /* Closes files */
+  if(sstDebug.pstLogFile != orxNULL)
+  {
+    fclose(sstDebug.pstLogFile);
+    sstDebug.pstLogFile = orxNULL;
+  }
+  if(sstDebug.pstDebugFile != orxNULL)
+  {
+    fclose(sstDebug.pstDebugFile);
+    sstDebug.pstDebugFile = orxNULL;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Rotates a file: name -> name.1 -> ... -> name.N, the oldest one being deleted
+ * @param[in]   _zFileName                    Name of the file to rotate
+ */
+static void orxDebug_RotateFile(const orxSTRING _zFileName)
+{
+  /* Keeps history? */
+  if(sstDebug.u32RotationNumber != 0)
+  {
+    orxCHAR acSource[orxDEBUG_KU32_FILE_NAME_SIZE], acDestination[orxDEBUG_KU32_FILE_NAME_SIZE];
+    orxU32  i;
+
+    /* Deletes oldest file */
+    snprintf(acDestination, sizeof(acDestination), "%s.%u", _zFileName, (unsigned int)sstDebug.u32RotationNumber);
+    acDestination[sizeof(acDestination) - 1] = orxCHAR_NULL;
+    remove(acDestination);
+
+    /* Shifts all the others */
+    for(i = sstDebug.u32RotationNumber - 1; i > 0; i--)
+    {
+      snprintf(acSource, sizeof(acSource), "%s.%u", _zFileName, (unsigned int)i);
+      acSource[sizeof(acSource) - 1] = orxCHAR_NULL;
+      snprintf(acDestination, sizeof(acDestination), "%s.%u", _zFileName, (unsigned int)(i + 1));
+      acDestination[sizeof(acDestination) - 1] = orxCHAR_NULL;
+      rename(acSource, acDestination);
+    }
+
+    /* Moves current file */
+    snprintf(acDestination, sizeof(acDestination), "%s.1", _zFileName);
+    acDestination[sizeof(acDestination) - 1] = orxCHAR_NULL;
+    rename(_zFileName, acDestination);
+  }
+  else
+  {
+    /* Deletes current file */
+    remove(_zFileName);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Opens (or rotates) the log/debug file before writing to it
+ * @param[in]   _bLog                         Log file (orxTRUE) or debug file (orxFALSE)
+ * @param[in]   _u32Size                      Size of the data about to be written, in bytes
+ */
+static void orxDebug_PrepareFile(orxBOOL _bLog, orxU32 _u32Size)
+{
+#if !defined(__orxANDROID__) && !defined(__orxANDROID_ANDROID__)
+
+  FILE    **ppstFile;
+  orxU32   *pu32FileSize;
+  orxCHAR   acFileName[orxDEBUG_KU32_FILE_NAME_SIZE];
+
+  /* Gets file info */
+  ppstFile      = (_bLog != orxFALSE) ? &(sstDebug.pstLogFile) : &(sstDebug.pstDebugFile);
+  pu32FileSize  = (_bLog != orxFALSE) ? &(sstDebug.u32LogFileSize) : &(sstDebug.u32DebugFileSize);
+
+  /* Gets file name, compact logs being stored separately */
+  snprintf(acFileName, sizeof(acFileName), "%s%s", (_bLog != orxFALSE) ? sstDebug.zLogFile : sstDebug.zDebugFile, orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_COMPACT) ? orxDEBUG_KZ_COMPACT_SUFFIX : orxSTRING_EMPTY);
+  acFileName[sizeof(acFileName) - 1] = orxCHAR_NULL;
+
+  /* Should rotate? */
+  if((*ppstFile != orxNULL)
+  && (sstDebug.u32RotationSize != 0)
+  && (*pu32FileSize != 0)
+  && (*pu32FileSize + _u32Size > sstDebug.u32RotationSize))
+  {
+    /* Closes file */
+    fclose(*ppstFile);
+    *ppstFile = orxNULL;
+
+    /* Rotates it */
+    orxDebug_RotateFile(acFileName);
+  }
+
+  /* Needs to open the file? */
+  if(*ppstFile == orxNULL)
+  {
+    /* Opens it */
+    *ppstFile = fopen(acFileName, "ab+");
+
+    /* Success? */
+    if(*ppstFile != orxNULL)
+    {
+      /* Gets its current size */
+      fseek(*ppstFile, 0, SEEK_END);
+      *pu32FileSize = (orxU32)ftell(*ppstFile);
+
+#ifdef orxDEBUG_HAS_ASYNC
+
+      /* Compact? */
+      if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_COMPACT))
+      {
+        orxU32 i, u32FileFlag;
+
+        /* New file? */
+        if(*pu32FileSize == 0)
+        {
+          /* Writes header */
+          orxDebug_WriteFile(_bLog, orxDEBUG_KZ_COMPACT_MAGIC, orxDEBUG_KU32_COMPACT_MAGIC_SIZE);
+        }
+
+        /* Gets file flag */
+        u32FileFlag = (_bLog != orxFALSE) ? orxDEBUG_KU32_DEFINITION_FLAG_LOG : orxDEBUG_KU32_DEFINITION_FLAG_DEBUG;
+
+        /* Definitions will have to be written again to this file */
+        for(i = 0; i < orxDEBUG_KU32_DICTIONARY_SIZE; i++)
+        {
+          sstDebug.astDefinitionList[i].u32FileFlags &= ~u32FileFlag;
+        }
+      }
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
+    }
+  }
+
+#endif /* !__orxANDROID__ */
+
+  /* Done! */
+  return;
+}
+
+/** Parses a printf conversion specification
+ * @param[in]   _pc                           Character following the '%'
+ * @param[out]  _pstSpec                      Parsed specification
+ * @return      Character following the specification
+ */
+static const orxCHAR *orxDebug_ParseSpec(const orxCHAR *_pc, orxDEBUG_SPEC *_pstSpec)
+{
+  /* Inits spec */
+  _pstSpec->pcStart       = _pc;
+  _pstSpec->u32StarCount  = 0;
+  _pstSpec->cLength       = orxCHAR_NULL;
+
+  /* Skips flags */
+  while((*_pc == '-') || (*_pc == '+') || (*_pc == ' ') || (*_pc == '#') || (*_pc == '0') || (*_pc == '\''))
+  {
+    _pc++;
+  }
+
+  /* Width */
+  if(*_pc == '*')
+  {
+    _pstSpec->u32StarCount++;
+    _pc++;
+  }
+  else
+  {
+    while((*_pc >= '0') && (*_pc <= '9'))
+    {
+      _pc++;
+    }
+  }
+
+  /* Precision */
+  if(*_pc == '.')
+  {
+    _pc++;
+    if(*_pc == '*')
+    {
+      _pstSpec->u32StarCount++;
+      _pc++;
+    }
+    else
+    {
+      while((*_pc >= '0') && (*_pc <= '9'))
+      {
+        _pc++;
+      }
+    }
+  }
+
+  /* Length modifier */
+  _pstSpec->pcLength = _pc;
+  switch(*_pc)
+  {
+    case 'h':
+    {
+      _pstSpec->cLength = (_pc[1] == 'h') ? 'H' : 'h';
+      _pc += (_pc[1] == 'h') ? 2 : 1;
+      break;
+    }
+
+    case 'l':
+    {
+      _pstSpec->cLength = (_pc[1] == 'l') ? 'q' : 'l';
+      _pc += (_pc[1] == 'l') ? 2 : 1;
+      break;
+    }
+
+    case 'q':
+    case 'j':
+    {
+      _pstSpec->cLength = 'q';
+      _pc++;
+      break;
+    }
+
+    case 'z':
+    case 't':
+    case 'L':
+    {
+      _pstSpec->cLength = *_pc;
+      _pc++;
+      break;
+    }
+
+    case 'I':
+    {
+      /* MSVC size modifiers */
+      if((_pc[1] == '6') && (_pc[2] == '4'))
+      {
+        _pstSpec->cLength = 'q';
+        _pc += 3;
+      }
+      else if((_pc[1] == '3') && (_pc[2] == '2'))
+      {
+        _pc += 3;
+      }
+      else
+      {
+        _pstSpec->cLength = 'z';
+        _pc++;
+      }
+      break;
+    }
+
+    default:
+    {
+      break;
+    }
+  }
+
+  /* Stores conversion */
+  _pstSpec->pcConversion = _pc;
+
+  /* Done! */
+  return (*_pc != orxCHAR_NULL) ? _pc + 1 : _pc;
+}
+
+#ifdef orxDEBUG_HAS_ASYNC
+
+/** Yields the current thread
+ */
+static orxINLINE void orxDebug_Yield()
+{
+#ifdef __orxWINDOWS__
+
+  /* Yields */
+  Sleep(0);
+
+#else /* __orxWINDOWS__ */
+
+  /* Yields */
+  sched_yield();
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return;
+}
+
+/** Sleeps for a given number of milliseconds
+ * @param[in]   _u32Delay                     Delay, in milliseconds
+ */
+static orxINLINE void orxDebug_Sleep(orxU32 _u32Delay)
+{
+#ifdef __orxWINDOWS__
+
+  /* Sleeps */
+  Sleep((DWORD)_u32Delay);
+
+#else /* __orxWINDOWS__ */
+
+  /* Sleeps */
+  usleep((useconds_t)(_u32Delay * 1000));
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return;
+}
+
+/** Tries to get exclusive access to the consumer side of the ring & to the files
+ * @return      orxTRUE if access was granted, orxFALSE otherwise
+ */
+static orxINLINE orxBOOL orxDebug_TryLockConsumer()
+{
+  /* Done! */
+  return orxMEMORY_ATOMIC_CAS32(&(sstDebug.u32ConsumerLock), 0, 1);
+}
+
+/** Gets exclusive access to the consumer side of the ring & to the files
+ */
+static orxINLINE void orxDebug_LockConsumer()
+{
+  /* Waits for access */
+  while(orxDebug_TryLockConsumer() == orxFALSE)
+  {
+    orxDebug_Yield();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Releases exclusive access to the consumer side of the ring & to the files
+ */
+static orxINLINE void orxDebug_UnlockConsumer()
+{
+  /* Releases access */
+  orxMEMORY_BARRIER();
+  sstDebug.u32ConsumerLock = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Acquires a slot in the log ring, waiting for the writer if the ring is full
+ * @return      Acquired slot, to be published with orxDebug_PublishSlot()
+ */
+static orxDEBUG_SLOT *orxDebug_AcquireSlot()
+{
+  orxDEBUG_SLOT  *pstResult;
+  orxU32          u32Position;
+
+  /* Gets current position */
+  u32Position = sstDebug.u32EnqueuePosition;
+
+  /* Until a slot is acquired */
+  for(;;)
+  {
+    orxS32 s32Delta;
+
+    /* Gets slot */
+    pstResult = &(sstDebug.astSlotList[u32Position & orxDEBUG_KU32_ASYNC_SLOT_MASK]);
+
+    /* Gets its delta with position */
+    s32Delta = (orxS32)(pstResult->u32Sequence - u32Position);
+
+    /* Available? */
+    if(s32Delta == 0)
+    {
+      /* Claims it */
+      if(orxMEMORY_ATOMIC_CAS32(&(sstDebug.u32EnqueuePosition), u32Position, u32Position + 1) != orxFALSE)
+      {
+        break;
+      }
+    }
+    /* Ring full? */
+    else if(s32Delta < 0)
+    {
+      /* Lets the writer catch up */
+      orxDebug_Yield();
+    }
+
+    /* Updates position */
+    u32Position = sstDebug.u32EnqueuePosition;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Publishes a slot to the writer
+ * @param[in]   _pstSlot                      Slot to publish
+ */
+static orxINLINE void orxDebug_PublishSlot(orxDEBUG_SLOT *_pstSlot)
+{
+  /* Publishes it */
+  orxMEMORY_BARRIER();
+  _pstSlot->u32Sequence++;
+
+  /* Done! */
+  return;
+}
+
+/** Gets a string ID, registering it on first use
+ * @param[in]   _zString                      Concerned string
+ * @param[out]  _pbNew                        orxTRUE if the definition of the string has to be sent with this record
+ * @return      String ID (its dictionary index + 1, or its hash with orxDEBUG_KU32_DICTIONARY_OVERFLOW if it couldn't be registered)
+ */
+static orxU32 orxDebug_GetStringID(const orxSTRING _zString, orxBOOL *_pbNew)
+{
+  const orxCHAR  *pc;
+  orxU32          u32Hash, u32Result, i;
+
+  /* Computes its FNV-1a hash */
+  for(u32Hash = 0x811C9DC5, pc = _zString; *pc != orxCHAR_NULL; pc++)
+  {
+    u32Hash = (u32Hash ^ (orxU8)*pc) * 0x01000193;
+  }
+
+  /* Reserves empty & pending entries */
+  if((u32Hash == 0) || (u32Hash == orxDEBUG_KU32_DICTIONARY_PENDING))
+  {
+    u32Hash = 1;
+  }
+
+  /* Defaults to new & unregistered */
+  *_pbNew   = orxTRUE;
+  u32Result = u32Hash | orxDEBUG_KU32_DICTIONARY_OVERFLOW;
+
+  /* For all probed entries */
+  for(i = 0; i < orxDEBUG_KU32_DICTIONARY_PROBE;)
+  {
+    volatile orxU32  *pu32Entry;
+    orxU32            u32Index, u32Entry;
+
+    /* Gets entry */
+    u32Index  = (u32Hash + i) & orxDEBUG_KU32_DICTIONARY_MASK;
+    pu32Entry = &(sstDebug.au32StringTable[u32Index]);
+    u32Entry  = *pu32Entry;
+
+    /* Same hash? */
+    if(u32Entry == u32Hash)
+    {
+      /* Acquires its string */
+      orxMEMORY_BARRIER();
+
+      /* Same string? */
+      if(strcmp(sstDebug.azStringList[u32Index], _zString) == 0)
+      {
+        /* Updates result */
+        *_pbNew   = orxFALSE;
+        u32Result = u32Index + 1;
+        break;
+      }
+
+      /* Collision, probes next entry */
+      i++;
+    }
+    /* Empty? */
+    else if(u32Entry == 0)
+    {
+      /* Reserves it */
+      if(orxMEMORY_ATOMIC_CAS32(pu32Entry, 0, orxDEBUG_KU32_DICTIONARY_PENDING) != orxFALSE)
+      {
+        size_t sSize;
+
+        /* Stores a copy of the string */
+        sSize = strlen(_zString) + 1;
+        sstDebug.azStringList[u32Index] = (orxCHAR *)malloc(sSize);
+
+        /* Success? */
+        if(sstDebug.azStringList[u32Index] != orxNULL)
+        {
+          memcpy(sstDebug.azStringList[u32Index], _zString, sSize);
+
+          /* Publishes it */
+          orxMEMORY_BARRIER();
+          *pu32Entry = u32Hash;
+
+          /* Updates result */
+          u32Result = u32Index + 1;
+        }
+        else
+        {
+          /* Releases entry */
+          orxMEMORY_BARRIER();
+          *pu32Entry = 0;
+        }
+        break;
+      }
+
+      /* Registered meanwhile by another thread, checks it again */
+    }
+    else
+    {
+      /* Probes next entry (pending ones may end up holding the same string under a different ID) */
+      i++;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Appends bytes to a compact record
+ * @param[in]   _pstSlot                      Concerned slot
+ * @param[in]   _pData                        Data to append
+ * @param[in]   _u32Size                      Size of the data, in bytes
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE if there's not enough room
+ */
+static orxINLINE orxSTATUS orxDebug_AppendCompact(orxDEBUG_SLOT *_pstSlot, const void *_pData, orxU32 _u32Size)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Enough room? */
+  if(_pstSlot->u32Size + _u32Size <= orxDEBUG_KU32_ASYNC_SLOT_SIZE)
+  {
+    /* Appends data */
+    memcpy(_pstSlot->au8Data + _pstSlot->u32Size, _pData, (size_t)_u32Size);
+    _pstSlot->u32Size += _u32Size;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Appends a string definition to a compact record, if needed
+ * @param[in]   _pstSlot                      Concerned slot
+ * @param[in]   _zString                      Concerned string
+ * @return      String ID
+ */
+static orxU32 orxDebug_AppendCompactString(orxDEBUG_SLOT *_pstSlot, const orxSTRING _zString)
+{
+  orxBOOL bNew;
+  orxU32  u32Result;
+
+  /* Gets its ID */
+  u32Result = orxDebug_GetStringID(_zString, &bNew);
+
+  /* New? */
+  if(bNew != orxFALSE)
+  {
+    orxU8   au8Header[8];
+    orxU32  u32Length;
+    orxU16  u16Length;
+
+    /* Gets length, truncated to what the record can hold */
+    u32Length = (orxU32)strlen(_zString);
+    if(u32Length > orxDEBUG_KU32_ASYNC_SLOT_SIZE / 2)
+    {
+      u32Length = orxDEBUG_KU32_ASYNC_SLOT_SIZE / 2;
+    }
+    u16Length = (orxU16)u32Length;
+
+    /* Appends definition */
+    au8Header[0] = orxDEBUG_KC_COMPACT_DEFINITION;
+    au8Header[1] = 0;
+    memcpy(&au8Header[2], &u16Length, sizeof(orxU16));
+    memcpy(&au8Header[4], &u32Result, sizeof(orxU32));
+    if(orxDebug_AppendCompact(_pstSlot, au8Header, sizeof(au8Header)) != orxSTATUS_FAILURE)
+    {
+      orxDebug_AppendCompact(_pstSlot, _zString, u32Length);
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Appends a numerical argument to a compact record
+ * @param[in]   _pstSlot                      Concerned slot
+ * @param[in]   _cTag                         Argument tag
+ * @param[in]   _pValue                       8-byte value
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxINLINE orxSTATUS orxDebug_AppendCompactValue(orxDEBUG_SLOT *_pstSlot, orxCHAR _cTag, const void *_pValue)
+{
+  orxU8     au8Buffer[9];
+  orxSTATUS eResult;
+
+  /* Appends it */
+  au8Buffer[0] = (orxU8)_cTag;
+  memcpy(&au8Buffer[1], _pValue, 8);
+  eResult = orxDebug_AppendCompact(_pstSlot, au8Buffer, sizeof(au8Buffer));
+
+  /* Done! */
+  return eResult;
+}
+
+/** Queues a compact record: string IDs & raw arguments, no formatting
+ * @param[in]   _eLevel                       Debug level associated with this output
+ * @param[in]   _zFunction                    Calling function name
+ * @param[in]   _zFile                        Calling file name
+ * @param[in]   _u32Line                      Calling file line
+ * @param[in]   _zFormat                      Printf formatted text
+ * @param[in]   _stArgs                       Arguments
+ */
+static void orxDebug_EnqueueCompact(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction, const orxSTRING _zFile, orxU32 _u32Line, const orxSTRING _zFormat, va_list _stArgs)
+{
+  orxDEBUG_SLOT  *pstSlot;
+  const orxCHAR  *pc;
+  orxU8          *pu8Header;
+  orxU32          u32FormatID, u32FileID, u32FunctionID, u32HeaderOffset, u32ArgCount = 0;
+  orxU64          u64Time;
+  orxSTATUS       eStatus = orxSTATUS_SUCCESS;
+
+  /* Acquires slot */
+  pstSlot = orxDebug_AcquireSlot();
+  pstSlot->u32Level = (orxU32)_eLevel;
+  pstSlot->u32Size  = 0;
+
+  /* Appends new string definitions */
+  u32FormatID   = orxDebug_AppendCompactString(pstSlot, _zFormat);
+  u32FileID     = orxDebug_AppendCompactString(pstSlot, orxString_SkipPath(_zFile));
+  u32FunctionID = orxDebug_AppendCompactString(pstSlot, _zFunction);
+
+  /* Enough room for message header? */
+  if(pstSlot->u32Size + orxDEBUG_KU32_COMPACT_MESSAGE_SIZE <= orxDEBUG_KU32_ASYNC_SLOT_SIZE)
+  {
+    /* Reserves it */
+    u32HeaderOffset   = pstSlot->u32Size;
+    pstSlot->u32Size += orxDEBUG_KU32_COMPACT_MESSAGE_SIZE;
+
+    /* For all conversions */
+    for(pc = _zFormat; (*pc != orxCHAR_NULL) && (eStatus != orxSTATUS_FAILURE); pc++)
+    {
+      /* Conversion? */
+      if(*pc == '%')
+      {
+        orxDEBUG_SPEC stSpec;
+        orxU32        i;
+
+        /* Parses it */
+        pc = orxDebug_ParseSpec(pc + 1, &stSpec) - 1;
+
+        /* Stores width & precision arguments */
+        for(i = 0; (i < stSpec.u32StarCount) && (eStatus != orxSTATUS_FAILURE); i++)
+        {
+          orxS64 s64Value;
+
+          s64Value  = (orxS64)va_arg(_stArgs, int);
+          eStatus   = orxDebug_AppendCompactValue(pstSlot, orxDEBUG_KC_COMPACT_SIGNED, &s64Value);
+          u32ArgCount++;
+        }
+
+        /* Depending on conversion */
+        switch(*stSpec.pcConversion)
+        {
+          case 'd':
+          case 'i':
+          case 'c':
+          {
+            orxS64 s64Value;
+
+            /* Gets value */
+            switch(stSpec.cLength)
+            {
+              case 'l': s64Value = (orxS64)va_arg(_stArgs, long); break;
+              case 'q': s64Value = (orxS64)va_arg(_stArgs, long long); break;
+              case 'z': s64Value = (orxS64)va_arg(_stArgs, size_t); break;
+              case 't': s64Value = (orxS64)va_arg(_stArgs, ptrdiff_t); break;
+              default:  s64Value = (orxS64)va_arg(_stArgs, int); break;
+            }
+
+            /* Stores it */
+            eStatus = orxDebug_AppendCompactValue(pstSlot, orxDEBUG_KC_COMPACT_SIGNED, &s64Value);
+            u32ArgCount++;
+            break;
+          }
+
+          case 'u':
+          case 'o':
+          case 'x':
+          case 'X':
+          {
+            orxU64 u64Value;
+
+            /* Gets value */
+            switch(stSpec.cLength)
+            {
+              case 'l': u64Value = (orxU64)va_arg(_stArgs, unsigned long); break;
+              case 'q': u64Value = (orxU64)va_arg(_stArgs, unsigned long long); break;
+              case 'z': u64Value = (orxU64)va_arg(_stArgs, size_t); break;
+              case 't': u64Value = (orxU64)va_arg(_stArgs, ptrdiff_t); break;
+              default:  u64Value = (orxU64)va_arg(_stArgs, unsigned int); break;
+            }
+
+            /* Stores it */
+            eStatus = orxDebug_AppendCompactValue(pstSlot, orxDEBUG_KC_COMPACT_UNSIGNED, &u64Value);
+            u32ArgCount++;
+            break;
+          }
+
+          case 'f':
+          case 'F':
+          case 'e':
+          case 'E':
+          case 'g':
+          case 'G':
+          case 'a':
+          case 'A':
+          {
+            orxDOUBLE dValue;
+
+            /* Gets value */
+            dValue = (stSpec.cLength == 'L') ? (orxDOUBLE)va_arg(_stArgs, long double) : va_arg(_stArgs, orxDOUBLE);
+
+            /* Stores it */
+            eStatus = orxDebug_AppendCompactValue(pstSlot, orxDEBUG_KC_COMPACT_FLOAT, &dValue);
+            u32ArgCount++;
+            break;
+          }
+
+          case 's':
+          {
+            const orxCHAR  *zValue;
+            orxU8           au8Header[3];
+            orxU32          u32Length;
+            orxU16          u16Length;
+
+            /* Gets value */
+            zValue = va_arg(_stArgs, const orxCHAR *);
+            if(zValue == orxNULL)
+            {
+              zValue = "(null)";
+            }
+
+            /* Gets its length, truncated to the remaining room */
+            u32Length = (orxU32)strlen(zValue);
+            if(pstSlot->u32Size + sizeof(au8Header) + u32Length > orxDEBUG_KU32_ASYNC_SLOT_SIZE)
+            {
+              u32Length = (pstSlot->u32Size + sizeof(au8Header) < orxDEBUG_KU32_ASYNC_SLOT_SIZE) ? orxDEBUG_KU32_ASYNC_SLOT_SIZE - pstSlot->u32Size - sizeof(au8Header) : 0;
+            }
+            u16Length = (orxU16)u32Length;
+
+            /* Stores it */
+            au8Header[0] = orxDEBUG_KC_COMPACT_STRING;
+            memcpy(&au8Header[1], &u16Length, sizeof(orxU16));
+            if((eStatus = orxDebug_AppendCompact(pstSlot, au8Header, sizeof(au8Header))) != orxSTATUS_FAILURE)
+            {
+              orxDebug_AppendCompact(pstSlot, zValue, u32Length);
+              u32ArgCount++;
+            }
+            break;
+          }
+
+          case 'p':
+          {
+            orxU64 u64Value;
+
+            /* Stores it */
+            u64Value  = (orxU64)(orxUPTR)va_arg(_stArgs, void *);
+            eStatus   = orxDebug_AppendCompactValue(pstSlot, orxDEBUG_KC_COMPACT_POINTER, &u64Value);
+            u32ArgCount++;
+            break;
+          }
+
+          case 'n':
+          {
+            /* Skips it */
+            (void)va_arg(_stArgs, void *);
+            break;
+          }
+
+          case '%':
+          {
+            break;
+          }
+
+          default:
+          {
+            /* Unknown argument type, stops */
+            eStatus = orxSTATUS_FAILURE;
+            break;
+          }
+        }
+
+        /* End of format? */
+        if(*stSpec.pcConversion == orxCHAR_NULL)
+        {
+          break;
+        }
+      }
+    }
+
+    /* Writes message header */
+    pu8Header   = pstSlot->au8Data + u32HeaderOffset;
+    u64Time     = (orxU64)time(NULL);
+    pu8Header[0] = orxDEBUG_KC_COMPACT_MESSAGE;
+    pu8Header[1] = (orxU8)_eLevel;
+    pu8Header[2] = (orxU8)((u32ArgCount < 0xFF) ? u32ArgCount : 0xFF);
+    pu8Header[3] = 0;
+    memcpy(&pu8Header[4], &u32FormatID, sizeof(orxU32));
+    memcpy(&pu8Header[8], &u32FileID, sizeof(orxU32));
+    memcpy(&pu8Header[12], &u32FunctionID, sizeof(orxU32));
+    memcpy(&pu8Header[16], &_u32Line, sizeof(orxU32));
+    memcpy(&pu8Header[20], &u64Time, sizeof(orxU64));
+  }
+
+  /* Publishes slot */
+  orxDebug_PublishSlot(pstSlot);
+
+  /* Done! */
+  return;
+}
+
+/** Queues an already formatted text
+ * @param[in]   _eLevel                       Debug level associated with this output
+ * @param[in]   _zText                        Text to write
+ */
+static void orxDebug_EnqueueText(orxDEBUG_LEVEL _eLevel, const orxSTRING _zText)
+{
+  orxDEBUG_SLOT  *pstSlot;
+  orxU32          u32Size;
+
+  /* Gets text size */
+  u32Size = (orxU32)strlen(_zText);
+  if(u32Size > orxDEBUG_KU32_ASYNC_SLOT_SIZE)
+  {
+    u32Size = orxDEBUG_KU32_ASYNC_SLOT_SIZE;
+  }
+
+  /* Acquires slot */
+  pstSlot = orxDebug_AcquireSlot();
+
+  /* Stores text */
+  pstSlot->u32Level = (orxU32)_eLevel;
+  pstSlot->u32Size  = u32Size;
+  memcpy(pstSlot->au8Data, _zText, (size_t)u32Size);
+
+  /* Publishes it */
+  orxDebug_PublishSlot(pstSlot);
+
+  /* Done! */
+  return;
+}
+
+/** Makes sure a string definition has been written to a file (writer side)
+ * @param[in]   _pstDefinition                Concerned definition
+ * @param[in]   _bLog                         Log file (orxTRUE) or debug file (orxFALSE)
+ */
+static void orxDebug_WriteDefinition(orxDEBUG_DEFINITION *_pstDefinition, orxBOOL _bLog)
+{
+  orxU32 u32FileFlag;
+
+  /* Gets file flag */
+  u32FileFlag = (_bLog != orxFALSE) ? orxDEBUG_KU32_DEFINITION_FLAG_LOG : orxDEBUG_KU32_DEFINITION_FLAG_DEBUG;
+
+  /* Not already written? */
+  if(!orxFLAG_TEST(_pstDefinition->u32FileFlags, u32FileFlag))
+  {
+    orxU8   au8Header[8];
+    orxU16  u16Length;
+
+    /* Writes it */
+    u16Length     = (orxU16)_pstDefinition->u32Size;
+    au8Header[0]  = orxDEBUG_KC_COMPACT_DEFINITION;
+    au8Header[1]  = 0;
+    memcpy(&au8Header[2], &u16Length, sizeof(orxU16));
+    memcpy(&au8Header[4], &(_pstDefinition->u32ID), sizeof(orxU32));
+    orxDebug_WriteFile(_bLog, au8Header, sizeof(au8Header));
+    orxDebug_WriteFile(_bLog, _pstDefinition->zString, _pstDefinition->u32Size);
+
+    /* Updates status */
+    _pstDefinition->u32FileFlags |= u32FileFlag;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets a string definition (writer side)
+ * @param[in]   _u32ID                        String ID
+ * @param[in]   _pcString                     String content, orxNULL for lookup only
+ * @param[in]   _u32Size                      String size
+ * @return      orxDEBUG_DEFINITION / orxNULL
+ */
+static orxDEBUG_DEFINITION *orxDebug_GetDefinition(orxU32 _u32ID, const orxCHAR *_pcString, orxU32 _u32Size)
+{
+  orxDEBUG_DEFINITION  *pstResult = orxNULL;
+  orxU32                i;
+
+  /* For all probed entries */
+  for(i = 0; i < orxDEBUG_KU32_DICTIONARY_PROBE; i++)
+  {
+    orxDEBUG_DEFINITION *pstDefinition;
+
+    /* Gets it */
+    pstDefinition = &(sstDebug.astDefinitionList[(_u32ID + i) & orxDEBUG_KU32_DICTIONARY_MASK]);
+
+    /* Found? */
+    if(pstDefinition->u32ID == _u32ID)
+    {
+      /* Updates result */
+      pstResult = pstDefinition;
+      break;
+    }
+    /* Empty? */
+    else if(pstDefinition->u32ID == 0)
+    {
+      /* Should add it? */
+      if(_pcString != orxNULL)
+      {
+        /* Stores it */
+        pstDefinition->zString = (orxCHAR *)malloc((size_t)_u32Size + 1);
+
+        /* Success? */
+        if(pstDefinition->zString != orxNULL)
+        {
+          /* Inits it */
+          memcpy(pstDefinition->zString, _pcString, (size_t)_u32Size);
+          pstDefinition->zString[_u32Size]  = orxCHAR_NULL;
+          pstDefinition->u32ID              = _u32ID;
+          pstDefinition->u32Size            = _u32Size;
+          pstDefinition->u32FileFlags       = 0;
+
+          /* Updates result */
+          pstResult = pstDefinition;
+        }
+      }
+      break;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Writes a compact record (writer side)
+ * @param[in]   _pstSlot                      Slot containing the record
+ */
+static void orxDebug_WriteCompact(const orxDEBUG_SLOT *_pstSlot)
+{
+  const orxU8  *pu8Data, *pu8End;
+  orxBOOL       bLog;
+
+  /* Gets target file */
+  bLog = (_pstSlot->u32Level == orxDEBUG_LEVEL_LOG) ? orxTRUE : orxFALSE;
+
+  /* Prepares it */
+  orxDebug_PrepareFile(bLog, _pstSlot->u32Size);
+
+  /* For all entries */
+  for(pu8Data = _pstSlot->au8Data, pu8End = _pstSlot->au8Data + _pstSlot->u32Size; pu8Data < pu8End;)
+  {
+    /* Definition? */
+    if((*pu8Data == orxDEBUG_KC_COMPACT_DEFINITION) && (pu8Data + 8 <= pu8End))
+    {
+      orxDEBUG_DEFINITION  *pstDefinition;
+      orxU32                u32ID, u32Size;
+      orxU16                u16Length;
+
+      /* Gets it */
+      memcpy(&u16Length, pu8Data + 2, sizeof(orxU16));
+      memcpy(&u32ID, pu8Data + 4, sizeof(orxU32));
+      u32Size = ((orxU32)u16Length <= (orxU32)(pu8End - pu8Data - 8)) ? (orxU32)u16Length : (orxU32)(pu8End - pu8Data - 8);
+
+      /* Registers it (unregistered strings are always sent along their record) */
+      pstDefinition = (!orxFLAG_TEST(u32ID, orxDEBUG_KU32_DICTIONARY_OVERFLOW)) ? orxDebug_GetDefinition(u32ID, (const orxCHAR *)pu8Data + 8, u32Size) : orxNULL;
+
+      /* Success? */
+      if(pstDefinition != orxNULL)
+      {
+        /* Makes sure it's been written */
+        orxDebug_WriteDefinition(pstDefinition, bLog);
+      }
+      else
+      {
+        /* Writes it as is */
+        orxDebug_WriteFile(bLog, pu8Data, 8 + u32Size);
+      }
+
+      /* Goes to next entry */
+      pu8Data += 8 + u32Size;
+    }
+    /* Message? */
+    else if((*pu8Data == orxDEBUG_KC_COMPACT_MESSAGE) && (pu8Data + orxDEBUG_KU32_COMPACT_MESSAGE_SIZE <= pu8End))
+    {
+      orxU32 i;
+
+      /* For all its string IDs */
+      for(i = 0; i < 3; i++)
+      {
+        orxDEBUG_DEFINITION  *pstDefinition;
+        orxU32                u32ID;
+
+        /* Gets definition */
+        memcpy(&u32ID, pu8Data + 4 + i * sizeof(orxU32), sizeof(orxU32));
+        pstDefinition = (!orxFLAG_TEST(u32ID, orxDEBUG_KU32_DICTIONARY_OVERFLOW)) ? orxDebug_GetDefinition(u32ID, orxNULL, 0) : orxNULL;
+
+        /* Found? */
+        if(pstDefinition != orxNULL)
+        {
+          /* Makes sure it's been written */
+          orxDebug_WriteDefinition(pstDefinition, bLog);
+        }
+      }
+
+      /* Writes message */
+      orxDebug_WriteFile(bLog, pu8Data, (orxU32)(pu8End - pu8Data));
+      break;
+    }
+    else
+    {
+      /* Invalid record, stops */
+      break;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Writes all the published slots (needs exclusive consumer access)
+ * @return      Number of slots written
+ */
+static orxU32 orxDebug_DrainRing()
+{
+  orxU32 u32Result = 0;
+
+  /* For all published slots */
+  for(;;)
+  {
+    orxDEBUG_SLOT  *pstSlot;
+    orxU32          u32Position;
+
+    /* Gets next slot */
+    u32Position = sstDebug.u32DequeuePosition;
+    pstSlot     = &(sstDebug.astSlotList[u32Position & orxDEBUG_KU32_ASYNC_SLOT_MASK]);
+
+    /* Not published yet? */
+    if(pstSlot->u32Sequence != u32Position + 1)
+    {
+      break;
+    }
+
+    /* Syncs with producer */
+    orxMEMORY_BARRIER();
+
+    /* Is enabled? */
+    if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_FILE)
+    {
+      /* Compact? */
+      if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_COMPACT))
+      {
+        /* Writes record */
+        orxDebug_WriteCompact(pstSlot);
+      }
+      else
+      {
+        orxBOOL bLog;
+
+        /* Writes text */
+        bLog = (pstSlot->u32Level == orxDEBUG_LEVEL_LOG) ? orxTRUE : orxFALSE;
+        orxDebug_PrepareFile(bLog, pstSlot->u32Size);
+        orxDebug_WriteFile(bLog, pstSlot->au8Data, pstSlot->u32Size);
+      }
+    }
+
+    /* Releases slot */
+    orxMEMORY_BARRIER();
+    pstSlot->u32Sequence = u32Position + orxDEBUG_KU32_ASYNC_SLOT_NUMBER;
+    sstDebug.u32DequeuePosition = u32Position + 1;
+
+    /* Updates result */
+    u32Result++;
+  }
+
+  /* Any? */
+  if(u32Result != 0)
+  {
+    /* Flushes files */
+    orxDebug_FlushFiles();
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Background writer
+ */
+#ifdef __orxWINDOWS__
+static DWORD WINAPI orxDebug_Write(LPVOID _pContext)
+#else /* __orxWINDOWS__ */
+static void *orxDebug_Write(void *_pContext)
+#endif /* __orxWINDOWS__ */
+{
+  /* While not requested to stop */
+  while(!orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_STOP))
+  {
+    orxU32 u32Count = 0;
+
+    /* Gets exclusive access */
+    if(orxDebug_TryLockConsumer() != orxFALSE)
+    {
+      /* Writes pending logs */
+      u32Count = orxDebug_DrainRing();
+
+      /* Releases access */
+      orxDebug_UnlockConsumer();
+    }
+
+    /* Nothing written? */
+    if(u32Count == 0)
+    {
+      /* Waits for more */
+      orxDebug_Sleep(orxDEBUG_KU32_ASYNC_IDLE_DELAY);
+    }
+  }
+
+  /* Done! */
+  return 0;
+}
+
+/** Writes all pending logs after a crash, without waiting forever on the writer
+ */
+static void orxDebug_FlushCrash()
+{
+  orxU32 i;
+
+  /* Tries to get exclusive access */
+  for(i = 0; (i < orxDEBUG_KU32_CRASH_LOCK_TRY_NUMBER) && (orxDebug_TryLockConsumer() == orxFALSE); i++)
+  {
+    orxDebug_Sleep(1);
+  }
+
+  /* Success? */
+  if(i < orxDEBUG_KU32_CRASH_LOCK_TRY_NUMBER)
+  {
+    /* Writes pending logs */
+    orxDebug_DrainRing();
+
+    /* Flushes files */
+    orxDebug_FlushFiles();
+
+    /* Releases access */
+    orxDebug_UnlockConsumer();
+  }
+
+  /* Done! */
+  return;
+}
+
+#ifdef __orxWINDOWS__
+
+/** Crash handler
+ */
+static LONG WINAPI orxDebug_CrashHandler(EXCEPTION_POINTERS *_pstExceptionInfo)
+{
+  /* Flushes pending logs */
+  orxDebug_FlushCrash();
+
+  /* Done! */
+  return (spfnPreviousExceptionFilter != NULL) ? spfnPreviousExceptionFilter(_pstExceptionInfo) : EXCEPTION_CONTINUE_SEARCH;
+}
+
+#else /* __orxWINDOWS__ */
+
+/** Crash handler
+ */
+static void orxDebug_CrashHandler(int _iSignal)
+{
+  orxU32 i;
+
+  /* Flushes pending logs */
+  orxDebug_FlushCrash();
+
+  /* Restores previous handler */
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sasCrashSignalList); i++)
+  {
+    if(sasCrashSignalList[i] == _iSignal)
+    {
+      sigaction(_iSignal, &(sastPreviousActionList[i]), NULL);
+      break;
+    }
+  }
+
+  /* Forwards signal */
+  raise(_iSignal);
+}
+
+#endif /* __orxWINDOWS__ */
+
+/** Installs/removes crash handler
+ * @param[in]   _bInstall                     Install or remove
+ */
+static void orxDebug_SetCrashHandler(orxBOOL _bInstall)
+{
+#ifdef __orxWINDOWS__
+
+  /* Install? */
+  if(_bInstall != orxFALSE)
+  {
+    /* Installs it */
+    spfnPreviousExceptionFilter = SetUnhandledExceptionFilter(&orxDebug_CrashHandler);
+  }
+  else
+  {
+    /* Restores previous one */
+    SetUnhandledExceptionFilter(spfnPreviousExceptionFilter);
+    spfnPreviousExceptionFilter = NULL;
+  }
+
+#else /* __orxWINDOWS__ */
+
+  orxU32 i;
+
+  /* For all crash signals */
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sasCrashSignalList); i++)
+  {
+    /* Install? */
+    if(_bInstall != orxFALSE)
+    {
+      struct sigaction stAction;
+
+      /* Installs it */
+      memset(&stAction, 0, sizeof(struct sigaction));
+      stAction.sa_handler = &orxDebug_CrashHandler;
+      sigemptyset(&stAction.sa_mask);
+      sigaction(sasCrashSignalList[i], &stAction, &(sastPreviousActionList[i]));
+    }
+    else
+    {
+      /* Restores previous one */
+      sigaction(sasCrashSignalList[i], &(sastPreviousActionList[i]), NULL);
+    }
+  }
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return;
+}
+
+/** Starts the background writer
+ * @param[in]   _bCompact                     Compact (binary) records?
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxDebug_StartWriter(orxBOOL _bCompact)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Allocates ring & dictionaries */
+  sstDebug.astSlotList        = (orxDEBUG_SLOT *)malloc(orxDEBUG_KU32_ASYNC_SLOT_NUMBER * sizeof(orxDEBUG_SLOT));
+  sstDebug.au32StringTable    = (volatile orxU32 *)calloc(orxDEBUG_KU32_DICTIONARY_SIZE, sizeof(orxU32));
+  sstDebug.azStringList       = (orxCHAR **)calloc(orxDEBUG_KU32_DICTIONARY_SIZE, sizeof(orxCHAR *));
+  sstDebug.astDefinitionList  = (orxDEBUG_DEFINITION *)calloc(orxDEBUG_KU32_DICTIONARY_SIZE, sizeof(orxDEBUG_DEFINITION));
+
+  /* Success? */
+  if((sstDebug.astSlotList != orxNULL) && (sstDebug.au32StringTable != orxNULL) && (sstDebug.azStringList != orxNULL) && (sstDebug.astDefinitionList != orxNULL))
+  {
+    orxU32 i;
+
+    /* Inits ring */
+    for(i = 0; i < orxDEBUG_KU32_ASYNC_SLOT_NUMBER; i++)
+    {
+      sstDebug.astSlotList[i].u32Sequence = i;
+    }
+    sstDebug.u32EnqueuePosition = sstDebug.u32DequeuePosition = 0;
+    sstDebug.u32ConsumerLock    = 0;
+
+    /* Updates flags */
+    orxFLAG_SET(sstDebug.u32Flags, (_bCompact != orxFALSE) ? orxDEBUG_KU32_STATIC_FLAG_ASYNC | orxDEBUG_KU32_STATIC_FLAG_COMPACT : orxDEBUG_KU32_STATIC_FLAG_ASYNC, orxDEBUG_KU32_STATIC_FLAG_STOP);
+    orxMEMORY_BARRIER();
+
+    /* Starts writer thread */
+#ifdef __orxWINDOWS__
+    sstDebug.hWriterThread = CreateThread(NULL, 0, &orxDebug_Write, NULL, 0, NULL);
+    if(sstDebug.hWriterThread != NULL)
+#else /* __orxWINDOWS__ */
+    if(pthread_create(&(sstDebug.hWriterThread), NULL, &orxDebug_Write, NULL) == 0)
+#endif /* __orxWINDOWS__ */
+    {
+      /* Installs crash handler */
+      orxDebug_SetCrashHandler(orxTRUE);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Updates flags */
+      orxFLAG_SET(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_NONE, orxDEBUG_KU32_STATIC_FLAG_ASYNC | orxDEBUG_KU32_STATIC_FLAG_COMPACT);
+    }
+  }
+
+  /* Failure? */
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    /* Frees ring & dictionaries */
+    free(sstDebug.astSlotList);
+    free((void *)sstDebug.au32StringTable);
+    free(sstDebug.azStringList);
+    free(sstDebug.astDefinitionList);
+    sstDebug.astSlotList        = orxNULL;
+    sstDebug.au32StringTable    = orxNULL;
+    sstDebug.azStringList       = orxNULL;
+    sstDebug.astDefinitionList  = orxNULL;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops the background writer, after having written all pending logs
+ */
+static void orxDebug_StopWriter()
+{
+  orxU32 i;
+
+  /* Requests stop */
+  orxFLAG_SET(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_STOP, orxDEBUG_KU32_STATIC_FLAG_NONE);
+  orxMEMORY_BARRIER();
+
+  /* Waits for writer thread */
+#ifdef __orxWINDOWS__
+  WaitForSingleObject(sstDebug.hWriterThread, INFINITE);
+  CloseHandle(sstDebug.hWriterThread);
+  sstDebug.hWriterThread = NULL;
+#else /* __orxWINDOWS__ */
+  pthread_join(sstDebug.hWriterThread, NULL);
+#endif /* __orxWINDOWS__ */
+
+  /* Removes crash handler */
+  orxDebug_SetCrashHandler(orxFALSE);
+
+  /* Writes remaining logs */
+  orxDebug_LockConsumer();
+  orxDebug_DrainRing();
+  orxDebug_UnlockConsumer();
+
+  /* Frees strings & definitions */
+  for(i = 0; i < orxDEBUG_KU32_DICTIONARY_SIZE; i++)
+  {
+    free(sstDebug.azStringList[i]);
+    free(sstDebug.astDefinitionList[i].zString);
+  }
+
+  /* Frees ring & dictionaries */
+  free(sstDebug.astSlotList);
+  free((void *)sstDebug.au32StringTable);
+  free(sstDebug.azStringList);
+  free(sstDebug.astDefinitionList);
+  sstDebug.astSlotList        = orxNULL;
+  sstDebug.au32StringTable    = orxNULL;
+  sstDebug.azStringList       = orxNULL;
+  sstDebug.astDefinitionList  = orxNULL;
+
+  /* Updates flags */
+  orxFLAG_SET(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_NONE, orxDEBUG_KU32_STATIC_FLAG_ASYNC | orxDEBUG_KU32_STATIC_FLAG_COMPACT | orxDEBUG_KU32_STATIC_FLAG_STOP);
+
+  /* Done! */
+  return;
+}
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
+/** Compares two compact definitions (decoder side)
+ */
+static int orxDebug_CompareDecodedDefinitions(const void *_pA, const void *_pB)
+{
+  orxU32 u32A, u32B;
+
+  /* Gets IDs */
+  u32A = ((const orxDEBUG_DEFINITION *)_pA)->u32ID;
+  u32B = ((const orxDEBUG_DEFINITION *)_pB)->u32ID;
+
+  /* Done! */
+  return (u32A < u32B) ? -1 : (u32A > u32B) ? 1 : 0;
+}
+
+/** Finds a decoded definition
+ */
+static const orxSTRING orxDebug_FindDecodedDefinition(const orxDEBUG_DEFINITION *_astDefinitionList, orxU32 _u32Count, orxU32 _u32ID)
+{
+  orxDEBUG_DEFINITION         stKey;
+  const orxDEBUG_DEFINITION  *pstDefinition;
+
+  /* Finds it */
+  stKey.u32ID   = _u32ID;
+  pstDefinition = (_u32Count != 0) ? (const orxDEBUG_DEFINITION *)bsearch(&stKey, _astDefinitionList, (size_t)_u32Count, sizeof(orxDEBUG_DEFINITION), &orxDebug_CompareDecodedDefinitions) : orxNULL;
+
+  /* Done! */
+  return (pstDefinition != orxNULL) ? pstDefinition->zString : orxNULL;
+}
+
+/** Formats a compact message (decoder side)
+ * @param[in]   _zFormat                      Format string
+ * @param[in]   _pu8Args                      Encoded arguments
+ * @param[in]   _pu8End                       End of the encoded arguments
+ * @param[in]   _u32ArgCount                  Number of encoded arguments
+ * @param[out]  _acBuffer                     Output buffer
+ * @param[in]   _u32Size                      Output buffer size
+ */
+static void orxDebug_FormatCompact(const orxSTRING _zFormat, const orxU8 *_pu8Args, const orxU8 *_pu8End, orxU32 _u32ArgCount, orxCHAR *_acBuffer, orxU32 _u32Size)
+{
+  const orxCHAR  *pc;
+  orxCHAR        *pcDst, *pcEnd;
+
+  /* For all characters */
+  for(pc = _zFormat, pcDst = _acBuffer, pcEnd = _acBuffer + _u32Size - 1; (*pc != orxCHAR_NULL) && (pcDst < pcEnd);)
+  {
+    /* Conversion? */
+    if(*pc == '%')
+    {
+      orxDEBUG_SPEC   stSpec;
+      orxCHAR         acSpec[64], *pcSpec = acSpec;
+      const orxCHAR  *pcNext, *pcSource;
+      orxBOOL         bValid = orxTRUE;
+      int             iWritten = 0;
+
+      /* Parses it */
+      pcNext = orxDebug_ParseSpec(pc + 1, &stSpec);
+
+      /* Rebuilds spec, with stars resolved & without length modifier */
+      *pcSpec++ = '%';
+      for(pcSource = stSpec.pcStart; (pcSource < stSpec.pcLength) && (pcSpec < acSpec + sizeof(acSpec) - 24); pcSource++)
+      {
+        /* Star? */
+        if(*pcSource == '*')
+        {
+          orxS64 s64Value = 0;
+
+          /* Gets its value */
+          if((_u32ArgCount != 0) && (_pu8Args + 9 <= _pu8End))
+          {
+            memcpy(&s64Value, _pu8Args + 1, sizeof(orxS64));
+            _pu8Args += 9;
+            _u32ArgCount--;
+          }
+          else
+          {
+            bValid = orxFALSE;
+          }
+
+          /* Prints it */
+          pcSpec += snprintf(pcSpec, 16, "%d", (int)s64Value);
+        }
+        else
+        {
+          *pcSpec++ = *pcSource;
+        }
+      }
+
+      /* Depending on conversion */
+      switch(*stSpec.pcConversion)
+      {
+        case '%':
+        {
+          /* Copies it */
+          *pcDst++ = '%';
+          break;
+        }
+
+        case 'd':
+        case 'i':
+        case 'c':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        case 'p':
+        {
+          orxU8 au8Value[8];
+
+          /* Has value? */
+          if((bValid != orxFALSE) && (_u32ArgCount != 0) && (_pu8Args + 9 <= _pu8End))
+          {
+            /* Gets it */
+            memcpy(au8Value, _pu8Args + 1, sizeof(au8Value));
+            _pu8Args += 9;
+            _u32ArgCount--;
+
+            /* Depending on conversion */
+            switch(*stSpec.pcConversion)
+            {
+              case 'c':
+              {
+                orxS64 s64Value;
+
+                memcpy(&s64Value, au8Value, sizeof(orxS64));
+                *pcSpec++ = 'c';
+                *pcSpec   = orxCHAR_NULL;
+                iWritten  = snprintf(pcDst, (size_t)(pcEnd - pcDst + 1), acSpec, (int)s64Value);
+                break;
+              }
+
+              case 'd':
+              case 'i':
+              {
+                orxS64 s64Value;
+
+                memcpy(&s64Value, au8Value, sizeof(orxS64));
+                *pcSpec++ = 'l';
+                *pcSpec++ = 'l';
+                *pcSpec++ = *stSpec.pcConversion;
+                *pcSpec   = orxCHAR_NULL;
+                iWritten  = snprintf(pcDst, (size_t)(pcEnd - pcDst + 1), acSpec, (long long)s64Value);
+                break;
+              }
+
+              case 'u':
+              case 'o':
+              case 'x':
+              case 'X':
+              {
+                orxU64 u64Value;
+
+                memcpy(&u64Value, au8Value, sizeof(orxU64));
+                *pcSpec++ = 'l';
+                *pcSpec++ = 'l';
+                *pcSpec++ = *stSpec.pcConversion;
+                *pcSpec   = orxCHAR_NULL;
+                iWritten  = snprintf(pcDst, (size_t)(pcEnd - pcDst + 1), acSpec, (unsigned long long)u64Value);
+                break;
+              }
+
+              case 'p':
+              {
+                orxU64 u64Value;
+
+                memcpy(&u64Value, au8Value, sizeof(orxU64));
+                *pcSpec++ = 'p';
+                *pcSpec   = orxCHAR_NULL;
+                iWritten  = snprintf(pcDst, (size_t)(pcEnd - pcDst + 1), acSpec, (void *)(orxUPTR)u64Value);
+                break;
+              }
+
+              default:
+              {
+                orxDOUBLE dValue;
+
+                memcpy(&dValue, au8Value, sizeof(orxDOUBLE));
+                *pcSpec++ = *stSpec.pcConversion;
+                *pcSpec   = orxCHAR_NULL;
+                iWritten  = snprintf(pcDst, (size_t)(pcEnd - pcDst + 1), acSpec, dValue);
+                break;
+              }
+            }
+          }
+          else
+          {
+            /* Marks it as missing */
+            iWritten = snprintf(pcDst, (size_t)(pcEnd - pcDst + 1), "<?>");
+          }
+          break;
+        }
+
+        case 's':
+        {
+          orxU16 u16Length;
+
+          /* Has value? */
+          if((bValid != orxFALSE) && (_u32ArgCount != 0) && (_pu8Args + 3 <= _pu8End))
+          {
+            orxCHAR *zValue;
+
+            /* Gets it */
+            memcpy(&u16Length, _pu8Args + 1, sizeof(orxU16));
+            if(_pu8Args + 3 + u16Length > _pu8End)
+            {
+              u16Length = (orxU16)(_pu8End - _pu8Args - 3);
+            }
+            zValue = (orxCHAR *)malloc((size_t)u16Length + 1);
+            if(zValue != orxNULL)
+            {
+              memcpy(zValue, _pu8Args + 3, (size_t)u16Length);
+              zValue[u16Length] = orxCHAR_NULL;
+              *pcSpec++ = 's';
+              *pcSpec   = orxCHAR_NULL;
+              iWritten  = snprintf(pcDst, (size_t)(pcEnd - pcDst + 1), acSpec, zValue);
+              free(zValue);
+            }
+            _pu8Args += 3 + u16Length;
+            _u32ArgCount--;
+          }
+          else
+          {
+            /* Marks it as missing */
+            iWritten = snprintf(pcDst, (size_t)(pcEnd - pcDst + 1), "<?>");
+          }
+          break;
+        }
+
+        default:
+        {
+          /* Copies spec verbatim */
+          for(pcSource = pc; (pcSource < pcNext) && (pcDst < pcEnd); pcSource++)
+          {
+            *pcDst++ = *pcSource;
+          }
+          break;
+        }
       }
-      else
+
+      /* Updates destination */
+      if(iWritten > 0)
       {
-        /* Stops */
-        break;
+        pcDst = ((pcDst + iWritten) < pcEnd) ? pcDst + iWritten : pcEnd;
       }
+
+      /* Goes to next character */
+      pc = pcNext;
     }
     else
     {
-      /* Should copy? */
-      if(pcDst != pc)
-      {
-        *pcDst = *pc;
-      }
-
-      /* Updates destination */
-      pcDst++;
+      /* Copies it */
+      *pcDst++ = *pc++;
     }
   }
 
@@ -292,30 +2164,6 @@ static orxINLINE void orxDebug_ClearANSICodes(orxSTRING _zBuffer)
   return;
 }
 
-/** Has ANSI codes>
- * @param[in]   _zBuffer                      Concerned buffer
- */
-static orxINLINE orxBOOL orxDebug_HasANSICodes(orxSTRING _zBuffer)
-{
-  orxCHAR  *pc;
-  orxBOOL   bResult = orxFALSE;
-
-  /* For all characters */
-  for(pc = _zBuffer; *pc != orxCHAR_NULL; pc++)
-  {
-    /* ANSI escape code? */
-    if(*pc == orxANSI_KC_MARKER)
-    {
-      /* Updates result */
-      bResult = orxTRUE;
-      break;
-    }
-  }
-
-  /* Done! */
-  return bResult;
-}
-
 
 /***************************************************************************
  * Public functions                                                        *
@@ -424,6 +2272,17 @@ void orxFASTCALL _orxDebug_Exit()
   /* Initialized? */
   if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY)
   {
+#ifdef orxDEBUG_HAS_ASYNC
+
+    /* Is background writer running? */
+    if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
+    {
+      /* Stops it */
+      orxDebug_StopWriter();
+    }
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
 #if !defined(__orxANDROID__)
 
     /* Closes files */
@@ -459,6 +2318,13 @@ void orxFASTCALL _orxDebug_Exit()
 /** Software break function */
 void orxFASTCALL _orxDebug_Break()
 {
+  /* Initialized? */
+  if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY)
+  {
+    /* Writes pending logs */
+    _orxDebug_Flush();
+  }
+
   /* Windows / Linux / Mac / iOS / Android */
 #if defined(__orxWINDOWS__) || defined(__orxLINUX__) || defined(__orxMAC__) || defined(__orxIOS__) || defined(__orxANDROID__)
 
@@ -529,118 +2395,130 @@ void orxCDECL _orxDebug_Log(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction,
   orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
 
   /* Is level enabled and not re-entrant? */
-  if(orxFLAG_TEST(sstDebug.u32LevelFlags, (1 << _eLevel)) && !orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_LOGGING))
+  if(orxFLAG_TEST(sstDebug.u32LevelFlags, (1 << _eLevel)) && (sbLogging == orxFALSE))
   {
     orxCHAR   zBuffer[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE], zLog[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE], *pcBuffer = zBuffer;
-    orxBOOL   bUseANSICodes = orxFALSE;
+    orxBOOL   bUseANSICodes = orxFALSE, bFormat = orxTRUE;
     orxSTATUS eStatus = orxSTATUS_SUCCESS;
     va_list   stArgs;
 
     /* Updates status */
-    orxFLAG_SET(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_LOGGING, orxDEBUG_KU32_STATIC_FLAG_NONE);
+    sbLogging = orxTRUE;
 
     /* Empties current buffer */
     pcBuffer[0] = orxCHAR_NULL;
 
-    /* Full Time Stamp? */
-    if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_FULL_TIMESTAMP)
+    /* Compact file output only? */
+    if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_COMPACT)
+    && !orxFLAG_TEST(sstDebug.u32DebugFlags, orxDEBUG_KU32_STATIC_FLAG_TERMINAL | orxDEBUG_KU32_STATIC_FLAG_CONSOLE | orxDEBUG_KU32_STATIC_FLAG_CALLBACK))
     {
-      time_t u32Time;
+      /* Doesn't need formatting, the writer thread will store raw arguments */
+      bFormat = orxFALSE;
+    }
 
-      /* Inits Log Time */
-      time(&u32Time);
+    /* Should format? */
+    if(bFormat != orxFALSE)
+    {
+      /* Full Time Stamp? */
+      if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_FULL_TIMESTAMP)
+      {
+        time_t u32Time;
 
-      pcBuffer += strftime(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE, orxDEBUG_KZ_DATE_FULL_FORMAT " ", localtime(&u32Time));
+        /* Inits Log Time */
+        time(&u32Time);
 
-      /* Updates status */
-      bUseANSICodes = orxTRUE;
-    }
-    /* Time Stamp? */
-    else if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TIMESTAMP)
-    {
-      time_t u32Time;
+        pcBuffer += strftime(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE, orxDEBUG_KZ_DATE_FULL_FORMAT " ", localtime(&u32Time));
 
-      /* Inits Log Time */
-      time(&u32Time);
+        /* Updates status */
+        bUseANSICodes = orxTRUE;
+      }
+      /* Time Stamp? */
+      else if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TIMESTAMP)
+      {
+        time_t u32Time;
 
-      pcBuffer += strftime(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE, orxDEBUG_KZ_DATE_FORMAT " ", localtime(&u32Time));
+        /* Inits Log Time */
+        time(&u32Time);
 
-      /* Updates status */
-      bUseANSICodes = orxTRUE;
-    }
+        pcBuffer += strftime(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE, orxDEBUG_KZ_DATE_FORMAT " ", localtime(&u32Time));
 
-    /* Log Type? */
-    if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TYPE)
-    {
+        /* Updates status */
+        bUseANSICodes = orxTRUE;
+      }
+
+      /* Log Type? */
+      if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TYPE)
+      {
 
 #ifdef __orxMSVC__
 
-      pcBuffer += _snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), orxDebug_GetLevelFormat(_eLevel), orxDebug_GetLevelString(_eLevel));
+        pcBuffer += _snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), orxDebug_GetLevelFormat(_eLevel), orxDebug_GetLevelString(_eLevel));
 
 #else /* __orxMSVC__ */
 
-      pcBuffer += snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), orxDebug_GetLevelFormat(_eLevel), orxDebug_GetLevelString(_eLevel));
+        pcBuffer += snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), orxDebug_GetLevelFormat(_eLevel), orxDebug_GetLevelString(_eLevel));
 
 #endif /* __orxMSVC__ */
 
-      /* Updates status */
-      bUseANSICodes = orxTRUE;
-    }
+        /* Updates status */
+        bUseANSICodes = orxTRUE;
+      }
 
-    /* Log FUNCTION, FILE & LINE? */
-    if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TAGGED)
-    {
-      const orxSTRING zFile;
+      /* Log FUNCTION, FILE & LINE? */
+      if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TAGGED)
+      {
+        const orxSTRING zFile;
 
-      /* Skips complete path */
-      zFile = orxString_SkipPath(_zFile);
+        /* Skips complete path */
+        zFile = orxString_SkipPath(_zFile);
 
 #ifdef __orxMSVC__
 
-      /* Writes info */
-      pcBuffer += _snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), orxDEBUG_KZ_FILE_FORMAT " ", zFile, _zFunction, _u32Line);
+        /* Writes info */
+        pcBuffer += _snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), orxDEBUG_KZ_FILE_FORMAT " ", zFile, _zFunction, _u32Line);
 
 #else /* __orxMSVC__ */
 
-      /* Writes info */
-      pcBuffer += snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), orxDEBUG_KZ_FILE_FORMAT " ", zFile, _zFunction, (unsigned int)_u32Line);
+        /* Writes info */
+        pcBuffer += snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), orxDEBUG_KZ_FILE_FORMAT " ", zFile, _zFunction, (unsigned int)_u32Line);
 
 #endif /* __orxMSVC__ */
 
-      /* Updates status */
-      bUseANSICodes = orxTRUE;
-    }
+        /* Updates status */
+        bUseANSICodes = orxTRUE;
+      }
 
-    /* Debug Log */
-    va_start(stArgs, _zFormat);
-    vsnprintf(zLog, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), _zFormat, stArgs);
-    zLog[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer) - 1] = orxCHAR_NULL;
-    va_end(stArgs);
+      /* Debug Log */
+      va_start(stArgs, _zFormat);
+      vsnprintf(zLog, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), _zFormat, stArgs);
+      zLog[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer) - 1] = orxCHAR_NULL;
+      va_end(stArgs);
 
-    /* Doesn't implicitly use ANSI codes? */
-    if(bUseANSICodes == orxFALSE)
-    {
-      /* Updates status */
-      bUseANSICodes = orxDebug_HasANSICodes(zLog);
-    }
+      /* Doesn't implicitly use ANSI codes? */
+      if(bUseANSICodes == orxFALSE)
+      {
+        /* Updates status */
+        bUseANSICodes = orxDebug_HasANSICodes(zLog);
+      }
 
 #ifdef __orxMSVC__
 
-    pcBuffer += _snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), "%s%s%s", zLog, (bUseANSICodes != orxFALSE) ? orxANSI_KZ_COLOR_RESET : orxSTRING_EMPTY, orxSTRING_EOL);
+      pcBuffer += _snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), "%s%s%s", zLog, (bUseANSICodes != orxFALSE) ? orxANSI_KZ_COLOR_RESET : orxSTRING_EMPTY, orxSTRING_EOL);
 
 #else /* __orxMSVC__ */
 
-    pcBuffer += snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), "%s%s%s", zLog, (bUseANSICodes != orxFALSE) ? orxANSI_KZ_COLOR_RESET : orxSTRING_EMPTY, orxSTRING_EOL);
+      pcBuffer += snprintf(pcBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - (pcBuffer - zBuffer), "%s%s%s", zLog, (bUseANSICodes != orxFALSE) ? orxANSI_KZ_COLOR_RESET : orxSTRING_EMPTY, orxSTRING_EOL);
 
 #endif /* __orxMSVC__ */
 
-    pcBuffer[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE  - (pcBuffer - zBuffer) - 1] = orxCHAR_NULL;
+      pcBuffer[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE  - (pcBuffer - zBuffer) - 1] = orxCHAR_NULL;
 
-    /* Doesn't have ANSI support? */
-    if(!orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ANSI))
-    {
-      /* Clears ANSI codes */
-      orxDebug_ClearANSICodes(zBuffer);
+      /* Doesn't have ANSI support? */
+      if(!orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ANSI))
+      {
+        /* Clears ANSI codes */
+        orxDebug_ClearANSICodes(zBuffer);
+      }
     }
 
     /* Should call the log callback? */
@@ -719,46 +2597,42 @@ void orxCDECL _orxDebug_Log(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction,
       /* File print? */
       if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_FILE)
       {
-        FILE *pstFile;
+#ifdef orxDEBUG_HAS_ASYNC
 
-        if(_eLevel == orxDEBUG_LEVEL_LOG)
+        /* Compact? */
+        if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_COMPACT))
         {
-
-#if !defined(__orxANDROID__) && !defined(__orxANDROID_ANDROID__)
-
-          /* Needs to open the file? */
-          if(sstDebug.pstLogFile == orxNULL)
-          {
-            /* Opens it */
-            sstDebug.pstLogFile = fopen(sstDebug.zLogFile, "ab+");
-          }
-
-#endif /* !__orxANDROID__ */
-
-          pstFile = sstDebug.pstLogFile;
+          /* Enqueues raw arguments */
+          va_start(stArgs, _zFormat);
+          orxDebug_EnqueueCompact(_eLevel, _zFunction, _zFile, _u32Line, _zFormat, stArgs);
+          va_end(stArgs);
         }
-        else
+        /* Asynchronous? */
+        else if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
         {
+          /* Enqueues formatted text */
+          orxDebug_EnqueueText(_eLevel, zBuffer);
+        }
+        else
 
-#if !defined(__orxANDROID__) && !defined(__orxANDROID_ANDROID__)
+#endif /* orxDEBUG_HAS_ASYNC */
 
-          /* Needs to open the file? */
-          if(sstDebug.pstDebugFile == orxNULL)
-          {
-            /* Opens it */
-            sstDebug.pstDebugFile = fopen(sstDebug.zDebugFile, "ab+");
-          }
+        {
+          orxBOOL bLog;
+          orxU32  u32Size;
 
-#endif /* !__orxANDROID__ */
+          /* Gets target & size */
+          bLog    = (_eLevel == orxDEBUG_LEVEL_LOG) ? orxTRUE : orxFALSE;
+          u32Size = (orxU32)strlen(zBuffer);
 
-          pstFile = sstDebug.pstDebugFile;
-        }
+          /* Opens/rotates file */
+          orxDebug_PrepareFile(bLog, u32Size);
 
-        /* Valid? */
-        if(pstFile != orxNULL)
-        {
-          fprintf(pstFile, "%s", zBuffer);
-          fflush(pstFile);
+          /* Writes text */
+          orxDebug_WriteFile(bLog, zBuffer, u32Size);
+
+          /* Flushes it */
+          orxDebug_FlushFiles();
         }
       }
 
@@ -775,7 +2649,7 @@ void orxCDECL _orxDebug_Log(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction,
     }
 
     /* Updates status */
-    orxFLAG_SET(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_NONE, orxDEBUG_KU32_STATIC_FLAG_LOGGING);
+    sbLogging = orxFALSE;
   }
 
   /* Done */
@@ -865,6 +2739,18 @@ void orxFASTCALL _orxDebug_SetDebugFile(const orxSTRING _zFileName)
   /* Checks */
   orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
 
+#ifdef orxDEBUG_HAS_ASYNC
+
+  /* Is background writer running? */
+  if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
+  {
+    /* Writes pending logs to the previous file */
+    orxDebug_LockConsumer();
+    orxDebug_DrainRing();
+  }
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
   /* Was open? */
   if(sstDebug.pstDebugFile != orxNULL)
   {
@@ -900,6 +2786,17 @@ void orxFASTCALL _orxDebug_SetDebugFile(const orxSTRING _zFileName)
     sstDebug.zDebugFile = (orxSTRING)orxDEBUG_KZ_DEFAULT_DEBUG_FILE;
   }
 
+#ifdef orxDEBUG_HAS_ASYNC
+
+  /* Is background writer running? */
+  if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
+  {
+    /* Releases access */
+    orxDebug_UnlockConsumer();
+  }
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
   /* Done! */
   return;
 }
@@ -912,6 +2809,18 @@ void orxFASTCALL _orxDebug_SetLogFile(const orxSTRING _zFileName)
   /* Checks */
   orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
 
+#ifdef orxDEBUG_HAS_ASYNC
+
+  /* Is background writer running? */
+  if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
+  {
+    /* Writes pending logs to the previous file */
+    orxDebug_LockConsumer();
+    orxDebug_DrainRing();
+  }
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
   /* Was open? */
   if(sstDebug.pstLogFile != orxNULL)
   {
@@ -947,6 +2856,17 @@ void orxFASTCALL _orxDebug_SetLogFile(const orxSTRING _zFileName)
     sstDebug.zLogFile = (orxSTRING)orxDEBUG_KZ_DEFAULT_LOG_FILE;
   }
 
+#ifdef orxDEBUG_HAS_ASYNC
+
+  /* Is background writer running? */
+  if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
+  {
+    /* Releases access */
+    orxDebug_UnlockConsumer();
+  }
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
   /* Done! */
   return;
 }
@@ -966,6 +2886,363 @@ void orxFASTCALL _orxDebug_SetLogCallback(const orxDEBUG_CALLBACK_FUNCTION _pfnL
   return;
 }
 
+/** Sets the log backend mode, should be called when no other thread is logging
+ * @param[in]   _eMode                        Mode to use
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the mode isn't supported on this platform
+ */
+orxSTATUS orxFASTCALL _orxDebug_SetMode(orxDEBUG_MODE _eMode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eMode < orxDEBUG_MODE_NUMBER);
+
+  /* New mode? */
+  if(_eMode != _orxDebug_GetMode())
+  {
+#ifdef orxDEBUG_HAS_ASYNC
+
+    /* Is background writer running? */
+    if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
+    {
+      /* Stops it */
+      orxDebug_StopWriter();
+    }
+
+    /* Closes files, their format might change */
+    orxDebug_CloseFiles();
+
+    /* Asynchronous? */
+    if(_eMode != orxDEBUG_MODE_SYNC)
+    {
+      /* Starts background writer */
+      eResult = orxDebug_StartWriter((_eMode == orxDEBUG_MODE_COMPACT) ? orxTRUE : orxFALSE);
+    }
+
+#else /* orxDEBUG_HAS_ASYNC */
+
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Asynchronous logging isn't supported on this platform.");
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+
+#endif /* orxDEBUG_HAS_ASYNC */
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets the log backend mode
+ * @return      orxDEBUG_MODE
+ */
+orxDEBUG_MODE orxFASTCALL _orxDebug_GetMode()
+{
+  orxDEBUG_MODE eResult;
+
+  /* Checks */
+  orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  eResult = orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_COMPACT)
+            ? orxDEBUG_MODE_COMPACT
+            : orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC)
+              ? orxDEBUG_MODE_ASYNC
+              : orxDEBUG_MODE_SYNC;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Sets size-based rotation of the log & debug files
+ * @param[in]   _u32MaxSize                   Size, in bytes, above which a file gets rotated, 0 to disable rotation
+ * @param[in]   _u32MaxFileNumber             Number of rotated files to keep (name.1 being the most recent), 0 to simply restart the file
+ */
+void orxFASTCALL _orxDebug_SetFileRotation(orxU32 _u32MaxSize, orxU32 _u32MaxFileNumber)
+{
+  /* Checks */
+  orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
+
+#ifdef orxDEBUG_HAS_ASYNC
+
+  /* Is background writer running? */
+  if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
+  {
+    /* Gets exclusive access */
+    orxDebug_LockConsumer();
+  }
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
+  /* Stores rotation settings */
+  sstDebug.u32RotationSize    = _u32MaxSize;
+  sstDebug.u32RotationNumber  = _u32MaxFileNumber;
+
+#ifdef orxDEBUG_HAS_ASYNC
+
+  /* Is background writer running? */
+  if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
+  {
+    /* Releases access */
+    orxDebug_UnlockConsumer();
+  }
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
+  /* Done! */
+  return;
+}
+
+/** Writes all pending logs to their files
+ */
+void orxFASTCALL _orxDebug_Flush()
+{
+  /* Checks */
+  orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
+
+#ifdef orxDEBUG_HAS_ASYNC
+
+  /* Is background writer running? */
+  if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
+  {
+    /* Writes pending logs */
+    orxDebug_LockConsumer();
+    orxDebug_DrainRing();
+    orxDebug_FlushFiles();
+    orxDebug_UnlockConsumer();
+  }
+  else
+
+#endif /* orxDEBUG_HAS_ASYNC */
+
+  {
+    /* Flushes files */
+    orxDebug_FlushFiles();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Decodes a compact log file into text
+ * @param[in]   _zInputFile                   Compact log file (written with orxDEBUG_MODE_COMPACT)
+ * @param[in]   _zOutputFile                  Text file to write, orxNULL for stdout
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL _orxDebug_DecodeCompactFile(const orxSTRING _zInputFile, const orxSTRING _zOutputFile)
+{
+  FILE     *pstInput;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(_zInputFile != orxNULL);
+
+  /* Opens input */
+  pstInput = fopen(_zInputFile, "rb");
+
+  /* Success? */
+  if(pstInput != orxNULL)
+  {
+    orxU8  *pu8Buffer = orxNULL;
+    long    lSize;
+
+    /* Loads it */
+    fseek(pstInput, 0, SEEK_END);
+    lSize = ftell(pstInput);
+    fseek(pstInput, 0, SEEK_SET);
+    if((lSize >= (long)orxDEBUG_KU32_COMPACT_MAGIC_SIZE)
+    && ((pu8Buffer = (orxU8 *)malloc((size_t)lSize)) != orxNULL)
+    && (fread(pu8Buffer, 1, (size_t)lSize, pstInput) == (size_t)lSize)
+    && (memcmp(pu8Buffer, orxDEBUG_KZ_COMPACT_MAGIC, orxDEBUG_KU32_COMPACT_MAGIC_SIZE) == 0))
+    {
+      orxDEBUG_DEFINITION  *astDefinitionList = orxNULL;
+      orxU32                u32DefinitionCount = 0, u32DefinitionSize = 0, u32Pass, i;
+      const orxU8          *pu8End;
+      FILE                 *pstOutput;
+
+      /* Opens output */
+      pstOutput = (_zOutputFile != orxNULL) ? fopen(_zOutputFile, "wb") : stdout;
+
+      /* Success? */
+      if(pstOutput != orxNULL)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+
+        /* Gets end */
+        pu8End = pu8Buffer + lSize;
+
+        /* Collects definitions first, as a message can precede the definition sent by another thread */
+        for(u32Pass = 0; u32Pass < 2; u32Pass++)
+        {
+          const orxU8 *pu8;
+
+          /* For all records */
+          for(pu8 = pu8Buffer + orxDEBUG_KU32_COMPACT_MAGIC_SIZE; pu8 < pu8End;)
+          {
+            /* Definition? */
+            if((*pu8 == orxDEBUG_KC_COMPACT_DEFINITION) && (pu8 + 8 <= pu8End))
+            {
+              orxU16 u16Length;
+
+              /* Gets its length */
+              memcpy(&u16Length, pu8 + 2, sizeof(orxU16));
+
+              /* Invalid? */
+              if(pu8 + 8 + u16Length > pu8End)
+              {
+                break;
+              }
+
+              /* First pass? */
+              if(u32Pass == 0)
+              {
+                /* Needs more room? */
+                if(u32DefinitionCount == u32DefinitionSize)
+                {
+                  orxDEBUG_DEFINITION *astNewList;
+
+                  /* Grows list */
+                  u32DefinitionSize = (u32DefinitionSize != 0) ? u32DefinitionSize * 2 : 256;
+                  astNewList        = (orxDEBUG_DEFINITION *)realloc(astDefinitionList, (size_t)u32DefinitionSize * sizeof(orxDEBUG_DEFINITION));
+                  if(astNewList == orxNULL)
+                  {
+                    eResult = orxSTATUS_FAILURE;
+                    break;
+                  }
+                  astDefinitionList = astNewList;
+                }
+
+                /* Stores it */
+                memcpy(&(astDefinitionList[u32DefinitionCount].u32ID), pu8 + 4, sizeof(orxU32));
+                astDefinitionList[u32DefinitionCount].u32Size = u16Length;
+                astDefinitionList[u32DefinitionCount].zString = (orxCHAR *)malloc((size_t)u16Length + 1);
+                if(astDefinitionList[u32DefinitionCount].zString != orxNULL)
+                {
+                  memcpy(astDefinitionList[u32DefinitionCount].zString, pu8 + 8, (size_t)u16Length);
+                  astDefinitionList[u32DefinitionCount].zString[u16Length] = orxCHAR_NULL;
+                  u32DefinitionCount++;
+                }
+              }
+
+              /* Goes to next record */
+              pu8 += 8 + u16Length;
+            }
+            /* Message? */
+            else if((*pu8 == orxDEBUG_KC_COMPACT_MESSAGE) && (pu8 + orxDEBUG_KU32_COMPACT_MESSAGE_SIZE <= pu8End))
+            {
+              const orxU8  *pu8Args;
+              orxU32        u32ArgCount;
+
+              /* Finds its end */
+              for(i = 0, u32ArgCount = pu8[2], pu8Args = pu8 + orxDEBUG_KU32_COMPACT_MESSAGE_SIZE; (i < u32ArgCount) && (pu8Args < pu8End); i++)
+              {
+                if(*pu8Args == orxDEBUG_KC_COMPACT_STRING)
+                {
+                  orxU16 u16Length;
+
+                  memcpy(&u16Length, pu8Args + 1, sizeof(orxU16));
+                  pu8Args += 3 + u16Length;
+                }
+                else
+                {
+                  pu8Args += 9;
+                }
+              }
+
+              /* Invalid? */
+              if(pu8Args > pu8End)
+              {
+                break;
+              }
+
+              /* Second pass? */
+              if(u32Pass != 0)
+              {
+                orxCHAR         acMessage[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE], acTime[32];
+                const orxSTRING zFormat;
+                const orxSTRING zFile;
+                const orxSTRING zFunction;
+                orxU32          u32ID, u32Line;
+                orxU64          u64Time;
+                time_t          stTime;
+
+                /* Gets its strings */
+                memcpy(&u32ID, pu8 + 4, sizeof(orxU32));
+                zFormat   = orxDebug_FindDecodedDefinition(astDefinitionList, u32DefinitionCount, u32ID);
+                memcpy(&u32ID, pu8 + 8, sizeof(orxU32));
+                zFile     = orxDebug_FindDecodedDefinition(astDefinitionList, u32DefinitionCount, u32ID);
+                memcpy(&u32ID, pu8 + 12, sizeof(orxU32));
+                zFunction = orxDebug_FindDecodedDefinition(astDefinitionList, u32DefinitionCount, u32ID);
+                memcpy(&u32Line, pu8 + 16, sizeof(orxU32));
+                memcpy(&u64Time, pu8 + 20, sizeof(orxU64));
+
+                /* Formats message */
+                orxDebug_FormatCompact((zFormat != orxNULL) ? zFormat : "<unknown format>", pu8 + orxDEBUG_KU32_COMPACT_MESSAGE_SIZE, pu8Args, u32ArgCount, acMessage, sizeof(acMessage));
+
+                /* Gets time */
+                stTime = (time_t)u64Time;
+                strftime(acTime, sizeof(acTime), "%Y-%m-%d %H:%M:%S", localtime(&stTime));
+
+                /* Outputs it */
+                fprintf(pstOutput, "[%s] [%s] [%s:%s(%u)] ", acTime, orxDebug_GetLevelString((orxDEBUG_LEVEL)pu8[1]), (zFile != orxNULL) ? zFile : "?", (zFunction != orxNULL) ? zFunction : "?", (unsigned int)u32Line);
+                orxDebug_ClearANSICodes(acMessage);
+                fprintf(pstOutput, "%s\n", acMessage);
+              }
+
+              /* Goes to next record */
+              pu8 = pu8Args;
+            }
+            else
+            {
+              /* Invalid record, stops */
+              break;
+            }
+          }
+
+          /* End of first pass? */
+          if(u32Pass == 0)
+          {
+            /* Sorts definitions */
+            if(u32DefinitionCount != 0)
+            {
+              qsort(astDefinitionList, (size_t)u32DefinitionCount, sizeof(orxDEBUG_DEFINITION), &orxDebug_CompareDecodedDefinitions);
+            }
+          }
+        }
+
+        /* Closes output */
+        if(pstOutput != stdout)
+        {
+          fclose(pstOutput);
+        }
+        else
+        {
+          fflush(pstOutput);
+        }
+      }
+
+      /* Frees definitions */
+      for(i = 0; i < u32DefinitionCount; i++)
+      {
+        free(astDefinitionList[i].zString);
+      }
+      free(astDefinitionList);
+    }
+
+    /* Frees buffer */
+    free(pu8Buffer);
+
+    /* Closes input */
+    fclose(pstInput);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 #ifdef __orxMSVC__
 
   #pragma warning(pop)
@@ -35,6 +35,7 @@
 #include "memory/orxMemory.h"
 #include "core/orxSystem.h"
 #include "core/orxThread.h"
+#include "io/orxFile.h"
 #include "utils/orxString.h"
 
 
@@ -51,6 +52,7 @@
 #define orxPROFILER_KU32_STATIC_FLAG_READY        0x00000001
 #define orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS   0x10000000
 #define orxPROFILER_KU32_STATIC_FLAG_PAUSED       0x20000000
+#define orxPROFILER_KU32_STATIC_FLAG_CAPTURE      0x40000000
 
 #define orxPROFILER_KU32_STATIC_MASK_ALL          0xFFFFFFFF
 
@@ -69,11 +71,16 @@
 /** Misc defines
  */
 #define orxPROFILER_KU32_MAX_MARKER_NUMBER        (orxPROFILER_KU32_MASK_MARKER_ID + 1)
-#define orxPROFILER_KU32_SHIFT_MARKER_ID          7
-#define orxPROFILER_KU32_MASK_MARKER_ID           0x7F
+#define orxPROFILER_KU32_SHIFT_MARKER_ID          8
+#define orxPROFILER_KU32_MASK_MARKER_ID           0xFF
 #define orxPROFILER_KS32_MARKER_ID_ROOT           -2
 #define orxPROFILER_KU32_MARKER_DATA_NUMBER       orxTHREAD_KU32_MAX_THREAD_NUMBER
 
+#define orxPROFILER_KU32_CAPTURE_CHUNK_SIZE       16384                     /**< Capture chunk size, in events */
+#define orxPROFILER_KU32_CAPTURE_CHUNK_NUMBER     256                       /**< Max number of capture chunks per thread */
+#define orxPROFILER_KS32_CAPTURE_ID_POP           -1                        /**< Captured pop event */
+#define orxPROFILER_KS32_CAPTURE_ID_FRAME         -2                        /**< Captured frame event */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -110,6 +117,25 @@ typedef struct __orxPROFILER_MARKER_INFO_t
 
 } orxPROFILER_MARKER_INFO;
 
+/** Internal capture event structure
+ */
+typedef struct __orxPROFILER_CAPTURE_EVENT_t
+{
+  orxDOUBLE               dTimeStamp;
+  orxS32                  s32ID;
+
+} orxPROFILER_CAPTURE_EVENT;
+
+/** Internal capture chunk structure
+ */
+typedef struct __orxPROFILER_CAPTURE_CHUNK_t
+{
+  struct __orxPROFILER_CAPTURE_CHUNK_t *volatile pstNext;
+  volatile orxU32         u32Count;
+  orxPROFILER_CAPTURE_EVENT astEventList[orxPROFILER_KU32_CAPTURE_CHUNK_SIZE];
+
+} orxPROFILER_CAPTURE_CHUNK;
+
 /** Internal marker data structure
  */
 typedef struct __orxPROFILER_MARKER_DATA_t
@@ -124,6 +150,11 @@ typedef struct __orxPROFILER_MARKER_DATA_t
   orxU32                  u32HistoryIndex;
   orxU32                  u32HistoryQueryIndex;
   orxBOOL                 bReset;
+  orxPROFILER_CAPTURE_CHUNK *pstCaptureFirstChunk;
+  orxPROFILER_CAPTURE_CHUNK *pstCaptureChunk;
+  orxU32                  u32CaptureChunkCount;
+  volatile orxU32         u32CaptureID;
+  volatile orxBOOL        bCaptureTruncated;
 
 } orxPROFILER_MARKER_DATA;
 
@@ -138,6 +169,8 @@ typedef struct __orxPROFILER_STATIC_t
   orxS32                  s32MarkerCount;
   orxTHREAD_SEMAPHORE    *pstSemaphore;
   orxPROFILER_MARKER      astMarkerList[orxPROFILER_KU32_MAX_MARKER_NUMBER];
+  orxDOUBLE               dCaptureStartTime;
+  volatile orxU32         u32CaptureID;
   orxU32                  u32Flags;
 
   orxPROFILER_MARKER_DATA *apstMarkerDataList[orxPROFILER_KU32_MARKER_DATA_NUMBER];
@@ -259,6 +292,248 @@ static orxINLINE void orxProfiler_ResetData(orxPROFILER_MARKER_DATA *_pstData)
   return;
 }
 
+static orxINLINE void orxProfiler_Capture(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID, orxDOUBLE _dTimeStamp)
+{
+  orxPROFILER_CAPTURE_CHUNK *pstChunk;
+
+  /* New capture? */
+  if(_pstData->u32CaptureID != sstProfiler.u32CaptureID)
+  {
+    /* For all its chunks */
+    for(pstChunk = _pstData->pstCaptureFirstChunk; pstChunk != orxNULL; pstChunk = pstChunk->pstNext)
+    {
+      /* Clears it */
+      pstChunk->u32Count = 0;
+    }
+
+    /* Rewinds */
+    _pstData->pstCaptureChunk   = _pstData->pstCaptureFirstChunk;
+    _pstData->bCaptureTruncated = orxFALSE;
+
+    /* Updates its capture ID */
+    orxMEMORY_BARRIER();
+    _pstData->u32CaptureID      = sstProfiler.u32CaptureID;
+  }
+
+  /* Gets current chunk */
+  pstChunk = _pstData->pstCaptureChunk;
+
+  /* None or full? */
+  if((pstChunk == orxNULL) || (pstChunk->u32Count == orxPROFILER_KU32_CAPTURE_CHUNK_SIZE))
+  {
+    orxPROFILER_CAPTURE_CHUNK *pstNextChunk;
+
+    /* Gets next chunk */
+    pstNextChunk = (pstChunk != orxNULL) ? pstChunk->pstNext : _pstData->pstCaptureFirstChunk;
+
+    /* None and can allocate a new one? */
+    if((pstNextChunk == orxNULL) && (_pstData->u32CaptureChunkCount < orxPROFILER_KU32_CAPTURE_CHUNK_NUMBER))
+    {
+      /* Allocates it */
+      pstNextChunk = (orxPROFILER_CAPTURE_CHUNK *)orxMemory_Allocate(sizeof(orxPROFILER_CAPTURE_CHUNK), orxMEMORY_TYPE_DEBUG);
+
+      /* Success? */
+      if(pstNextChunk != orxNULL)
+      {
+        /* Inits it */
+        pstNextChunk->pstNext   = orxNULL;
+        pstNextChunk->u32Count  = 0;
+        _pstData->u32CaptureChunkCount++;
+
+        /* Links it */
+        orxMEMORY_BARRIER();
+        if(pstChunk != orxNULL)
+        {
+          pstChunk->pstNext = pstNextChunk;
+        }
+        else
+        {
+          _pstData->pstCaptureFirstChunk = pstNextChunk;
+        }
+      }
+    }
+
+    /* Updates current chunk */
+    pstChunk = pstNextChunk;
+    if(pstChunk != orxNULL)
+    {
+      _pstData->pstCaptureChunk = pstChunk;
+    }
+  }
+
+  /* Has room? */
+  if(pstChunk != orxNULL)
+  {
+    orxPROFILER_CAPTURE_EVENT *pstEvent;
+
+    /* Stores event */
+    pstEvent              = &(pstChunk->astEventList[pstChunk->u32Count]);
+    pstEvent->dTimeStamp  = _dTimeStamp;
+    pstEvent->s32ID       = _s32ID;
+
+    /* Publishes it */
+    orxMEMORY_BARRIER();
+    pstChunk->u32Count++;
+  }
+  else
+  {
+    /* Updates status */
+    _pstData->bCaptureTruncated = orxTRUE;
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxProfiler_PrintCaptureString(orxFILE *_pstFile, const orxSTRING _zString)
+{
+  const orxCHAR *pc;
+
+  /* For all characters */
+  for(pc = _zString; *pc != orxCHAR_NULL; pc++)
+  {
+    /* Needs escaping? */
+    if((*pc == '"') || (*pc == '\\'))
+    {
+      orxFile_Print(_pstFile, "\\%c", *pc);
+    }
+    /* Control character? */
+    else if((orxU8)*pc < 0x20)
+    {
+      orxFile_Print(_pstFile, "\\u%04x", (orxU32)(orxU8)*pc);
+    }
+    else
+    {
+      orxFile_Print(_pstFile, "%c", *pc);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxProfiler_SaveCapture(const orxSTRING _zFileName, orxDOUBLE _dStopTime)
+{
+  orxFILE  *pstFile;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Opens file */
+  pstFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  /* Success? */
+  if(pstFile != orxNULL)
+  {
+    orxU32  i;
+    orxBOOL bFirst = orxTRUE;
+
+    /* Writes header */
+    orxFile_Print(pstFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    /* For all marker data */
+    for(i = 0; i < orxPROFILER_KU32_MARKER_DATA_NUMBER; i++)
+    {
+      orxPROFILER_MARKER_DATA *pstData;
+
+      /* Gets it */
+      pstData = sstProfiler.apstMarkerDataList[i];
+
+      /* Has events for this capture? */
+      if((pstData != orxNULL) && (pstData->u32CaptureID == sstProfiler.u32CaptureID) && (pstData->pstCaptureFirstChunk != orxNULL))
+      {
+        const orxPROFILER_CAPTURE_CHUNK  *pstChunk;
+        const orxSTRING                   zThreadName;
+        orxU32                            u32Depth = 0;
+
+        /* Gets thread name */
+        zThreadName = orxThread_GetName(i);
+
+        /* Writes thread name */
+        orxFile_Print(pstFile, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", (bFirst != orxFALSE) ? orxSTRING_EMPTY : ",", i);
+        orxProfiler_PrintCaptureString(pstFile, ((zThreadName != orxNULL) && (*zThreadName != orxCHAR_NULL)) ? zThreadName : "Thread");
+        orxFile_Print(pstFile, "\"}}");
+        bFirst = orxFALSE;
+
+        /* For all its chunks */
+        for(pstChunk = pstData->pstCaptureFirstChunk; pstChunk != orxNULL; pstChunk = pstChunk->pstNext)
+        {
+          orxU32 j, u32Count;
+
+          /* Gets its published count */
+          u32Count = pstChunk->u32Count;
+          orxMEMORY_BARRIER();
+
+          /* For all its events */
+          for(j = 0; j < u32Count; j++)
+          {
+            const orxPROFILER_CAPTURE_EVENT  *pstEvent;
+            orxDOUBLE                         dTime;
+
+            /* Gets it */
+            pstEvent  = &(pstChunk->astEventList[j]);
+            dTime     = (pstEvent->dTimeStamp - sstProfiler.dCaptureStartTime) * orx2D(1.0e6);
+
+            /* Pop? */
+            if(pstEvent->s32ID == orxPROFILER_KS32_CAPTURE_ID_POP)
+            {
+              /* Matches a captured push? */
+              if(u32Depth != 0)
+              {
+                /* Writes it */
+                orxFile_Print(pstFile, ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", i, dTime);
+                u32Depth--;
+              }
+            }
+            /* Frame? */
+            else if(pstEvent->s32ID == orxPROFILER_KS32_CAPTURE_ID_FRAME)
+            {
+              /* Writes it */
+              orxFile_Print(pstFile, ",\n{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", i, dTime);
+            }
+            else
+            {
+              /* Writes it */
+              orxFile_Print(pstFile, ",\n{\"name\":\"");
+              orxProfiler_PrintCaptureString(pstFile, sstProfiler.astMarkerList[pstEvent->s32ID].zName);
+              orxFile_Print(pstFile, "\",\"ph\":\"B\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", i, dTime);
+              u32Depth++;
+            }
+          }
+        }
+
+        /* Closes all pending markers */
+        for(; u32Depth != 0; u32Depth--)
+        {
+          orxFile_Print(pstFile, ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", i, (_dStopTime - sstProfiler.dCaptureStartTime) * orx2D(1.0e6));
+        }
+
+        /* Was truncated? */
+        if(pstData->bCaptureTruncated != orxFALSE)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Capture of thread [%u] was truncated after %u events.", i, orxPROFILER_KU32_CAPTURE_CHUNK_SIZE * orxPROFILER_KU32_CAPTURE_CHUNK_NUMBER);
+        }
+      }
+    }
+
+    /* Writes footer */
+    orxFile_Print(pstFile, "\n]}\n");
+
+    /* Closes file */
+    orxFile_Close(pstFile);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't save capture: couldn't open file <%s>.", _zFileName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /***************************************************************************
  * Public functions                                                        *
  ***************************************************************************/
@@ -350,6 +625,19 @@ void orxFASTCALL orxProfiler_Exit()
       /* Valid? */
       if(pstData != orxNULL)
       {
+        orxPROFILER_CAPTURE_CHUNK *pstChunk;
+
+        /* For all its capture chunks */
+        for(pstChunk = pstData->pstCaptureFirstChunk; pstChunk != orxNULL;)
+        {
+          orxPROFILER_CAPTURE_CHUNK *pstNextChunk;
+
+          /* Deletes it */
+          pstNextChunk = pstChunk->pstNext;
+          orxMemory_Free(pstChunk);
+          pstChunk = pstNextChunk;
+        }
+
         /* Deletes data */
         orxMemory_Free(pstData);
         sstProfiler.apstMarkerDataList[i] = orxNULL;
@@ -603,6 +891,13 @@ void orxFASTCALL orxProfiler_PushMarker(orxS32 _s32MarkerID)
 
           /* Stores time stamp */
           pstMarkerInfo->dTimeStamp = dTimeStamp;
+
+          /* Is capturing? */
+          if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_CAPTURE))
+          {
+            /* Captures push */
+            orxProfiler_Capture(pstData, s32ID, dTimeStamp);
+          }
         }
         else
         {
@@ -655,13 +950,17 @@ void orxFASTCALL orxProfiler_PopMarker()
         {
           orxPROFILER_MARKER_INFO    *pstMarkerInfo;
           orxPROFILER_HISTORY_ENTRY  *pstEntry;
+          orxDOUBLE                   dTimeStamp;
 
           /* Gets marker & current info */
           pstMarkerInfo = &(pstData->astMarkerInfoList[pstData->s32CurrentMarker]);
           pstEntry      = &(pstData->aastHistory[pstData->u32HistoryIndex][pstData->s32CurrentMarker]);
 
+          /* Gets time stamp */
+          dTimeStamp    = orxSystem_GetTime();
+
           /* Updates cumulated time */
-          pstEntry->dCumulatedTime += orxSystem_GetTime() - pstMarkerInfo->dTimeStamp;
+          pstEntry->dCumulatedTime += dTimeStamp - pstMarkerInfo->dTimeStamp;
 
           /* Updates max cumulated time */
           if(pstEntry->dCumulatedTime > pstEntry->dMaxCumulatedTime)
@@ -681,6 +980,13 @@ void orxFASTCALL orxProfiler_PopMarker()
 
           /* Updates flags */
           orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_NONE, orxPROFILER_KU32_FLAG_PUSHED);
+
+          /* Is capturing? */
+          if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_CAPTURE))
+          {
+            /* Captures pop */
+            orxProfiler_Capture(pstData, orxPROFILER_KS32_CAPTURE_ID_POP, dTimeStamp);
+          }
         }
         else
         {
@@ -790,6 +1096,13 @@ void orxFASTCALL orxProfiler_ResetAllMarkers()
       }
     }
 
+    /* Is capturing? */
+    if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_CAPTURE))
+    {
+      /* Captures frame */
+      orxProfiler_Capture(orxProfiler_GetMarkerData(orxTHREAD_KU32_MAIN_THREAD_ID, orxFALSE), orxPROFILER_KS32_CAPTURE_ID_FRAME, orxSystem_GetTime());
+    }
+
     /* Resets main data */
     orxProfiler_ResetData(orxProfiler_GetMarkerData(orxTHREAD_KU32_MAIN_THREAD_ID, orxFALSE));
   }
@@ -798,6 +1111,108 @@ void orxFASTCALL orxProfiler_ResetAllMarkers()
   return;
 }
 
+/** Starts capturing all marker push/pop operations, on all threads, for later export as a Chrome trace
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxProfiler_StartCapture()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+
+  /* Not already capturing? */
+  if(!orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_CAPTURE))
+  {
+    /* Starts new capture */
+    sstProfiler.dCaptureStartTime = orxSystem_GetTime();
+    sstProfiler.u32CaptureID++;
+
+    /* Updates flags */
+    orxMEMORY_BARRIER();
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_CAPTURE, orxPROFILER_KU32_STATIC_FLAG_NONE);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't start capture: a capture is already in progress.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops the current capture and exports it as a Chrome trace JSON file (chrome://tracing, Perfetto, ...)
+ * @param[in] _zFileName        Name of the file to export, orxNULL to discard the capture
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxProfiler_StopCapture(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+
+  /* Is capturing? */
+  if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_CAPTURE))
+  {
+    orxDOUBLE dStopTime;
+
+    /* Gets stop time */
+    dStopTime = orxSystem_GetTime();
+
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_CAPTURE);
+    orxMEMORY_BARRIER();
+
+    /* Should export? */
+    if((_zFileName != orxNULL) && (*_zFileName != orxCHAR_NULL))
+    {
+      /* Is file module initialized? */
+      if(orxModule_IsInitialized(orxMODULE_ID_FILE) != orxFALSE)
+      {
+        /* Saves capture */
+        eResult = orxProfiler_SaveCapture(_zFileName, dStopTime);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't save capture to <%s>: file module isn't initialized.", _zFileName);
+      }
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't stop capture: no capture in progress.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Is the profiler capturing?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxProfiler_IsCapturing()
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_CAPTURE) ? orxTRUE : orxFALSE;
+}
+
 /** Resets all maxima (usually called at a regular interval)
  */
 void orxFASTCALL orxProfiler_ResetAllMaxima()
@@ -123,8 +123,12 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_DeleteBitmap, void, orxBITMAP *);
 
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_LoadBitmap, orxBITMAP *, const orxSTRING);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_SaveBitmap, orxSTATUS, const orxBITMAP *, const orxSTRING);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_EncodeBitmapData, orxSTATUS, orxHANDLE, orxU32, orxU32, const orxU8 *);
 
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_LoadFont, orxBITMAP *, const orxSTRING, const orxSTRING, const orxVECTOR *, const orxVECTOR *, const orxVECTOR *, orxBOOL, orxFLOAT *);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_LoadTypeface, orxHANDLE, const orxSTRING, const orxVECTOR *, const orxVECTOR *, orxBOOL);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_DeleteTypeface, void, orxHANDLE);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_RenderGlyph, orxSTATUS, const orxHANDLE, orxU32, orxFLOAT *, orxU8 *);
 
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_SetTempBitmap, orxSTATUS, const orxBITMAP *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetTempBitmap, const orxBITMAP *);
@@ -193,8 +197,12 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, DELETE_BITMAP, orxDisplay_DeleteBitma
 
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, LOAD_BITMAP, orxDisplay_LoadBitmap)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, SAVE_BITMAP, orxDisplay_SaveBitmap)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, ENCODE_BITMAP_DATA, orxDisplay_EncodeBitmapData)
 
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, LOAD_FONT, orxDisplay_LoadFont)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, LOAD_TYPEFACE, orxDisplay_LoadTypeface)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, DELETE_TYPEFACE, orxDisplay_DeleteTypeface)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, RENDER_GLYPH, orxDisplay_RenderGlyph)
 
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, SET_TEMP_BITMAP, orxDisplay_SetTempBitmap)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, GET_TEMP_BITMAP, orxDisplay_GetTempBitmap)
@@ -318,11 +326,31 @@ orxSTATUS orxFASTCALL orxDisplay_SaveBitmap(const orxBITMAP *_pstBitmap, const o
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_SaveBitmap)(_pstBitmap, _zFileName);
 }
 
+orxSTATUS orxFASTCALL orxDisplay_EncodeBitmapData(orxHANDLE _hResource, orxU32 _u32Width, orxU32 _u32Height, const orxU8 *_au8Data)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_EncodeBitmapData)(_hResource, _u32Width, _u32Height, _au8Data);
+}
+
 orxBITMAP *orxFASTCALL orxDisplay_LoadFont(const orxSTRING _zFileName, const orxSTRING _zCharacterList, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvCharacterSpacing, const orxVECTOR * _pvCharacterPadding, orxBOOL _bSDF, orxFLOAT *_afCharacterWidthList)
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_LoadFont)(_zFileName, _zCharacterList, _pvCharacterSize, _pvCharacterSpacing, _pvCharacterPadding, _bSDF, _afCharacterWidthList);
 }
 
+orxHANDLE orxFASTCALL orxDisplay_LoadTypeface(const orxSTRING _zFileName, const orxVECTOR *_pvCharacterSize, const orxVECTOR *_pvCharacterPadding, orxBOOL _bSDF)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_LoadTypeface)(_zFileName, _pvCharacterSize, _pvCharacterPadding, _bSDF);
+}
+
+void orxFASTCALL orxDisplay_DeleteTypeface(orxHANDLE _hTypeface)
+{
+  orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_DeleteTypeface)(_hTypeface);
+}
+
+orxSTATUS orxFASTCALL orxDisplay_RenderGlyph(const orxHANDLE _hTypeface, orxU32 _u32CharacterCodePoint, orxFLOAT *_pfWidth, orxU8 *_pu8Data)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_RenderGlyph)(_hTypeface, _u32CharacterCodePoint, _pfWidth, _pu8Data);
+}
+
 orxBITMAP *orxFASTCALL orxDisplay_GetScreenBitmap()
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_GetScreenBitmap)();
@@ -36,6 +36,8 @@
 #include "core/orxConfig.h"
 #include "core/orxEvent.h"
 #include "core/orxResource.h"
+#include "core/orxSystem.h"
+#include "core/orxThread.h"
 #include "display/orxDisplay.h"
 #include "object/orxStructure.h"
 #include "utils/orxHashTable.h"
@@ -59,6 +61,7 @@
 #define orxFONT_KU32_FLAG_CAN_UPDATE_MAP        0x80000000  /**< Can update map flag */
 #define orxFONT_KU32_FLAG_SDF                   0x01000000  /**< SDF flag */
 #define orxFONT_KU32_FLAG_INTERNAL_SHADER       0x02000000  /**< Internal shader flag */
+#define orxFONT_KU32_FLAG_DYNAMIC               0x04000000  /**< Dynamic flag */
 
 #define orxFONT_KU32_MASK_ALL                   0xFFFFFFFF  /**< All mask */
 
@@ -69,11 +72,13 @@
 #define orxFONT_KU32_REFERENCE_TABLE_SIZE       4           /**< Reference table size */
 #define orxFONT_KU32_CHARACTER_BANK_SIZE        256         /**< Character bank size */
 #define orxFONT_KU32_CHARACTER_TABLE_SIZE       256         /**< Character table size */
+#define orxFONT_KU32_GLYPH_BANK_SIZE            128         /**< Glyph bank size */
 
 #define orxFONT_KU32_BANK_SIZE                  16          /**< Bank size */
 
 #define orxFONT_KV_DEFAULT_CHARACTER_SPACING    orx2F(2.0f), orx2F(2.0f), orxFLOAT_0
 #define orxFONT_KV_DEFAULT_CHARACTER_SIZE       orxFLOAT_0, orx2F(32.0f), orxFLOAT_0
+#define orxFONT_KV_DEFAULT_ATLAS_SIZE           orx2F(1024.0f), orx2F(1024.0f), orxFLOAT_0
 
 #define orxFONT_KZ_CONFIG_TEXTURE_CORNER        "TextureCorner" /**< Kept for retro-compatibility reason */
 
@@ -87,6 +92,61 @@
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Glyph atlas shelf structure
+ */
+typedef struct __orxFONT_SHELF_t
+{
+  struct __orxFONT_CACHED_GLYPH_t  *pstGlyphList;   /**< Glyph list : 4 */
+  orxU32                            u32X;           /**< Next free horizontal position : 8 */
+  orxU32                            u32Y;           /**< Vertical position : 12 */
+  orxU32                            u32Stamp;       /**< Frame of last use : 16 */
+
+} orxFONT_SHELF;
+
+/** Cached glyph structure
+ */
+typedef struct __orxFONT_CACHED_GLYPH_t
+{
+  orxCHARACTER_GLYPH                stGlyph;        /**< Glyph, first structure member : 12 */
+  struct __orxFONT_CACHED_GLYPH_t  *pstNext;        /**< Next glyph on the same shelf : 16 */
+  orxFONT_SHELF                    *pstShelf;       /**< Shelf : 20 */
+  orxU32                            u32CodePoint;   /**< Character code point : 24 */
+  orxU32                            u32Serial;      /**< Serial, used to discard outdated renderings : 28 */
+
+} orxFONT_CACHED_GLYPH;
+
+/** Glyph cache structure, can outlive its font while glyphs are still rendering
+ */
+typedef struct __orxFONT_CACHE_t
+{
+  struct __orxFONT_t               *pstFont;        /**< Font, orxNULL once detached : 4 */
+  orxBITMAP                        *pstBitmap;      /**< Atlas bitmap : 8 */
+  orxHANDLE                         hTypeface;      /**< Typeface : 12 */
+  orxBANK                          *pstGlyphBank;   /**< Glyph bank : 16 */
+  orxFONT_SHELF                    *astShelfList;   /**< Shelf list : 20 */
+  orxU32                            u32ShelfCount;  /**< Shelf count : 24 */
+  orxU32                            u32Width;       /**< Atlas width : 28 */
+  orxU32                            u32CellHeight;  /**< Cell height : 32 */
+  orxU32                            u32SpacingX;    /**< Horizontal spacing : 36 */
+  orxU32                            u32Serial;      /**< Glyph serial counter : 40 */
+  orxU32                            u32TaskCount;   /**< Pending task count : 44 */
+  orxBOOL                           bFull;          /**< Full status, used to log only once : 48 */
+
+} orxFONT_CACHE;
+
+/** Glyph task structure, followed by the glyph's pixels
+ */
+typedef struct __orxFONT_GLYPH_TASK_t
+{
+  orxFONT_CACHE                    *pstCache;       /**< Cache : 4 */
+  orxU8                            *pu8Data;        /**< Pixel data : 8 */
+  orxU32                            u32CodePoint;   /**< Character code point : 12 */
+  orxU32                            u32Serial;      /**< Glyph serial : 16 */
+  orxU32                            u32Width;       /**< Width : 20 */
+  orxU32                            u32Height;      /**< Height : 24 */
+
+} orxFONT_GLYPH_TASK;
+
 /** Font structure
  */
 struct __orxFONT_t
@@ -105,6 +165,7 @@ struct __orxFONT_t
   const orxSTRING   zReference;                 /**< Config reference : 84 */
   const orxSTRING   zTypeface;                  /**< Typeface : 88 */
   orxSHADER        *pstShader;                  /**< Shader : 92 */
+  orxFONT_CACHE    *pstCache;                   /**< Glyph cache : 96 */
 };
 
 /** Static structure
@@ -117,6 +178,8 @@ typedef struct __orxFONT_STATIC_t
   orxU32            u32Flags;                   /**< Control flags : 16 */
   const orxSTRING   zANSICharacterList;         /**< ANSI character list : 20 */
   const orxSTRING   zASCIICharacterList;        /**< ASCII character list : 24 */
+  orxU32            u32FrameCount;              /**< Current frame count : 28 */
+  orxU32            u32TaskCount;               /**< Pending glyph task count : 32 */
 
 } orxFONT_STATIC;
 
@@ -142,8 +205,9 @@ static void orxFASTCALL orxFont_UpdateMap(orxFONT *_pstFont)
   /* Check */
   orxSTRUCTURE_ASSERT(_pstFont);
 
-  /* Can update? */
-  if(orxStructure_TestFlags(_pstFont, orxFONT_KU32_FLAG_CAN_UPDATE_MAP))
+  /* Can update and not dynamic? */
+  if((orxStructure_TestFlags(_pstFont, orxFONT_KU32_FLAG_CAN_UPDATE_MAP))
+  && (_pstFont->pstCache == orxNULL))
   {
     /* Clears UTF-8 table */
     orxHashTable_Clear(_pstFont->pstMap->pstCharacterTable);
@@ -236,6 +300,428 @@ static void orxFASTCALL orxFont_UpdateMap(orxFONT *_pstFont)
   return;
 }
 
+/** Deletes a glyph cache
+ * @param[in]   _pstCache       Concerned cache
+ */
+static void orxFASTCALL orxFont_DeleteGlyphCache(orxFONT_CACHE *_pstCache)
+{
+  /* Checks */
+  orxASSERT(_pstCache != orxNULL);
+  orxASSERT(_pstCache->u32TaskCount == 0);
+
+  /* Deletes its typeface */
+  orxDisplay_DeleteTypeface(_pstCache->hTypeface);
+
+  /* Deletes its glyph bank */
+  orxBank_Delete(_pstCache->pstGlyphBank);
+
+  /* Frees it (along with its shelves) */
+  orxMemory_Free(_pstCache);
+
+  /* Done! */
+  return;
+}
+
+/** Creates a glyph cache
+ * @param[in]   _pstFont        Concerned font, its texture and character height need to be set
+ * @param[in]   _hTypeface      Typeface used to render glyphs
+ * @param[in]   _pstBitmap      Atlas bitmap
+ * @param[in]   _pvSpacing      Character spacing
+ * @return      orxFONT_CACHE / orxNULL
+ */
+static orxFONT_CACHE *orxFASTCALL orxFont_CreateGlyphCache(orxFONT *_pstFont, orxHANDLE _hTypeface, orxBITMAP *_pstBitmap, const orxVECTOR *_pvSpacing)
+{
+  orxU32          u32Width, u32Height, u32CellHeight, u32SpacingX, u32SpacingY, u32ShelfCount;
+  orxFONT_CACHE  *pstResult = orxNULL;
+
+  /* Gets atlas metrics */
+  u32Width      = orxF2U(_pstFont->fWidth);
+  u32Height     = orxF2U(_pstFont->fHeight);
+  u32CellHeight = orxF2U(orxMath_Ceil(_pstFont->fCharacterHeight));
+  u32SpacingX   = orxF2U(orxMAX(orxFLOAT_0, _pvSpacing->fX));
+  u32SpacingY   = orxF2U(orxMAX(orxFLOAT_0, _pvSpacing->fY));
+
+  /* Gets shelf count */
+  u32ShelfCount = ((u32CellHeight != 0) && (u32Height > u32SpacingY)) ? (u32Height - u32SpacingY) / (u32CellHeight + u32SpacingY) : 0;
+
+  /* Valid? */
+  if(u32ShelfCount != 0)
+  {
+    /* Allocates cache along with its shelves */
+    pstResult = (orxFONT_CACHE *)orxMemory_Allocate(sizeof(orxFONT_CACHE) + u32ShelfCount * sizeof(orxFONT_SHELF), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(pstResult != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstResult, sizeof(orxFONT_CACHE) + u32ShelfCount * sizeof(orxFONT_SHELF));
+
+      /* Creates its glyph bank */
+      pstResult->pstGlyphBank = orxBank_Create(orxFONT_KU32_GLYPH_BANK_SIZE, sizeof(orxFONT_CACHED_GLYPH), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(pstResult->pstGlyphBank != orxNULL)
+      {
+        orxU32 i;
+
+        /* Stores its properties */
+        pstResult->pstFont        = _pstFont;
+        pstResult->pstBitmap      = _pstBitmap;
+        pstResult->hTypeface      = _hTypeface;
+        pstResult->astShelfList   = (orxFONT_SHELF *)(pstResult + 1);
+        pstResult->u32ShelfCount  = u32ShelfCount;
+        pstResult->u32Width       = u32Width;
+        pstResult->u32CellHeight  = u32CellHeight;
+        pstResult->u32SpacingX    = u32SpacingX;
+
+        /* For all shelves */
+        for(i = 0; i < u32ShelfCount; i++)
+        {
+          /* Inits it */
+          pstResult->astShelfList[i].u32X = u32SpacingX;
+          pstResult->astShelfList[i].u32Y = u32SpacingY + i * (u32CellHeight + u32SpacingY);
+        }
+
+        /* Stores character height */
+        _pstFont->pstMap->fCharacterHeight = _pstFont->fCharacterHeight;
+      }
+      else
+      {
+        /* Frees cache */
+        orxMemory_Free(pstResult);
+        pstResult = orxNULL;
+      }
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "[%s] Atlas of size (%u, %u) is too small for characters of height %g.", _pstFont->zReference, u32Width, u32Height, _pstFont->fCharacterHeight);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Detaches a font's glyph cache, which will be deleted as soon as none of its glyphs are rendering anymore
+ * @param[in]   _pstFont        Concerned font
+ */
+static void orxFASTCALL orxFont_DetachGlyphCache(orxFONT *_pstFont)
+{
+  orxFONT_CACHE *pstCache;
+
+  /* Gets cache */
+  pstCache = _pstFont->pstCache;
+
+  /* Valid? */
+  if(pstCache != orxNULL)
+  {
+    /* Clears character table (its glyphs belong to the cache) */
+    orxHashTable_Clear(_pstFont->pstMap->pstCharacterTable);
+
+    /* Detaches it */
+    pstCache->pstFont   = orxNULL;
+    pstCache->pstBitmap = orxNULL;
+    _pstFont->pstCache  = orxNULL;
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstFont, orxFONT_KU32_FLAG_NONE, orxFONT_KU32_FLAG_DYNAMIC);
+
+    /* No pending task? */
+    if(pstCache->u32TaskCount == 0)
+    {
+      /* Deletes it */
+      orxFont_DeleteGlyphCache(pstCache);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Renders a glyph (task run callback, executed on a worker thread)
+ * @param[in]   _pContext       Glyph task
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFont_RenderGlyphTask(void *_pContext)
+{
+  orxFONT_GLYPH_TASK *pstTask;
+  orxFLOAT            fWidth;
+  orxSTATUS           eResult;
+
+  /* Gets task */
+  pstTask = (orxFONT_GLYPH_TASK *)_pContext;
+
+  /* Renders glyph */
+  eResult = orxDisplay_RenderGlyph(pstTask->pstCache->hTypeface, pstTask->u32CodePoint, &fWidth, pstTask->pu8Data);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Cleans a glyph task (task else callback)
+ * @param[in]   _pContext       Glyph task
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFont_CleanGlyphTask(void *_pContext)
+{
+  orxFONT_GLYPH_TASK *pstTask;
+  orxFONT_CACHE      *pstCache;
+
+  /* Gets task & cache */
+  pstTask   = (orxFONT_GLYPH_TASK *)_pContext;
+  pstCache  = pstTask->pstCache;
+
+  /* Frees task */
+  orxMemory_Free(pstTask);
+
+  /* Updates counts */
+  pstCache->u32TaskCount--;
+  sstFont.u32TaskCount--;
+
+  /* Detached and last pending task? */
+  if((pstCache->pstFont == orxNULL) && (pstCache->u32TaskCount == 0))
+  {
+    /* Deletes cache */
+    orxFont_DeleteGlyphCache(pstCache);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Uploads a rendered glyph to its atlas (task then callback)
+ * @param[in]   _pContext       Glyph task
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFont_UploadGlyphTask(void *_pContext)
+{
+  orxFONT_GLYPH_TASK *pstTask;
+  orxFONT_CACHE      *pstCache;
+
+  /* Gets task & cache */
+  pstTask   = (orxFONT_GLYPH_TASK *)_pContext;
+  pstCache  = pstTask->pstCache;
+
+  /* Still attached? */
+  if(pstCache->pstFont != orxNULL)
+  {
+    const orxFONT_CACHED_GLYPH *pstGlyph;
+
+    /* Gets glyph */
+    pstGlyph = (const orxFONT_CACHED_GLYPH *)orxHashTable_Get(pstCache->pstFont->pstMap->pstCharacterTable, pstTask->u32CodePoint);
+
+    /* Hasn't been evicted meanwhile? */
+    if((pstGlyph != orxNULL) && (pstGlyph->u32Serial == pstTask->u32Serial))
+    {
+      /* Uploads it */
+      orxDisplay_SetPartialBitmapData(pstCache->pstBitmap, pstTask->pu8Data, orxF2U(pstGlyph->stGlyph.fX), orxF2U(pstGlyph->stGlyph.fY), pstTask->u32Width, pstTask->u32Height);
+    }
+  }
+
+  /* Cleans task */
+  return orxFont_CleanGlyphTask(_pContext);
+}
+
+/** Evicts all the glyphs of a shelf
+ * @param[in]   _pstCache       Concerned cache
+ * @param[in]   _pstShelf       Concerned shelf
+ */
+static void orxFASTCALL orxFont_ClearShelf(orxFONT_CACHE *_pstCache, orxFONT_SHELF *_pstShelf)
+{
+  orxFONT_CACHED_GLYPH *pstGlyph, *pstNextGlyph;
+  orxU8                *pu8Data;
+  orxU32                u32Size;
+
+  /* For all its glyphs */
+  for(pstGlyph = _pstShelf->pstGlyphList; pstGlyph != orxNULL; pstGlyph = pstNextGlyph)
+  {
+    /* Gets next glyph */
+    pstNextGlyph = pstGlyph->pstNext;
+
+    /* Removes it from character table */
+    orxHashTable_Remove(_pstCache->pstFont->pstMap->pstCharacterTable, pstGlyph->u32CodePoint);
+
+    /* Frees it */
+    orxBank_Free(_pstCache->pstGlyphBank, pstGlyph);
+  }
+
+  /* Resets shelf */
+  _pstShelf->pstGlyphList = orxNULL;
+  _pstShelf->u32X         = _pstCache->u32SpacingX;
+
+  /* Allocates blank row */
+  u32Size = _pstCache->u32Width * _pstCache->u32CellHeight * 4;
+  pu8Data = (orxU8 *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if(pu8Data != orxNULL)
+  {
+    /* Clears shelf's pixels, so that no stale glyph is displayed until new ones have been rendered */
+    orxMemory_Zero(pu8Data, u32Size);
+    orxDisplay_SetPartialBitmapData(_pstCache->pstBitmap, pu8Data, 0, _pstShelf->u32Y, _pstCache->u32Width, _pstCache->u32CellHeight);
+
+    /* Frees it */
+    orxMemory_Free(pu8Data);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Requests a glyph from a dynamic font: if not already cached, it gets a spot in the atlas right away and is rendered asynchronously
+ * @param[in]   _pstFont                Concerned font
+ * @param[in]   _u32CharacterCodePoint  Character code point
+ * @return      orxCHARACTER_GLYPH / orxNULL
+ */
+static orxCHARACTER_GLYPH *orxFASTCALL orxFont_RequestGlyph(const orxFONT *_pstFont, orxU32 _u32CharacterCodePoint)
+{
+  orxFONT_CACHE        *pstCache;
+  orxFONT_CACHED_GLYPH *pstGlyph;
+
+  /* Gets cache */
+  pstCache = _pstFont->pstCache;
+
+  /* Checks */
+  orxASSERT(pstCache != orxNULL);
+
+  /* Gets glyph */
+  pstGlyph = (orxFONT_CACHED_GLYPH *)orxHashTable_Get(_pstFont->pstMap->pstCharacterTable, _u32CharacterCodePoint);
+
+  /* Found? */
+  if(pstGlyph != orxNULL)
+  {
+    /* Marks its shelf as used */
+    pstGlyph->pstShelf->u32Stamp = sstFont.u32FrameCount;
+  }
+  else
+  {
+    orxFLOAT fWidth;
+
+    /* Gets glyph's width */
+    if(orxDisplay_RenderGlyph(pstCache->hTypeface, _u32CharacterCodePoint, &fWidth, orxNULL) != orxSTATUS_FAILURE)
+    {
+      orxFONT_SHELF  *pstShelf = orxNULL, *pstOldestShelf = orxNULL;
+      orxU32          u32Width, i;
+
+      /* Gets its pixel width */
+      u32Width = orxF2U(fWidth);
+
+      /* For all shelves */
+      for(i = 0; i < pstCache->u32ShelfCount; i++)
+      {
+        orxFONT_SHELF *pstCurrentShelf;
+
+        /* Gets it */
+        pstCurrentShelf = &(pstCache->astShelfList[i]);
+
+        /* Has enough room? */
+        if(pstCurrentShelf->u32X + u32Width <= pstCache->u32Width)
+        {
+          /* Selects it */
+          pstShelf = pstCurrentShelf;
+          break;
+        }
+
+        /* Not used during the last two frames and least recently used one? */
+        if((pstCurrentShelf->u32Stamp + 1 < sstFont.u32FrameCount)
+        && ((pstOldestShelf == orxNULL) || (pstCurrentShelf->u32Stamp < pstOldestShelf->u32Stamp)))
+        {
+          /* Stores it */
+          pstOldestShelf = pstCurrentShelf;
+        }
+      }
+
+      /* No room left but found an evictable shelf? */
+      if((pstShelf == orxNULL) && (pstOldestShelf != orxNULL) && (pstCache->u32SpacingX + u32Width <= pstCache->u32Width))
+      {
+        /* Evicts its glyphs */
+        orxFont_ClearShelf(pstCache, pstOldestShelf);
+
+        /* Selects it */
+        pstShelf = pstOldestShelf;
+      }
+
+      /* Found a spot? */
+      if(pstShelf != orxNULL)
+      {
+        /* Allocates glyph */
+        pstGlyph = (orxFONT_CACHED_GLYPH *)orxBank_Allocate(pstCache->pstGlyphBank);
+
+        /* Checks */
+        orxASSERT(pstGlyph != orxNULL);
+
+        /* Inits it */
+        pstGlyph->stGlyph.fX      = orxU2F(pstShelf->u32X);
+        pstGlyph->stGlyph.fY      = orxU2F(pstShelf->u32Y);
+        pstGlyph->stGlyph.fWidth  = fWidth;
+        pstGlyph->pstShelf        = pstShelf;
+        pstGlyph->u32CodePoint    = _u32CharacterCodePoint;
+        pstGlyph->u32Serial       = ++(pstCache->u32Serial);
+
+        /* Adds it to its shelf */
+        pstGlyph->pstNext       = pstShelf->pstGlyphList;
+        pstShelf->pstGlyphList  = pstGlyph;
+        pstShelf->u32X         += u32Width + pstCache->u32SpacingX;
+        pstShelf->u32Stamp      = sstFont.u32FrameCount;
+
+        /* Adds it to character table */
+        orxHashTable_Add(_pstFont->pstMap->pstCharacterTable, _u32CharacterCodePoint, pstGlyph);
+
+        /* Has pixels? */
+        if(u32Width != 0)
+        {
+          orxFONT_GLYPH_TASK *pstTask;
+
+          /* Allocates task along with its pixels */
+          pstTask = (orxFONT_GLYPH_TASK *)orxMemory_Allocate(sizeof(orxFONT_GLYPH_TASK) + u32Width * pstCache->u32CellHeight * 4, orxMEMORY_TYPE_MAIN);
+
+          /* Success? */
+          if(pstTask != orxNULL)
+          {
+            /* Inits it */
+            pstTask->pstCache     = pstCache;
+            pstTask->pu8Data      = (orxU8 *)(pstTask + 1);
+            pstTask->u32CodePoint = _u32CharacterCodePoint;
+            pstTask->u32Serial    = pstGlyph->u32Serial;
+            pstTask->u32Width     = u32Width;
+            pstTask->u32Height    = pstCache->u32CellHeight;
+
+            /* Clears pixels (the renderer may not fill the whole rounded up cell) */
+            orxMemory_Zero(pstTask->pu8Data, u32Width * pstCache->u32CellHeight * 4);
+
+            /* Updates counts */
+            pstCache->u32TaskCount++;
+            sstFont.u32TaskCount++;
+
+            /* Couldn't render it asynchronously? */
+            if(orxThread_RunTask(orxFont_RenderGlyphTask, orxFont_UploadGlyphTask, orxFont_CleanGlyphTask, pstTask) == orxSTATUS_FAILURE)
+            {
+              /* Cleans task */
+              orxFont_CleanGlyphTask(pstTask);
+            }
+          }
+        }
+      }
+      else
+      {
+        /* First time? */
+        if(pstCache->bFull == orxFALSE)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "[%s] Glyph atlas is full, couldn't cache character <0x%X>: consider increasing its %s.", _pstFont->zReference, _u32CharacterCodePoint, orxFONT_KZ_CONFIG_ATLAS_SIZE);
+
+          /* Updates status */
+          pstCache->bFull = orxTRUE;
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return (orxCHARACTER_GLYPH *)pstGlyph;
+}
+
 /* Creates default font
  */
 static orxINLINE void orxFont_CreateDefaultFont()
@@ -385,6 +871,9 @@ static orxSTATUS orxFASTCALL orxFont_ProcessConfigData(orxFONT *_pstFont)
     const orxSTRING zName;
     orxBOOL         bSDF;
 
+    /* Detaches current glyph cache, if any */
+    orxFont_DetachGlyphCache(_pstFont);
+
     /* Pushes its config section */
     orxConfig_PushSection(_pstFont->zReference);
 
@@ -399,7 +888,8 @@ static orxSTATUS orxFASTCALL orxFont_ProcessConfigData(orxFONT *_pstFont)
     {
       orxVECTOR       vCharacterSize, vCharacterSpacing, vCharacterPadding;
       const orxSTRING zCharacterList;
-      orxBITMAP      *pstBitmap;
+      orxBITMAP      *pstBitmap = orxNULL;
+      orxHANDLE       hTypeface = orxHANDLE_UNDEFINED;
       orxFLOAT       *afCharacterWidthList;
       orxU32          u32CharacterCount;
 
@@ -455,8 +945,60 @@ static orxSTATUS orxFASTCALL orxFont_ProcessConfigData(orxFONT *_pstFont)
       afCharacterWidthList = (orxFLOAT *)orxMemory_StackAllocate(u32CharacterCount * sizeof(orxFLOAT));
       orxASSERT(afCharacterWidthList != orxNULL);
 
-      /* Loads font bitmap */
-      pstBitmap = orxDisplay_LoadFont(zName, zCharacterList, &vCharacterSize, &vCharacterSpacing, &vCharacterPadding, bSDF, afCharacterWidthList);
+      /* Dynamic? */
+      if(orxConfig_GetBool(orxFONT_KZ_CONFIG_DYNAMIC) != orxFALSE)
+      {
+        /* Loads typeface */
+        hTypeface = orxDisplay_LoadTypeface(zName, &vCharacterSize, &vCharacterPadding, bSDF);
+
+        /* Success? */
+        if((hTypeface != orxHANDLE_UNDEFINED) && (hTypeface != orxNULL))
+        {
+          orxVECTOR vAtlasSize;
+
+          /* Gets atlas size */
+          if(orxConfig_GetVector(orxFONT_KZ_CONFIG_ATLAS_SIZE, &vAtlasSize) == orxNULL)
+          {
+            /* Uses default size */
+            orxVector_Set(&vAtlasSize, orxFONT_KV_DEFAULT_ATLAS_SIZE);
+          }
+
+          /* Creates atlas bitmap */
+          pstBitmap = orxDisplay_CreateBitmap(orxF2U(vAtlasSize.fX), orxF2U(vAtlasSize.fY));
+
+          /* Success? */
+          if(pstBitmap != orxNULL)
+          {
+            /* Clears it */
+            orxDisplay_ClearBitmap(pstBitmap, orx2RGBA(0x00, 0x00, 0x00, 0x00));
+          }
+          else
+          {
+            /* Deletes typeface */
+            orxDisplay_DeleteTypeface(hTypeface);
+            hTypeface = orxHANDLE_UNDEFINED;
+          }
+        }
+        else
+        {
+          /* Clears typeface */
+          hTypeface = orxHANDLE_UNDEFINED;
+        }
+
+        /* Failure? */
+        if(pstBitmap == orxNULL)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "[%s] Couldn't create glyph atlas for typeface (%s): reverting to static rendering.", _pstFont->zReference, zName);
+        }
+      }
+
+      /* Not dynamic? */
+      if(pstBitmap == orxNULL)
+      {
+        /* Loads font bitmap */
+        pstBitmap = orxDisplay_LoadFont(zName, zCharacterList, &vCharacterSize, &vCharacterSpacing, &vCharacterPadding, bSDF, afCharacterWidthList);
+      }
 
       /* Success? */
       if(pstBitmap != orxNULL)
@@ -493,9 +1035,15 @@ static orxSTATUS orxFASTCALL orxFont_ProcessConfigData(orxFONT *_pstFont)
               /* Sets character list */
               orxFont_SetCharacterList(_pstFont, zCharacterList);
 
-              /* Sets character height & width list */
+              /* Sets character height */
               orxFont_SetCharacterHeight(_pstFont, vCharacterSize.fY);
-              orxFont_SetCharacterWidthList(_pstFont, u32CharacterCount, afCharacterWidthList);
+
+              /* Not dynamic? */
+              if(hTypeface == orxHANDLE_UNDEFINED)
+              {
+                /* Sets character width list */
+                orxFont_SetCharacterWidthList(_pstFont, u32CharacterCount, afCharacterWidthList);
+              }
 
               /* Removes shader */
               orxFont_SetShaderFromConfig(_pstFont, orxNULL);
@@ -508,6 +1056,34 @@ static orxSTATUS orxFASTCALL orxFont_ProcessConfigData(orxFONT *_pstFont)
 
               /* Updates result */
               eResult = orxSTATUS_SUCCESS;
+
+              /* Dynamic? */
+              if(hTypeface != orxHANDLE_UNDEFINED)
+              {
+                /* Creates its glyph cache */
+                _pstFont->pstCache = orxFont_CreateGlyphCache(_pstFont, hTypeface, pstBitmap, &vCharacterSpacing);
+
+                /* Success? */
+                if(_pstFont->pstCache != orxNULL)
+                {
+                  /* Updates flags */
+                  orxStructure_SetFlags(_pstFont, orxFONT_KU32_FLAG_DYNAMIC, orxFONT_KU32_FLAG_NONE);
+
+                  /* Transfers typeface ownership */
+                  hTypeface = orxHANDLE_UNDEFINED;
+                }
+                else
+                {
+                  /* Logs message */
+                  orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "[%s] Couldn't create glyph cache for typeface (%s).", _pstFont->zReference, zName);
+
+                  /* Unlinks texture */
+                  orxFont_SetTexture(_pstFont, orxNULL);
+
+                  /* Updates result */
+                  eResult = orxSTATUS_FAILURE;
+                }
+              }
             }
             else
             {
@@ -533,6 +1109,13 @@ static orxSTATUS orxFASTCALL orxFont_ProcessConfigData(orxFONT *_pstFont)
         /* Logs message */
         orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "[%s] Couldn't load typeface (%s): invalid or missing.", _pstFont->zReference, zName);
       }
+
+      /* Has unused typeface? */
+      if(hTypeface != orxHANDLE_UNDEFINED)
+      {
+        /* Deletes it */
+        orxDisplay_DeleteTypeface(hTypeface);
+      }
     }
     else
     {
@@ -785,6 +1368,13 @@ static orxSTATUS orxFASTCALL orxFont_ProcessConfigData(orxFONT *_pstFont)
 
       /* Updates its map */
       orxFont_UpdateMap(_pstFont);
+
+      /* Dynamic? */
+      if(_pstFont->pstCache != orxNULL)
+      {
+        /* Preloads its character list */
+        orxFont_CacheCharacters(_pstFont, _pstFont->zCharacterList);
+      }
     }
 
     /* Pops config section */
@@ -836,6 +1426,21 @@ static orxSTATUS orxFASTCALL orxFont_EventHandler(const orxEVENT *_pstEvent)
   return eResult;
 }
 
+/** System event handler
+ */
+static orxSTATUS orxFASTCALL orxFont_SystemEventHandler(const orxEVENT *_pstEvent)
+{
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_SYSTEM);
+  orxASSERT(_pstEvent->eID == orxSYSTEM_EVENT_GAME_LOOP_START);
+
+  /* Stores frame count, used to find least recently used glyphs */
+  sstFont.u32FrameCount = ((orxSYSTEM_EVENT_PAYLOAD *)_pstEvent->pstPayload)->u32FrameCount;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 /** Deletes all fonts
  */
 static orxINLINE void orxFont_DeleteAll()
@@ -876,7 +1481,9 @@ void orxFASTCALL orxFont_Setup()
   orxModule_AddDependency(orxMODULE_ID_FONT, orxMODULE_ID_RESOURCE);
   orxModule_AddDependency(orxMODULE_ID_FONT, orxMODULE_ID_SHADER);
   orxModule_AddDependency(orxMODULE_ID_FONT, orxMODULE_ID_STRUCTURE);
+  orxModule_AddDependency(orxMODULE_ID_FONT, orxMODULE_ID_SYSTEM);
   orxModule_AddDependency(orxMODULE_ID_FONT, orxMODULE_ID_TEXTURE);
+  orxModule_AddDependency(orxMODULE_ID_FONT, orxMODULE_ID_THREAD);
 
   /* Done! */
   return;
@@ -941,6 +1548,8 @@ orxSTATUS orxFASTCALL orxFont_Init()
     /* Adds event handler */
     orxEvent_AddHandler(orxEVENT_TYPE_RESOURCE, orxFont_EventHandler);
     orxEvent_SetHandlerIDFlags(orxFont_EventHandler, orxEVENT_TYPE_RESOURCE, orxNULL, orxEVENT_GET_FLAG(orxRESOURCE_EVENT_ADD) | orxEVENT_GET_FLAG(orxRESOURCE_EVENT_UPDATE), orxEVENT_KU32_MASK_ID_ALL);
+    orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, orxFont_SystemEventHandler);
+    orxEvent_SetHandlerIDFlags(orxFont_SystemEventHandler, orxEVENT_TYPE_SYSTEM, orxNULL, orxEVENT_GET_FLAG(orxSYSTEM_EVENT_GAME_LOOP_START), orxEVENT_KU32_MASK_ID_ALL);
   }
   else
   {
@@ -978,8 +1587,9 @@ void orxFASTCALL orxFont_Exit()
   /* Initialized? */
   if(sstFont.u32Flags & orxFONT_KU32_STATIC_FLAG_READY)
   {
-    /* Removes event handler */
+    /* Removes event handlers */
     orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, orxFont_EventHandler);
+    orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxFont_SystemEventHandler);
 
     /* Deletes default font */
     if(sstFont.pstDefaultFont != orxNULL)
@@ -995,6 +1605,14 @@ void orxFASTCALL orxFont_Exit()
     /* Deletes font list */
     orxFont_DeleteAll();
 
+    /* While glyphs are still rendering */
+    while(sstFont.u32TaskCount != 0)
+    {
+      /* Lets pending tasks complete (will pump their notifications) */
+      orxThread_GetTaskCount();
+      orxThread_Yield();
+    }
+
     /* Deletes reference table */
     orxHashTable_Delete(sstFont.pstReferenceTable);
     sstFont.pstReferenceTable = orxNULL;
@@ -1309,6 +1927,9 @@ orxSTATUS orxFASTCALL orxFont_SetTexture(orxFONT *_pstFont, orxTEXTURE *_pstText
   orxASSERT(sstFont.u32Flags & orxFONT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstFont);
 
+  /* Detaches glyph cache, if any */
+  orxFont_DetachGlyphCache(_pstFont);
+
   /* Had previous texture? */
   if(_pstFont->pstTexture != orxNULL)
   {
@@ -1761,8 +2382,24 @@ orxFLOAT orxFASTCALL orxFont_GetCharacterWidth(const orxFONT *_pstFont, orxU32 _
   orxASSERT(sstFont.u32Flags & orxFONT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstFont);
 
-  /* Gets glyph */
-  pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstFont->pstMap->pstCharacterTable, _u32CharacterCodePoint);
+  /* Dynamic? */
+  if(_pstFont->pstCache != orxNULL)
+  {
+    /* Requests glyph */
+    pstGlyph = orxFont_RequestGlyph(_pstFont, _u32CharacterCodePoint);
+
+    /* Couldn't cache it? */
+    if(pstGlyph == orxNULL)
+    {
+      /* Gets its width directly from the typeface */
+      orxDisplay_RenderGlyph(_pstFont->pstCache->hTypeface, _u32CharacterCodePoint, &fResult, orxNULL);
+    }
+  }
+  else
+  {
+    /* Gets glyph */
+    pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstFont->pstMap->pstCharacterTable, _u32CharacterCodePoint);
+  }
 
   /* Valid? */
   if(pstGlyph != orxNULL)
@@ -1876,6 +2513,74 @@ orxBOOL orxFASTCALL orxFont_IsSDF(const orxFONT *_pstFont)
   return bResult;
 }
 
+/** Is Font dynamic (glyphs are rendered on demand in an atlas)?
+ * @param[in]   _pstFont      Concerned font
+ * @return      orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxFont_IsDynamic(const orxFONT *_pstFont)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(sstFont.u32Flags & orxFONT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstFont);
+
+  /* Updates result */
+  bResult = orxStructure_TestFlags(_pstFont, orxFONT_KU32_FLAG_DYNAMIC);
+
+  /* Done! */
+  return bResult;
+}
+
+/** Makes sure all the characters of a string are available in a dynamic font's atlas, missing ones will be rendered asynchronously and become visible a frame later
+ * @param[in]   _pstFont      Concerned font
+ * @param[in]   _zString      String whose characters will be used
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxFont_CacheCharacters(const orxFONT *_pstFont, const orxSTRING _zString)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstFont.u32Flags & orxFONT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstFont);
+  orxASSERT(_zString != orxNULL);
+
+  /* Dynamic? */
+  if(_pstFont->pstCache != orxNULL)
+  {
+    const orxCHAR  *pc;
+    orxU32          u32CharacterCodePoint;
+
+    /* For all characters */
+    for(u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(_zString, &pc);
+        u32CharacterCodePoint != orxCHAR_NULL;
+        u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(pc, &pc))
+    {
+      /* Invalid? */
+      if(u32CharacterCodePoint == orxU32_UNDEFINED)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+
+        break;
+      }
+
+      /* Not a line break and couldn't get glyph? */
+      if((u32CharacterCodePoint != orxCHAR_CR)
+      && (u32CharacterCodePoint != orxCHAR_LF)
+      && (orxFont_RequestGlyph(_pstFont, u32CharacterCodePoint) == orxNULL))
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Gets font's map
  * @param[in]   _pstFont      Concerned font
  * @return      orxCHARACTER_MAP / orxNULL
@@ -52,6 +52,7 @@
 /** Graphic flags
  */
 #define orxGRAPHIC_KU32_FLAG_INTERNAL             0x10000000  /**< Internal structure handling flag  */
+#define orxGRAPHIC_KU32_FLAG_ATLAS                0x20000000  /**< Atlas region flag  */
 #define orxGRAPHIC_KU32_FLAG_HAS_FLIP             0x01000000  /**< Has flip flag  */
 #define orxGRAPHIC_KU32_FLAG_HAS_COLOR            0x02000000  /**< Has color flag  */
 #define orxGRAPHIC_KU32_FLAG_HAS_BLEND_MODE       0x04000000  /**< Has blend mode flag  */
@@ -144,6 +145,109 @@ static orxGRAPHIC_STATIC sstGraphic;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Loads a graphic's texture, using its atlas page if the file is part of an atlas
+ * @param[in]   _zFileName      Name of the original bitmap file
+ * @param[in]   _bKeepInCache   Should be kept in cache after no more references exist?
+ * @param[out]  _pbAtlas        orxTRUE if the atlas page was loaded, orxFALSE if it's the original bitmap file
+ * @return      orxTEXTURE / orxNULL
+ */
+static orxINLINE orxTEXTURE *orxGraphic_LoadTexture(const orxSTRING _zFileName, orxBOOL _bKeepInCache, orxBOOL *_pbAtlas)
+{
+  const orxSTRING zPageName;
+  orxTEXTURE     *pstResult = orxNULL;
+
+  /* Clears status */
+  *_pbAtlas = orxFALSE;
+
+  /* Is part of an atlas? */
+  if(orxTexture_GetAtlasRegion(_zFileName, &zPageName, orxNULL, orxNULL) != orxSTATUS_FAILURE)
+  {
+    /* Loads its page */
+    pstResult = orxTexture_Load(zPageName, _bKeepInCache);
+
+    /* Success? */
+    if(pstResult != orxNULL)
+    {
+      /* Updates status */
+      *_pbAtlas = orxTRUE;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't load atlas page <%s> for <%s>: loading it directly instead.", zPageName, _zFileName);
+    }
+  }
+
+  /* No texture yet? */
+  if(pstResult == orxNULL)
+  {
+    /* Loads file as is */
+    pstResult = orxTexture_Load(_zFileName, _bKeepInCache);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Updates a graphic's texture region: atlas region, TextureOrigin/TextureCorner & TextureSize, needs the graphic's config section to be selected
+ * @param[in]   _pstGraphic     Concerned graphic, with its texture already linked
+ * @param[in]   _zFileName      Name of the original bitmap file
+ * @param[in]   _bAtlas         Is its texture the atlas page of the original bitmap file?
+ */
+static void orxFASTCALL orxGraphic_UpdateTextureRegion(orxGRAPHIC *_pstGraphic, const orxSTRING _zFileName, orxBOOL _bAtlas)
+{
+  orxVECTOR vValue, vAtlasOrigin, vAtlasSize;
+
+  /* Updates size */
+  orxGraphic_UpdateSize(_pstGraphic);
+
+  /* Is part of an atlas? */
+  if((_bAtlas != orxFALSE)
+  && (orxTexture_GetAtlasRegion(_zFileName, orxNULL, &vAtlasOrigin, &vAtlasSize) != orxSTATUS_FAILURE))
+  {
+    /* Restricts graphic to its region of the atlas page */
+    _pstGraphic->fLeft    = vAtlasOrigin.fX;
+    _pstGraphic->fTop     = vAtlasOrigin.fY;
+    _pstGraphic->fWidth   = vAtlasSize.fX;
+    _pstGraphic->fHeight  = vAtlasSize.fY;
+
+    /* Updates status */
+    orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_ATLAS, orxGRAPHIC_KU32_FLAG_NONE);
+  }
+  else
+  {
+    /* Clears atlas origin */
+    orxVector_Copy(&vAtlasOrigin, &orxVECTOR_0);
+
+    /* Updates status */
+    orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_NONE, orxGRAPHIC_KU32_FLAG_ATLAS);
+  }
+
+  /* Has origin / corner? */
+  if((orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_TEXTURE_ORIGIN, &vValue) != orxNULL)
+  || (orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_TEXTURE_CORNER, &vValue) != orxNULL))
+  {
+    /* Applies it, relative to the original bitmap */
+    _pstGraphic->fLeft    = vAtlasOrigin.fX + vValue.fX;
+    _pstGraphic->fTop     = vAtlasOrigin.fY + vValue.fY;
+
+    /* Updates size */
+    _pstGraphic->fWidth   = orxMAX(orxFLOAT_0, _pstGraphic->fWidth - vValue.fX);
+    _pstGraphic->fHeight  = orxMAX(orxFLOAT_0, _pstGraphic->fHeight - vValue.fY);
+  }
+
+  /* Has size? */
+  if(orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_TEXTURE_SIZE, &vValue) != orxNULL)
+  {
+    /* Applies it */
+    _pstGraphic->fWidth   = vValue.fX;
+    _pstGraphic->fHeight  = vValue.fY;
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Sets graphic data
  * @param[in]   _pstGraphic     Graphic concerned
  * @param[in]   _pstData        Data structure to set / orxNULL
@@ -256,6 +360,50 @@ static orxINLINE orxSTATUS orxGraphic_SetDataInternal(orxGRAPHIC *_pstGraphic, o
   return eResult;
 }
 
+/** Swaps a graphic's texture for another bitmap file (locale change / stasis), keeping its region in sync if an atlas is involved
+ * @param[in]   _pstGraphic     Concerned graphic
+ * @param[in]   _zFileName      Name of the new original bitmap file
+ * @param[in]   _bKeepInCache   Should be kept in cache after no more references exist?
+ */
+static void orxFASTCALL orxGraphic_SwapTexture(orxGRAPHIC *_pstGraphic, const orxSTRING _zFileName, orxBOOL _bKeepInCache)
+{
+  orxTEXTURE *pstTexture;
+  orxBOOL     bAtlas;
+
+  /* Loads texture */
+  pstTexture = orxGraphic_LoadTexture(_zFileName, _bKeepInCache, &bAtlas);
+
+  /* Valid? */
+  if(pstTexture != orxNULL)
+  {
+    /* Updates data */
+    if(orxGraphic_SetDataInternal(_pstGraphic, (orxSTRUCTURE *)pstTexture, orxTRUE) != orxSTATUS_FAILURE)
+    {
+      /* Uses or used an atlas region and has a config section? */
+      if(((bAtlas != orxFALSE) || (orxStructure_TestFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_ATLAS)))
+      && (_pstGraphic->zReference != orxNULL))
+      {
+        /* Pushes its section */
+        orxConfig_PushSection(_pstGraphic->zReference);
+
+        /* Updates its region */
+        orxGraphic_UpdateTextureRegion(_pstGraphic, _zFileName, bAtlas);
+
+        /* Pops config section */
+        orxConfig_PopSection();
+      }
+    }
+    else
+    {
+      /* Deletes texture */
+      orxTexture_Delete(pstTexture);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Event handler
  * @param[in]   _pstEvent                     Sent event
  * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
@@ -299,7 +447,6 @@ static orxSTATUS orxFASTCALL orxGraphic_EventHandler(const orxEVENT *_pstEvent)
         if((pstPayload->zGroup == orxNULL) || (orxString_Compare(pstPayload->zGroup, pstGraphic->zLocaleGroup) == 0))
         {
           const orxSTRING zName;
-          orxTEXTURE     *pstTexture;
 
           /* Retrieves name */
           zName = orxLocale_GetString(pstGraphic->zLocaleName, pstGraphic->zLocaleGroup);
@@ -317,15 +464,8 @@ static orxSTATUS orxFASTCALL orxGraphic_EventHandler(const orxEVENT *_pstEvent)
             /* Has quad data? */
             if(orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_QUAD))
             {
-              /* Loads texture */
-              pstTexture = orxTexture_Load(zName, orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_KEEP_IN_CACHE) ? orxTRUE : orxFALSE);
-
-              /* Valid? */
-              if(pstTexture != orxNULL)
-              {
-                /* Updates data */
-                orxGraphic_SetDataInternal(pstGraphic, (orxSTRUCTURE *)pstTexture, orxTRUE);
-              }
+              /* Swaps texture */
+              orxGraphic_SwapTexture(pstGraphic, zName, orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_KEEP_IN_CACHE) ? orxTRUE : orxFALSE);
             }
           }
         }
@@ -350,8 +490,8 @@ static orxSTATUS orxFASTCALL orxGraphic_EventHandler(const orxEVENT *_pstEvent)
         /* Checks */
         orxASSERT(pstGraphic->pstData == orxNULL);
 
-        /* Updates data */
-        orxGraphic_SetDataInternal(pstGraphic, (orxSTRUCTURE *)orxTexture_Load(pstGraphic->zDataReference, orxFALSE), orxTRUE);
+        /* Swaps texture */
+        orxGraphic_SwapTexture(pstGraphic, pstGraphic->zDataReference, orxFALSE);
       }
       /* Disable */
       else
@@ -702,6 +842,7 @@ orxGRAPHIC *orxFASTCALL orxGraphic_CreateFromConfig(const orxSTRING _zConfigID)
       if((zName != orxNULL) && (zName != orxSTRING_EMPTY))
       {
         orxTEXTURE *pstTexture;
+        orxBOOL     bAtlas;
 
         /* Begins with locale marker? */
         if(*zName == orxGRAPHIC_KC_LOCALE_MARKER)
@@ -733,7 +874,7 @@ orxGRAPHIC *orxFASTCALL orxGraphic_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Loads texture */
-        pstTexture = orxTexture_Load(zName, orxFLAG_TEST(u32Flags, orxGRAPHIC_KU32_FLAG_KEEP_IN_CACHE) ? orxTRUE : orxFALSE);
+        pstTexture = orxGraphic_LoadTexture(zName, orxFLAG_TEST(u32Flags, orxGRAPHIC_KU32_FLAG_KEEP_IN_CACHE) ? orxTRUE : orxFALSE, &bAtlas);
 
         /* Valid? */
         if(pstTexture != orxNULL)
@@ -744,31 +885,8 @@ orxGRAPHIC *orxFASTCALL orxGraphic_CreateFromConfig(const orxSTRING _zConfigID)
           /* Links it */
           if(orxGraphic_SetDataInternal(pstResult, (orxSTRUCTURE *)pstTexture, orxTRUE) != orxSTATUS_FAILURE)
           {
-            orxVECTOR vValue;
-
-            /* Updates size */
-            orxGraphic_UpdateSize(pstResult);
-
-            /* Has origin / corner? */
-            if((orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_TEXTURE_ORIGIN, &vValue) != orxNULL)
-            || (orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_TEXTURE_CORNER, &vValue) != orxNULL))
-            {
-              /* Applies it */
-              pstResult->fLeft    = vValue.fX;
-              pstResult->fTop     = vValue.fY;
-
-              /* Updates size */
-              pstResult->fWidth   = orxMAX(orxFLOAT_0, pstResult->fWidth - vValue.fX);
-              pstResult->fHeight  = orxMAX(orxFLOAT_0, pstResult->fHeight - vValue.fY);
-            }
-
-            /* Has size? */
-            if(orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_TEXTURE_SIZE, &vValue) != orxNULL)
-            {
-              /* Applies it */
-              pstResult->fWidth   = vValue.fX;
-              pstResult->fHeight  = vValue.fY;
-            }
+            /* Updates its region */
+            orxGraphic_UpdateTextureRegion(pstResult, zName, bAtlas);
 
             /* Has orientation? */
             if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_ORIENTATION) != orxFALSE)
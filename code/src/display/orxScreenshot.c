@@ -35,8 +35,13 @@
 #include "debug/orxDebug.h"
 #include "core/orxCommand.h"
 #include "core/orxConfig.h"
+#include "core/orxEvent.h"
+#include "core/orxResource.h"
+#include "core/orxThread.h"
 #include "display/orxDisplay.h"
+#include "display/orxTexture.h"
 #include "io/orxFile.h"
+#include "render/orxRender.h"
 #include "utils/orxString.h"
 #include "memory/orxMemory.h"
 
@@ -46,6 +51,7 @@
 #define orxSCREENSHOT_KU32_STATIC_FLAG_NONE                     0x00000000
 
 #define orxSCREENSHOT_KU32_STATIC_FLAG_READY                    0x00000001
+#define orxSCREENSHOT_KU32_STATIC_FLAG_RECORD                   0x00000002
 
 #define orxSCREENSHOT_KU32_STATIC_MASK_ALL                      0xFFFFFFFF
 
@@ -54,21 +60,44 @@
  */
 #define orxSCREENSHOT_KU32_BUFFER_SIZE                          256
 
+#define orxSCREENSHOT_KU32_DEFAULT_BUFFER_NUMBER                3
+
 #define orxSCREENSHOT_KZ_CONFIG_SECTION                         "Screenshot"
 #define orxSCREENSHOT_KZ_CONFIG_DIRECTORY                       "Directory"
 #define orxSCREENSHOT_KZ_CONFIG_BASE_NAME                       "BaseName"
 #define orxSCREENSHOT_KZ_CONFIG_EXTENSION                       "Extension"
 #define orxSCREENSHOT_KZ_CONFIG_DIGITS                          "Digits"
+#define orxSCREENSHOT_KZ_CONFIG_BUFFER_NUMBER                   "BufferNumber"
+#define orxSCREENSHOT_KZ_CONFIG_RECORD                          "Record"
 
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Staging buffer structure
+ */
+typedef struct __orxSCREENSHOT_BUFFER_t
+{
+  orxU8    *pu8Data;                                            /**< Pixel data */
+  orxHANDLE hResource;                                          /**< Destination resource */
+  orxU32    u32Size;                                            /**< Allocated size */
+  orxU32    u32Width;                                           /**< Width */
+  orxU32    u32Height;                                          /**< Height */
+  orxBOOL   bPending;                                           /**< Waiting for its encoding task? */
+  orxCHAR   acFileName[orxSCREENSHOT_KU32_BUFFER_SIZE];         /**< Destination file name */
+
+} orxSCREENSHOT_BUFFER;
+
 /** Static structure
  */
 typedef struct __orxSCREENSHOT_STATIC_t
 {
+  orxSCREENSHOT_BUFFER *astBufferList;                          /**< Staging buffer ring */
+  orxU32    u32BufferNumber;                                    /**< Number of staging buffers */
+  orxU32    u32BufferIndex;                                     /**< Next staging buffer to use */
+  orxU32    u32PendingCount;                                    /**< Number of staging buffers waiting for their encoding task */
+  orxU32    u32RecordCount;                                     /**< Remaining frames to record, 0 for no limit */
   orxU32    u32ScreenshotIndex;                                 /**< Screenshot index */
   orxU32    u32Flags;                                           /**< Control flags */
   orxCHAR   acScreenshotBuffer[orxSCREENSHOT_KU32_BUFFER_SIZE]; /**< Screenshot file name buffer */
@@ -103,6 +132,31 @@ void orxFASTCALL orxScreenshot_CommandCapture(orxU32 _u32ArgNumber, const orxCOM
   return;
 }
 
+/** Command: Record
+ */
+void orxFASTCALL orxScreenshot_CommandRecord(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Starts recording */
+  _pstResult->bValue = (orxScreenshot_Record((_u32ArgNumber > 0) ? _astArgList[0].u32Value : 0) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: Stop
+ */
+void orxFASTCALL orxScreenshot_CommandStop(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = orxScreenshot_IsRecording();
+
+  /* Stops recording */
+  orxScreenshot_StopRecording();
+
+  /* Done! */
+  return;
+}
+
 /** Computes next screenshot index
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
@@ -198,12 +252,282 @@ static orxINLINE orxSTATUS orxScreenshot_ComputeIndex()
   return eResult;
 }
 
+/** Encodes a staging buffer (run on a task worker)
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_EncodeBuffer(void *_pContext)
+{
+  orxSCREENSHOT_BUFFER *pstBuffer;
+  orxSTATUS             eResult;
+
+  /* Gets staging buffer */
+  pstBuffer = (orxSCREENSHOT_BUFFER *)_pContext;
+
+  /* Encodes it */
+  eResult = orxDisplay_EncodeBitmapData(pstBuffer->hResource, pstBuffer->u32Width, pstBuffer->u32Height, pstBuffer->pu8Data);
+
+  /* Closes resource */
+  orxResource_Close(pstBuffer->hResource);
+  pstBuffer->hResource = orxHANDLE_UNDEFINED;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Releases a staging buffer after a successful encoding (run on the main thread)
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_ReleaseBuffer(void *_pContext)
+{
+  orxSCREENSHOT_BUFFER *pstBuffer;
+
+  /* Gets staging buffer */
+  pstBuffer = (orxSCREENSHOT_BUFFER *)_pContext;
+
+  /* Logs */
+  orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Screenshot captured to [%s].", pstBuffer->acFileName);
+
+  /* Releases it */
+  pstBuffer->bPending = orxFALSE;
+  sstScreenshot.u32PendingCount--;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Releases a staging buffer after a failed encoding (run on the main thread)
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_DiscardBuffer(void *_pContext)
+{
+  orxSCREENSHOT_BUFFER *pstBuffer;
+
+  /* Gets staging buffer */
+  pstBuffer = (orxSCREENSHOT_BUFFER *)_pContext;
+
+  /* Logs message */
+  orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't save screenshot to [%s].", pstBuffer->acFileName);
+
+  /* Releases it */
+  pstBuffer->bPending = orxFALSE;
+  sstScreenshot.u32PendingCount--;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Gets next free staging buffer
+ * @param[in]   _bWait                                Wait for a pending buffer to be released if none are free?
+ * @return      orxSCREENSHOT_BUFFER / orxNULL
+ */
+static orxSCREENSHOT_BUFFER *orxFASTCALL orxScreenshot_GetFreeBuffer(orxBOOL _bWait)
+{
+  orxSCREENSHOT_BUFFER *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(sstScreenshot.u32BufferNumber != 0);
+
+  /* No free buffer? */
+  if(sstScreenshot.u32PendingCount == sstScreenshot.u32BufferNumber)
+  {
+    /* Pumps task notifications */
+    orxThread_GetTaskCount();
+
+    /* Should wait? */
+    if(_bWait != orxFALSE)
+    {
+      /* While all buffers are still being encoded */
+      while(sstScreenshot.u32PendingCount == sstScreenshot.u32BufferNumber)
+      {
+        /* Lets pending tasks complete (will pump their notifications) */
+        orxThread_Yield();
+        orxThread_GetTaskCount();
+      }
+    }
+  }
+
+  /* Has free buffer? */
+  if(sstScreenshot.u32PendingCount < sstScreenshot.u32BufferNumber)
+  {
+    orxU32 i;
+
+    /* Finds it, following the ring order */
+    for(i = 0; i < sstScreenshot.u32BufferNumber; i++)
+    {
+      orxSCREENSHOT_BUFFER *pstBuffer;
+
+      /* Gets buffer */
+      pstBuffer = &(sstScreenshot.astBufferList[(sstScreenshot.u32BufferIndex + i) % sstScreenshot.u32BufferNumber]);
+
+      /* Free? */
+      if(pstBuffer->bPending == orxFALSE)
+      {
+        /* Updates next index */
+        sstScreenshot.u32BufferIndex = (sstScreenshot.u32BufferIndex + i + 1) % sstScreenshot.u32BufferNumber;
+
+        /* Updates result */
+        pstResult = pstBuffer;
+
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Captures the screen into a staging buffer and queues its encoding
+ * @param[in]   _bWait                                Wait for a staging buffer to be free if none are available?
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_CaptureBuffer(orxBOOL _bWait)
+{
+  orxSCREENSHOT_BUFFER *pstBuffer;
+  orxSTATUS             eResult;
+
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Gets free staging buffer */
+  pstBuffer = orxScreenshot_GetFreeBuffer(_bWait);
+
+  /* Valid? */
+  if(pstBuffer != orxNULL)
+  {
+    /* Computes screenshot index (only once a buffer is available, so as to not skip any index) */
+    eResult = orxScreenshot_ComputeIndex();
+
+    /* Valid? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      const orxBITMAP  *pstScreen;
+      orxFLOAT          fWidth, fHeight;
+      orxU32            u32Size;
+
+      /* Gets screen size */
+      pstScreen = orxDisplay_GetScreenBitmap();
+      orxDisplay_GetBitmapSize(pstScreen, &fWidth, &fHeight);
+      pstBuffer->u32Width   = orxF2U(fWidth);
+      pstBuffer->u32Height  = orxF2U(fHeight);
+      u32Size               = pstBuffer->u32Width * pstBuffer->u32Height * sizeof(orxRGBA);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      /* Screen size changed? */
+      if(u32Size != pstBuffer->u32Size)
+      {
+        /* Frees previous data */
+        if(pstBuffer->pu8Data != orxNULL)
+        {
+          orxMemory_Free(pstBuffer->pu8Data);
+        }
+
+        /* Allocates new one */
+        pstBuffer->pu8Data  = (orxU8 *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_TEMP);
+        pstBuffer->u32Size  = (pstBuffer->pu8Data != orxNULL) ? u32Size : 0;
+      }
+
+      /* Grabs screen pixels */
+      if((pstBuffer->pu8Data != orxNULL)
+      && (orxDisplay_GetBitmapData(pstScreen, pstBuffer->pu8Data, u32Size) != orxSTATUS_FAILURE))
+      {
+        const orxSTRING zResourceLocation;
+
+        /* Valid file to open? */
+        if(((zResourceLocation = orxResource_LocateInStorage(orxTEXTURE_KZ_RESOURCE_GROUP, orxRESOURCE_KZ_DEFAULT_STORAGE, sstScreenshot.acScreenshotBuffer)) != orxNULL)
+        && ((pstBuffer->hResource = orxResource_Open(zResourceLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+        {
+          /* Stores file name */
+          orxString_NCopy(pstBuffer->acFileName, sstScreenshot.acScreenshotBuffer, sizeof(pstBuffer->acFileName) - 1);
+          pstBuffer->acFileName[sizeof(pstBuffer->acFileName) - 1] = orxCHAR_NULL;
+
+          /* Marks it as pending */
+          pstBuffer->bPending = orxTRUE;
+          sstScreenshot.u32PendingCount++;
+
+          /* Runs encoding task */
+          eResult = orxThread_RunTask(&orxScreenshot_EncodeBuffer, &orxScreenshot_ReleaseBuffer, &orxScreenshot_DiscardBuffer, pstBuffer);
+
+          /* Failure? */
+          if(eResult == orxSTATUS_FAILURE)
+          {
+            /* Closes resource */
+            orxResource_Close(pstBuffer->hResource);
+            pstBuffer->hResource = orxHANDLE_UNDEFINED;
+
+            /* Releases buffer */
+            pstBuffer->bPending = orxFALSE;
+            sstScreenshot.u32PendingCount--;
+          }
+        }
+      }
+
+      /* Failure? */
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't capture screenshot to [%s].", sstScreenshot.acScreenshotBuffer);
+      }
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Skipping screenshot: all %u staging buffers are still being encoded.", sstScreenshot.u32BufferNumber);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Event handler
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_EventHandler(const orxEVENT *_pstEvent)
+{
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_RENDER);
+  orxASSERT(_pstEvent->eID == orxRENDER_EVENT_STOP);
+
+  /* Recording? */
+  if(orxFLAG_TEST(sstScreenshot.u32Flags, orxSCREENSHOT_KU32_STATIC_FLAG_RECORD))
+  {
+    /* Captures frame, waiting for a free staging buffer so as to not drop any */
+    if(orxScreenshot_CaptureBuffer(orxTRUE) != orxSTATUS_FAILURE)
+    {
+      /* Limited recording? */
+      if(sstScreenshot.u32RecordCount != 0)
+      {
+        /* Last frame? */
+        if(--sstScreenshot.u32RecordCount == 0)
+        {
+          /* Stops recording */
+          orxScreenshot_StopRecording();
+        }
+      }
+    }
+    else
+    {
+      /* Stops recording */
+      orxScreenshot_StopRecording();
+    }
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 /** Registers all the screenshot commands
  */
 static orxINLINE void orxScreenshot_RegisterCommands()
 {
   /* Command: Capture */
   orxCOMMAND_REGISTER_CORE_COMMAND(Screenshot, Capture, "File", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
+  /* Command: Record */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Screenshot, Record, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"FrameCount = 0", orxCOMMAND_VAR_TYPE_U32});
+  /* Command: Stop */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Screenshot, Stop, "WasRecording?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
 
   /* Done! */
   return;
@@ -215,6 +539,10 @@ static orxINLINE void orxScreenshot_UnregisterCommands()
 {
   /* Command: Capture */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Screenshot, Capture);
+  /* Command: Record */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Screenshot, Record);
+  /* Command: Stop */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Screenshot, Stop);
 
   /* Done! */
   return;
@@ -233,7 +561,10 @@ void orxFASTCALL orxScreenshot_Setup()
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_STRING);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_CONFIG);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_COMMAND);
+  orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_EVENT);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_FILE);
+  orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_RESOURCE);
+  orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_THREAD);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_DISPLAY);
 
   /* Done! */
@@ -245,24 +576,87 @@ void orxFASTCALL orxScreenshot_Setup()
  */
 orxSTATUS orxFASTCALL orxScreenshot_Init()
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
 
   /* Not already Initialized? */
   if(!(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY))
   {
+    orxU32 u32RecordCount = 0;
+
     /* Cleans control structure */
     orxMemory_Zero(&sstScreenshot, sizeof(orxSCREENSHOT_STATIC));
 
-    /* Registers commands */
-    orxScreenshot_RegisterCommands();
+    /* Uses default buffer number */
+    sstScreenshot.u32BufferNumber = orxSCREENSHOT_KU32_DEFAULT_BUFFER_NUMBER;
 
-    /* Inits flags */
-    sstScreenshot.u32Flags = orxSCREENSHOT_KU32_STATIC_FLAG_READY;
+    /* Pushes section */
+    if((orxConfig_HasSection(orxSCREENSHOT_KZ_CONFIG_SECTION) != orxFALSE)
+    && (orxConfig_PushSection(orxSCREENSHOT_KZ_CONFIG_SECTION) != orxSTATUS_FAILURE))
+    {
+      orxU32 u32Value;
+
+      /* Gets buffer number */
+      if((u32Value = orxConfig_GetU32(orxSCREENSHOT_KZ_CONFIG_BUFFER_NUMBER)) > 0)
+      {
+        /* Stores it */
+        sstScreenshot.u32BufferNumber = u32Value;
+      }
+
+      /* Gets frames to record */
+      u32RecordCount = orxConfig_GetU32(orxSCREENSHOT_KZ_CONFIG_RECORD);
+
+      /* Pops previous section */
+      orxConfig_PopSection();
+    }
+
+    /* Allocates staging buffers */
+    sstScreenshot.astBufferList = (orxSCREENSHOT_BUFFER *)orxMemory_Allocate(sstScreenshot.u32BufferNumber * sizeof(orxSCREENSHOT_BUFFER), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(sstScreenshot.astBufferList != orxNULL)
+    {
+      orxU32 i;
+
+      /* Inits them */
+      orxMemory_Zero(sstScreenshot.astBufferList, sstScreenshot.u32BufferNumber * sizeof(orxSCREENSHOT_BUFFER));
+      for(i = 0; i < sstScreenshot.u32BufferNumber; i++)
+      {
+        sstScreenshot.astBufferList[i].hResource = orxHANDLE_UNDEFINED;
+      }
+
+      /* Adds event handler */
+      orxEvent_AddHandler(orxEVENT_TYPE_RENDER, orxScreenshot_EventHandler);
+      orxEvent_SetHandlerIDFlags(orxScreenshot_EventHandler, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_GET_FLAG(orxRENDER_EVENT_STOP), orxEVENT_KU32_MASK_ID_ALL);
+
+      /* Registers commands */
+      orxScreenshot_RegisterCommands();
+
+      /* Inits flags */
+      sstScreenshot.u32Flags = orxSCREENSHOT_KU32_STATIC_FLAG_READY;
+
+      /* Should record? */
+      if(u32RecordCount != 0)
+      {
+        /* Starts recording */
+        orxScreenshot_Record(u32RecordCount);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't allocate %u staging buffers.", sstScreenshot.u32BufferNumber);
+    }
   }
   else
   {
     /* Logs message */
     orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Tried to initalize Screenshot module when it was already initialized.");
+
+    /* Already initialized */
+    eResult = orxSTATUS_SUCCESS;
   }
 
   /* Done! */
@@ -276,11 +670,39 @@ void orxFASTCALL orxScreenshot_Exit()
   /* Initialized? */
   if(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY)
   {
+    orxU32 i;
+
+    /* Removes event handler */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, orxScreenshot_EventHandler);
+
     /* Unregisters commands */
     orxScreenshot_UnregisterCommands();
 
+    /* While screenshots are still being encoded */
+    while(sstScreenshot.u32PendingCount != 0)
+    {
+      /* Lets pending tasks complete (will pump their notifications) */
+      orxThread_Yield();
+      orxThread_GetTaskCount();
+    }
+
+    /* For all staging buffers */
+    for(i = 0; i < sstScreenshot.u32BufferNumber; i++)
+    {
+      /* Has data? */
+      if(sstScreenshot.astBufferList[i].pu8Data != orxNULL)
+      {
+        /* Frees it */
+        orxMemory_Free(sstScreenshot.astBufferList[i].pu8Data);
+      }
+    }
+
+    /* Frees staging buffers */
+    orxMemory_Free(sstScreenshot.astBufferList);
+    sstScreenshot.astBufferList = orxNULL;
+
     /* Updates flags */
-    sstScreenshot.u32Flags &= ~orxSCREENSHOT_KU32_STATIC_FLAG_READY;
+    sstScreenshot.u32Flags &= ~orxSCREENSHOT_KU32_STATIC_MASK_ALL;
   }
   else
   {
@@ -302,23 +724,81 @@ orxSTATUS orxFASTCALL orxScreenshot_Capture()
   /* Checks */
   orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
 
-  /* Computes screenshot index */
-  eResult = orxScreenshot_ComputeIndex();
+  /* Captures screen, without waiting for a free staging buffer */
+  eResult = orxScreenshot_CaptureBuffer(orxFALSE);
 
-  /* Valid? */
-  if(eResult != orxSTATUS_FAILURE)
+  /* Done! */
+  return eResult;
+}
+
+/** Starts recording screenshots, one per rendered frame
+ * @param[in]   _u32FrameCount                        Number of frames to record, 0 to record until orxScreenshot_StopRecording() is called
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxScreenshot_Record(orxU32 _u32FrameCount)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Not already recording? */
+  if(!orxFLAG_TEST(sstScreenshot.u32Flags, orxSCREENSHOT_KU32_STATIC_FLAG_RECORD))
   {
-    /* Saves it */
-    eResult = orxDisplay_SaveBitmap(orxDisplay_GetScreenBitmap(), sstScreenshot.acScreenshotBuffer);
+    /* Stores frame count */
+    sstScreenshot.u32RecordCount = _u32FrameCount;
 
-    /* Success? */
-    if(eResult != orxSTATUS_FAILURE)
-    {
-      /* Logs */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Screenshot captured to [%s].", sstScreenshot.acScreenshotBuffer);
-    }
+    /* Updates flags */
+    orxFLAG_SET(sstScreenshot.u32Flags, orxSCREENSHOT_KU32_STATIC_FLAG_RECORD, orxSCREENSHOT_KU32_STATIC_FLAG_NONE);
+
+    /* Logs */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Started recording %u frame(s) (0 = until stopped).", _u32FrameCount);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Can't start recording: a recording is already in progress.");
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
   }
 
   /* Done! */
   return eResult;
 }
+
+/** Stops recording screenshots, already captured frames will still be saved
+ */
+void orxFASTCALL orxScreenshot_StopRecording()
+{
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Recording? */
+  if(orxFLAG_TEST(sstScreenshot.u32Flags, orxSCREENSHOT_KU32_STATIC_FLAG_RECORD))
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstScreenshot.u32Flags, orxSCREENSHOT_KU32_STATIC_FLAG_NONE, orxSCREENSHOT_KU32_STATIC_FLAG_RECORD);
+
+    /* Clears frame count */
+    sstScreenshot.u32RecordCount = 0;
+
+    /* Logs */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Stopped recording.");
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Is recording screenshots?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxScreenshot_IsRecording()
+{
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstScreenshot.u32Flags, orxSCREENSHOT_KU32_STATIC_FLAG_RECORD) ? orxTRUE : orxFALSE;
+}
@@ -33,6 +33,7 @@
 #include "display/orxTexture.h"
 
 #include "core/orxCommand.h"
+#include "core/orxConfig.h"
 #include "core/orxEvent.h"
 #include "core/orxResource.h"
 #include "debug/orxDebug.h"
@@ -609,6 +610,7 @@ void orxFASTCALL orxTexture_Setup()
 {
   /* Adds module dependencies */
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_COMMAND);
+  orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_CONFIG);
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_DISPLAY);
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_EVENT);
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_MEMORY);
@@ -1294,3 +1296,66 @@ orxU32 orxFASTCALL orxTexture_GetLoadCount()
   /* Done! */
   return sstTexture.u32LoadCount;
 }
+
+/** Gets the atlas region of a bitmap file, as defined in the TextureAtlas config section (see orxAtlasGen)
+ * @param[in]   _zFileName      Name of the original bitmap file
+ * @param[out]  _pzPageName     Name of the atlas page bitmap file containing it, orxNULL to ignore
+ * @param[out]  _pvOrigin       Top left corner of the region in the page, orxNULL to ignore
+ * @param[out]  _pvSize         Size of the region, orxNULL to ignore
+ * @return      orxSTATUS_SUCCESS if the file is part of an atlas, orxSTATUS_FAILURE otherwise
+ */
+orxSTATUS orxFASTCALL orxTexture_GetAtlasRegion(const orxSTRING _zFileName, const orxSTRING *_pzPageName, orxVECTOR *_pvOrigin, orxVECTOR *_pvSize)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstTexture.u32Flags & orxTEXTURE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Has atlas section? */
+  if((orxConfig_HasSection(orxTEXTURE_KZ_CONFIG_ATLAS) != orxFALSE)
+  && (orxConfig_PushSection(orxTEXTURE_KZ_CONFIG_ATLAS) != orxSTATUS_FAILURE))
+  {
+    /* Has a valid region for this file? */
+    if((orxConfig_HasValue(_zFileName) != orxFALSE)
+    && (orxConfig_GetListCount(_zFileName) >= 3))
+    {
+      /* Gets page name */
+      if(_pzPageName != orxNULL)
+      {
+        *_pzPageName = orxConfig_GetListString(_zFileName, 0);
+      }
+
+      /* Gets origin */
+      if((_pvOrigin != orxNULL)
+      && (orxConfig_GetListVector(_zFileName, 1, _pvOrigin) == orxNULL))
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Invalid atlas origin for bitmap [%s], using (0, 0).", _zFileName);
+
+        /* Clears it */
+        orxVector_Copy(_pvOrigin, &orxVECTOR_0);
+      }
+
+      /* Gets size */
+      if((_pvSize != orxNULL)
+      && (orxConfig_GetListVector(_zFileName, 2, _pvSize) == orxNULL))
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Invalid atlas size for bitmap [%s], using (0, 0).", _zFileName);
+
+        /* Clears it */
+        orxVector_Copy(_pvSize, &orxVECTOR_0);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Done! */
+  return eResult;
+}
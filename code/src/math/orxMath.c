@@ -32,6 +32,13 @@
 
 #include "math/orxMath.h"
 
+#include "memory/orxMemory.h"
+
+
+/** Misc defines
+ */
+#define orxMATH_KU64_GOLDEN_GAMMA     0x9E3779B97F4A7C15ULL
+
 
 /***************************************************************************
  * Static variables                                                        *
@@ -39,17 +46,23 @@
 
 static orxU64 su64State;
 
+static orxU64 su64StreamSeed;
+static volatile orxU32 su32StreamCount;
+static volatile orxU32 su32StreamGeneration = 1;
+
+static orxTHREAD_LOCAL orxMATH_RANDOM_STREAM sstThreadStream;
+static orxTHREAD_LOCAL orxU32 su32ThreadStreamGeneration;
+
 
 /***************************************************************************
  * Private functions                                                       *
  ***************************************************************************/
 
-static orxINLINE orxU64 orxMath_SplitMix64()
+static orxINLINE orxU64 orxMath_Mix64(orxU64 _u64Value)
 {
   orxU64 u64Result;
 
-  u64Result = su64State;
-  su64State = su64State + 0x9E3779B97F4A7C15;
+  u64Result = _u64Value;
   u64Result = (u64Result ^ (u64Result >> 30)) * 0xBF58476D1CE4E5B9;
   u64Result = (u64Result ^ (u64Result >> 27)) * 0x94D049BB133111EB;
 
@@ -57,6 +70,47 @@ static orxINLINE orxU64 orxMath_SplitMix64()
   return(u64Result ^ (u64Result >> 31));
 }
 
+static orxINLINE orxU64 orxMath_MixGamma(orxU64 _u64Value)
+{
+  orxU64 u64Result;
+
+  /* Mixes value (MurmurHash3 finalizer) and forces it odd */
+  u64Result = _u64Value;
+  u64Result = (u64Result ^ (u64Result >> 33)) * 0xFF51AFD7ED558CCD;
+  u64Result = (u64Result ^ (u64Result >> 33)) * 0xC4CEB9FE1A85EC53;
+  u64Result = (u64Result ^ (u64Result >> 33)) | 1;
+
+  /* Not enough bit transitions? */
+  if(orxMath_GetBitCount((orxU32)(u64Result ^ (u64Result >> 1))) + orxMath_GetBitCount((orxU32)((u64Result ^ (u64Result >> 1)) >> 32)) < 24)
+  {
+    /* Flips every other bit */
+    u64Result ^= 0xAAAAAAAAAAAAAAAA;
+  }
+
+  /* Done! */
+  return u64Result;
+}
+
+static orxINLINE orxU64 orxMath_SplitMix64()
+{
+  orxU64 u64Result;
+
+  u64Result = su64State;
+  su64State = su64State + orxMATH_KU64_GOLDEN_GAMMA;
+
+  /* Done! */
+  return orxMath_Mix64(u64Result);
+}
+
+static orxINLINE orxU64 orxMath_GetNextStreamValue(orxMATH_RANDOM_STREAM *_pstStream)
+{
+  /* Advances counter */
+  _pstStream->u64State += _pstStream->u64Gamma;
+
+  /* Done! */
+  return orxMath_Mix64(_pstStream->u64State);
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -72,6 +126,14 @@ void orxFASTCALL orxMath_InitRandom(orxU32 _u32Seed)
 
   /* Inits random seed */
   su64State = (orxU64)_u32Seed * (orxU64)_u32Seed;
+
+  /* Inits thread streams' seed */
+  su64StreamSeed  = orxMath_Mix64(su64State);
+  su32StreamCount = 0;
+
+  /* Invalidates all thread streams */
+  orxMEMORY_BARRIER();
+  orxMEMORY_ATOMIC_INC32(&su32StreamGeneration);
   
   /* Done! */
   return;
@@ -333,3 +395,194 @@ void orxFASTCALL orxMath_SetRandomSeeds(const orxU32 _au32Seeds[4])
   /* Done! */
   return;
 }
+
+/** Inits a random stream, streams inited with the same seed will produce the same sequence
+ * @param[out]  _pstStream                      Stream to init
+ * @param[in]   _u64Seed                        Seed to use
+ */
+void orxFASTCALL orxMath_InitRandomStream(orxMATH_RANDOM_STREAM *_pstStream, orxU64 _u64Seed)
+{
+  /* Checks */
+  orxASSERT(_pstStream != orxNULL);
+
+  /* Inits it */
+  _pstStream->u64State  = orxMath_Mix64(_u64Seed);
+  _pstStream->u64Gamma  = orxMath_MixGamma(_u64Seed + orxMATH_KU64_GOLDEN_GAMMA);
+
+  /* Done! */
+  return;
+}
+
+/** Splits a random stream: the parent stream is advanced and the child stream is statistically independent from it, deterministic for a given parent state
+ * @param[in]   _pstStream                      Stream to split
+ * @param[out]  _pstChild                       Child stream
+ */
+void orxFASTCALL orxMath_SplitRandomStream(orxMATH_RANDOM_STREAM *_pstStream, orxMATH_RANDOM_STREAM *_pstChild)
+{
+  /* Checks */
+  orxASSERT(_pstStream != orxNULL);
+  orxASSERT(_pstChild != orxNULL);
+  orxASSERT(_pstChild != _pstStream);
+
+  /* Inits child from the next two counter values */
+  _pstStream->u64State += _pstStream->u64Gamma;
+  _pstChild->u64State   = orxMath_Mix64(_pstStream->u64State);
+  _pstStream->u64State += _pstStream->u64Gamma;
+  _pstChild->u64Gamma   = orxMath_MixGamma(_pstStream->u64State);
+
+  /* Done! */
+  return;
+}
+
+/** Skips values of a random stream in constant time
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _u64Count                       Number of values to skip
+ */
+void orxFASTCALL orxMath_SkipRandomStream(orxMATH_RANDOM_STREAM *_pstStream, orxU64 _u64Count)
+{
+  /* Checks */
+  orxASSERT(_pstStream != orxNULL);
+
+  /* Advances counter */
+  _pstStream->u64State += _u64Count * _pstStream->u64Gamma;
+
+  /* Done! */
+  return;
+}
+
+/** Gets the calling thread's default random stream, seeded from orxMath_InitRandom's seed on first use
+ * @return      Calling thread's random stream, only to be used by that thread
+ */
+orxMATH_RANDOM_STREAM *orxFASTCALL orxMath_GetThreadRandomStream()
+{
+  orxU32 u32Generation;
+
+  /* Gets current generation */
+  u32Generation = su32StreamGeneration;
+
+  /* Outdated? */
+  if(su32ThreadStreamGeneration != u32Generation)
+  {
+    orxU32 u32Index;
+
+    /* Gets unique index */
+    u32Index = orxMEMORY_ATOMIC_INC32(&su32StreamCount);
+
+    /* Inits stream */
+    orxMath_InitRandomStream(&sstThreadStream, su64StreamSeed + (orxU64)u32Index * orxMATH_KU64_GOLDEN_GAMMA);
+
+    /* Updates generation */
+    su32ThreadStreamGeneration = u32Generation;
+  }
+
+  /* Done! */
+  return &sstThreadStream;
+}
+
+/** Gets a random orxFLOAT value from a stream
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _fMin                           Minimum boundary (inclusive)
+ * @param[in]   _fMax                           Maximum boundary (exclusive)
+ * @return      Random value
+ */
+orxFLOAT orxFASTCALL orxMath_GetRandomStreamFloat(orxMATH_RANDOM_STREAM *_pstStream, orxFLOAT _fMin, orxFLOAT _fMax)
+{
+  union
+  {
+    orxU32    u32Value;
+    orxFLOAT  fValue;
+  } stSwap;
+  orxFLOAT fResult;
+
+  /* Checks */
+  orxASSERT(_pstStream != orxNULL);
+
+  /* Gets next random number (as float, from the high bits) */
+  stSwap.u32Value = ((orxU32)(orxMath_GetNextStreamValue(_pstStream) >> 41)) | 0x3f800000;
+
+  /* Updates result */
+  fResult = _fMin + (stSwap.fValue - orxFLOAT_1) * (_fMax - _fMin);
+
+  /* Done! */
+  return fResult;
+}
+
+/** Gets a random orxU32 value from a stream
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _u32Min                         Minimum boundary (inclusive)
+ * @param[in]   _u32Max                         Maximum boundary (inclusive)
+ * @return      Random value
+ */
+orxU32 orxFASTCALL orxMath_GetRandomStreamU32(orxMATH_RANDOM_STREAM *_pstStream, orxU32 _u32Min, orxU32 _u32Max)
+{
+  orxU32 u32Range, u32Result;
+
+  /* Checks */
+  orxASSERT(_pstStream != orxNULL);
+
+  /* Gets range */
+  u32Range = _u32Max - _u32Min + 1;
+
+  /* Updates result (multiply-shift on the high bits, full range when wrapped) */
+  u32Result = (u32Range != 0)
+            ? _u32Min + (orxU32)(((orxMath_GetNextStreamValue(_pstStream) >> 32) * (orxU64)u32Range) >> 32)
+            : (orxU32)(orxMath_GetNextStreamValue(_pstStream) >> 32);
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets a random orxS32 value from a stream
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _s32Min                         Minimum boundary (inclusive)
+ * @param[in]   _s32Max                         Maximum boundary (inclusive)
+ * @return      Random value
+ */
+orxS32 orxFASTCALL orxMath_GetRandomStreamS32(orxMATH_RANDOM_STREAM *_pstStream, orxS32 _s32Min, orxS32 _s32Max)
+{
+  /* Done! */
+  return (orxS32)((orxU32)_s32Min + orxMath_GetRandomStreamU32(_pstStream, 0, (orxU32)_s32Max - (orxU32)_s32Min));
+}
+
+/** Gets a random orxU64 value from a stream
+ * @param[in]   _pstStream                      Concerned stream
+ * @param[in]   _u64Min                         Minimum boundary (inclusive)
+ * @param[in]   _u64Max                         Maximum boundary (inclusive)
+ * @return      Random value
+ */
+orxU64 orxFASTCALL orxMath_GetRandomStreamU64(orxMATH_RANDOM_STREAM *_pstStream, orxU64 _u64Min, orxU64 _u64Max)
+{
+  orxU64 u64Range, u64Result;
+
+  /* Checks */
+  orxASSERT(_pstStream != orxNULL);
+
+  /* Gets range */
+  u64Range = _u64Max - _u64Min + 1;
+
+  /* Not wrapped? */
+  if(u64Range != 0)
+  {
+    orxU64 u64Threshold;
+
+    /* Gets rejection threshold (2^64 modulo range), below which values would bias the modulo */
+    u64Threshold = (0 - u64Range) % u64Range;
+
+    /* Gets first unbiased random number */
+    do
+    {
+      u64Result = orxMath_GetNextStreamValue(_pstStream);
+    } while(u64Result < u64Threshold);
+
+    /* Updates result */
+    u64Result = _u64Min + (u64Result % u64Range);
+  }
+  else
+  {
+    /* Updates result (full range) */
+    u64Result = orxMath_GetNextStreamValue(_pstStream);
+  }
+
+  /* Done! */
+  return u64Result;
+}
@@ -62,6 +62,7 @@ struct __orxBANK_t
   orxU32            u32SegmentSize;         /**< Segment size */
   orxU32            u32CellCount;           /**< Allocated cells count */
   orxU32            u32SegmentCount;        /**< Segment count */
+  orxU32            u32FreeHint;            /**< Cell map entry before which no cell is free */
   orxU32            u32Flags;               /**< Flags set for the memory bank */
   orxMEMORY_TYPE    eMemType;               /**< Memory type that will be used by the memory allocation */
 };
@@ -431,15 +432,18 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
   {
     orxU32 *pu32MapEntry;
 
-    /* Finds non-full segment */
-    for(u32SegmentIndex = 0; (u32SegmentIndex < _pstBank->u32SegmentCount) && (_pstBank->au32SegmentFree[u32SegmentIndex] == 0); u32SegmentIndex++)
+    /* Finds non-full segment, starting from the free hint */
+    for(u32SegmentIndex = _pstBank->u32FreeHint / u32MapSize; (u32SegmentIndex < _pstBank->u32SegmentCount) && (_pstBank->au32SegmentFree[u32SegmentIndex] == 0); u32SegmentIndex++)
       ;
 
     /* Checks */
     orxASSERT(u32SegmentIndex < _pstBank->u32SegmentCount);
 
+    /* Gets first cell map entry to check */
+    pu32MapEntry = _pstBank->au32CellMap + orxMAX(_pstBank->u32FreeHint, u32SegmentIndex * u32MapSize);
+
     /* For all cell map entries */
-    for(u32CellIndex = 0, pu32MapEntry = _pstBank->au32CellMap + u32SegmentIndex * u32MapSize;
+    for(u32CellIndex = (orxU32)(pu32MapEntry - (_pstBank->au32CellMap + u32SegmentIndex * u32MapSize)) << 5;
         u32CellIndex < _pstBank->u32SegmentSize;
         u32CellIndex += 32, pu32MapEntry++)
     {
@@ -460,6 +464,9 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
 
     /* Updates map */
     *pu32MapEntry &= ~(1U << (u32CellIndex & 31));
+
+    /* Updates free hint */
+    _pstBank->u32FreeHint = (orxU32)(pu32MapEntry - _pstBank->au32CellMap);
   }
   else
   {
@@ -553,6 +560,9 @@ void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
   /* Marks cell as free */
   _pstBank->au32CellMap[u32SegmentIndex * u32MapSize + (u32CellIndex >> 5)] |= 1U << (u32CellIndex & 31);
 
+  /* Updates free hint */
+  _pstBank->u32FreeHint = orxMIN(_pstBank->u32FreeHint, u32SegmentIndex * u32MapSize + (u32CellIndex >> 5));
+
   /* Updates segment free count */
   _pstBank->au32SegmentFree[u32SegmentIndex]++;
 
@@ -597,6 +607,9 @@ void orxFASTCALL orxBank_FreeAtIndex(orxBANK *_pstBank, orxU32 _u32Index)
   /* Marks cell as free */
   _pstBank->au32CellMap[u32SegmentIndex * u32MapSize + (u32CellIndex >> 5)] |= 1U << (u32CellIndex & 31);
 
+  /* Updates free hint */
+  _pstBank->u32FreeHint = orxMIN(_pstBank->u32FreeHint, u32SegmentIndex * u32MapSize + (u32CellIndex >> 5));
+
   /* Updates segment free count */
   _pstBank->au32SegmentFree[u32SegmentIndex]++;
 
@@ -634,8 +647,9 @@ void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
     _pstBank->au32SegmentFree[i] = _pstBank->u32SegmentSize;
   }
 
-  /* Clears cell count */
-  _pstBank->u32CellCount = 0;
+  /* Clears cell count & free hint */
+  _pstBank->u32CellCount  = 0;
+  _pstBank->u32FreeHint   = 0;
 
   /* Done! */
   return;
@@ -718,6 +732,9 @@ void orxFASTCALL orxBank_Compact(orxBANK *_pstBank)
 
     /* Updates segment count */
     _pstBank->u32SegmentCount = u32NewSegmentCount;
+
+    /* Updates free hint */
+    _pstBank->u32FreeHint = orxMIN(_pstBank->u32FreeHint, u32NewSegmentCount * ((orxU32)orxALIGN(_pstBank->u32SegmentSize, 32) >> 5));
   }
 
   /* Done! */
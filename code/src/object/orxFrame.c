@@ -39,6 +39,18 @@
 #include "object/orxStructure.h"
 #include "math/orxMath.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+
+  #define __orxFRAME_SSE2__
+  #include <emmintrin.h>
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+  #define __orxFRAME_NEON__
+  #include <arm_neon.h>
+
+#endif
+
 
 /** Module flags
  */
@@ -57,6 +69,8 @@
 #define orxFRAME_KU32_FLAG_NONE                               0x00000000  /**< No flags */
 
 #define orxFRAME_KU32_FLAG_DATA_2D                            0x10000000  /**< 2D ID flag */
+#define orxFRAME_KU32_FLAG_DIRTY                              0x20000000  /**< Dirty flag */
+#define orxFRAME_KU32_FLAG_TRACK_DIRTY                        0x40000000  /**< Track dirty flag */
 
 #define orxFRAME_KU32_MASK_ALL                                0xFFFFFFFF  /**< All mask */
 
@@ -65,6 +79,9 @@
  */
 #define orxFRAME_KU32_BANK_SIZE                               2048        /**< Bank size */
 #define orxFRAME_KU32_RESULT_BUFFER_SIZE                      128
+#define orxFRAME_KU32_BATCH_SIZE                              256         /**< Batch initial size */
+#define orxFRAME_KU32_BATCH_WIDTH                             4           /**< Batch SIMD width */
+#define orxFRAME_KU32_BATCH_CHUNK_SIZE                        32          /**< Batch chunk size */
 
 #define orxFRAME_KZ_NONE                                      "none"
 #define orxFRAME_KZ_ROTATION                                  "rotation"
@@ -84,6 +101,32 @@
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Batch value enum
+ */
+typedef enum __orxFRAME_BATCH_VALUE_t
+{
+  orxFRAME_BATCH_VALUE_LOCAL_POSITION_X = 0,
+  orxFRAME_BATCH_VALUE_LOCAL_POSITION_Y,
+  orxFRAME_BATCH_VALUE_LOCAL_POSITION_Z,
+  orxFRAME_BATCH_VALUE_LOCAL_ROTATION,
+  orxFRAME_BATCH_VALUE_LOCAL_SCALE_X,
+  orxFRAME_BATCH_VALUE_LOCAL_SCALE_Y,
+  orxFRAME_BATCH_VALUE_GLOBAL_POSITION_X,
+  orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Y,
+  orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Z,
+  orxFRAME_BATCH_VALUE_GLOBAL_ROTATION,
+  orxFRAME_BATCH_VALUE_GLOBAL_SCALE_X,
+  orxFRAME_BATCH_VALUE_GLOBAL_SCALE_Y,
+  orxFRAME_BATCH_VALUE_COS,
+  orxFRAME_BATCH_VALUE_SIN,
+
+  orxFRAME_BATCH_VALUE_NUMBER,
+
+  orxFRAME_BATCH_VALUE_NONE = orxENUM_NONE
+
+} orxFRAME_BATCH_VALUE;
+
+
 /** Internal 2D Frame Data structure
  */
 typedef struct __orxFRAME_DATA_2D_t
@@ -106,6 +149,7 @@ struct __orxFRAME_t
 {
   orxSTRUCTURE      stStructure;                              /**< Public structure, first structure member : 32 */
   orxFRAME_DATA_2D  stData;                                   /**< Frame data : 64 */
+  orxLINKLIST_NODE  stDirtyNode;                              /**< Dirty list node : 76 */
 };
 
 /** Static structure
@@ -115,6 +159,14 @@ typedef struct __orxFRAME_STATIC_t
   orxU32    u32Flags;                                         /**< Control flags */
   orxFRAME *pstRoot;                                          /**< Frame root */
   orxBANK  *pst2DDataBank;                                    /**< 2D Data bank */
+  orxLINKLIST stDirtyList;                                    /**< Dirty list */
+  orxFRAME **apstBatchFrame;                                  /**< Batch frames */
+  orxFRAME **apstBatchChild;                                  /**< Batch first children */
+  orxU32   *au32BatchParent;                                  /**< Batch parent indices */
+  orxU32   *au32BatchFlags;                                   /**< Batch ignore flags */
+  orxFLOAT *aafBatchValue[orxFRAME_BATCH_VALUE_NUMBER];       /**< Batch values (SoA) */
+  orxU32    u32BatchSize;                                     /**< Batch size */
+  orxU32    u32BatchCount;                                    /**< Batch count */
   orxCHAR   acResultBuffer[orxFRAME_KU32_RESULT_BUFFER_SIZE]; /**< Result buffer */
 
 } orxFRAME_STATIC;
@@ -133,6 +185,44 @@ static orxFRAME_STATIC sstFrame;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Marks a frame as dirty, if tracked
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_SetDirty(orxFRAME *_pstFrame)
+{
+  /* Tracked and not already dirty? */
+  if(orxStructure_GetFlags(_pstFrame, orxFRAME_KU32_FLAG_TRACK_DIRTY | orxFRAME_KU32_FLAG_DIRTY) == orxFRAME_KU32_FLAG_TRACK_DIRTY)
+  {
+    /* Adds it to dirty list */
+    orxLinkList_AddEnd(&(sstFrame.stDirtyList), &(_pstFrame->stDirtyNode));
+
+    /* Updates status */
+    orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY, orxFRAME_KU32_FLAG_NONE);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Clears a frame's dirty status
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_ClearDirty(orxFRAME *_pstFrame)
+{
+  /* Dirty? */
+  if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY))
+  {
+    /* Removes it from dirty list */
+    orxLinkList_Remove(&(_pstFrame->stDirtyNode));
+
+    /* Updates status */
+    orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_DIRTY);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Sets frame position
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _pvPos          Position to set
@@ -154,6 +244,9 @@ static orxINLINE orxBOOL _orxFrame_SetPosition(orxFRAME *_pstFrame, const orxVEC
       /* Stores it */
       orxVector_Copy(&(_pstFrame->stData.vGlobalPos), _pvPos);
 
+      /* Marks it as dirty */
+      orxFrame_SetDirty(_pstFrame);
+
       /* Updates result */
       bResult = orxTRUE;
     }
@@ -196,6 +289,9 @@ static orxINLINE orxBOOL _orxFrame_SetRotation(orxFRAME *_pstFrame, orxFLOAT _fR
       /* Stores it */
       _pstFrame->stData.fGlobalRotation = _fRotation;
 
+      /* Marks it as dirty */
+      orxFrame_SetDirty(_pstFrame);
+
       /* Updates result */
       bResult = orxTRUE;
     }
@@ -238,6 +334,9 @@ static orxINLINE orxBOOL _orxFrame_SetScale(orxFRAME *_pstFrame, const orxVECTOR
       _pstFrame->stData.fGlobalScaleX = _pvScale->fX;
       _pstFrame->stData.fGlobalScaleY = _pvScale->fY;
 
+      /* Marks it as dirty */
+      orxFrame_SetDirty(_pstFrame);
+
       /* Updates result */
       bResult = orxTRUE;
     }
@@ -662,6 +761,494 @@ static void orxFASTCALL orxFrame_ProcessInternal(orxFRAME *_pstFrame, const orxF
   return;
 }
 
+/** Grows batch buffers
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFrame_GrowBatch()
+{
+  orxU32    u32Size;
+  orxU8    *pu8Buffer;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Gets new size */
+  u32Size = (sstFrame.u32BatchSize != 0) ? sstFrame.u32BatchSize << 1 : orxFRAME_KU32_BATCH_SIZE;
+
+  /* Allocates all buffers at once */
+  pu8Buffer = (orxU8 *)orxMemory_Allocate(u32Size * (2 * sizeof(orxFRAME *) + 2 * sizeof(orxU32) + orxFRAME_BATCH_VALUE_NUMBER * sizeof(orxFLOAT)), orxMEMORY_TYPE_MAIN);
+
+  /* Success? */
+  if(pu8Buffer != orxNULL)
+  {
+    orxFRAME  **apstFrame, **apstChild;
+    orxU32     *au32Parent, *au32Flags;
+    orxFLOAT   *afValue;
+    orxU32      i;
+
+    /* Gets buffers */
+    apstFrame   = (orxFRAME **)pu8Buffer;
+    apstChild   = apstFrame + u32Size;
+    au32Parent  = (orxU32 *)(apstChild + u32Size);
+    au32Flags   = au32Parent + u32Size;
+    afValue     = (orxFLOAT *)(au32Flags + u32Size);
+
+    /* Had previous buffers? */
+    if(sstFrame.apstBatchFrame != orxNULL)
+    {
+      /* Copies current content */
+      orxMemory_Copy(apstFrame, sstFrame.apstBatchFrame, sstFrame.u32BatchCount * sizeof(orxFRAME *));
+      orxMemory_Copy(apstChild, sstFrame.apstBatchChild, sstFrame.u32BatchCount * sizeof(orxFRAME *));
+      orxMemory_Copy(au32Parent, sstFrame.au32BatchParent, sstFrame.u32BatchCount * sizeof(orxU32));
+      orxMemory_Copy(au32Flags, sstFrame.au32BatchFlags, sstFrame.u32BatchCount * sizeof(orxU32));
+      for(i = 0; i < orxFRAME_BATCH_VALUE_NUMBER; i++)
+      {
+        orxMemory_Copy(afValue + i * u32Size, sstFrame.aafBatchValue[i], sstFrame.u32BatchCount * sizeof(orxFLOAT));
+      }
+
+      /* Deletes them */
+      orxMemory_Free(sstFrame.apstBatchFrame);
+    }
+
+    /* Stores new buffers */
+    sstFrame.apstBatchFrame   = apstFrame;
+    sstFrame.apstBatchChild   = apstChild;
+    sstFrame.au32BatchParent  = au32Parent;
+    sstFrame.au32BatchFlags   = au32Flags;
+    for(i = 0; i < orxFRAME_BATCH_VALUE_NUMBER; i++)
+    {
+      sstFrame.aafBatchValue[i] = afValue + i * u32Size;
+    }
+    sstFrame.u32BatchSize     = u32Size;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stores cosine & sine of a batch entry's global rotation, using the same special angles as orxVector_2DRotate
+ * @param[in]   _u32Index       Batch index
+ */
+static orxINLINE void orxFrame_SetBatchRotation(orxU32 _u32Index)
+{
+  orxFLOAT fRotation, fCos, fSin;
+
+  /* Gets global rotation */
+  fRotation = sstFrame.aafBatchValue[orxFRAME_BATCH_VALUE_GLOBAL_ROTATION][_u32Index];
+
+  /* Depending on angle */
+  if(fRotation == orxFLOAT_0)
+  {
+    fCos = orxFLOAT_1;
+    fSin = orxFLOAT_0;
+  }
+  else if(fRotation == orxMATH_KF_PI_BY_2)
+  {
+    fCos = orxFLOAT_0;
+    fSin = orxFLOAT_1;
+  }
+  else if(fRotation == -orxMATH_KF_PI_BY_2)
+  {
+    fCos = orxFLOAT_0;
+    fSin = -orxFLOAT_1;
+  }
+  else if(fRotation == orxMATH_KF_PI)
+  {
+    fCos = -orxFLOAT_1;
+    fSin = orxFLOAT_0;
+  }
+  else
+  {
+    fCos = orxMath_Cos(fRotation);
+    fSin = orxMath_Sin(fRotation);
+  }
+
+  /* Stores them */
+  sstFrame.aafBatchValue[orxFRAME_BATCH_VALUE_COS][_u32Index] = fCos;
+  sstFrame.aafBatchValue[orxFRAME_BATCH_VALUE_SIN][_u32Index] = fSin;
+
+  /* Done! */
+  return;
+}
+
+/** Adds a frame to the batch
+ * @param[in]   _pstFrame       Concerned frame
+ * @param[in]   _u32Parent      Parent's batch index
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxINLINE orxSTATUS orxFrame_AddBatch(orxFRAME *_pstFrame, orxU32 _u32Parent)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Full? */
+  if(sstFrame.u32BatchCount >= sstFrame.u32BatchSize)
+  {
+    /* Grows buffers */
+    eResult = orxFrame_GrowBatch();
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    orxFLOAT  **aafValue;
+    orxU32      u32Index;
+
+    /* Gets index */
+    u32Index = sstFrame.u32BatchCount++;
+
+    /* Stores frame, first child, parent and flags */
+    sstFrame.apstBatchFrame[u32Index]   = _pstFrame;
+    sstFrame.apstBatchChild[u32Index]   = orxFRAME(orxStructure_GetChild(_pstFrame));
+    sstFrame.au32BatchParent[u32Index]  = _u32Parent;
+    sstFrame.au32BatchFlags[u32Index]   = orxStructure_GetFlags(_pstFrame, orxFRAME_KU32_MASK_IGNORE_ALL);
+
+    /* Stores local values */
+    aafValue = sstFrame.aafBatchValue;
+    aafValue[orxFRAME_BATCH_VALUE_LOCAL_POSITION_X][u32Index] = _pstFrame->stData.vLocalPos.fX;
+    aafValue[orxFRAME_BATCH_VALUE_LOCAL_POSITION_Y][u32Index] = _pstFrame->stData.vLocalPos.fY;
+    aafValue[orxFRAME_BATCH_VALUE_LOCAL_POSITION_Z][u32Index] = _pstFrame->stData.vLocalPos.fZ;
+    aafValue[orxFRAME_BATCH_VALUE_LOCAL_ROTATION][u32Index]   = _pstFrame->stData.fLocalRotation;
+    aafValue[orxFRAME_BATCH_VALUE_LOCAL_SCALE_X][u32Index]    = _pstFrame->stData.fLocalScaleX;
+    aafValue[orxFRAME_BATCH_VALUE_LOCAL_SCALE_Y][u32Index]    = _pstFrame->stData.fLocalScaleY;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Computes a batch entry's global values from its parent's ones
+ * @param[in]   _u32Index       Batch index
+ */
+static orxINLINE void orxFrame_ComputeBatchEntry(orxU32 _u32Index)
+{
+  orxFLOAT  **aafValue;
+  orxFLOAT    fX, fY, fCos, fSin;
+  orxU32      u32Parent, u32Flags;
+
+  /* Gets values, parent & flags */
+  aafValue  = sstFrame.aafBatchValue;
+  u32Parent = sstFrame.au32BatchParent[_u32Index];
+  u32Flags  = sstFrame.au32BatchFlags[_u32Index];
+
+  /* Computes scale */
+  aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_X][_u32Index] = aafValue[orxFRAME_BATCH_VALUE_LOCAL_SCALE_X][_u32Index] * (orxFLAG_TEST(u32Flags, orxFRAME_KU32_FLAG_IGNORE_SCALE_X) ? orxFLOAT_1 : aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_X][u32Parent]);
+  aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_Y][_u32Index] = aafValue[orxFRAME_BATCH_VALUE_LOCAL_SCALE_Y][_u32Index] * (orxFLAG_TEST(u32Flags, orxFRAME_KU32_FLAG_IGNORE_SCALE_Y) ? orxFLOAT_1 : aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_Y][u32Parent]);
+
+  /* Computes rotation */
+  aafValue[orxFRAME_BATCH_VALUE_GLOBAL_ROTATION][_u32Index] = orxFLAG_TEST(u32Flags, orxFRAME_KU32_FLAG_IGNORE_ROTATION) ? aafValue[orxFRAME_BATCH_VALUE_LOCAL_ROTATION][_u32Index] : aafValue[orxFRAME_BATCH_VALUE_LOCAL_ROTATION][_u32Index] + aafValue[orxFRAME_BATCH_VALUE_GLOBAL_ROTATION][u32Parent];
+
+  /* Computes position */
+  fX = aafValue[orxFRAME_BATCH_VALUE_LOCAL_POSITION_X][_u32Index] * (orxFLAG_TEST(u32Flags, orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_X) ? orxFLOAT_1 : aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_X][u32Parent]);
+  fY = aafValue[orxFRAME_BATCH_VALUE_LOCAL_POSITION_Y][_u32Index] * (orxFLAG_TEST(u32Flags, orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Y) ? orxFLOAT_1 : aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_Y][u32Parent]);
+  if(orxFLAG_TEST(u32Flags, orxFRAME_KU32_FLAG_IGNORE_POSITION_ROTATION))
+  {
+    fCos = orxFLOAT_1;
+    fSin = orxFLOAT_0;
+  }
+  else
+  {
+    fCos = aafValue[orxFRAME_BATCH_VALUE_COS][u32Parent];
+    fSin = aafValue[orxFRAME_BATCH_VALUE_SIN][u32Parent];
+  }
+  if(fSin == orxFLOAT_0)
+  {
+    fX = fCos * fX;
+    fY = fCos * fY;
+  }
+  else if(fCos == orxFLOAT_0)
+  {
+    orxFLOAT fTemp;
+
+    fTemp = -fSin * fY;
+    fY    = fSin * fX;
+    fX    = fTemp;
+  }
+  else
+  {
+    orxFLOAT fTemp;
+
+    fTemp = (fCos * fX) - (fSin * fY);
+    fY    = (fSin * fX) + (fCos * fY);
+    fX    = fTemp;
+  }
+  aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_X][_u32Index] = fX + (orxFLAG_TEST(u32Flags, orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_X) ? orxFLOAT_0 : aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_X][u32Parent]);
+  aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Y][_u32Index] = fY + (orxFLAG_TEST(u32Flags, orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Y) ? orxFLOAT_0 : aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Y][u32Parent]);
+  aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Z][_u32Index] = aafValue[orxFRAME_BATCH_VALUE_LOCAL_POSITION_Z][_u32Index] + (orxFLAG_TEST(u32Flags, orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Z) ? orxFLOAT_0 : aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Z][u32Parent]);
+
+  /* Done! */
+  return;
+}
+
+#if defined(__orxFRAME_SSE2__)
+
+  typedef __m128                                              orxFRAME_BATCH_VECTOR;
+  typedef __m128i                                             orxFRAME_BATCH_FLAGS;
+  typedef __m128                                              orxFRAME_BATCH_MASK;
+
+  #define orxFRAME_BATCH_LOAD(ADDRESS)                        _mm_loadu_ps(ADDRESS)
+  #define orxFRAME_BATCH_STORE(ADDRESS, VALUE)                _mm_storeu_ps(ADDRESS, VALUE)
+  #define orxFRAME_BATCH_SET(VALUE)                           _mm_set1_ps(VALUE)
+  #define orxFRAME_BATCH_GATHER(ARRAY, INDICES)               _mm_set_ps((ARRAY)[(INDICES)[3]], (ARRAY)[(INDICES)[2]], (ARRAY)[(INDICES)[1]], (ARRAY)[(INDICES)[0]])
+  #define orxFRAME_BATCH_ADD(OP1, OP2)                        _mm_add_ps(OP1, OP2)
+  #define orxFRAME_BATCH_SUB(OP1, OP2)                        _mm_sub_ps(OP1, OP2)
+  #define orxFRAME_BATCH_MUL(OP1, OP2)                        _mm_mul_ps(OP1, OP2)
+  #define orxFRAME_BATCH_LOAD_FLAGS(ADDRESS)                  _mm_loadu_si128((const __m128i *)(ADDRESS))
+  #define orxFRAME_BATCH_TEST_FLAG(FLAGS, FLAG)               _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(FLAGS, _mm_set1_epi32(FLAG)), _mm_set1_epi32(FLAG)))
+  #define orxFRAME_BATCH_TEST_ZERO(VALUE)                     _mm_cmpeq_ps(VALUE, _mm_setzero_ps())
+  #define orxFRAME_BATCH_BLEND(MASK, OP1, OP2)                _mm_or_ps(_mm_and_ps(MASK, OP1), _mm_andnot_ps(MASK, OP2))
+
+#elif defined(__orxFRAME_NEON__)
+
+  typedef float32x4_t                                         orxFRAME_BATCH_VECTOR;
+  typedef uint32x4_t                                          orxFRAME_BATCH_FLAGS;
+  typedef uint32x4_t                                          orxFRAME_BATCH_MASK;
+
+  #define orxFRAME_BATCH_LOAD(ADDRESS)                        vld1q_f32(ADDRESS)
+  #define orxFRAME_BATCH_STORE(ADDRESS, VALUE)                vst1q_f32(ADDRESS, VALUE)
+  #define orxFRAME_BATCH_SET(VALUE)                           vdupq_n_f32(VALUE)
+  #define orxFRAME_BATCH_GATHER(ARRAY, INDICES)               vsetq_lane_f32((ARRAY)[(INDICES)[3]], vsetq_lane_f32((ARRAY)[(INDICES)[2]], vsetq_lane_f32((ARRAY)[(INDICES)[1]], vdupq_n_f32((ARRAY)[(INDICES)[0]]), 1), 2), 3)
+  #define orxFRAME_BATCH_ADD(OP1, OP2)                        vaddq_f32(OP1, OP2)
+  #define orxFRAME_BATCH_SUB(OP1, OP2)                        vsubq_f32(OP1, OP2)
+  #define orxFRAME_BATCH_MUL(OP1, OP2)                        vmulq_f32(OP1, OP2)
+  #define orxFRAME_BATCH_LOAD_FLAGS(ADDRESS)                  vld1q_u32((const uint32_t *)(ADDRESS))
+  #define orxFRAME_BATCH_TEST_FLAG(FLAGS, FLAG)               vtstq_u32(FLAGS, vdupq_n_u32(FLAG))
+  #define orxFRAME_BATCH_TEST_ZERO(VALUE)                     vceqq_f32(VALUE, vdupq_n_f32(0.0f))
+  #define orxFRAME_BATCH_BLEND(MASK, OP1, OP2)                vbslq_f32(MASK, OP1, OP2)
+
+#endif
+
+#if defined(__orxFRAME_SSE2__) || defined(__orxFRAME_NEON__)
+
+  #define orxFRAME_BATCH_SELECT(FLAGS, FLAG, IGNORE, VALUE)   orxFRAME_BATCH_BLEND(orxFRAME_BATCH_TEST_FLAG(FLAGS, FLAG), IGNORE, VALUE)
+
+#endif
+
+/** Computes batch entries' global values, parents need to have been computed beforehand
+ * @param[in]   _u32Start       First batch index
+ * @param[in]   _u32End         Last batch index (excluded)
+ */
+static orxINLINE void orxFrame_ComputeBatch(orxU32 _u32Start, orxU32 _u32End)
+{
+  orxU32 i = _u32Start;
+
+#if defined(__orxFRAME_SSE2__) || defined(__orxFRAME_NEON__)
+
+  orxFLOAT **aafValue;
+
+  /* Gets values */
+  aafValue = sstFrame.aafBatchValue;
+
+  /* For all full lanes */
+  for(; i + orxFRAME_KU32_BATCH_WIDTH <= _u32End; i += orxFRAME_KU32_BATCH_WIDTH)
+  {
+    orxFRAME_BATCH_FLAGS  vFlags;
+    orxFRAME_BATCH_MASK   vSinZero, vCosZero;
+    orxFRAME_BATCH_VECTOR vOne, vZero, vParentScaleX, vParentScaleY, vRotation, vCos, vSin, vX, vY, vRotatedX, vRotatedY;
+    const orxU32         *au32Parent;
+
+    /* Gets flags & parents */
+    vFlags      = orxFRAME_BATCH_LOAD_FLAGS(sstFrame.au32BatchFlags + i);
+    au32Parent  = sstFrame.au32BatchParent + i;
+    vOne        = orxFRAME_BATCH_SET(orxFLOAT_1);
+    vZero       = orxFRAME_BATCH_SET(orxFLOAT_0);
+
+    /* Gathers parent scales */
+    vParentScaleX = orxFRAME_BATCH_GATHER(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_X], au32Parent);
+    vParentScaleY = orxFRAME_BATCH_GATHER(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_Y], au32Parent);
+
+    /* Computes scale */
+    orxFRAME_BATCH_STORE(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_X] + i, orxFRAME_BATCH_MUL(orxFRAME_BATCH_LOAD(aafValue[orxFRAME_BATCH_VALUE_LOCAL_SCALE_X] + i), orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_SCALE_X, vOne, vParentScaleX)));
+    orxFRAME_BATCH_STORE(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_Y] + i, orxFRAME_BATCH_MUL(orxFRAME_BATCH_LOAD(aafValue[orxFRAME_BATCH_VALUE_LOCAL_SCALE_Y] + i), orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_SCALE_Y, vOne, vParentScaleY)));
+
+    /* Computes rotation */
+    vRotation = orxFRAME_BATCH_LOAD(aafValue[orxFRAME_BATCH_VALUE_LOCAL_ROTATION] + i);
+    orxFRAME_BATCH_STORE(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_ROTATION] + i, orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_ROTATION, vRotation, orxFRAME_BATCH_ADD(vRotation, orxFRAME_BATCH_GATHER(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_ROTATION], au32Parent))));
+
+    /* Computes position */
+    vX    = orxFRAME_BATCH_MUL(orxFRAME_BATCH_LOAD(aafValue[orxFRAME_BATCH_VALUE_LOCAL_POSITION_X] + i), orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_X, vOne, vParentScaleX));
+    vY    = orxFRAME_BATCH_MUL(orxFRAME_BATCH_LOAD(aafValue[orxFRAME_BATCH_VALUE_LOCAL_POSITION_Y] + i), orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Y, vOne, vParentScaleY));
+    vCos  = orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_POSITION_ROTATION, vOne, orxFRAME_BATCH_GATHER(aafValue[orxFRAME_BATCH_VALUE_COS], au32Parent));
+    vSin  = orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_POSITION_ROTATION, vZero, orxFRAME_BATCH_GATHER(aafValue[orxFRAME_BATCH_VALUE_SIN], au32Parent));
+    vSinZero  = orxFRAME_BATCH_TEST_ZERO(vSin);
+    vCosZero  = orxFRAME_BATCH_TEST_ZERO(vCos);
+    vRotatedX = orxFRAME_BATCH_BLEND(vSinZero, orxFRAME_BATCH_MUL(vCos, vX), orxFRAME_BATCH_BLEND(vCosZero, orxFRAME_BATCH_MUL(orxFRAME_BATCH_SUB(vZero, vSin), vY), orxFRAME_BATCH_SUB(orxFRAME_BATCH_MUL(vCos, vX), orxFRAME_BATCH_MUL(vSin, vY))));
+    vRotatedY = orxFRAME_BATCH_BLEND(vSinZero, orxFRAME_BATCH_MUL(vCos, vY), orxFRAME_BATCH_BLEND(vCosZero, orxFRAME_BATCH_MUL(vSin, vX), orxFRAME_BATCH_ADD(orxFRAME_BATCH_MUL(vSin, vX), orxFRAME_BATCH_MUL(vCos, vY))));
+    orxFRAME_BATCH_STORE(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_X] + i, orxFRAME_BATCH_ADD(vRotatedX, orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_X, vZero, orxFRAME_BATCH_GATHER(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_X], au32Parent))));
+    orxFRAME_BATCH_STORE(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Y] + i, orxFRAME_BATCH_ADD(vRotatedY, orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Y, vZero, orxFRAME_BATCH_GATHER(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Y], au32Parent))));
+    orxFRAME_BATCH_STORE(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Z] + i, orxFRAME_BATCH_ADD(orxFRAME_BATCH_LOAD(aafValue[orxFRAME_BATCH_VALUE_LOCAL_POSITION_Z] + i), orxFRAME_BATCH_SELECT(vFlags, orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Z, vZero, orxFRAME_BATCH_GATHER(aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Z], au32Parent))));
+  }
+
+#endif /* __orxFRAME_SSE2__ || __orxFRAME_NEON__ */
+
+  /* For all remaining entries */
+  for(; i < _u32End; i++)
+  {
+    /* Computes it */
+    orxFrame_ComputeBatchEntry(i);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Stores a batch entry's global values back into its frame
+ * @param[in]   _u32Index       Batch index
+ */
+static orxINLINE void orxFrame_StoreBatch(orxU32 _u32Index)
+{
+  orxFRAME   *pstFrame;
+  orxFLOAT  **aafValue;
+  orxVECTOR   vPos, vScale;
+
+  /* Gets frame & values */
+  pstFrame = sstFrame.apstBatchFrame[_u32Index];
+  aafValue = sstFrame.aafBatchValue;
+
+  /* Stores them */
+  _orxFrame_SetRotation(pstFrame, aafValue[orxFRAME_BATCH_VALUE_GLOBAL_ROTATION][_u32Index], orxFRAME_SPACE_GLOBAL);
+  _orxFrame_SetScale(pstFrame, orxVector_Set(&vScale, aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_X][_u32Index], aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_Y][_u32Index], orxFLOAT_1), orxFRAME_SPACE_GLOBAL);
+  _orxFrame_SetPosition(pstFrame, orxVector_Set(&vPos, aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_X][_u32Index], aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Y][_u32Index], aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Z][_u32Index]), orxFRAME_SPACE_GLOBAL);
+
+  /* Done! */
+  return;
+}
+
+/** Computes and stores batch entries
+ * @param[in]   _u32Start       First batch index
+ * @param[in]   _u32End         Last batch index (excluded)
+ */
+static orxINLINE void orxFrame_UpdateBatch(orxU32 _u32Start, orxU32 _u32End)
+{
+  orxU32 i;
+
+  /* Computes them */
+  orxFrame_ComputeBatch(_u32Start, _u32End);
+
+  /* For all of them */
+  for(i = _u32Start; i < _u32End; i++)
+  {
+    /* Stores it */
+    orxFrame_StoreBatch(i);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Processes the children of an updated sibling group of batch entries, depth first
+ * @param[in]   _u32Start       Group's first batch index, group ending with the batch
+ */
+static void orxFASTCALL orxFrame_ProcessBatchGroup(orxU32 _u32Start)
+{
+  orxU32 u32End, i;
+
+  /* For all group entries */
+  for(i = _u32Start, u32End = sstFrame.u32BatchCount; i < u32End; i++)
+  {
+    orxFRAME *pstChild;
+
+    /* Has children? */
+    if((pstChild = sstFrame.apstBatchChild[i]) != orxNULL)
+    {
+      orxU32 u32Child, u32Chunk;
+
+      /* Stores its rotation */
+      orxFrame_SetBatchRotation(i);
+
+      /* For all children */
+      for(u32Child = u32Chunk = sstFrame.u32BatchCount;
+          pstChild != orxNULL;
+          pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
+      {
+        /* Can't add it to the batch? */
+        if(orxFrame_AddBatch(pstChild, i) == orxSTATUS_FAILURE)
+        {
+          /* Processes it recursively */
+          orxFrame_ProcessInternal(pstChild, sstFrame.apstBatchFrame[i]);
+        }
+        /* Chunk full? */
+        else if(sstFrame.u32BatchCount - u32Chunk == orxFRAME_KU32_BATCH_CHUNK_SIZE)
+        {
+          /* Updates it while its frames are still cached */
+          orxFrame_UpdateBatch(u32Chunk, sstFrame.u32BatchCount);
+          u32Chunk = sstFrame.u32BatchCount;
+        }
+      }
+
+      /* Updates last chunk */
+      orxFrame_UpdateBatch(u32Chunk, sstFrame.u32BatchCount);
+
+      /* Processes children's own children */
+      orxFrame_ProcessBatchGroup(u32Child);
+    }
+  }
+
+  /* Removes group */
+  sstFrame.u32BatchCount = _u32Start;
+
+  /* Done! */
+  return;
+}
+
+/** Processes a frame hierarchy using batched SoA buffers, one sibling group at a time
+ * @param[in]   _pstFrame       Concerned frame
+ * @param[in]   _pstParent      Parent frame
+ */
+static void orxFASTCALL orxFrame_ProcessBatch(orxFRAME *_pstFrame, const orxFRAME *_pstParent)
+{
+  orxFLOAT **aafValue;
+
+  /* Clears batch */
+  sstFrame.u32BatchCount = 0;
+
+  /* Not enough room for parent & frame? */
+  if((sstFrame.u32BatchSize < 2) && (orxFrame_GrowBatch() == orxSTATUS_FAILURE))
+  {
+    /* Processes it recursively */
+    orxFrame_ProcessInternal(_pstFrame, _pstParent);
+
+    /* Done! */
+    return;
+  }
+
+  /* Stores parent as first entry, root acting as identity */
+  aafValue = sstFrame.aafBatchValue;
+  if(_pstParent != sstFrame.pstRoot)
+  {
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_X][0] = _pstParent->stData.vGlobalPos.fX;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Y][0] = _pstParent->stData.vGlobalPos.fY;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Z][0] = _pstParent->stData.vGlobalPos.fZ;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_ROTATION][0]   = _pstParent->stData.fGlobalRotation;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_X][0]    = _pstParent->stData.fGlobalScaleX;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_Y][0]    = _pstParent->stData.fGlobalScaleY;
+  }
+  else
+  {
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_X][0] = orxFLOAT_0;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Y][0] = orxFLOAT_0;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_POSITION_Z][0] = orxFLOAT_0;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_ROTATION][0]   = orxFLOAT_0;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_X][0]    = orxFLOAT_1;
+    aafValue[orxFRAME_BATCH_VALUE_GLOBAL_SCALE_Y][0]    = orxFLOAT_1;
+  }
+  sstFrame.apstBatchFrame[0]  = (orxFRAME *)_pstParent;
+  sstFrame.u32BatchCount      = 1;
+
+  /* Adds frame */
+  orxFrame_SetBatchRotation(0);
+  orxFrame_AddBatch(_pstFrame, 0);
+
+  /* Updates it */
+  orxFrame_UpdateBatch(1, 2);
+
+  /* Processes its children */
+  orxFrame_ProcessBatchGroup(1);
+
+  /* Done! */
+  return;
+}
+
 /** Processes a frame
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _pstParent      Parent frame
@@ -671,8 +1258,17 @@ static orxINLINE void orxFrame_Process(orxFRAME *_pstFrame, const orxFRAME *_pst
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxFrame_Process");
 
-  /* Processes frame */
-  orxFrame_ProcessInternal(_pstFrame, _pstParent);
+  /* Has children? */
+  if(orxStructure_GetChild(_pstFrame) != orxNULL)
+  {
+    /* Processes frame hierarchy */
+    orxFrame_ProcessBatch(_pstFrame, _pstParent);
+  }
+  else
+  {
+    /* Updates frame's data */
+    orxFrame_UpdateData(_pstFrame, _pstParent);
+  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -1090,6 +1686,15 @@ void orxFASTCALL orxFrame_Exit()
     /* Deletes frame tree */
     orxFrame_DeleteAll();
 
+    /* Has batch buffers? */
+    if(sstFrame.apstBatchFrame != orxNULL)
+    {
+      /* Deletes them */
+      orxMemory_Free(sstFrame.apstBatchFrame);
+      sstFrame.apstBatchFrame = orxNULL;
+      sstFrame.u32BatchSize   = 0;
+    }
+
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_FRAME);
 
@@ -1176,6 +1781,9 @@ orxSTATUS orxFASTCALL orxFrame_Delete(orxFRAME *_pstFrame)
   {
     orxFRAME *pstParent;
 
+    /* Clears dirty status */
+    orxFrame_ClearDirty(_pstFrame);
+
     /* Gets parent frame */
     pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
@@ -1338,6 +1946,63 @@ orxBOOL orxFASTCALL orxFrame_IsRootChild(const orxFRAME *_pstFrame)
   return bResult;
 }
 
+/** Sets frame dirty tracking
+ * @param[in]   _pstFrame       Concerned frame
+ * @param[in]   _bTrack         If orxTRUE, any change of the frame's global data will add it to the dirty list
+ */
+void orxFASTCALL orxFrame_TrackDirty(orxFRAME *_pstFrame, orxBOOL _bTrack)
+{
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstFrame);
+
+  /* Track? */
+  if(_bTrack != orxFALSE)
+  {
+    /* Updates flags */
+    orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_TRACK_DIRTY, orxFRAME_KU32_FLAG_NONE);
+  }
+  else
+  {
+    /* Clears dirty status */
+    orxFrame_ClearDirty(_pstFrame);
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_TRACK_DIRTY);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Pops the next dirty frame: its dirty status is cleared
+ * @return orxFRAME / orxNULL if no tracked frame changed since the last pop
+ */
+orxFRAME *orxFASTCALL orxFrame_PopDirty()
+{
+  orxLINKLIST_NODE *pstNode;
+  orxFRAME         *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+
+  /* Gets first dirty node */
+  pstNode = orxLinkList_GetFirst(&(sstFrame.stDirtyList));
+
+  /* Valid? */
+  if(pstNode != orxNULL)
+  {
+    /* Gets its frame */
+    pstResult = orxSTRUCT_GET_FROM_FIELD(orxFRAME, stDirtyNode, pstNode);
+
+    /* Clears its dirty status */
+    orxFrame_ClearDirty(pstResult);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Sets frame position
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _eSpace         Coordinate space system to use
@@ -102,6 +102,14 @@
 #define orxOBJECT_KU32_GROUP_BANK_SIZE          64
 #define orxOBJECT_KU32_GROUP_TABLE_SIZE         64
 
+#define orxOBJECT_KU32_GRID_CELL_BANK_SIZE      256
+#define orxOBJECT_KU32_GRID_TABLE_SIZE          256
+#define orxOBJECT_KF_GRID_COORD_MAX             orx2F(1.0e9f)
+
+#define orxOBJECT_KU32_PREFAB_BANK_SIZE         64
+#define orxOBJECT_KU32_PREFAB_TABLE_SIZE        128
+#define orxOBJECT_PREFAB_HAS_KEY(MASK, KEY)     (((MASK) & ((orxU64)1 << orxOBJECT_PREFAB_KEY_##KEY)) != 0)
+
 #define orxOBJECT_KU32_OVERRIDE_MARKER_LENGTH   2
 
 #define orxOBJECT_KU32_STACK_SIZE               64
@@ -158,6 +166,7 @@
 #define orxOBJECT_KZ_CONFIG_ON_PREPARE          "OnPrepare"
 #define orxOBJECT_KZ_CONFIG_ON_CREATE           "OnCreate"
 #define orxOBJECT_KZ_CONFIG_ON_DELETE           "OnDelete"
+#define orxOBJECT_KZ_CONFIG_GRID_SECTION        "ObjectGrid"
 #define orxOBJECT_KZ_OVERRIDE_MARKER            "->"
 #define orxOBJECT_KZ_CENTERED_PIVOT             "center"
 #define orxOBJECT_KZ_TRUNCATE_PIVOT             "truncate"
@@ -219,15 +228,80 @@ void orxFASTCALL orxObject_##FUNCTION##Recursive(orxOBJECT *_pstObject, PARAM_TY
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Prefab keys: optional config properties whose presence is cached per section
+ */
+typedef enum __orxOBJECT_PREFAB_KEY_t
+{
+  orxOBJECT_PREFAB_KEY_AGE = 0,
+  orxOBJECT_PREFAB_KEY_GROUP,
+  orxOBJECT_PREFAB_KEY_POSITION,
+  orxOBJECT_PREFAB_KEY_AUTO_SCROLL,
+  orxOBJECT_PREFAB_KEY_DEPTH_SCALE,
+  orxOBJECT_PREFAB_KEY_IGNORE_FROM_PARENT,
+  orxOBJECT_PREFAB_KEY_PARENT_CAMERA,
+  orxOBJECT_PREFAB_KEY_USE_PARENT_SPACE,
+  orxOBJECT_PREFAB_KEY_TRIGGER_LIST,
+  orxOBJECT_PREFAB_KEY_GRAPHIC_NAME,
+  orxOBJECT_PREFAB_KEY_ANIMPOINTER_NAME,
+  orxOBJECT_PREFAB_KEY_FLIP,
+  orxOBJECT_PREFAB_KEY_ORIGIN,
+  orxOBJECT_PREFAB_KEY_SIZE,
+  orxOBJECT_PREFAB_KEY_PIVOT,
+  orxOBJECT_PREFAB_KEY_SCALE,
+  orxOBJECT_PREFAB_KEY_COLOR,
+  orxOBJECT_PREFAB_KEY_RGB,
+  orxOBJECT_PREFAB_KEY_HSL,
+  orxOBJECT_PREFAB_KEY_HSV,
+  orxOBJECT_PREFAB_KEY_ALPHA,
+  orxOBJECT_PREFAB_KEY_BODY,
+  orxOBJECT_PREFAB_KEY_CLOCK,
+  orxOBJECT_PREFAB_KEY_ROTATION,
+  orxOBJECT_PREFAB_KEY_SPHERICAL_POSITION,
+  orxOBJECT_PREFAB_KEY_CHILD_LIST,
+  orxOBJECT_PREFAB_KEY_SPEED,
+  orxOBJECT_PREFAB_KEY_ANGULAR_VELOCITY,
+  orxOBJECT_PREFAB_KEY_SOUND_LIST,
+  orxOBJECT_PREFAB_KEY_FX_LIST,
+  orxOBJECT_PREFAB_KEY_SPAWNER,
+  orxOBJECT_PREFAB_KEY_SHADER,
+  orxOBJECT_PREFAB_KEY_SHADER_LIST,
+  orxOBJECT_PREFAB_KEY_TRACK_LIST,
+  orxOBJECT_PREFAB_KEY_SMOOTHING,
+  orxOBJECT_PREFAB_KEY_BLEND_MODE,
+  orxOBJECT_PREFAB_KEY_REPEAT,
+  orxOBJECT_PREFAB_KEY_LIFETIME,
+  orxOBJECT_PREFAB_KEY_ON_PREPARE,
+  orxOBJECT_PREFAB_KEY_ON_CREATE,
+  orxOBJECT_PREFAB_KEY_ON_DELETE,
+
+  orxOBJECT_PREFAB_KEY_NUMBER,
+
+  orxOBJECT_PREFAB_KEY_NONE = orxENUM_NONE
+
+} orxOBJECT_PREFAB_KEY;
+
 /** Object lists
  */
 typedef struct __orxOBJECT_LISTS_t
 {
   orxLINKLIST       stList;                     /**< List : 12 / 24 */
   orxLINKLIST       stEnableList;               /**< Enable list : 24 / 48 */
+  orxHASHTABLE     *pstCellTable;               /**< Grid cell table : 28 / 56 */
+  orxFLOAT          fRecCellSize;               /**< Grid reciprocal cell size : 32 / 60 */
+  orxFLOAT          fMaxExtentX;                /**< Grid max object X half-extent : 36 / 64 */
+  orxFLOAT          fMaxExtentY;                /**< Grid max object Y half-extent : 40 / 68 */
 
 } orxOBJECT_LISTS;
 
+/** Object prefab structure: resolved config layout of an object section
+ */
+typedef struct __orxOBJECT_PREFAB_t
+{
+  orxU64            u64KeyMask;                 /**< Present keys mask : 8 */
+  orxU32            u32Revision;                /**< Config revision : 12 */
+
+} orxOBJECT_PREFAB;
+
 /** Object context structure
  */
 typedef struct __orxOBJECT_CONTEXT_t
@@ -257,7 +331,9 @@ struct __orxOBJECT_t
   orxLINKLIST_NODE  stGroupNode;                /**< Group node: 172 / 256 */
   orxLINKLIST_NODE  stEnableNode;               /**< Enable node: 184 / 280 */
   orxLINKLIST_NODE  stEnableGroupNode;          /**< Enable group node: 196 / 304 */
-  const orxSTRING   zOnDelete;                  /**< On Delete command : 200 / 312 */
+  orxLINKLIST_NODE  stGridNode;                 /**< Grid cell node: 208 / 328 */
+  orxU64            u64GridCell;                /**< Grid cell key : 216 / 336 */
+  const orxSTRING   zOnDelete;                  /**< On Delete command : 220 / 344 */
 };
 
 /** Static structure
@@ -267,7 +343,10 @@ typedef struct __orxOBJECT_STATIC_t
   orxCLOCK         *pstClock;                   /**< Clock */
   orxBANK          *pstGroupBank;               /**< Group bank */
   orxBANK          *pstAgeBank;                 /**< Age bank */
+  orxBANK          *pstGridCellBank;            /**< Grid cell bank */
+  orxBANK          *pstPrefabBank;              /**< Prefab bank */
   orxHASHTABLE     *pstGroupTable;              /**< Group table */
+  orxHASHTABLE     *pstPrefabTable;             /**< Prefab table */
   orxOBJECT_LISTS  *pstCachedGroupLists;        /**< Cached group lists */
   orxOBJECT        *pstCurrentParent;           /**< Current parent */
   orxFRAME         *pstFrame;                   /**< Conversion frame */
@@ -275,6 +354,9 @@ typedef struct __orxOBJECT_STATIC_t
   orxSTRINGID       stDefaultGroupID;           /**< Default group ID */
   orxSTRINGID       stCurrentGroupID;           /**< Current group ID */
   orxSTRINGID       stCachedGroupID;            /**< Cached group ID */
+  orxU64           *au64NeighborList;           /**< Neighbor list */
+  orxU32            u32NeighborCount;           /**< Neighbor count */
+  orxU32            u32NeighborSize;            /**< Neighbor list size */
   orxU32            u32Flags;                   /**< Control flags */
 
 #ifdef __orxDEBUG__
@@ -292,6 +374,53 @@ typedef struct __orxOBJECT_STATIC_t
  */
 static orxOBJECT_STATIC sstObject;
 
+/** Prefab key names
+ */
+static const orxSTRING sazObjectPrefabKeyList[orxOBJECT_PREFAB_KEY_NUMBER] =
+{
+  orxOBJECT_KZ_CONFIG_AGE,
+  orxOBJECT_KZ_CONFIG_GROUP,
+  orxOBJECT_KZ_CONFIG_POSITION,
+  orxOBJECT_KZ_CONFIG_AUTO_SCROLL,
+  orxOBJECT_KZ_CONFIG_DEPTH_SCALE,
+  orxOBJECT_KZ_CONFIG_IGNORE_FROM_PARENT,
+  orxOBJECT_KZ_CONFIG_PARENT_CAMERA,
+  orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE,
+  orxOBJECT_KZ_CONFIG_TRIGGER_LIST,
+  orxOBJECT_KZ_CONFIG_GRAPHIC_NAME,
+  orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME,
+  orxOBJECT_KZ_CONFIG_FLIP,
+  orxOBJECT_KZ_CONFIG_ORIGIN,
+  orxOBJECT_KZ_CONFIG_SIZE,
+  orxOBJECT_KZ_CONFIG_PIVOT,
+  orxOBJECT_KZ_CONFIG_SCALE,
+  orxOBJECT_KZ_CONFIG_COLOR,
+  orxOBJECT_KZ_CONFIG_RGB,
+  orxOBJECT_KZ_CONFIG_HSL,
+  orxOBJECT_KZ_CONFIG_HSV,
+  orxOBJECT_KZ_CONFIG_ALPHA,
+  orxOBJECT_KZ_CONFIG_BODY,
+  orxOBJECT_KZ_CONFIG_CLOCK,
+  orxOBJECT_KZ_CONFIG_ROTATION,
+  orxOBJECT_KZ_CONFIG_SPHERICAL_POSITION,
+  orxOBJECT_KZ_CONFIG_CHILD_LIST,
+  orxOBJECT_KZ_CONFIG_SPEED,
+  orxOBJECT_KZ_CONFIG_ANGULAR_VELOCITY,
+  orxOBJECT_KZ_CONFIG_SOUND_LIST,
+  orxOBJECT_KZ_CONFIG_FX_LIST,
+  orxOBJECT_KZ_CONFIG_SPAWNER,
+  orxOBJECT_KZ_CONFIG_SHADER,
+  orxOBJECT_KZ_CONFIG_SHADER_LIST,
+  orxOBJECT_KZ_CONFIG_TRACK_LIST,
+  orxOBJECT_KZ_CONFIG_SMOOTHING,
+  orxOBJECT_KZ_CONFIG_BLEND_MODE,
+  orxOBJECT_KZ_CONFIG_REPEAT,
+  orxOBJECT_KZ_CONFIG_LIFETIME,
+  orxOBJECT_KZ_CONFIG_ON_PREPARE,
+  orxOBJECT_KZ_CONFIG_ON_CREATE,
+  orxOBJECT_KZ_CONFIG_ON_DELETE
+};
+
 
 /***************************************************************************
  * Private functions                                                       *
@@ -301,6 +430,301 @@ static orxOBJECT_STATIC sstObject;
  */
 orxVECTOR *orxFASTCALL orxConfig_ToVector(const orxSTRING _zValue, orxCOLORSPACE _eColorSpace, orxVECTOR *_pvVector);
 
+/** Gets group lists
+ */
+static orxINLINE orxOBJECT_LISTS *orxObject_GetGroupLists(orxSTRINGID _stGroupID)
+{
+  orxOBJECT_LISTS *pstResult;
+
+  /* Is cached one? */
+  if(_stGroupID == sstObject.stCachedGroupID)
+  {
+    /* Gets it */
+    pstResult = sstObject.pstCachedGroupLists;
+  }
+  else
+  {
+    /* Gets group lists */
+    pstResult = (orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
+
+    /* Valid? */
+    if(pstResult != orxNULL)
+    {
+      /* Caches it */
+      sstObject.pstCachedGroupLists = pstResult;
+      sstObject.stCachedGroupID     = _stGroupID;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets grid cell coordinate
+ */
+static orxINLINE orxS32 orxObject_GetGridCoord(orxFLOAT _fValue, const orxOBJECT_LISTS *_pstGroupLists)
+{
+  orxFLOAT fCoord;
+
+  /* Gets clamped cell coordinate */
+  fCoord = orxMath_Floor(_fValue * _pstGroupLists->fRecCellSize);
+  fCoord = orxCLAMP(fCoord, -orxOBJECT_KF_GRID_COORD_MAX, orxOBJECT_KF_GRID_COORD_MAX);
+
+  /* Done! */
+  return (orxS32)fCoord;
+}
+
+/** Gets grid cell key (bijective, with mixed low bits as the hash table only uses those for bucket selection)
+ */
+static orxINLINE orxU64 orxObject_GetGridCellKey(orxS32 _s32X, orxS32 _s32Y)
+{
+  /* Done! */
+  return ((orxU64)(orxU32)_s32X << 32) | (orxU64)((orxU32)_s32Y ^ ((orxU32)_s32X * 0x9E3779B1U));
+}
+
+/** Gets object's axis-aligned extents, in the XY plane
+ */
+static orxINLINE void orxObject_GetGridExtents(const orxOBJECT *_pstObject, orxVECTOR *_pvCenter, orxFLOAT *_pfExtentX, orxFLOAT *_pfExtentY)
+{
+  orxOBOX stBox;
+
+  /* Gets bounding box & its center */
+  orxObject_GetBoundingBox(_pstObject, &stBox);
+  orxOBox_GetCenter(&stBox, _pvCenter);
+
+  /* Gets half-extents */
+  *_pfExtentX = orx2F(0.5f) * (orxMath_Abs(stBox.vX.fX) + orxMath_Abs(stBox.vY.fX));
+  *_pfExtentY = orx2F(0.5f) * (orxMath_Abs(stBox.vX.fY) + orxMath_Abs(stBox.vY.fY));
+
+  /* Done! */
+  return;
+}
+
+/** Removes an object from its group grid
+ */
+static orxINLINE void orxObject_RemoveFromGrid(orxOBJECT *_pstObject, orxOBJECT_LISTS *_pstGroupLists)
+{
+  orxLINKLIST *pstCell;
+
+  /* Gets its cell */
+  pstCell = orxLinkList_GetList(&(_pstObject->stGridNode));
+
+  /* Valid? */
+  if(pstCell != orxNULL)
+  {
+    /* Removes object from it */
+    orxLinkList_Remove(&(_pstObject->stGridNode));
+
+    /* Empty cell? */
+    if(orxLinkList_GetCount(pstCell) == 0)
+    {
+      /* Removes it from table */
+      orxHashTable_Remove(_pstGroupLists->pstCellTable, _pstObject->u64GridCell);
+
+      /* Frees it */
+      orxBank_Free(sstObject.pstGridCellBank, pstCell);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates an object's cell in its group grid
+ */
+static void orxFASTCALL orxObject_UpdateGridCell(orxOBJECT *_pstObject, orxOBJECT_LISTS *_pstGroupLists)
+{
+  /* Checks */
+  orxASSERT(_pstGroupLists->pstCellTable != orxNULL);
+
+  /* Has frame? */
+  if(_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME] != orxNULL)
+  {
+    orxVECTOR vCenter;
+    orxFLOAT  fExtentX, fExtentY;
+    orxU64    u64Key;
+
+    /* Gets its extents */
+    orxObject_GetGridExtents(_pstObject, &vCenter, &fExtentX, &fExtentY);
+
+    /* Updates group max extents */
+    _pstGroupLists->fMaxExtentX = orxMAX(_pstGroupLists->fMaxExtentX, fExtentX);
+    _pstGroupLists->fMaxExtentY = orxMAX(_pstGroupLists->fMaxExtentY, fExtentY);
+
+    /* Gets its cell key */
+    u64Key = orxObject_GetGridCellKey(orxObject_GetGridCoord(vCenter.fX, _pstGroupLists), orxObject_GetGridCoord(vCenter.fY, _pstGroupLists));
+
+    /* New cell? */
+    if((u64Key != _pstObject->u64GridCell)
+    || (orxLinkList_GetList(&(_pstObject->stGridNode)) == orxNULL))
+    {
+      orxLINKLIST **ppstCell;
+
+      /* Removes it from its current cell */
+      orxObject_RemoveFromGrid(_pstObject, _pstGroupLists);
+
+      /* Gets new cell bucket */
+      ppstCell = (orxLINKLIST **)orxHashTable_Retrieve(_pstGroupLists->pstCellTable, u64Key);
+
+      /* Checks */
+      orxASSERT(ppstCell != orxNULL);
+
+      /* Not found? */
+      if(*ppstCell == orxNULL)
+      {
+        /* Allocates it */
+        *ppstCell = (orxLINKLIST *)orxBank_Allocate(sstObject.pstGridCellBank);
+
+        /* Checks */
+        orxASSERT(*ppstCell != orxNULL);
+
+        /* Clears it */
+        orxMemory_Zero(*ppstCell, sizeof(orxLINKLIST));
+      }
+
+      /* Adds object to it */
+      orxLinkList_AddEnd(*ppstCell, &(_pstObject->stGridNode));
+
+      /* Stores cell key */
+      _pstObject->u64GridCell = u64Key;
+    }
+  }
+  else
+  {
+    /* Removes it from grid */
+    orxObject_RemoveFromGrid(_pstObject, _pstGroupLists);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates an object in its group grid, if any
+ */
+static void orxFASTCALL orxObject_UpdateGrid(orxOBJECT *_pstObject)
+{
+  orxOBJECT_LISTS *pstGroupLists;
+
+  /* Gets its group lists */
+  pstGroupLists = orxObject_GetGroupLists(_pstObject->stGroupID);
+
+  /* Uses a grid? */
+  if((pstGroupLists != orxNULL) && (pstGroupLists->pstCellTable != orxNULL))
+  {
+    /* Has frame? */
+    if(_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME] != orxNULL)
+    {
+      /* Tracks its changes */
+      orxFrame_TrackDirty(orxFRAME(_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME]), orxTRUE);
+    }
+
+    /* Updates its cell */
+    orxObject_UpdateGridCell(_pstObject, pstGroupLists);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Processes all dirty frames, updating their objects' grid cells
+ */
+static void orxFASTCALL orxObject_ProcessDirtyFrames()
+{
+  orxFRAME *pstFrame;
+
+  /* For all dirty frames */
+  while((pstFrame = orxFrame_PopDirty()) != orxNULL)
+  {
+    orxOBJECT *pstObject;
+
+    /* Gets its object */
+    pstObject = orxOBJECT(orxStructure_GetOwner(pstFrame));
+
+    /* Valid? */
+    if((pstObject != orxNULL)
+    && (pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME] == orxSTRUCTURE(pstFrame)))
+    {
+      orxOBJECT_LISTS *pstGroupLists;
+
+      /* Gets its group lists */
+      pstGroupLists = orxObject_GetGroupLists(pstObject->stGroupID);
+
+      /* Uses a grid? */
+      if((pstGroupLists != orxNULL) && (pstGroupLists->pstCellTable != orxNULL))
+      {
+        /* Updates its cell */
+        orxObject_UpdateGridCell(pstObject, pstGroupLists);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets the grid cell range overlapped by a box, expanded by the group's max object extents
+ * @return orxTRUE if the range covers less cells than the group contains objects, orxFALSE otherwise
+ */
+static orxINLINE orxBOOL orxObject_GetGridRange(const orxOBOX *_pstBox, const orxOBJECT_LISTS *_pstGroupLists, orxS32 *_ps32MinX, orxS32 *_ps32MinY, orxS32 *_ps32MaxX, orxS32 *_ps32MaxY)
+{
+  orxVECTOR vCenter;
+  orxFLOAT  fExtentX, fExtentY, fCellCount;
+  orxBOOL   bResult;
+
+  /* Gets box center & half-extents, expanded by the group's max ones */
+  orxOBox_GetCenter(_pstBox, &vCenter);
+  fExtentX = orx2F(0.5f) * (orxMath_Abs(_pstBox->vX.fX) + orxMath_Abs(_pstBox->vY.fX)) + _pstGroupLists->fMaxExtentX;
+  fExtentY = orx2F(0.5f) * (orxMath_Abs(_pstBox->vX.fY) + orxMath_Abs(_pstBox->vY.fY)) + _pstGroupLists->fMaxExtentY;
+
+  /* Gets cell range */
+  *_ps32MinX = orxObject_GetGridCoord(vCenter.fX - fExtentX, _pstGroupLists);
+  *_ps32MinY = orxObject_GetGridCoord(vCenter.fY - fExtentY, _pstGroupLists);
+  *_ps32MaxX = orxObject_GetGridCoord(vCenter.fX + fExtentX, _pstGroupLists);
+  *_ps32MaxY = orxObject_GetGridCoord(vCenter.fY + fExtentY, _pstGroupLists);
+
+  /* Gets cell count */
+  fCellCount = (orxS2F(*_ps32MaxX) - orxS2F(*_ps32MinX) + orxFLOAT_1) * (orxS2F(*_ps32MaxY) - orxS2F(*_ps32MinY) + orxFLOAT_1);
+
+  /* Updates result */
+  bResult = (fCellCount < orxU2F(orxLinkList_GetCount(&(_pstGroupLists->stList)))) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Gets the grid of a group, processing pending changes, if the query box is small enough to make it worth it
+ */
+static orxINLINE orxOBJECT_LISTS *orxObject_GetQueryGrid(const orxOBOX *_pstBox, orxSTRINGID _stGroupID, orxS32 *_ps32MinX, orxS32 *_ps32MinY, orxS32 *_ps32MaxX, orxS32 *_ps32MaxY)
+{
+  orxOBJECT_LISTS *pstResult = orxNULL;
+
+  /* Has box and group? */
+  if((_pstBox != orxNULL) && (_stGroupID != orxSTRINGID_UNDEFINED))
+  {
+    orxOBJECT_LISTS *pstGroupLists;
+
+    /* Gets group lists */
+    pstGroupLists = orxObject_GetGroupLists(_stGroupID);
+
+    /* Uses a grid? */
+    if((pstGroupLists != orxNULL) && (pstGroupLists->pstCellTable != orxNULL))
+    {
+      /* Processes pending changes */
+      orxObject_ProcessDirtyFrames();
+
+      /* Worth it? */
+      if(orxObject_GetGridRange(_pstBox, pstGroupLists, _ps32MinX, _ps32MinY, _ps32MaxX, _ps32MaxY) != orxFALSE)
+      {
+        /* Updates result */
+        pstResult = pstGroupLists;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Update body scale
  */
 static void orxFASTCALL orxObject_UpdateBodyScale(orxOBJECT *_pstObject)
@@ -5113,6 +5537,107 @@ static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject, orxBO
   return eResult;
 }
 
+/** Gets the prefab key mask of the current config section, (re)building its prefab if needed
+ * @param[in]   _zSection                     Current config section
+ * @return      Mask of the optional keys that have to be read from config
+ */
+static orxU64 orxFASTCALL orxObject_GetPrefabKeyMask(const orxSTRING _zSection)
+{
+  orxOBJECT_PREFAB *pstPrefab = orxNULL;
+  orxSTRINGID       stID;
+  orxU32            u32Revision;
+  orxU64            u64Result = (orxU64)-1;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxObject_GetPrefabKeyMask");
+
+  /* Gets section ID & config revision */
+  stID        = orxString_Hash(_zSection);
+  u32Revision = orxConfig_GetRevision();
+
+  /* No prefab table yet? */
+  if(sstObject.pstPrefabTable == orxNULL)
+  {
+    /* Creates prefab bank & table */
+    sstObject.pstPrefabBank   = orxBank_Create(orxOBJECT_KU32_PREFAB_BANK_SIZE, sizeof(orxOBJECT_PREFAB), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstObject.pstPrefabTable  = orxHashTable_Create(orxOBJECT_KU32_PREFAB_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+  }
+  else
+  {
+    /* Gets prefab */
+    pstPrefab = (orxOBJECT_PREFAB *)orxHashTable_Get(sstObject.pstPrefabTable, stID);
+  }
+
+  /* Found and up-to-date? */
+  if((pstPrefab != orxNULL) && (pstPrefab->u32Revision == u32Revision))
+  {
+    /* Updates result */
+    u64Result = pstPrefab->u64KeyMask;
+  }
+  else
+  {
+    /* Not found? */
+    if(pstPrefab == orxNULL)
+    {
+      /* Valid bank & table? */
+      if((sstObject.pstPrefabBank != orxNULL) && (sstObject.pstPrefabTable != orxNULL))
+      {
+        /* Allocates prefab */
+        pstPrefab = (orxOBJECT_PREFAB *)orxBank_Allocate(sstObject.pstPrefabBank);
+
+        /* Valid? */
+        if(pstPrefab != orxNULL)
+        {
+          /* Can't store it? */
+          if(orxHashTable_Add(sstObject.pstPrefabTable, stID, pstPrefab) == orxSTATUS_FAILURE)
+          {
+            /* Frees it */
+            orxBank_Free(sstObject.pstPrefabBank, pstPrefab);
+            pstPrefab = orxNULL;
+          }
+        }
+      }
+    }
+
+    /* Valid? */
+    if(pstPrefab != orxNULL)
+    {
+      orxU32 i;
+
+      /* Clears its mask */
+      pstPrefab->u64KeyMask = 0;
+
+      /* For all prefab keys */
+      for(i = 0; i < orxOBJECT_PREFAB_KEY_NUMBER; i++)
+      {
+        /* Present? */
+        if(orxConfig_HasValueNoCheck(sazObjectPrefabKeyList[i]) != orxFALSE)
+        {
+          /* Updates mask */
+          pstPrefab->u64KeyMask |= (orxU64)1 << i;
+        }
+      }
+
+      /* Stores revision */
+      pstPrefab->u32Revision = u32Revision;
+
+      /* Note: in debug, the creation that (re)builds a prefab reads all its keys to preserve config typo checks */
+#ifndef __orxDEBUG__
+
+      /* Updates result */
+      u64Result = pstPrefab->u64KeyMask;
+
+#endif /* !__orxDEBUG__ */
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u64Result;
+}
+
 /** Event handler
  * @param[in]   _pstEvent                     Sent event
  * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
@@ -5441,6 +5966,14 @@ static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, co
           }
         }
 
+        /* Is animated and part of a grid? */
+        if((_pstObject->apstStructureList[orxSTRUCTURE_ID_ANIMPOINTER] != orxNULL)
+        && (orxLinkList_GetList(&(_pstObject->stGridNode)) != orxNULL))
+        {
+          /* Updates its grid cell (size might have changed) */
+          orxObject_UpdateGrid(_pstObject);
+        }
+
         /* Has no body or local update? */
         if((_pstObject->apstStructureList[orxSTRUCTURE_ID_BODY] == orxNULL)
         || orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_LOCAL_UPDATE))
@@ -5844,6 +6377,54 @@ void orxFASTCALL orxObject_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_OBJECT);
 
+    /* Has grids? */
+    if(sstObject.pstGridCellBank != orxNULL)
+    {
+      orxOBJECT_LISTS  *pstGroupLists;
+      orxHANDLE         hIterator;
+
+      /* For all groups */
+      for(hIterator = orxHashTable_GetNext(sstObject.pstGroupTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstGroupLists);
+          hIterator != orxHANDLE_UNDEFINED;
+          hIterator = orxHashTable_GetNext(sstObject.pstGroupTable, hIterator, orxNULL, (void **)&pstGroupLists))
+      {
+        /* Has grid? */
+        if(pstGroupLists->pstCellTable != orxNULL)
+        {
+          /* Deletes it */
+          orxHashTable_Delete(pstGroupLists->pstCellTable);
+        }
+      }
+
+      /* Deletes cell bank */
+      orxBank_Delete(sstObject.pstGridCellBank);
+      sstObject.pstGridCellBank = orxNULL;
+    }
+
+    /* Has neighbor list? */
+    if(sstObject.au64NeighborList != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(sstObject.au64NeighborList);
+      sstObject.au64NeighborList = orxNULL;
+    }
+
+    /* Has prefab table? */
+    if(sstObject.pstPrefabTable != orxNULL)
+    {
+      /* Deletes it */
+      orxHashTable_Delete(sstObject.pstPrefabTable);
+      sstObject.pstPrefabTable = orxNULL;
+    }
+
+    /* Has prefab bank? */
+    if(sstObject.pstPrefabBank != orxNULL)
+    {
+      /* Deletes it */
+      orxBank_Delete(sstObject.pstPrefabBank);
+      sstObject.pstPrefabBank = orxNULL;
+    }
+
     /* Deletes group table */
     orxHashTable_Delete(sstObject.pstGroupTable);
 
@@ -5961,6 +6542,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
       orxCOMMAND_VAR  stCommandResult;
       const orxSTRING zCommand;
       orxSTRUCTURE   *pstParent = orxNULL;
+      orxU64          u64KeyMask;
 
       /* Stores reference */
       pstResult->zReference = orxConfig_GetCurrentSection();
@@ -6011,7 +6593,8 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
       /* Should continue? */
       if((orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
-      && (((zCommand = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_PREPARE)) == orxSTRING_EMPTY)
+      && ((orxOBJECT_PREFAB_HAS_KEY(orxObject_GetPrefabKeyMask(pstResult->zReference), ON_PREPARE) == orxFALSE)
+       || ((zCommand = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_PREPARE)) == orxSTRING_EMPTY)
        || (orxCommand_EvaluateWithGUID(zCommand, orxStructure_GetGUID(pstResult), &stCommandResult) == orxNULL)
        || ((stCommandResult.eType != orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.eType != orxCOMMAND_VAR_TYPE_STRING))
        || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_STRING) && (*stCommandResult.zValue != orxNULL) && (orxString_ICompare(stCommandResult.zValue, orxSTRING_FALSE) != 0))
@@ -6041,6 +6624,9 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxBOOL         bUseParentScale = orxFALSE, bUseParentPosition = orxFALSE, bHasColor = orxFALSE, bUseParentSpace = orxFALSE, bHasPosition = orxFALSE, bTypoCheck;
         orxCHAR         acPositionBuffer[128];
 
+        /* Gets prefab key mask (refreshed if PREPARE handlers or OnPrepare modified config) */
+        u64KeyMask = orxObject_GetPrefabKeyMask(pstResult->zReference);
+
         /* Backups current parent */
         pstPreviousObject = sstObject.pstCurrentParent;
 
@@ -6048,7 +6634,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         sstObject.pstCurrentParent = orxNULL;
 
         /* Gets age */
-        fAge = orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_AGE);
+        fAge = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, AGE) ? orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_AGE) : orxFLOAT_0;
 
         /* Valid? */
         if(fAge > orxFLOAT_0)
@@ -6070,7 +6656,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Has group? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_GROUP) != orxFALSE)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, GROUP) && (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_GROUP) != orxFALSE))
         {
           /* Sets it */
           orxObject_SetGroupID(pstResult, orxString_GetID(orxConfig_GetString(orxOBJECT_KZ_CONFIG_GROUP)));
@@ -6083,7 +6669,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Gets position literals */
-        orxString_NPrint(acPositionBuffer, sizeof(acPositionBuffer), "%s", orxConfig_GetString(orxOBJECT_KZ_CONFIG_POSITION));
+        orxString_NPrint(acPositionBuffer, sizeof(acPositionBuffer), "%s", orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, POSITION) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_POSITION) : orxSTRING_EMPTY);
         zPosition = acPositionBuffer;
 
         /* Has pivot override? */
@@ -6111,7 +6697,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Frame *** */
 
         /* Gets auto scrolling value */
-        zAutoScrolling = orxConfig_GetString(orxOBJECT_KZ_CONFIG_AUTO_SCROLL);
+        zAutoScrolling = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, AUTO_SCROLL) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_AUTO_SCROLL) : orxSTRING_EMPTY;
 
         /* X auto scrolling? */
         if(orxString_ICompare(zAutoScrolling, orxOBJECT_KZ_X) == 0)
@@ -6138,14 +6724,14 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Depth scaling active? */
-        if(orxConfig_GetBool(orxOBJECT_KZ_CONFIG_DEPTH_SCALE) != orxFALSE)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, DEPTH_SCALE) && (orxConfig_GetBool(orxOBJECT_KZ_CONFIG_DEPTH_SCALE) != orxFALSE))
         {
           /* Updates frame flags */
           u32FrameFlags  |= orxFRAME_KU32_FLAG_DEPTH_SCALE;
         }
 
         /* Ignore from parent? */
-        zIgnoreFromParent = orxConfig_GetString(orxOBJECT_KZ_CONFIG_IGNORE_FROM_PARENT);
+        zIgnoreFromParent = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, IGNORE_FROM_PARENT) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_IGNORE_FROM_PARENT) : orxSTRING_EMPTY;
         if(*zIgnoreFromParent != orxCHAR_NULL)
         {
           /* Updates flags */
@@ -6181,7 +6767,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxMemory_Zero(&stParentBox, sizeof(orxAABOX));
 
         /* Gets camera file name */
-        zParentName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_PARENT_CAMERA);
+        zParentName = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, PARENT_CAMERA) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_PARENT_CAMERA) : orxSTRING_EMPTY;
 
         /* Valid? */
         if((zParentName != orxNULL) && (*zParentName != orxCHAR_NULL))
@@ -6223,7 +6809,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           if(pstParent != orxNULL)
           {
             /* Updates parent space status */
-            bUseParentSpace = orxConfig_HasValue(orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE);
+            bUseParentSpace = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, USE_PARENT_SPACE) ? orxConfig_HasValue(orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE) : orxFALSE;
 
             /* Is parent an object? */
             if(orxStructure_GetID(pstParent) == orxSTRUCTURE_ID_OBJECT)
@@ -6296,7 +6882,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           const orxSTRING zUseParentSpace;
 
           /* Gets its literal version */
-          zUseParentSpace = orxConfig_GetString(orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE);
+          zUseParentSpace = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, USE_PARENT_SPACE) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE) : orxSTRING_EMPTY;
 
           /* Defined? */
           if((zUseParentSpace != orxNULL) && (*zUseParentSpace != orxCHAR_NULL))
@@ -6344,7 +6930,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Trigger *** */
 
         /* Has triggers? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_TRIGGER_LIST)) > 0)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, TRIGGER_LIST) && ((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_TRIGGER_LIST)) > 0))
         {
           orxS32 i;
 
@@ -6373,7 +6959,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           const orxSTRING zGraphicName;
 
           /* Gets graphic file name */
-          zGraphicName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_GRAPHIC_NAME);
+          zGraphicName = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, GRAPHIC_NAME) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_GRAPHIC_NAME) : orxSTRING_EMPTY;
 
           /* Valid? */
           if((zGraphicName != orxNULL) && (*zGraphicName != orxCHAR_NULL))
@@ -6412,7 +6998,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           const orxSTRING zAnimPointerName;
 
           /* Gets animation set name */
-          zAnimPointerName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME);
+          zAnimPointerName = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, ANIMPOINTER_NAME) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME) : orxSTRING_EMPTY;
 
           /* Valid? */
           if((zAnimPointerName != orxNULL) && (*zAnimPointerName != orxCHAR_NULL))
@@ -6489,7 +7075,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Flip/Origin/Size/Pivot *** */
 
         /* Gets flip value */
-        zFlip = orxConfig_GetString(orxOBJECT_KZ_CONFIG_FLIP);
+        zFlip = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, FLIP) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_FLIP) : orxSTRING_EMPTY;
 
         /* Valid? */
         if(*zFlip != orxCHAR_NULL)
@@ -6521,21 +7107,21 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Has origin? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_ORIGIN, &vValue) != orxNULL)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, ORIGIN) && (orxConfig_GetVector(orxOBJECT_KZ_CONFIG_ORIGIN, &vValue) != orxNULL))
         {
           /* Updates object origin */
           orxObject_SetOrigin(pstResult, &vValue);
         }
 
         /* Has size? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SIZE, &vValue) != orxNULL)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, SIZE) && (orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SIZE, &vValue) != orxNULL))
         {
           /* Updates object size */
           orxObject_SetSize(pstResult, &vValue);
         }
 
         /* Gets pivot */
-        zPivot = orxString_SkipWhiteSpaces(orxConfig_GetString(orxOBJECT_KZ_CONFIG_PIVOT));
+        zPivot = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, PIVOT) ? orxString_SkipWhiteSpaces(orxConfig_GetString(orxOBJECT_KZ_CONFIG_PIVOT)) : orxSTRING_EMPTY;
 
         /* Valid? */
         if(*zPivot != orxCHAR_NULL)
@@ -6556,7 +7142,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Scale *** */
 
         /* Has scale? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_SCALE) != orxFALSE)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, SCALE) && (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_SCALE) != orxFALSE))
         {
           /* Is config scale not a vector? */
           if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SCALE, &vScale) == orxNULL)
@@ -6626,7 +7212,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxConfig_EnableTypoCheck(orxFALSE);
 
         /* Has color? */
-        if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_COLOR, orxCOLORSPACE_COMPONENT, &(stColor.vRGB)) != orxNULL)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, COLOR) && (orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_COLOR, orxCOLORSPACE_COMPONENT, &(stColor.vRGB)) != orxNULL))
         {
           /* Normalizes it */
           orxVector_Mulf(&(stColor.vRGB), &(stColor.vRGB), orxCOLOR_NORMALIZER);
@@ -6635,13 +7221,13 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           bHasColor = orxTRUE;
         }
         /* Has RGB values? */
-        else if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_RGB, orxCOLORSPACE_RGB, &(stColor.vRGB)) != orxNULL)
+        else if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, RGB) && (orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_RGB, orxCOLORSPACE_RGB, &(stColor.vRGB)) != orxNULL))
         {
           /* Updates status */
           bHasColor = orxTRUE;
         }
         /* Has HSL values? */
-        else if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_HSL, orxCOLORSPACE_HSL, &(stColor.vHSL)) != orxNULL)
+        else if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, HSL) && (orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_HSL, orxCOLORSPACE_HSL, &(stColor.vHSL)) != orxNULL))
         {
           /* Stores its RGB equivalent */
           orxColor_FromHSLToRGB(&stColor, &stColor);
@@ -6650,7 +7236,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           bHasColor = orxTRUE;
         }
         /* Has HSV values? */
-        else if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_HSV, orxCOLORSPACE_HSV, &(stColor.vHSV)) != orxNULL)
+        else if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, HSV) && (orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_HSV, orxCOLORSPACE_HSV, &(stColor.vHSV)) != orxNULL))
         {
           /* Stores its RGB equivalent */
           orxColor_FromHSVToRGB(&stColor, &stColor);
@@ -6663,7 +7249,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxConfig_EnableTypoCheck(bTypoCheck);
 
         /* Has alpha? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_ALPHA) != orxFALSE)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, ALPHA) && (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_ALPHA) != orxFALSE))
         {
           /* Doesn't have any color? */
           if(bHasColor == orxFALSE)
@@ -6701,7 +7287,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Body *** */
 
         /* Gets body name */
-        zBodyName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_BODY);
+        zBodyName = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, BODY) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_BODY) : orxSTRING_EMPTY;
 
         /* Sets it */
         pstBody = ((zBodyName != orxNULL) && (*zBodyName != orxCHAR_NULL)) ? orxObject_SetBodyFromConfig(pstResult, zBodyName) : orxNULL;
@@ -6709,7 +7295,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Clock *** */
 
         /* Gets clock name */
-        zClockName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_CLOCK);
+        zClockName = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, CLOCK) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_CLOCK) : orxSTRING_EMPTY;
 
         /* Valid? */
         if((zClockName != orxNULL) && (*zClockName != orxCHAR_NULL))
@@ -6743,7 +7329,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Rotation & position */
 
         /* Updates object rotation */
-        fRotation = orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ROTATION);
+        fRotation = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, ROTATION) ? orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ROTATION) : orxFLOAT_0;
         orxObject_SetRotation(pstResult, fRotation);
 
         /* Clears pivot override */
@@ -6918,7 +7504,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             bHasPosition = orxTRUE;
           }
           /* Has spherical position? */
-          else if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SPHERICAL_POSITION, &vPosition) != orxNULL)
+          else if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, SPHERICAL_POSITION) && (orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SPHERICAL_POSITION, &vPosition) != orxNULL))
           {
             /* Transforms it */
             vPosition.fTheta *= orxMATH_KF_DEG_TO_RAD;
@@ -6950,7 +7536,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Children *** */
 
         /* Has child list? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_LIST)) > 0)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, CHILD_LIST) && ((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_LIST)) > 0))
         {
           orxS32      i, s32JointNumber;
           orxOBJECT  *pstLastChild;
@@ -7046,7 +7632,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Speed *** */
 
         /* Has speed? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SPEED, &vValue) != orxNULL)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, SPEED) && (orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SPEED, &vValue) != orxNULL))
         {
           /* Uses relative speed? */
           if(orxConfig_GetBool(orxOBJECT_KZ_CONFIG_USE_RELATIVE_SPEED) != orxFALSE)
@@ -7064,12 +7650,12 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Angular velocity *** */
 
         /* Sets angular velocity? */
-        orxObject_SetAngularVelocity(pstResult, orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ANGULAR_VELOCITY));
+        orxObject_SetAngularVelocity(pstResult, orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, ANGULAR_VELOCITY) ? orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ANGULAR_VELOCITY) : orxFLOAT_0);
 
         /* *** Sound *** */
 
         /* Has sound? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_SOUND_LIST)) > 0)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, SOUND_LIST) && ((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_SOUND_LIST)) > 0))
         {
           orxS32 i;
 
@@ -7093,7 +7679,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** FX *** */
 
         /* Has FX? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_FX_LIST)) > 0)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, FX_LIST) && ((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_FX_LIST)) > 0))
         {
           orxCLOCK_INFO stClockInfo;
           orxS32        i, s32RecursiveCount;
@@ -7161,7 +7747,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Spawner *** */
 
         /* Gets spawner name */
-        zSpawnerName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_SPAWNER);
+        zSpawnerName = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, SPAWNER) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_SPAWNER) : orxSTRING_EMPTY;
 
         /* Valid? */
         if((zSpawnerName != orxNULL) && (*zSpawnerName != orxCHAR_NULL))
@@ -7198,10 +7784,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Shader *** */
 
         /* Gets shader name */
-        zShaderName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_SHADER);
+        zShaderName = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, SHADER) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_SHADER) : orxSTRING_EMPTY;
 
         /* Not found? */
-        if(*zShaderName == orxCHAR_NULL)
+        if((*zShaderName == orxCHAR_NULL) && orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, SHADER_LIST))
         {
           /* Gets first shader from list */
           zShaderName = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_SHADER_LIST, 0);
@@ -7224,7 +7810,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Timeline *** */
 
         /* Has TimeLine tracks? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_TRACK_LIST)) > 0)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, TRACK_LIST) && ((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_TRACK_LIST)) > 0))
         {
           orxS32 i;
 
@@ -7248,14 +7834,14 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Misc *** */
 
         /* Has smoothing value? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_SMOOTHING) != orxFALSE)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, SMOOTHING) && (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_SMOOTHING) != orxFALSE))
         {
           /* Updates flags */
           u32Flags |= (orxConfig_GetBool(orxOBJECT_KZ_CONFIG_SMOOTHING) != orxFALSE) ? orxOBJECT_KU32_FLAG_SMOOTHING_ON : orxOBJECT_KU32_FLAG_SMOOTHING_OFF;
         }
 
         /* Has blend mode? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_BLEND_MODE) != orxFALSE)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, BLEND_MODE) && (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_BLEND_MODE) != orxFALSE))
         {
           const orxSTRING zBlendMode;
 
@@ -7267,14 +7853,14 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Should repeat? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_REPEAT, &vValue) != orxNULL)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, REPEAT) && (orxConfig_GetVector(orxOBJECT_KZ_CONFIG_REPEAT, &vValue) != orxNULL))
         {
           /* Stores it */
           orxObject_SetRepeat(pstResult, vValue.fX, vValue.fY);
         }
 
         /* Has life time? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_LIFETIME) != orxFALSE)
+        if(orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, LIFETIME) && (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_LIFETIME) != orxFALSE))
         {
           /* Sets literal lifetime? */
           if(orxObject_SetLiteralLifeTime(pstResult, orxConfig_GetString(orxOBJECT_KZ_CONFIG_LIFETIME)) == orxSTATUS_FAILURE)
@@ -7288,7 +7874,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxStructure_SetFlags(pstResult, u32Flags, orxOBJECT_KU32_FLAG_NONE);
 
         /* Gets on-delete command? */
-        zCommand = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_DELETE);
+        zCommand = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, ON_DELETE) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_DELETE) : orxSTRING_EMPTY;
 
         /* Valid? */
         if(zCommand != orxSTRING_EMPTY)
@@ -7298,7 +7884,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Gets on-create command */
-        zCommand = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_CREATE);
+        zCommand = orxOBJECT_PREFAB_HAS_KEY(u64KeyMask, ON_CREATE) ? orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_CREATE) : orxSTRING_EMPTY;
 
         /* Valid? */
         if(zCommand != orxSTRING_EMPTY)
@@ -7498,6 +8084,15 @@ orxSTATUS orxFASTCALL orxObject_LinkStructure(orxOBJECT *_pstObject, orxSTRUCTUR
 
     /* Links new structure to object */
     _pstObject->apstStructureList[eStructureID] = _pstStructure;
+
+    /* Can affect bounding box? */
+    if((eStructureID == orxSTRUCTURE_ID_FRAME)
+    || (eStructureID == orxSTRUCTURE_ID_GRAPHIC)
+    || (eStructureID == orxSTRUCTURE_ID_ANIMPOINTER))
+    {
+      /* Updates grid */
+      orxObject_UpdateGrid(_pstObject);
+    }
   }
   else
   {
@@ -7531,6 +8126,20 @@ void orxFASTCALL orxObject_UnlinkStructure(orxOBJECT *_pstObject, orxSTRUCTURE_I
   /* Needs to be processed? */
   if(pstStructure != orxNULL)
   {
+    /* Frame? */
+    if(_eStructureID == orxSTRUCTURE_ID_FRAME)
+    {
+      /* Stops tracking its changes */
+      orxFrame_TrackDirty(orxFRAME(pstStructure), orxFALSE);
+
+      /* Part of a grid? */
+      if(orxLinkList_GetList(&(_pstObject->stGridNode)) != orxNULL)
+      {
+        /* Removes it */
+        orxObject_RemoveFromGrid(_pstObject, orxObject_GetGroupLists(_pstObject->stGroupID));
+      }
+    }
+
     /* Decreases structure reference count */
     orxStructure_DecreaseCount(pstStructure);
 
@@ -8405,6 +9014,13 @@ orxSTATUS orxFASTCALL orxObject_SetPivot(orxOBJECT *_pstObject, const orxVECTOR
     eResult = orxSTATUS_SUCCESS;
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Updates grid */
+    orxObject_UpdateGrid(_pstObject);
+  }
+
   /* Done! */
   return eResult;
 }
@@ -8455,6 +9071,13 @@ orxSTATUS orxFASTCALL orxObject_SetRelativePivot(orxOBJECT *_pstObject, orxU32 _
     }
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Updates grid */
+    orxObject_UpdateGrid(_pstObject);
+  }
+
   /* Done! */
   return eResult;
 }
@@ -8491,6 +9114,13 @@ orxSTATUS orxFASTCALL orxObject_SetOrigin(orxOBJECT *_pstObject, const orxVECTOR
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Updates grid */
+    orxObject_UpdateGrid(_pstObject);
+  }
+
   /* Done! */
   return eResult;
 }
@@ -8535,6 +9165,13 @@ orxSTATUS orxFASTCALL orxObject_SetSize(orxOBJECT *_pstObject, const orxVECTOR *
     eResult = orxSTATUS_SUCCESS;
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Updates grid */
+    orxObject_UpdateGrid(_pstObject);
+  }
+
   /* Done! */
   return eResult;
 }
@@ -12367,8 +13004,8 @@ const orxSTRING orxFASTCALL orxObject_GetName(const orxOBJECT *_pstObject)
  */
 orxSTATUS orxFASTCALL orxObject_ForAllNeighbors(const orxOBJECT_NEIGHBOR_FUNCTION _pfnNeighborCallback, const orxOBOX *_pstCheckBox, orxSTRINGID _stGroupID, orxBOOL _bEnabled, void *_pContext)
 {
-  orxOBJECT *(orxFASTCALL  *pfnGet)(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID);
-  orxOBJECT                *pstObject;
+  orxOBJECT_LISTS          *pstGroupLists;
+  orxS32                    s32MinX, s32MinY, s32MaxX, s32MaxY;
   orxSTATUS                 eResult = orxSTATUS_SUCCESS;
 
   /* Profiles */
@@ -12378,27 +13015,125 @@ orxSTATUS orxFASTCALL orxObject_ForAllNeighbors(const orxOBJECT_NEIGHBOR_FUNCTIO
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pfnNeighborCallback != orxNULL);
 
-  /* Selects get function */
-  pfnGet = (_bEnabled != orxFALSE) ? orxObject_GetNextEnabled : orxObject_GetNext;
+  /* Gets group grid */
+  pstGroupLists = orxObject_GetQueryGrid(_pstCheckBox, _stGroupID, &s32MinX, &s32MinY, &s32MaxX, &s32MaxY);
 
-  /* For all objects */
-  for(pstObject = pfnGet(orxNULL, _stGroupID);
-      pstObject != orxNULL;
-      pstObject = pfnGet(pstObject, _stGroupID))
+  /* Valid? */
+  if(pstGroupLists != orxNULL)
   {
-    orxOBOX stObjectBox;
+    orxU32 u32Base, i;
+    orxS32 s32X, s32Y;
+
+    /* Stores neighbor list base (nested calls will use the list above it) */
+    u32Base = sstObject.u32NeighborCount;
 
-    /* No box or is intersecting? */
-    if((_pstCheckBox == orxNULL)
-    || ((orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
-     && (orxOBox_ZAlignedTestIntersection(_pstCheckBox, &stObjectBox) != orxFALSE)))
+    /* For all overlapped cells */
+    for(s32Y = s32MinY; s32Y <= s32MaxY; s32Y++)
     {
-      /* Runs callback */
-      if(_pfnNeighborCallback(pstObject, _pContext) == orxFALSE)
+      for(s32X = s32MinX; s32X <= s32MaxX; s32X++)
       {
-        /* Updates result */
-        eResult = orxSTATUS_FAILURE;
-        break;
+        orxLINKLIST *pstCell;
+
+        /* Gets cell */
+        pstCell = (orxLINKLIST *)orxHashTable_Get(pstGroupLists->pstCellTable, orxObject_GetGridCellKey(s32X, s32Y));
+
+        /* Valid? */
+        if(pstCell != orxNULL)
+        {
+          orxLINKLIST_NODE *pstNode;
+
+          /* For all its objects */
+          for(pstNode = orxLinkList_GetFirst(pstCell);
+              pstNode != orxNULL;
+              pstNode = orxLinkList_GetNext(pstNode))
+          {
+            orxOBJECT *pstObject;
+            orxOBOX    stObjectBox;
+
+            /* Gets object */
+            pstObject = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stGridNode, pstNode);
+
+            /* Valid and intersecting? */
+            if(((_bEnabled == orxFALSE) || (orxLinkList_GetList(&(pstObject->stEnableGroupNode)) != orxNULL))
+            && (orxOBox_ZAlignedTestIntersection(_pstCheckBox, orxObject_GetBoundingBox(pstObject, &stObjectBox)) != orxFALSE))
+            {
+              /* Neighbor list full? */
+              if(sstObject.u32NeighborCount == sstObject.u32NeighborSize)
+              {
+                orxU32 u32NewSize;
+
+                /* Gets new size */
+                u32NewSize = (sstObject.u32NeighborSize != 0) ? sstObject.u32NeighborSize << 1 : orxOBJECT_KU32_NEIGHBOR_LIST_SIZE;
+
+                /* Resizes it */
+                sstObject.au64NeighborList = (orxU64 *)orxMemory_Reallocate(sstObject.au64NeighborList, u32NewSize * sizeof(orxU64), orxMEMORY_TYPE_MAIN);
+
+                /* Checks */
+                orxASSERT(sstObject.au64NeighborList != orxNULL);
+
+                /* Stores new size */
+                sstObject.u32NeighborSize = u32NewSize;
+              }
+
+              /* Stores its GUID (callbacks could delete objects or move them to other cells) */
+              sstObject.au64NeighborList[sstObject.u32NeighborCount++] = orxStructure_GetGUID(pstObject);
+            }
+          }
+        }
+      }
+    }
+
+    /* For all neighbors */
+    for(i = u32Base; i < sstObject.u32NeighborCount; i++)
+    {
+      orxOBJECT *pstObject;
+
+      /* Gets object */
+      pstObject = orxOBJECT(orxStructure_Get(sstObject.au64NeighborList[i]));
+
+      /* Still valid? */
+      if(pstObject != orxNULL)
+      {
+        /* Runs callback */
+        if(_pfnNeighborCallback(pstObject, _pContext) == orxFALSE)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+          break;
+        }
+      }
+    }
+
+    /* Restores neighbor list */
+    sstObject.u32NeighborCount = u32Base;
+  }
+  else
+  {
+    orxOBJECT *(orxFASTCALL  *pfnGet)(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID);
+    orxOBJECT                *pstObject;
+
+    /* Selects get function */
+    pfnGet = (_bEnabled != orxFALSE) ? orxObject_GetNextEnabled : orxObject_GetNext;
+
+    /* For all objects */
+    for(pstObject = pfnGet(orxNULL, _stGroupID);
+        pstObject != orxNULL;
+        pstObject = pfnGet(pstObject, _stGroupID))
+    {
+      orxOBOX stObjectBox;
+
+      /* No box or is intersecting? */
+      if((_pstCheckBox == orxNULL)
+      || ((orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
+       && (orxOBox_ZAlignedTestIntersection(_pstCheckBox, &stObjectBox) != orxFALSE)))
+      {
+        /* Runs callback */
+        if(_pfnNeighborCallback(pstObject, _pContext) == orxFALSE)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+          break;
+        }
       }
     }
   }
@@ -13333,6 +14068,12 @@ orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObject, orxSTRINGID _s
   orxSTRUCTURE_ASSERT(_pstObject);
   orxASSERT((_stGroupID != 0) && (_stGroupID != orxSTRINGID_UNDEFINED));
 
+  /* Removes object from its current grid */
+  if(orxLinkList_GetList(&(_pstObject->stGridNode)) != orxNULL)
+  {
+    orxObject_RemoveFromGrid(_pstObject, orxObject_GetGroupLists(_pstObject->stGroupID));
+  }
+
   /* Removes object from its current group */
   if(orxLinkList_GetList(&(_pstObject->stGroupNode)) != orxNULL)
   {
@@ -13362,6 +14103,40 @@ orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObject, orxSTRINGID _s
     /* Clears it */
     orxMemory_Zero(pstGroupLists, sizeof(orxOBJECT_LISTS));
 
+    /* Pushes grid config section */
+    orxConfig_PushSection(orxOBJECT_KZ_CONFIG_GRID_SECTION);
+
+    /* Has a grid cell size for this group? */
+    if(orxConfig_GetFloat(orxString_GetFromID(_stGroupID)) > orxFLOAT_0)
+    {
+      /* No cell bank yet? */
+      if(sstObject.pstGridCellBank == orxNULL)
+      {
+        /* Creates it */
+        sstObject.pstGridCellBank = orxBank_Create(orxOBJECT_KU32_GRID_CELL_BANK_SIZE, sizeof(orxLINKLIST), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      }
+
+      /* Valid? */
+      if(sstObject.pstGridCellBank != orxNULL)
+      {
+        /* Creates cell table */
+        pstGroupLists->pstCellTable = orxHashTable_Create(orxOBJECT_KU32_GRID_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+        /* Stores reciprocal cell size */
+        pstGroupLists->fRecCellSize = orxFLOAT_1 / orxConfig_GetFloat(orxString_GetFromID(_stGroupID));
+      }
+
+      /* Failure? */
+      if(pstGroupLists->pstCellTable == orxNULL)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't create grid for group <%s>: falling back to brute force queries.", orxString_GetFromID(_stGroupID));
+      }
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+
     /* Stores it */
     *ppstBucket = pstGroupLists;
   }
@@ -13384,6 +14159,25 @@ orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObject, orxSTRINGID _s
   /* Stores group ID */
   _pstObject->stGroupID = _stGroupID;
 
+  /* Has frame? */
+  if(_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME] != orxNULL)
+  {
+    /* Uses a grid? */
+    if(pstGroupLists->pstCellTable != orxNULL)
+    {
+      /* Tracks frame changes */
+      orxFrame_TrackDirty(orxFRAME(_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME]), orxTRUE);
+
+      /* Adds object to grid */
+      orxObject_UpdateGridCell(_pstObject, pstGroupLists);
+    }
+    else
+    {
+      /* Stops tracking frame changes */
+      orxFrame_TrackDirty(orxFRAME(_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME]), orxFALSE);
+    }
+  }
+
   /* Done! */
   return eResult;
 }
@@ -13613,39 +14407,102 @@ orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition, orxSTRINGID
  */
 orxOBJECT *orxFASTCALL orxObject_BoxPick(const orxOBOX *_pstBox, orxSTRINGID _stGroupID)
 {
-  orxFLOAT    fSelectedZ;
-  orxOBJECT  *pstResult = orxNULL, *pstObject;
+  orxOBJECT_LISTS  *pstGroupLists;
+  orxS32            s32MinX, s32MinY, s32MaxX, s32MaxY;
+  orxFLOAT          fSelectedZ;
+  orxOBJECT        *pstResult = orxNULL, *pstObject;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBox != orxNULL);
 
-  /* For all objects */
-  for(pstObject = orxObject_GetNextEnabled(orxNULL, _stGroupID), fSelectedZ = _pstBox->vPosition.fZ;
-      pstObject != orxNULL;
-      pstObject = orxObject_GetNextEnabled(pstObject, _stGroupID))
+  /* Gets group grid */
+  pstGroupLists = orxObject_GetQueryGrid(_pstBox, _stGroupID, &s32MinX, &s32MinY, &s32MaxX, &s32MaxY);
+
+  /* Valid? */
+  if(pstGroupLists != orxNULL)
   {
-    orxVECTOR vObjectPos;
+    orxS32 s32X, s32Y;
 
-    /* Gets object position */
-    if(orxObject_GetWorldPosition(pstObject, &vObjectPos) != orxNULL)
+    /* For all overlapped cells */
+    for(s32Y = s32MinY, fSelectedZ = _pstBox->vPosition.fZ; s32Y <= s32MaxY; s32Y++)
     {
-      /* No selection or above it? */
-      if((pstResult == orxNULL) || (vObjectPos.fZ <= fSelectedZ))
+      for(s32X = s32MinX; s32X <= s32MaxX; s32X++)
       {
-        orxOBOX stObjectBox;
+        orxLINKLIST *pstCell;
 
-        /* Gets its bounding box */
-        if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
+        /* Gets cell */
+        pstCell = (orxLINKLIST *)orxHashTable_Get(pstGroupLists->pstCellTable, orxObject_GetGridCellKey(s32X, s32Y));
+
+        /* Valid? */
+        if(pstCell != orxNULL)
         {
-          /* Does it intersect with box? */
-          if(orxOBox_ZAlignedTestIntersection(_pstBox, &stObjectBox) != orxFALSE)
+          orxLINKLIST_NODE *pstNode;
+
+          /* For all its objects */
+          for(pstNode = orxLinkList_GetFirst(pstCell);
+              pstNode != orxNULL;
+              pstNode = orxLinkList_GetNext(pstNode))
           {
-            /* Updates result */
-            pstResult = pstObject;
+            /* Gets object */
+            pstObject = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stGridNode, pstNode);
+
+            /* Is enabled? */
+            if(orxLinkList_GetList(&(pstObject->stEnableGroupNode)) != orxNULL)
+            {
+              orxOBOX stObjectBox;
+
+              /* Gets its bounding box */
+              orxObject_GetBoundingBox(pstObject, &stObjectBox);
+
+              /* No selection or above it? */
+              if((pstResult == orxNULL) || (stObjectBox.vPosition.fZ <= fSelectedZ))
+              {
+                /* Does it intersect with box? */
+                if(orxOBox_ZAlignedTestIntersection(_pstBox, &stObjectBox) != orxFALSE)
+                {
+                  /* Updates result */
+                  pstResult = pstObject;
 
-            /* Updates selected position */
-            fSelectedZ = vObjectPos.fZ;
+                  /* Updates selected position */
+                  fSelectedZ = stObjectBox.vPosition.fZ;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  else
+  {
+    /* For all objects */
+    for(pstObject = orxObject_GetNextEnabled(orxNULL, _stGroupID), fSelectedZ = _pstBox->vPosition.fZ;
+        pstObject != orxNULL;
+        pstObject = orxObject_GetNextEnabled(pstObject, _stGroupID))
+    {
+      orxVECTOR vObjectPos;
+
+      /* Gets object position */
+      if(orxObject_GetWorldPosition(pstObject, &vObjectPos) != orxNULL)
+      {
+        /* No selection or above it? */
+        if((pstResult == orxNULL) || (vObjectPos.fZ <= fSelectedZ))
+        {
+          orxOBOX stObjectBox;
+
+          /* Gets its bounding box */
+          if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
+          {
+            /* Does it intersect with box? */
+            if(orxOBox_ZAlignedTestIntersection(_pstBox, &stObjectBox) != orxFALSE)
+            {
+              /* Updates result */
+              pstResult = pstObject;
+
+              /* Updates selected position */
+              fSelectedZ = vObjectPos.fZ;
+            }
           }
         }
       }
@@ -120,6 +120,14 @@ typedef struct __orxSHADER_PARAM_VALUE_t
 
   orxFLOAT            fTimeWrap;                          /**< Time wrap : 40 */
   orxFX              *pstTimeFX;                          /**< Time FX : 44 */
+  orxFLOAT            fLastTime;                          /**< Time of last evaluation : 48 */
+
+  union
+  {
+    orxFLOAT          fUploadedValue;                     /**< Last uploaded float value : 52 */
+    const orxBITMAP  *pstUploadedValue;                   /**< Last uploaded bitmap value : 52 */
+    orxVECTOR         vUploadedValue;                     /**< Last uploaded vector value : 60 */
+  };                                                      /**< Union uploaded value : 60 */
 
 } orxSHADER_PARAM_VALUE;
 
@@ -143,6 +151,7 @@ typedef struct __orxSHADER_STATIC_t
   orxU32                u32Flags;                         /**< Control flags */
   orxHASHTABLE         *pstReferenceTable;                /**< Reference hash table */
   const orxCLOCK_INFO  *pstClockInfo;                     /**< Core clock info */
+  orxU32                u32ParamUploadCount;              /**< Param upload count */
 
 } orxSHADER_STATIC;
 
@@ -515,6 +524,211 @@ static orxSTATUS orxFASTCALL orxShader_EventHandler(const orxEVENT *_pstEvent)
   return eResult;
 }
 
+/** Gets owner's texture & time
+ * @param[in]   _pstOwner       Owner structure (orxOBJECT / orxVIEWPORT)
+ * @param[out]  _ppstTexture    Owner's texture
+ * @param[out]  _pfTime         Owner's time
+ */
+static orxINLINE void orxShader_GetOwnerInfo(const orxSTRUCTURE *_pstOwner, orxTEXTURE **_ppstTexture, orxFLOAT *_pfTime)
+{
+  /* Inits values */
+  *_ppstTexture = orxNULL;
+  *_pfTime      = orxFLOAT_0;
+
+  /* Depending on its type */
+  switch(orxStructure_GetID(_pstOwner))
+  {
+    case orxSTRUCTURE_ID_OBJECT:
+    {
+      orxOBJECT *pstObject;
+
+      /* Gets cast owner */
+      pstObject = orxOBJECT(_pstOwner);
+
+      /* Gets its working texture */
+      *_ppstTexture = orxObject_GetWorkingTexture(pstObject);
+
+      /* Gets its active time */
+      *_pfTime = orxObject_GetActiveTime(pstObject);
+
+      break;
+    }
+
+    case orxSTRUCTURE_ID_VIEWPORT:
+    {
+      /* Updates owner texture */
+      orxViewport_GetTextureList(orxVIEWPORT(_pstOwner), 1, _ppstTexture);
+
+      /* Gets core time */
+      *_pfTime = sstShader.pstClockInfo->fTime;
+
+      break;
+    }
+
+    default:
+    {
+      break;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Uploads parameter values of a started shader
+ * @param[in]   _pstShader        Concerned shader
+ * @param[in]   _pstOwnerTexture  Owner's texture
+ * @param[in]   _fTime            Owner's time
+ * @param[in]   _bForce           If true, all values are uploaded, otherwise only the ones that changed since their last upload
+ */
+static void orxFASTCALL orxShader_UploadParams(const orxSHADER *_pstShader, const orxTEXTURE *_pstOwnerTexture, orxFLOAT _fTime, orxBOOL _bForce)
+{
+  orxSHADER_PARAM_VALUE *pstParamValue;
+
+  /* For all parameter values */
+  for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
+      pstParamValue != orxNULL;
+      pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
+  {
+    /* Depending on parameter type */
+    switch(pstParamValue->pstParam->eType)
+    {
+      case orxSHADER_PARAM_TYPE_FLOAT:
+      {
+        /* Time and not already evaluated for this time? */
+        if((pstParamValue->fTimeWrap != orxFLOAT_0)
+        && ((_bForce != orxFALSE) || (pstParamValue->fLastTime != _fTime)))
+        {
+          /* Stores time */
+          pstParamValue->fLastTime = _fTime;
+
+          /* Gets time */
+          pstParamValue->fValue = _fTime;
+
+          /* Has time wrap? */
+          if(pstParamValue->fTimeWrap > orxFLOAT_0)
+          {
+            /* Applies it */
+            pstParamValue->fValue = orxMath_Mod(pstParamValue->fValue, pstParamValue->fTimeWrap);
+          }
+
+          /* Has time FX? */
+          if(pstParamValue->pstTimeFX != orxNULL)
+          {
+            /* Applies it */
+            pstParamValue->fValue = orxFX_GetFloat(pstParamValue->pstTimeFX, orxFLOAT_0, pstParamValue->fValue);
+          }
+        }
+
+        /* Should upload? */
+        if((_bForce != orxFALSE) || (pstParamValue->fValue != pstParamValue->fUploadedValue))
+        {
+          /* Sets it */
+          orxDisplay_SetShaderFloat(_pstShader->hData, pstParamValue->s32ID, pstParamValue->fValue);
+
+          /* Stores it */
+          pstParamValue->fUploadedValue = pstParamValue->fValue;
+
+          /* Updates count */
+          sstShader.u32ParamUploadCount++;
+        }
+
+        break;
+      }
+
+      case orxSHADER_PARAM_TYPE_TEXTURE:
+      {
+        const orxBITMAP *pstBitmap;
+
+        /* Has default texture? */
+        if(pstParamValue->pstValue != orxNULL)
+        {
+          /* Gets its bitmap */
+          pstBitmap = orxTexture_GetBitmap(pstParamValue->pstValue);
+        }
+        /* Has an owner texture? */
+        else if(_pstOwnerTexture != orxNULL)
+        {
+          /* Gets its bitmap */
+          pstBitmap = orxTexture_GetBitmap(_pstOwnerTexture);
+        }
+        else
+        {
+          /* No bitmap specified */
+          pstBitmap = orxNULL;
+        }
+
+        /* Should upload? */
+        if((_bForce != orxFALSE) || (pstBitmap != pstParamValue->pstUploadedValue))
+        {
+          /* Sets it */
+          orxDisplay_SetShaderBitmap(_pstShader->hData, pstParamValue->s32ID, pstBitmap);
+
+          /* Stores it */
+          pstParamValue->pstUploadedValue = pstBitmap;
+
+          /* Updates count */
+          sstShader.u32ParamUploadCount++;
+        }
+
+        break;
+      }
+
+      case orxSHADER_PARAM_TYPE_VECTOR:
+      {
+        /* Time and not already evaluated for this time? */
+        if((pstParamValue->fTimeWrap != orxFLOAT_0)
+        && ((_bForce != orxFALSE) || (pstParamValue->fLastTime != _fTime)))
+        {
+          orxFLOAT fValue;
+
+          /* Stores time */
+          pstParamValue->fLastTime = _fTime;
+
+          /* Gets time */
+          fValue = _fTime;
+
+          /* Has time wrap? */
+          if(pstParamValue->fTimeWrap > orxFLOAT_0)
+          {
+            /* Applies it */
+            fValue = orxMath_Mod(fValue, pstParamValue->fTimeWrap);
+          }
+
+          /* Checks */
+          orxASSERT(pstParamValue->pstTimeFX != orxNULL);
+
+          /* Gets vector value */
+          orxFX_GetVector(pstParamValue->pstTimeFX, orxFLOAT_0, fValue, &(pstParamValue->vValue));
+        }
+
+        /* Should upload? */
+        if((_bForce != orxFALSE) || (orxVector_AreEqual(&(pstParamValue->vValue), &(pstParamValue->vUploadedValue)) == orxFALSE))
+        {
+          /* Sets it */
+          orxDisplay_SetShaderVector(_pstShader->hData, pstParamValue->s32ID, &(pstParamValue->vValue));
+
+          /* Stores it */
+          orxVector_Copy(&(pstParamValue->vUploadedValue), &(pstParamValue->vValue));
+
+          /* Updates count */
+          sstShader.u32ParamUploadCount++;
+        }
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Deletes all the shaders
  */
 static orxINLINE void orxShader_DeleteAll()
@@ -980,150 +1194,18 @@ orxSTATUS orxFASTCALL orxShader_Start(const orxSHADER *_pstShader, const orxSTRU
     /* Success? */
     if(eResult != orxSTATUS_FAILURE)
     {
-      orxTEXTURE             *pstOwnerTexture = orxNULL;
+      orxTEXTURE             *pstOwnerTexture;
       orxSHADER_PARAM_VALUE  *pstParamValue;
-      orxFLOAT                fTime = orxFLOAT_0;
-
-      /* Depending on its type */
-      switch(orxStructure_GetID(_pstOwner))
-      {
-        case orxSTRUCTURE_ID_OBJECT:
-        {
-          orxOBJECT *pstObject;
-
-          /* Gets cast owner */
-          pstObject = orxOBJECT(_pstOwner);
-
-          /* Gets its working texture */
-          pstOwnerTexture = orxObject_GetWorkingTexture(pstObject);
-
-          /* Gets its active time */
-          fTime = orxObject_GetActiveTime(pstObject);
-
-          break;
-        }
-
-        case orxSTRUCTURE_ID_VIEWPORT:
-        {
-          /* Updates owner texture */
-          orxViewport_GetTextureList(orxVIEWPORT(_pstOwner), 1, &pstOwnerTexture);
-
-          /* Gets core time */
-          fTime = sstShader.pstClockInfo->fTime;
-
-          break;
-        }
+      orxFLOAT                fTime;
 
-        default:
-        {
-          break;
-        }
-      }
+      /* Gets owner's texture & time */
+      orxShader_GetOwnerInfo(_pstOwner, &pstOwnerTexture, &fTime);
 
       /* No custom param? */
       if(!orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM))
       {
-        /* For all parameter values */
-        for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
-            pstParamValue != orxNULL;
-            pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
-        {
-          /* Depending on parameter type */
-          switch(pstParamValue->pstParam->eType)
-          {
-            case orxSHADER_PARAM_TYPE_FLOAT:
-            {
-              /* Time? */
-              if(pstParamValue->fTimeWrap != orxFLOAT_0)
-              {
-                /* Gets time */
-                pstParamValue->fValue = fTime;
-
-                /* Has time wrap? */
-                if(pstParamValue->fTimeWrap > orxFLOAT_0)
-                {
-                  /* Applies it */
-                  pstParamValue->fValue = orxMath_Mod(pstParamValue->fValue, pstParamValue->fTimeWrap);
-                }
-
-                /* Has time FX? */
-                if(pstParamValue->pstTimeFX != orxNULL)
-                {
-                  /* Applies it */
-                  pstParamValue->fValue = orxFX_GetFloat(pstParamValue->pstTimeFX, orxFLOAT_0, pstParamValue->fValue);
-                }
-              }
-
-              /* Sets it */
-              orxDisplay_SetShaderFloat(_pstShader->hData, pstParamValue->s32ID, pstParamValue->fValue);
-
-              break;
-            }
-
-            case orxSHADER_PARAM_TYPE_TEXTURE:
-            {
-              orxBITMAP *pstBitmap;
-
-              /* Has default texture? */
-              if(pstParamValue->pstValue != orxNULL)
-              {
-                /* Gets its bitmap */
-                pstBitmap = orxTexture_GetBitmap(pstParamValue->pstValue);
-              }
-              /* Has an owner texture? */
-              else if(pstOwnerTexture != orxNULL)
-              {
-                /* Gets its bitmap */
-                pstBitmap = orxTexture_GetBitmap(pstOwnerTexture);
-              }
-              else
-              {
-                /* No bitmap specified */
-                pstBitmap = orxNULL;
-              }
-
-              /* Sets it */
-              orxDisplay_SetShaderBitmap(_pstShader->hData, pstParamValue->s32ID, pstBitmap);
-
-              break;
-            }
-
-            case orxSHADER_PARAM_TYPE_VECTOR:
-            {
-              /* Time? */
-              if(pstParamValue->fTimeWrap != orxFLOAT_0)
-              {
-                orxFLOAT fValue;
-
-                /* Gets time */
-                fValue = fTime;
-
-                /* Has time wrap? */
-                if(pstParamValue->fTimeWrap > orxFLOAT_0)
-                {
-                  /* Applies it */
-                  fValue = orxMath_Mod(fValue, pstParamValue->fTimeWrap);
-                }
-
-                /* Checks */
-                orxASSERT(pstParamValue->pstTimeFX != orxNULL);
-
-                /* Gets vector value */
-                orxFX_GetVector(pstParamValue->pstTimeFX, orxFLOAT_0, fValue, &(pstParamValue->vValue));
-              }
-
-              /* Sets it */
-              orxDisplay_SetShaderVector(_pstShader->hData, pstParamValue->s32ID, &(pstParamValue->vValue));
-
-              break;
-            }
-
-            default:
-            {
-              break;
-            }
-          }
-        }
+        /* Uploads all parameter values */
+        orxShader_UploadParams(_pstShader, pstOwnerTexture, fTime, orxTRUE);
       }
       else
       {
@@ -1181,6 +1263,9 @@ orxSTATUS orxFASTCALL orxShader_Start(const orxSHADER *_pstShader, const orxSTRU
               {
                 /* Sets it */
                 orxDisplay_SetShaderFloat(_pstShader->hData, pstParamValue->s32ID, stPayload.fValue);
+
+                /* Updates count */
+                sstShader.u32ParamUploadCount++;
               }
 
               break;
@@ -1196,6 +1281,9 @@ orxSTATUS orxFASTCALL orxShader_Start(const orxSHADER *_pstShader, const orxSTRU
               {
                 /* Sets it */
                 orxDisplay_SetShaderBitmap(_pstShader->hData, pstParamValue->s32ID, (stPayload.pstValue != orxNULL) ? orxTexture_GetBitmap(stPayload.pstValue) : orxNULL);
+
+                /* Updates count */
+                sstShader.u32ParamUploadCount++;
               }
 
               break;
@@ -1235,6 +1323,9 @@ orxSTATUS orxFASTCALL orxShader_Start(const orxSHADER *_pstShader, const orxSTRU
               {
                 /* Sets it */
                 orxDisplay_SetShaderVector(_pstShader->hData, pstParamValue->s32ID, &(stPayload.vValue));
+
+                /* Updates count */
+                sstShader.u32ParamUploadCount++;
               }
 
               break;
@@ -1295,6 +1386,61 @@ orxSTATUS orxFASTCALL orxShader_Stop(const orxSHADER *_pstShader)
   return eResult;
 }
 
+/** Restarts an already started shader for a new owner, only uploading the parameter values that changed since they were last uploaded
+ * @param[in] _pstShader              Concerned Shader, needs to be currently started
+ * @param[in] _pstOwner               New owner structure (orxOBJECT / orxVIEWPORT)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxShader_Restart(const orxSHADER *_pstShader, const orxSTRUCTURE *_pstOwner)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstShader.u32Flags & orxSHADER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstShader);
+  orxSTRUCTURE_ASSERT(_pstOwner);
+
+  /* Valid & enabled? */
+  if((_pstShader->hData != orxHANDLE_UNDEFINED) && (orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_ENABLED)))
+  {
+    /* Use custom param? */
+    if(orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM))
+    {
+      /* Stops it */
+      orxShader_Stop(_pstShader);
+
+      /* Starts it again, sending parameter events for the new owner */
+      eResult = orxShader_Start(_pstShader, _pstOwner);
+    }
+    else
+    {
+      orxTEXTURE *pstOwnerTexture;
+      orxFLOAT    fTime;
+
+      /* Gets owner's texture & time */
+      orxShader_GetOwnerInfo(_pstOwner, &pstOwnerTexture, &fTime);
+
+      /* Uploads modified parameter values */
+      orxShader_UploadParams(_pstShader, pstOwnerTexture, fTime, orxFALSE);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets the number of parameter values uploaded since the module was initialized
+ * @return Parameter value upload count
+ */
+orxU32 orxFASTCALL orxShader_GetParamUploadCount()
+{
+  /* Checks */
+  orxASSERT(sstShader.u32Flags & orxSHADER_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstShader.u32ParamUploadCount;
+}
+
 /** Adds a float parameter definition to a shader (parameters need to be set before compiling the shader code)
  * @param[in] _pstShader              Concerned Shader
  * @param[in] _zName                  Parameter's literal name
@@ -36,6 +36,12 @@
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "utils/orxString.h"
+#include "math/orxMath.h"
+
+
+/** Misc defines
+ */
+#define orxHASHTABLE_KU32_MAX_DISTANCE          255         /**< Max probe distance stored in open addressing metadata */
 
 
 /***************************************************************************
@@ -51,6 +57,14 @@ typedef struct __orxHASHTABLE_CELL_t
 
 } orxHASHTABLE_CELL;
 
+/** Hash table slot definition (open addressing) */
+typedef struct __orxHASHTABLE_SLOT_t
+{
+  orxU64                        u64Key;                       /**< Key element of a hash table : 8 / 8 */
+  void                         *pData;                        /**< Address of data : 12 / 16 */
+
+} orxHASHTABLE_SLOT;
+
 /** Hash Table */
 #ifdef __orxMSVC__
   #pragma warning(push)
@@ -62,6 +76,10 @@ struct __orxHASHTABLE_t
   orxBANK            *pstBank;                                /**< Bank where are stored cells : 4 / 8 */
   orxU32              u32Count;                               /**< Hashtable item count : 8 / 12 */
   orxU32              u32Size;                                /**< Hashtable size : 12 / 16 */
+  orxU32              u32Flags;                               /**< Hashtable flags : 16 / 20 */
+  orxMEMORY_TYPE      eMemType;                               /**< Memory type : 20 / 24 */
+  orxHASHTABLE_SLOT  *astSlot;                                /**< Slots (open addressing) : 24 / 32 */
+  orxU8              *au8Distance;                            /**< Slot probe distances, 0 for empty slots (open addressing) : 28 / 40 */
   orxHASHTABLE_CELL  *apstCell[0];                            /**< Hash table */
 };
 
@@ -92,6 +110,397 @@ static orxINLINE orxU32 orxHashTable_FindIndex(const orxHASHTABLE *_pstHashTable
   return((orxU32)_u64Key & (_pstHashTable->u32Size - 1));
 }
 
+/** Mixes a key (64-bit finalizer) so that pointers & aligned IDs spread over all slots.
+ * @param[in] _u64Key           Key to mix.
+ * @return Mixed key.
+ */
+static orxINLINE orxU64 orxHashTable_MixKey(orxU64 _u64Key)
+{
+  /* Mixes key */
+  _u64Key ^= _u64Key >> 33;
+  _u64Key *= 0xFF51AFD7ED558CCDULL;
+  _u64Key ^= _u64Key >> 33;
+  _u64Key *= 0xC4CEB9FE1A85EC53ULL;
+  _u64Key ^= _u64Key >> 33;
+
+  /* Done! */
+  return _u64Key;
+}
+
+/** Finds the slot of an item (open addressing).
+ * @param[in] _pstHashTable     Concerned hash table.
+ * @param[in] _u64Key           Key to find.
+ * @return Index of the slot, orxU32_UNDEFINED if not found.
+ */
+static orxINLINE orxU32 orxHashTable_FindSlot(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
+{
+  orxU32 u32Mask, u32Index, u32Distance, u32Result = orxU32_UNDEFINED;
+
+  /* Gets start index */
+  u32Mask   = _pstHashTable->u32Size - 1;
+  u32Index  = (orxU32)orxHashTable_MixKey(_u64Key) & u32Mask;
+
+  /* For all probed slots, till one is closer to its home than we are (or empty) */
+  for(u32Distance = 1; (orxU32)_pstHashTable->au8Distance[u32Index] >= u32Distance; u32Distance++, u32Index = (u32Index + 1) & u32Mask)
+  {
+    /* Found? */
+    if(_pstHashTable->astSlot[u32Index].u64Key == _u64Key)
+    {
+      /* Updates result */
+      u32Result = u32Index;
+      break;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Allocates open addressing storage.
+ * @param[in] _pstHashTable     Concerned hash table.
+ * @param[in] _u32Size          Number of slots, power of two.
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_AllocateSlots(orxHASHTABLE *_pstHashTable, orxU32 _u32Size)
+{
+  orxHASHTABLE_SLOT  *astSlot;
+  orxSTATUS           eResult;
+
+  /* Allocates slots & metadata in a single block */
+  astSlot = (orxHASHTABLE_SLOT *)orxMemory_Allocate(_u32Size * (sizeof(orxHASHTABLE_SLOT) + sizeof(orxU8)), _pstHashTable->eMemType);
+
+  /* Success? */
+  if(astSlot != orxNULL)
+  {
+    /* Stores them */
+    _pstHashTable->astSlot      = astSlot;
+    _pstHashTable->au8Distance  = (orxU8 *)(astSlot + _u32Size);
+    _pstHashTable->u32Size      = _u32Size;
+    _pstHashTable->u32Count     = 0;
+
+    /* Clears metadata */
+    orxMemory_Zero(_pstHashTable->au8Distance, _u32Size * sizeof(orxU8));
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxHASHTABLE_SLOT *orxFASTCALL orxHashTable_InsertSlot(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData);
+
+/** Resizes open addressing storage and reinserts all items, storage is left untouched upon failure.
+ * @param[in] _pstHashTable     Concerned hash table.
+ * @param[in] _u32Size          New number of slots, power of two.
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_ResizeSlots(orxHASHTABLE *_pstHashTable, orxU32 _u32Size)
+{
+  orxHASHTABLE_SLOT  *astOldSlot;
+  orxU8              *au8OldDistance;
+  orxU32              u32OldSize, u32OldCount;
+  orxSTATUS           eResult;
+
+  /* Backups old storage */
+  astOldSlot      = _pstHashTable->astSlot;
+  au8OldDistance  = _pstHashTable->au8Distance;
+  u32OldSize      = _pstHashTable->u32Size;
+  u32OldCount     = _pstHashTable->u32Count;
+
+  /* Allocates new storage */
+  eResult = orxHashTable_AllocateSlots(_pstHashTable, _u32Size);
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    orxU32 i;
+
+    /* For all old slots */
+    for(i = 0; i < u32OldSize; i++)
+    {
+      /* Used? */
+      if(au8OldDistance[i] != 0)
+      {
+        /* Reinserts it */
+        if(orxHashTable_InsertSlot(_pstHashTable, astOldSlot[i].u64Key, astOldSlot[i].pData) == orxNULL)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+          break;
+        }
+      }
+    }
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Frees old storage */
+      orxMemory_Free(astOldSlot);
+    }
+    else
+    {
+      /* Frees new storage */
+      orxMemory_Free(_pstHashTable->astSlot);
+
+      /* Restores old one */
+      _pstHashTable->astSlot      = astOldSlot;
+      _pstHashTable->au8Distance  = au8OldDistance;
+      _pstHashTable->u32Size      = u32OldSize;
+      _pstHashTable->u32Count     = u32OldCount;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Can a new item be inserted without any Robin Hood displacement reaching the max probe distance?
+ * @param[in] _pstHashTable     Concerned hash table.
+ * @param[in] _u64Key           Key to insert.
+ * @return orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxHashTable_CanInsertSlot(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
+{
+  orxU32  u32Mask, u32Index, u32Distance;
+  orxBOOL bResult = orxFALSE;
+
+  /* Gets start index */
+  u32Mask   = _pstHashTable->u32Size - 1;
+  u32Index  = (orxU32)orxHashTable_MixKey(_u64Key) & u32Mask;
+
+  /* For all slots that would be probed, following displaced items */
+  for(u32Distance = 1; u32Distance < orxHASHTABLE_KU32_MAX_DISTANCE; u32Distance++, u32Index = (u32Index + 1) & u32Mask)
+  {
+    orxU32 u32SlotDistance;
+
+    /* Gets slot distance */
+    u32SlotDistance = (orxU32)_pstHashTable->au8Distance[u32Index];
+
+    /* Empty? */
+    if(u32SlotDistance == 0)
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+      break;
+    }
+    /* Richer than the item in hand? */
+    else if(u32SlotDistance < u32Distance)
+    {
+      /* Carries it instead */
+      u32Distance = u32SlotDistance;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Inserts a new item using Robin Hood probing (the key must not be present yet), growing storage if the max probe distance would be reached.
+ * @param[in] _pstHashTable     Concerned hash table.
+ * @param[in] _u64Key           Key to insert.
+ * @param[in] _pData            Data to insert.
+ * @return Slot where the item has been stored, orxNULL if failed (storage is then left untouched).
+ */
+static orxHASHTABLE_SLOT *orxFASTCALL orxHashTable_InsertSlot(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
+{
+  orxHASHTABLE_SLOT  *pstResult = orxNULL;
+  orxSTATUS           eResult = orxSTATUS_SUCCESS;
+
+  /* While the max probe distance would be reached */
+  while((eResult != orxSTATUS_FAILURE) && (orxHashTable_CanInsertSlot(_pstHashTable, _u64Key) == orxFALSE))
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Hash table with %u items reached max probe distance, growing it to %u slots.", _pstHashTable->u32Count, _pstHashTable->u32Size << 1);
+
+    /* Grows storage, even when not expandable, to keep the table consistent */
+    eResult = orxHashTable_ResizeSlots(_pstHashTable, _pstHashTable->u32Size << 1);
+  }
+
+  /* Can insert? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    orxHASHTABLE_SLOT stSlot;
+    orxU32            u32Mask, u32Index, u32Distance;
+
+    /* Inits slot to insert */
+    stSlot.u64Key = _u64Key;
+    stSlot.pData  = _pData;
+
+    /* Gets its start index */
+    u32Mask   = _pstHashTable->u32Size - 1;
+    u32Index  = (orxU32)orxHashTable_MixKey(_u64Key) & u32Mask;
+
+    /* For all probed slots */
+    for(u32Distance = 1;; u32Distance++, u32Index = (u32Index + 1) & u32Mask)
+    {
+      orxU32 u32SlotDistance;
+
+      /* Gets slot distance */
+      u32SlotDistance = (orxU32)_pstHashTable->au8Distance[u32Index];
+
+      /* Empty? */
+      if(u32SlotDistance == 0)
+      {
+        /* Stores item */
+        _pstHashTable->astSlot[u32Index]      = stSlot;
+        _pstHashTable->au8Distance[u32Index]  = (orxU8)u32Distance;
+
+        /* Updates result */
+        if(pstResult == orxNULL)
+        {
+          pstResult = &(_pstHashTable->astSlot[u32Index]);
+        }
+
+        break;
+      }
+      /* Richer than us? */
+      else if(u32SlotDistance < u32Distance)
+      {
+        orxHASHTABLE_SLOT stTemp;
+
+        /* Takes its place */
+        stTemp                                = _pstHashTable->astSlot[u32Index];
+        _pstHashTable->astSlot[u32Index]      = stSlot;
+        _pstHashTable->au8Distance[u32Index]  = (orxU8)u32Distance;
+        stSlot                                = stTemp;
+        u32Distance                           = u32SlotDistance;
+
+        /* Updates result */
+        if(pstResult == orxNULL)
+        {
+          pstResult = &(_pstHashTable->astSlot[u32Index]);
+        }
+      }
+    }
+
+    /* Updates count */
+    _pstHashTable->u32Count++;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't grow hash table, item <0x%016llX> hasn't been inserted.", _u64Key);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Retrieves the slot of an item, creating it if needed (open addressing).
+ * @param[in] _pstHashTable     Concerned hash table.
+ * @param[in] _u64Key           Key to find.
+ * @param[out] _pbCreated       Was the slot created?
+ * @return Slot of the item, orxNULL if it couldn't be created.
+ */
+static orxHASHTABLE_SLOT *orxFASTCALL orxHashTable_RetrieveSlot(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, orxBOOL *_pbCreated)
+{
+  orxHASHTABLE_SLOT  *pstResult;
+  orxU32              u32Index;
+
+  /* Finds it */
+  u32Index = orxHashTable_FindSlot(_pstHashTable, _u64Key);
+
+  /* Found? */
+  if(u32Index != orxU32_UNDEFINED)
+  {
+    /* Updates result */
+    pstResult   = &(_pstHashTable->astSlot[u32Index]);
+    *_pbCreated = orxFALSE;
+  }
+  else
+  {
+    orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+    /* Above max load (7/8)? */
+    if(((_pstHashTable->u32Count + 1) << 3) > _pstHashTable->u32Size * 7)
+    {
+      /* Expandable? */
+      if(!orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE))
+      {
+        /* Grows storage */
+        eResult = orxHashTable_ResizeSlots(_pstHashTable, _pstHashTable->u32Size << 1);
+      }
+      /* Full? */
+      else if(_pstHashTable->u32Count == _pstHashTable->u32Size)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+
+    /* Valid? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Inserts it */
+      pstResult = orxHashTable_InsertSlot(_pstHashTable, _u64Key, orxNULL);
+    }
+    else
+    {
+      /* Updates result */
+      pstResult = orxNULL;
+    }
+
+    /* Updates status */
+    *_pbCreated = (pstResult != orxNULL) ? orxTRUE : orxFALSE;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Removes an item using backward shift deletion (open addressing).
+ * @param[in] _pstHashTable     Concerned hash table.
+ * @param[in] _u64Key           Key to remove.
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_RemoveSlot(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
+{
+  orxU32    u32Index;
+  orxSTATUS eResult;
+
+  /* Finds it */
+  u32Index = orxHashTable_FindSlot(_pstHashTable, _u64Key);
+
+  /* Found? */
+  if(u32Index != orxU32_UNDEFINED)
+  {
+    orxU32 u32Mask, u32Next;
+
+    /* Shifts back following displaced items */
+    for(u32Mask = _pstHashTable->u32Size - 1, u32Next = (u32Index + 1) & u32Mask;
+        _pstHashTable->au8Distance[u32Next] > 1;
+        u32Index = u32Next, u32Next = (u32Next + 1) & u32Mask)
+    {
+      _pstHashTable->astSlot[u32Index]      = _pstHashTable->astSlot[u32Next];
+      _pstHashTable->au8Distance[u32Index]  = _pstHashTable->au8Distance[u32Next] - 1;
+    }
+
+    /* Clears last slot */
+    _pstHashTable->au8Distance[u32Index] = 0;
+
+    /* Updates count */
+    _pstHashTable->u32Count--;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /***************************************************************************
  * Public functions                                                        *
  ***************************************************************************/
@@ -116,44 +525,81 @@ orxHASHTABLE *orxFASTCALL orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags
   /* Gets Power of Two size */
   u32Size = orxMath_GetNextPowerOfTwo(_u32NbKey);
 
-  /* Allocate memory for a hash table */
-  pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)), _eMemType);
-
-  /* Enough memory ? */
-  if(pstHashTable != orxNULL)
+  /* Open addressing? */
+  if(orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
   {
-    orxU32 u32Flags;
-
-    /* Set flags */
-    if(_u32Flags == orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)
+    /* Keeps room for max load (7/8) */
+    if((_u32NbKey << 3) > u32Size * 7)
     {
-      u32Flags = orxBANK_KU32_FLAG_NOT_EXPANDABLE;
-    }
-    else
-    {
-      u32Flags = orxBANK_KU32_FLAG_NONE;
+      u32Size <<= 1;
     }
 
-    /* Clean values */
-    orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)));
+    /* Allocate memory for a hash table */
+    pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE), _eMemType);
 
-    /* Allocate bank for cells */
-    pstHashTable->pstBank = orxBank_Create(u32Size, sizeof(orxHASHTABLE_CELL), u32Flags, _eMemType);
-
-    /* Correct bank allocation ? */
-    if(pstHashTable->pstBank != orxNULL)
+    /* Enough memory ? */
+    if(pstHashTable != orxNULL)
     {
-      /* Stores its size */
-      pstHashTable->u32Size = u32Size;
+      /* Clean values */
+      orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE));
+
+      /* Stores flags & memory type */
+      pstHashTable->u32Flags  = _u32Flags;
+      pstHashTable->eMemType  = _eMemType;
+
+      /* Allocates slots */
+      if(orxHashTable_AllocateSlots(pstHashTable, u32Size) == orxSTATUS_FAILURE)
+      {
+        /* Allocation problem, returns orxNULL */
+        orxMemory_Free(pstHashTable);
+        pstHashTable = orxNULL;
+      }
     }
-    else
+  }
+  else
+  {
+    /* Allocate memory for a hash table */
+    pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)), _eMemType);
+
+    /* Enough memory ? */
+    if(pstHashTable != orxNULL)
     {
-      /* Allocation problem, returns orxNULL */
-      orxMemory_Free(pstHashTable);
-      pstHashTable = orxNULL;
+      orxU32 u32Flags;
+
+      /* Set flags */
+      if(orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE))
+      {
+        u32Flags = orxBANK_KU32_FLAG_NOT_EXPANDABLE;
+      }
+      else
+      {
+        u32Flags = orxBANK_KU32_FLAG_NONE;
+      }
+
+      /* Clean values */
+      orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)));
+
+      /* Allocate bank for cells */
+      pstHashTable->pstBank = orxBank_Create(u32Size, sizeof(orxHASHTABLE_CELL), u32Flags, _eMemType);
+
+      /* Correct bank allocation ? */
+      if(pstHashTable->pstBank != orxNULL)
+      {
+        /* Stores its size, flags & memory type */
+        pstHashTable->u32Size   = u32Size;
+        pstHashTable->u32Flags  = _u32Flags;
+        pstHashTable->eMemType  = _eMemType;
+      }
+      else
+      {
+        /* Allocation problem, returns orxNULL */
+        orxMemory_Free(pstHashTable);
+        pstHashTable = orxNULL;
+      }
     }
   }
 
+  /* Done! */
   return pstHashTable;
 }
 
@@ -166,11 +612,20 @@ orxSTATUS orxFASTCALL orxHashTable_Delete(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear hash table (unallocate cells) */
-  orxHashTable_Clear(_pstHashTable);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Frees slots */
+    orxMemory_Free(_pstHashTable->astSlot);
+  }
+  else
+  {
+    /* Clear hash table (unallocate cells) */
+    orxHashTable_Clear(_pstHashTable);
 
-  /* Free bank */
-  orxBank_Delete(_pstHashTable->pstBank);
+    /* Free bank */
+    orxBank_Delete(_pstHashTable->pstBank);
+  }
 
   /* Unallocate memory */
   orxMemory_Free(_pstHashTable);
@@ -188,11 +643,20 @@ orxSTATUS orxFASTCALL orxHashTable_Clear(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear the memory bank */
-  orxBank_Clear(_pstHashTable->pstBank);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Clears metadata */
+    orxMemory_Zero(_pstHashTable->au8Distance, _pstHashTable->u32Size * sizeof(orxU8));
+  }
+  else
+  {
+    /* Clear the memory bank */
+    orxBank_Clear(_pstHashTable->pstBank);
 
-  /* Clear the hash */
-  orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+    /* Clear the hash */
+    orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+  }
 
   /* Clears count */
   _pstHashTable->u32Count = 0;
@@ -230,6 +694,7 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
 {
   orxU32              u32Index;
   orxHASHTABLE_CELL  *pstCell = orxNULL;
+  void               *pResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Get");
@@ -237,20 +702,33 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Finds the corresponding slot */
+    u32Index  = orxHashTable_FindSlot(_pstHashTable, _u64Key);
+    pResult   = (u32Index != orxU32_UNDEFINED) ? _pstHashTable->astSlot[u32Index].pData : orxNULL;
+  }
+  else
+  {
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Updates result */
+    pResult = (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
   /* Done! */
-  return (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+  return pResult;
 }
 
 /** Retrieves the bucket of an item in a hash table, if the item wasn't present, a new bucket will be created.
@@ -270,49 +748,62 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxHASHTABLE_SLOT  *pstSlot;
+    orxBOOL             bCreated;
 
-  /* Not found ? */
-  if(pstCell == orxNULL)
+    /* Retrieves the corresponding slot */
+    pstSlot   = orxHashTable_RetrieveSlot(_pstHashTable, _u64Key, &bCreated);
+    ppResult  = (pstSlot != orxNULL) ? &(pstSlot->pData) : orxNULL;
+  }
+  else
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
-    /* Success? */
-    if(pstCell != orxNULL)
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Not found ? */
+    if(pstCell == orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = orxNULL;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+      /* Creates a new cell */
+      pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
 
-      /* Updates count */
-      _pstHashTable->u32Count++;
+      /* Success? */
+      if(pstCell != orxNULL)
+      {
+        /* Inits cell */
+        pstCell->u64Key   = _u64Key;
+        pstCell->pData    = orxNULL;
+        pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+        /* Updates count */
+        _pstHashTable->u32Count++;
 
-      /* Updates result */
-      ppResult = &(pstCell->pData);
+        /* Inserts it */
+        _pstHashTable->apstCell[u32Index] = pstCell;
+
+        /* Updates result */
+        ppResult = &(pstCell->pData);
+      }
+      else
+      {
+        /* Updates result */
+        ppResult = orxNULL;
+      }
     }
     else
     {
       /* Updates result */
-      ppResult = orxNULL;
+      ppResult = &(pstCell->pData);
     }
   }
-  else
-  {
-    /* Updates result */
-    ppResult = &(pstCell->pData);
-  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -331,6 +822,7 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
 {
   orxU32              u32Index;
   orxHASHTABLE_CELL  *pstCell;
+  orxSTATUS           eResult = orxSTATUS_SUCCESS;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Set");
@@ -339,39 +831,63 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   orxASSERT(_pstHashTable != orxNULL);
   orxASSERT(_pData != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxHASHTABLE_SLOT  *pstSlot;
+    orxBOOL             bCreated;
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Retrieves the corresponding slot */
+    pstSlot = orxHashTable_RetrieveSlot(_pstHashTable, _u64Key, &bCreated);
 
-  /* Found ? */
-  if(pstCell != orxNULL)
-  {
-    /* Stores data */
-    pstCell->pData = _pData;
+    /* Success? */
+    if(pstSlot != orxNULL)
+    {
+      /* Stores data */
+      pstSlot->pData = _pData;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
   }
   else
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
-    /* Success? */
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Found ? */
     if(pstCell != orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+      /* Stores data */
+      pstCell->pData = _pData;
+    }
+    else
+    {
+      /* Creates a new cell */
+      pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
 
-      /* Updates count */
-      _pstHashTable->u32Count++;
+      /* Success? */
+      if(pstCell != orxNULL)
+      {
+        /* Inits cell */
+        pstCell->u64Key   = _u64Key;
+        pstCell->pData    = _pData;
+        pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+        /* Updates count */
+        _pstHashTable->u32Count++;
+
+        /* Inserts it */
+        _pstHashTable->apstCell[u32Index] = pstCell;
+      }
     }
   }
 
@@ -379,7 +895,7 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   orxPROFILER_POP_MARKER();
 
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return eResult;
 }
 
 
@@ -402,37 +918,59 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   orxASSERT(_pstHashTable != orxNULL);
   orxASSERT(_pData != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxHASHTABLE_SLOT  *pstSlot;
+    orxBOOL             bCreated;
+
+    /* Retrieves the corresponding slot */
+    pstSlot = orxHashTable_RetrieveSlot(_pstHashTable, _u64Key, &bCreated);
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Created? */
+    if((pstSlot != orxNULL) && (bCreated != orxFALSE))
+    {
+      /* Stores data */
+      pstSlot->pData = _pData;
 
-  /* Not found? */
-  if(pstCell == orxNULL)
+      /* Updates result */
+      eStatus = orxSTATUS_SUCCESS;
+    }
+  }
+  else
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
-    /* Success? */
-    if(pstCell != orxNULL)
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Not found? */
+    if(pstCell == orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+      /* Creates a new cell */
+      pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+      /* Success? */
+      if(pstCell != orxNULL)
+      {
+        /* Inits cell */
+        pstCell->u64Key   = _u64Key;
+        pstCell->pData    = _pData;
+        pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
 
-      /* Updates count */
-      _pstHashTable->u32Count++;
+        /* Inserts it */
+        _pstHashTable->apstCell[u32Index] = pstCell;
 
-      /* Updates result */
-      eStatus = orxSTATUS_SUCCESS;
+        /* Updates count */
+        _pstHashTable->u32Count++;
+
+        /* Updates result */
+        eStatus = orxSTATUS_SUCCESS;
+      }
     }
   }
 
@@ -460,55 +998,64 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Get the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
-  pstCell = _pstHashTable->apstCell[u32Index];
-
-  /* Is the first key is the key to remove ? */
-  if(pstCell != orxNULL)
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
   {
-    if(pstCell->u64Key == _u64Key)
-    {
-      /* The first cell has to be removed */
-      _pstHashTable->apstCell[u32Index] = pstCell->pstNext;
-      orxBank_Free(_pstHashTable->pstBank, pstCell);
+    /* Removes the corresponding slot */
+    eStatus = orxHashTable_RemoveSlot(_pstHashTable, _u64Key);
+  }
+  else
+  {
+    /* Get the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
-      /* Operation succeed */
-      eStatus = orxSTATUS_SUCCESS;
-    }
-    else
+    pstCell = _pstHashTable->apstCell[u32Index];
+
+    /* Is the first key is the key to remove ? */
+    if(pstCell != orxNULL)
     {
-      /* Traverse to find the key */
-      while(pstCell->pstNext != orxNULL && pstCell->pstNext->u64Key != _u64Key)
+      if(pstCell->u64Key == _u64Key)
       {
-        /* Try with next cell */
-        pstCell = pstCell->pstNext;
-      }
+        /* The first cell has to be removed */
+        _pstHashTable->apstCell[u32Index] = pstCell->pstNext;
+        orxBank_Free(_pstHashTable->pstBank, pstCell);
 
-      /* Cell found ? (key should be on the next cell) */
-      if(pstCell->pstNext != orxNULL)
+        /* Operation succeed */
+        eStatus = orxSTATUS_SUCCESS;
+      }
+      else
       {
-        orxHASHTABLE_CELL *pstRemoveCell;
+        /* Traverse to find the key */
+        while(pstCell->pstNext != orxNULL && pstCell->pstNext->u64Key != _u64Key)
+        {
+          /* Try with next cell */
+          pstCell = pstCell->pstNext;
+        }
 
-        /* We found it, remove this cell */
-        pstRemoveCell = pstCell->pstNext;
-        pstCell->pstNext = pstRemoveCell->pstNext;
+        /* Cell found ? (key should be on the next cell) */
+        if(pstCell->pstNext != orxNULL)
+        {
+          orxHASHTABLE_CELL *pstRemoveCell;
 
-        /* Free cell from bank */
-        orxBank_Free(_pstHashTable->pstBank, pstRemoveCell);
+          /* We found it, remove this cell */
+          pstRemoveCell = pstCell->pstNext;
+          pstCell->pstNext = pstRemoveCell->pstNext;
 
-        /* Operation succeed */
-        eStatus = orxSTATUS_SUCCESS;
+          /* Free cell from bank */
+          orxBank_Free(_pstHashTable->pstBank, pstRemoveCell);
+
+          /* Operation succeed */
+          eStatus = orxSTATUS_SUCCESS;
+        }
       }
     }
-  }
 
-  /* Successful? */
-  if(eStatus != orxSTATUS_FAILURE)
-  {
-    /* Updates count */
-    _pstHashTable->u32Count--;
+    /* Successful? */
+    if(eStatus != orxSTATUS_FAILURE)
+    {
+      /* Updates count */
+      _pstHashTable->u32Count--;
+    }
   }
 
   /* Profiles */
@@ -538,53 +1085,92 @@ orxHANDLE orxFASTCALL orxHashTable_GetNext(const orxHASHTABLE *_pstHashTable, or
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Has iterator? */
-  if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
   {
-    /* Gets current cell */
-    pstCell = (orxHASHTABLE_CELL *)_hIterator;
-
     /* Gets start index */
-    u32Index = orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key) + 1;
+    u32Index = ((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED)) ? (orxU32)((orxHASHTABLE_SLOT *)_hIterator - _pstHashTable->astSlot) + 1 : 0;
 
-    /* Updates temporary result */
-    pstCell = pstCell->pstNext;
+    /* Finds next used slot */
+    for(; (u32Index < _pstHashTable->u32Size) && (_pstHashTable->au8Distance[u32Index] == 0); u32Index++)
+    ;
+
+    /* Found? */
+    if(u32Index < _pstHashTable->u32Size)
+    {
+      /* Asked for key? */
+      if(_pu64Key != orxNULL)
+      {
+        /* Updates it */
+        *_pu64Key = _pstHashTable->astSlot[u32Index].u64Key;
+      }
+
+      /* Asked for data? */
+      if(_ppData != orxNULL)
+      {
+        /* Updates it */
+        *_ppData = _pstHashTable->astSlot[u32Index].pData;
+      }
+
+      /* Updates result */
+      hResult = (orxHANDLE)&(_pstHashTable->astSlot[u32Index]);
+    }
+    else
+    {
+      /* Updates result */
+      hResult = orxHANDLE_UNDEFINED;
+    }
   }
   else
   {
-    /* Starts a new search */
-    u32Index  = 0;
-    pstCell   = orxNULL;
-  }
+    /* Has iterator? */
+    if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
+    {
+      /* Gets current cell */
+      pstCell = (orxHASHTABLE_CELL *)_hIterator;
 
-  /* Finds next head cell if needed */
-  for(; (pstCell == orxNULL) && (u32Index < _pstHashTable->u32Size); pstCell = _pstHashTable->apstCell[u32Index++])
-  ;
+      /* Gets start index */
+      u32Index = orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key) + 1;
 
-  /* Found? */
-  if(pstCell != orxNULL)
-  {
-    /* Asked for key? */
-    if(_pu64Key != orxNULL)
+      /* Updates temporary result */
+      pstCell = pstCell->pstNext;
+    }
+    else
     {
-      /* Updates it */
-      *_pu64Key = pstCell->u64Key;
+      /* Starts a new search */
+      u32Index  = 0;
+      pstCell   = orxNULL;
     }
 
-    /* Asked for data? */
-    if(_ppData != orxNULL)
+    /* Finds next head cell if needed */
+    for(; (pstCell == orxNULL) && (u32Index < _pstHashTable->u32Size); pstCell = _pstHashTable->apstCell[u32Index++])
+    ;
+
+    /* Found? */
+    if(pstCell != orxNULL)
     {
-      /* Updates it */
-      *_ppData = pstCell->pData;
-    }
+      /* Asked for key? */
+      if(_pu64Key != orxNULL)
+      {
+        /* Updates it */
+        *_pu64Key = pstCell->u64Key;
+      }
 
-    /* Updates result */
-    hResult = (orxHANDLE)pstCell;
-  }
-  else
-  {
-    /* Updates result */
-    hResult = orxHANDLE_UNDEFINED;
+      /* Asked for data? */
+      if(_ppData != orxNULL)
+      {
+        /* Updates it */
+        *_ppData = pstCell->pData;
+      }
+
+      /* Updates result */
+      hResult = (orxHANDLE)pstCell;
+    }
+    else
+    {
+      /* Updates result */
+      hResult = orxHANDLE_UNDEFINED;
+    }
   }
 
   /* Done! */
@@ -602,8 +1188,9 @@ orxSTATUS orxFASTCALL orxHashTable_Optimize(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Has elements? */
-  if(_pstHashTable->u32Count > 0)
+  /* Has elements and not using open addressing (already contiguous)? */
+  if((_pstHashTable->u32Count > 0)
+  && (!orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)))
   {
     orxHASHTABLE_CELL *astWorkBuffer;
 
@@ -57,17 +57,41 @@
 /** Defines
  */
 #define orxSTRING_KU32_ID_TABLE_SIZE                      16384
+#define orxSTRING_KU32_SHARD_NUMBER                       16          /**< Needs to be a power of 2 */
+#define orxSTRING_KU32_SHARD_SHIFT                        60          /**< 64 - log2(orxSTRING_KU32_SHARD_NUMBER) */
+#define orxSTRING_KU32_ARENA_CHUNK_SIZE                   65536
+#define orxSTRING_KU32_ARENA_MAX_SIZE                     (orxSTRING_KU32_ARENA_CHUNK_SIZE / 4) /**< Larger strings get their own chunk */
 
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Arena chunk structure
+ */
+typedef struct __orxSTRING_CHUNK_t
+{
+  struct __orxSTRING_CHUNK_t *pstNext;                    /**< Next chunk */
+  orxU32                      u32Size;                    /**< Data size */
+  orxU32                      u32Used;                    /**< Used data size */
+
+} orxSTRING_CHUNK;
+
+/** Shard structure
+ */
+typedef struct __orxSTRING_SHARD_t
+{
+  orxHASHTABLE               *pstIDTable;                 /**< String ID table */
+  orxSTRING_CHUNK            *pstChunk;                   /**< Current arena chunk */
+  volatile orxU32             u32Lock;                    /**< Lock */
+
+} orxSTRING_SHARD;
+
 /** Static structure
  */
 typedef struct __orxSTRING_STATIC_t
 {
-  orxHASHTABLE *pstIDTable;                               /** String ID table */
+  orxSTRING_SHARD astShardList[orxSTRING_KU32_SHARD_NUMBER]; /**< Shard list */
   orxU32        u32Flags;                                 /**< Control flags */
 
 } orxSTRING_STATIC;
@@ -86,6 +110,157 @@ static orxSTRING_STATIC sstString;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Gets the shard of a string ID and locks it
+ * @param[in]   _stID           Concerned string ID
+ * @return      orxSTRING_SHARD
+ */
+static orxINLINE orxSTRING_SHARD *orxString_LockShard(orxSTRINGID _stID)
+{
+  orxSTRING_SHARD *pstResult;
+
+  /* Gets shard */
+  pstResult = &(sstString.astShardList[(orxU32)(_stID >> orxSTRING_KU32_SHARD_SHIFT)]);
+
+  /* Locks it */
+  while(orxMEMORY_ATOMIC_CAS32(&(pstResult->u32Lock), 0, 1) == orxFALSE)
+    ;
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Unlocks a shard
+ * @param[in]   _pstShard       Concerned shard
+ */
+static orxINLINE void orxString_UnlockShard(orxSTRING_SHARD *_pstShard)
+{
+  /* Unlocks it */
+  orxMEMORY_BARRIER();
+  _pstShard->u32Lock = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Copies a string into a shard's arena (shard needs to be locked)
+ * @param[in]   _pstShard       Concerned shard
+ * @param[in]   _zString        String to copy
+ * @return      Copied string / orxNULL
+ */
+static orxSTRING orxFASTCALL orxString_ArenaDuplicate(orxSTRING_SHARD *_pstShard, const orxSTRING _zString)
+{
+  orxSTRING_CHUNK  *pstChunk;
+  orxSTRING         zResult = orxNULL;
+  orxU32            u32Size;
+
+  /* Gets string size in bytes */
+  u32Size = (orxString_GetLength(_zString) + 1) * sizeof(orxCHAR);
+
+  /* Gets current chunk */
+  pstChunk = _pstShard->pstChunk;
+
+  /* Not enough room left? */
+  if((pstChunk == orxNULL) || (pstChunk->u32Used + u32Size > pstChunk->u32Size))
+  {
+    orxU32 u32ChunkSize;
+
+    /* Gets chunk size */
+    u32ChunkSize = (u32Size > orxSTRING_KU32_ARENA_MAX_SIZE) ? u32Size : orxSTRING_KU32_ARENA_CHUNK_SIZE - (orxU32)sizeof(orxSTRING_CHUNK);
+
+    /* Allocates new chunk */
+    pstChunk = (orxSTRING_CHUNK *)orxMemory_Allocate((orxU32)sizeof(orxSTRING_CHUNK) + u32ChunkSize, orxMEMORY_TYPE_TEXT);
+
+    /* Success? */
+    if(pstChunk != orxNULL)
+    {
+      /* Inits it */
+      pstChunk->u32Size = u32ChunkSize;
+      pstChunk->u32Used = 0;
+
+      /* Dedicated? */
+      if((u32Size > orxSTRING_KU32_ARENA_MAX_SIZE) && (_pstShard->pstChunk != orxNULL))
+      {
+        /* Links it after current one, which remains the active one */
+        pstChunk->pstNext           = _pstShard->pstChunk->pstNext;
+        _pstShard->pstChunk->pstNext = pstChunk;
+      }
+      else
+      {
+        /* Makes it the active one */
+        pstChunk->pstNext   = _pstShard->pstChunk;
+        _pstShard->pstChunk = pstChunk;
+      }
+    }
+  }
+
+  /* Valid? */
+  if(pstChunk != orxNULL)
+  {
+    /* Gets string */
+    zResult = (orxSTRING)(pstChunk + 1) + pstChunk->u32Used;
+
+    /* Copies it */
+    orxMemory_Copy(zResult, _zString, u32Size);
+
+    /* Updates chunk */
+    pstChunk->u32Used += u32Size;
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Stores a string internally
+ * @param[in]   _zString        Concerned string
+ * @param[in]   _stID           Its ID
+ * @return      Stored orxSTRING
+ */
+static const orxSTRING orxFASTCALL orxString_StoreInternal(const orxSTRING _zString, orxSTRINGID _stID)
+{
+  orxSTRING_SHARD  *pstShard;
+  const orxSTRING  *pzBucket;
+  const orxSTRING   zResult;
+
+  /* Locks shard */
+  pstShard = orxString_LockShard(_stID);
+
+  /* Gets stored string bucket */
+  pzBucket = (const orxSTRING *)orxHashTable_Retrieve(pstShard->pstIDTable, _stID);
+
+  /* Checks */
+  orxASSERT(pzBucket != orxNULL);
+
+  /* Not already stored? */
+  if(*pzBucket == orxNULL)
+  {
+    /* Updates result */
+    zResult = orxString_ArenaDuplicate(pstShard, _zString);
+
+    /* Adds it to table */
+    *pzBucket = zResult;
+  }
+  else
+  {
+    /* Gets it */
+    zResult = *pzBucket;
+
+#ifdef __orxDEBUG__
+    /* Different strings? */
+    if(orxString_Compare(_zString, zResult) != 0)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", zResult, _zString);
+    }
+#endif /* __orxDEBUG__ */
+  }
+
+  /* Unlocks shard */
+  orxString_UnlockShard(pstShard);
+
+  /* Done! */
+  return zResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -114,14 +289,34 @@ orxSTATUS orxFASTCALL orxString_Init()
   /* Not already Initialized? */
   if(!(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY))
   {
+    orxU32 i;
+
     /* Cleans static controller */
     orxMemory_Zero(&sstString, sizeof(orxSTRING_STATIC));
 
-    /* Creates ID table */
-    sstString.pstIDTable = orxHashTable_Create(orxSTRING_KU32_ID_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEXT);
+    /* For all shards */
+    for(i = 0; i < orxSTRING_KU32_SHARD_NUMBER; i++)
+    {
+      /* Creates its ID table */
+      sstString.astShardList[i].pstIDTable = orxHashTable_Create(orxSTRING_KU32_ID_TABLE_SIZE / orxSTRING_KU32_SHARD_NUMBER, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_TEXT);
+
+      /* Failure? */
+      if(sstString.astShardList[i].pstIDTable == orxNULL)
+      {
+        /* For all previous shards */
+        while(i-- > 0)
+        {
+          /* Deletes its ID table */
+          orxHashTable_Delete(sstString.astShardList[i].pstIDTable);
+          sstString.astShardList[i].pstIDTable = orxNULL;
+        }
+
+        break;
+      }
+    }
 
     /* Success? */
-    if(sstString.pstIDTable != orxNULL)
+    if(sstString.astShardList[0].pstIDTable != orxNULL)
     {
       /* Resets default locale in case it was modified by an external component, such as GTK */
       setlocale(LC_ALL, "C");
@@ -158,20 +353,27 @@ void orxFASTCALL orxString_Exit()
   /* Initialized? */
   if(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY)
   {
-    orxHANDLE hIterator;
-    orxSTRING zString;
+    orxU32 i;
 
-    /* For all string IDs */
-    for(hIterator = orxHashTable_GetNext(sstString.pstIDTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&zString);
-        hIterator != orxHANDLE_UNDEFINED;
-        hIterator = orxHashTable_GetNext(sstString.pstIDTable, hIterator, orxNULL, (void **)&zString))
+    /* For all shards */
+    for(i = 0; i < orxSTRING_KU32_SHARD_NUMBER; i++)
     {
-      /* Deletes its string */
-      orxString_Delete(zString);
-    }
+      orxSTRING_CHUNK *pstChunk;
 
-    /* Deletes ID table */
-    orxHashTable_Delete(sstString.pstIDTable);
+      /* For all its arena chunks */
+      for(pstChunk = sstString.astShardList[i].pstChunk; pstChunk != orxNULL;)
+      {
+        orxSTRING_CHUNK *pstNext;
+
+        /* Deletes it */
+        pstNext = pstChunk->pstNext;
+        orxMemory_Free(pstChunk);
+        pstChunk = pstNext;
+      }
+
+      /* Deletes its ID table */
+      orxHashTable_Delete(sstString.astShardList[i].pstIDTable);
+    }
 
     /* Updates flags */
     sstString.u32Flags &= ~orxSTRING_KU32_STATIC_FLAG_READY;
@@ -192,8 +394,7 @@ void orxFASTCALL orxString_Exit()
  */
 orxSTRINGID orxFASTCALL orxString_GetID(const orxSTRING _zString)
 {
-  const orxSTRING  *pzBucket;
-  orxSTRINGID       stResult = 0;
+  orxSTRINGID stResult = 0;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_GetID");
@@ -205,29 +406,8 @@ orxSTRINGID orxFASTCALL orxString_GetID(const orxSTRING _zString)
   /* Gets its ID */
   stResult = orxString_Hash(_zString);
 
-  /* Gets stored string bucket */
-  pzBucket = (const orxSTRING *)orxHashTable_Retrieve(sstString.pstIDTable, stResult);
-
-  /* Checks */
-  orxASSERT(pzBucket != orxNULL);
-
-  /* Not already stored? */
-  if(*pzBucket == orxNULL)
-  {
-    /* Adds it */
-    *pzBucket = orxString_Duplicate(_zString);
-  }
-#ifdef __orxDEBUG__
-  else
-  {
-    /* Different strings? */
-    if(orxString_Compare(_zString, *pzBucket) != 0)
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", *pzBucket, _zString);
-    }
-  }
-#endif /* __orxDEBUG__ */
+  /* Stores it */
+  orxString_StoreInternal(_zString, stResult);
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -242,13 +422,16 @@ orxSTRINGID orxFASTCALL orxString_GetID(const orxSTRING _zString)
  */
 const orxSTRING orxFASTCALL orxString_GetFromID(orxSTRINGID _stID)
 {
-  const orxSTRING zResult;
+  orxSTRING_SHARD  *pstShard;
+  const orxSTRING   zResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_GetFromID");
 
   /* Gets string from table */
-  zResult = (const orxSTRING)orxHashTable_Get(sstString.pstIDTable, _stID);
+  pstShard  = orxString_LockShard(_stID);
+  zResult   = (const orxSTRING)orxHashTable_Get(pstShard->pstIDTable, _stID);
+  orxString_UnlockShard(pstShard);
 
   /* Invalid? */
   if(zResult == orxNULL)
@@ -295,9 +478,7 @@ orxSTRINGID orxFASTCALL orxString_Hash(const orxSTRING _zString)
  */
 const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
 {
-  const orxSTRING  *pzBucket;
-  const orxSTRING   zResult;
-  orxSTRINGID       stID;
+  const orxSTRING zResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_Store");
@@ -306,38 +487,8 @@ const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
   orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
   orxASSERT(_zString != orxNULL);
 
-  /* Gets its ID */
-  stID = orxString_Hash(_zString);
-
-  /* Gets stored string bucket */
-  pzBucket = (const orxSTRING *)orxHashTable_Retrieve(sstString.pstIDTable, stID);
-
-  /* Checks */
-  orxASSERT(pzBucket != orxNULL);
-
-  /* Not already stored? */
-  if(*pzBucket == orxNULL)
-  {
-    /* Updates result */
-    zResult = orxString_Duplicate(_zString);
-
-    /* Adds it to table */
-    *pzBucket = zResult;
-  }
-  else
-  {
-    /* Gets it */
-    zResult = *pzBucket;
-
-#ifdef __orxDEBUG__
-    /* Different strings? */
-    if(orxString_Compare(_zString, zResult) != 0)
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", zResult, _zString);
-    }
-#endif /* __orxDEBUG__ */
-  }
+  /* Stores it */
+  zResult = orxString_StoreInternal(_zString, orxString_Hash(_zString));
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -352,24 +503,16 @@ const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
  */
 orxSTATUS orxFASTCALL orxString_Erase(orxSTRINGID _stID)
 {
-  orxSTRING zString;
-  orxSTATUS eResult = orxSTATUS_FAILURE;
+  orxSTRING_SHARD  *pstShard;
+  orxSTATUS         eResult;
 
   /* Checks */
   orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
 
-  /* Gets it from table */
-  zString = (orxSTRING)orxHashTable_Get(sstString.pstIDTable, _stID);
-
-  /* Found? */
-  if(zString != orxNULL)
-  {
-    /* Deletes it */
-    orxString_Delete(zString);
-
-    /* Erases it */
-    eResult = orxHashTable_Remove(sstString.pstIDTable, _stID);
-  }
+  /* Erases it from table (its arena storage will only be reclaimed upon exit) */
+  pstShard  = orxString_LockShard(_stID);
+  eResult   = orxHashTable_Remove(pstShard->pstIDTable, _stID);
+  orxString_UnlockShard(pstShard);
 
   /* Done! */
   return eResult;
@@ -0,0 +1,916 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008- Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxAtlasGen.c
+ * @date 16/10/2026
+ * @author iarwain@orx-project.org
+ *
+ */
+
+
+#include "orx.h"
+
+
+/** Module flags
+ */
+#define orxATLASGEN_KU32_STATIC_FLAG_NONE           0x00000000  /**< No flags */
+
+#define orxATLASGEN_KU32_STATIC_FLAG_INPUT          0x00000001  /**< Input flag */
+
+#define orxATLASGEN_KU32_STATIC_MASK_READY          0x00000001  /**< Ready mask */
+
+#define orxATLASGEN_KU32_STATIC_MASK_ALL            0xFFFFFFFF  /**< All mask */
+
+
+/** Misc defines
+ */
+#define orxATLASGEN_KZ_DEFAULT_NAME                 "Atlas"
+
+#define orxATLASGEN_KU32_DEFAULT_SIZE               2048
+#define orxATLASGEN_KU32_DEFAULT_PADDING            1
+
+#define orxATLASGEN_KU32_IMAGE_BANK_SIZE            256
+
+#define orxATLASGEN_KZ_LOG_TAG_LENGTH               "10"
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxATLASGEN_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxATLASGEN_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxATLASGEN_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxATLASGEN_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Rectangle structure
+ */
+typedef struct __orxATLASGEN_RECT_t
+{
+  orxU32          u32X;
+  orxU32          u32Y;
+  orxU32          u32Width;
+  orxU32          u32Height;
+
+} orxATLASGEN_RECT;
+
+/** Image structure
+ */
+typedef struct __orxATLASGEN_IMAGE_t
+{
+  orxSTRING       zFileName;
+  orxBITMAP      *pstBitmap;
+  orxATLASGEN_RECT stRect;
+  orxU32          u32Page;
+
+} orxATLASGEN_IMAGE;
+
+/** Static structure
+ */
+typedef struct __orxATLASGEN_STATIC_t
+{
+  orxSTRING           zAtlasName;
+  orxBANK            *pstImageBank;
+  orxATLASGEN_IMAGE **apstImageList;
+  orxATLASGEN_RECT   *astFreeList;
+  orxU32              u32FreeCount;
+  orxU32              u32FreeSize;
+  orxU32              u32ImageCount;
+  orxU32              u32PageSize;
+  orxU32              u32Padding;
+  orxU32              u32Flags;
+
+} orxATLASGEN_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxATLASGEN_STATIC sstAtlasGen;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static orxBOOL orxFASTCALL SaveFilter(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+{
+  orxBOOL bResult = orxTRUE;
+
+  // Udpates result
+  bResult = !orxString_Compare(_zSectionName, orxTEXTURE_KZ_CONFIG_ATLAS) ? orxTRUE : orxFALSE;
+
+  // Done!
+  return bResult;
+}
+
+static orxSTATUS orxFASTCALL Bootstrap()
+{
+  // No window
+  orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+  orxConfig_SetS32(orxDISPLAY_KZ_CONFIG_MONITOR, -1);
+  orxConfig_PopSection();
+
+  // Done!
+  return orxSTATUS_FAILURE;
+}
+
+static int orxCDECL CompareImages(const void *_pLeft, const void *_pRight)
+{
+  const orxATLASGEN_IMAGE *pstLeft, *pstRight;
+  orxU32                    u32LeftSide, u32RightSide;
+  int                       iResult;
+
+  // Gets images
+  pstLeft   = *(const orxATLASGEN_IMAGE **)_pLeft;
+  pstRight  = *(const orxATLASGEN_IMAGE **)_pRight;
+
+  // Gets their longest sides
+  u32LeftSide   = orxMAX(pstLeft->stRect.u32Width, pstLeft->stRect.u32Height);
+  u32RightSide  = orxMAX(pstRight->stRect.u32Width, pstRight->stRect.u32Height);
+
+  // Longest side first
+  if(u32LeftSide != u32RightSide)
+  {
+    // Updates result
+    iResult = (u32LeftSide > u32RightSide) ? -1 : 1;
+  }
+  else
+  {
+    orxU64 u64LeftArea, u64RightArea;
+
+    // Gets areas
+    u64LeftArea   = (orxU64)pstLeft->stRect.u32Width * (orxU64)pstLeft->stRect.u32Height;
+    u64RightArea  = (orxU64)pstRight->stRect.u32Width * (orxU64)pstRight->stRect.u32Height;
+
+    // Largest area first
+    iResult = (u64LeftArea > u64RightArea) ? -1 : (u64LeftArea < u64RightArea) ? 1 : 0;
+  }
+
+  // Done!
+  return iResult;
+}
+
+static void orxFASTCALL AddFreeRect(orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height)
+{
+  // Not enough room?
+  if(sstAtlasGen.u32FreeCount == sstAtlasGen.u32FreeSize)
+  {
+    // Grows list
+    sstAtlasGen.u32FreeSize = orxMAX(64, sstAtlasGen.u32FreeSize << 1);
+    sstAtlasGen.astFreeList = (orxATLASGEN_RECT *)orxMemory_Reallocate(sstAtlasGen.astFreeList, sstAtlasGen.u32FreeSize * sizeof(orxATLASGEN_RECT), orxMEMORY_TYPE_TEMP);
+    orxASSERT(sstAtlasGen.astFreeList != orxNULL);
+  }
+
+  // Stores it
+  sstAtlasGen.astFreeList[sstAtlasGen.u32FreeCount].u32X      = _u32X;
+  sstAtlasGen.astFreeList[sstAtlasGen.u32FreeCount].u32Y      = _u32Y;
+  sstAtlasGen.astFreeList[sstAtlasGen.u32FreeCount].u32Width  = _u32Width;
+  sstAtlasGen.astFreeList[sstAtlasGen.u32FreeCount].u32Height = _u32Height;
+  sstAtlasGen.u32FreeCount++;
+
+  // Done!
+  return;
+}
+
+static orxINLINE orxBOOL IsContained(const orxATLASGEN_RECT *_pstInner, const orxATLASGEN_RECT *_pstOuter)
+{
+  // Done!
+  return ((_pstInner->u32X >= _pstOuter->u32X)
+       && (_pstInner->u32Y >= _pstOuter->u32Y)
+       && (_pstInner->u32X + _pstInner->u32Width <= _pstOuter->u32X + _pstOuter->u32Width)
+       && (_pstInner->u32Y + _pstInner->u32Height <= _pstOuter->u32Y + _pstOuter->u32Height)) ? orxTRUE : orxFALSE;
+}
+
+static orxBOOL orxFASTCALL FindPosition(orxU32 _u32Width, orxU32 _u32Height, orxU32 *_pu32X, orxU32 *_pu32Y)
+{
+  orxU32  u32BestShortSide = orxU32_UNDEFINED, u32BestLongSide = orxU32_UNDEFINED, i;
+  orxBOOL bResult = orxFALSE;
+
+  // For all free rectangles
+  for(i = 0; i < sstAtlasGen.u32FreeCount; i++)
+  {
+    const orxATLASGEN_RECT *pstFree = &(sstAtlasGen.astFreeList[i]);
+
+    // Fits?
+    if((pstFree->u32Width >= _u32Width) && (pstFree->u32Height >= _u32Height))
+    {
+      orxU32 u32LeftoverX, u32LeftoverY, u32ShortSide, u32LongSide;
+
+      // Gets leftovers
+      u32LeftoverX  = pstFree->u32Width - _u32Width;
+      u32LeftoverY  = pstFree->u32Height - _u32Height;
+      u32ShortSide  = orxMIN(u32LeftoverX, u32LeftoverY);
+      u32LongSide   = orxMAX(u32LeftoverX, u32LeftoverY);
+
+      // Best short side fit?
+      if((u32ShortSide < u32BestShortSide)
+      || ((u32ShortSide == u32BestShortSide) && (u32LongSide < u32BestLongSide)))
+      {
+        // Stores it
+        *_pu32X           = pstFree->u32X;
+        *_pu32Y           = pstFree->u32Y;
+        u32BestShortSide  = u32ShortSide;
+        u32BestLongSide   = u32LongSide;
+
+        // Updates result
+        bResult = orxTRUE;
+      }
+    }
+  }
+
+  // Done!
+  return bResult;
+}
+
+static void orxFASTCALL PlaceRect(const orxATLASGEN_RECT *_pstRect)
+{
+  orxU32 i, j, u32Count;
+
+  // For all current free rectangles
+  for(i = 0, u32Count = sstAtlasGen.u32FreeCount; i < u32Count; i++)
+  {
+    orxATLASGEN_RECT stFree = sstAtlasGen.astFreeList[i];
+
+    // Intersects placed rectangle?
+    if((_pstRect->u32X < stFree.u32X + stFree.u32Width)
+    && (_pstRect->u32X + _pstRect->u32Width > stFree.u32X)
+    && (_pstRect->u32Y < stFree.u32Y + stFree.u32Height)
+    && (_pstRect->u32Y + _pstRect->u32Height > stFree.u32Y))
+    {
+      // Adds the (up to) four maximal leftover rectangles
+      if(_pstRect->u32X > stFree.u32X)
+      {
+        AddFreeRect(stFree.u32X, stFree.u32Y, _pstRect->u32X - stFree.u32X, stFree.u32Height);
+      }
+      if(_pstRect->u32X + _pstRect->u32Width < stFree.u32X + stFree.u32Width)
+      {
+        AddFreeRect(_pstRect->u32X + _pstRect->u32Width, stFree.u32Y, stFree.u32X + stFree.u32Width - (_pstRect->u32X + _pstRect->u32Width), stFree.u32Height);
+      }
+      if(_pstRect->u32Y > stFree.u32Y)
+      {
+        AddFreeRect(stFree.u32X, stFree.u32Y, stFree.u32Width, _pstRect->u32Y - stFree.u32Y);
+      }
+      if(_pstRect->u32Y + _pstRect->u32Height < stFree.u32Y + stFree.u32Height)
+      {
+        AddFreeRect(stFree.u32X, _pstRect->u32Y + _pstRect->u32Height, stFree.u32Width, stFree.u32Y + stFree.u32Height - (_pstRect->u32Y + _pstRect->u32Height));
+      }
+
+      // Marks split rectangle for removal
+      sstAtlasGen.astFreeList[i].u32Width = 0;
+    }
+  }
+
+  // Removes split rectangles
+  for(i = 0, j = 0; i < sstAtlasGen.u32FreeCount; i++)
+  {
+    // Still valid?
+    if(sstAtlasGen.astFreeList[i].u32Width != 0)
+    {
+      // Keeps it
+      sstAtlasGen.astFreeList[j++] = sstAtlasGen.astFreeList[i];
+    }
+  }
+  sstAtlasGen.u32FreeCount = j;
+
+  // Prunes contained free rectangles
+  for(i = 0; i < sstAtlasGen.u32FreeCount; i++)
+  {
+    for(j = i + 1; j < sstAtlasGen.u32FreeCount;)
+    {
+      // Is i contained in j?
+      if(IsContained(&(sstAtlasGen.astFreeList[i]), &(sstAtlasGen.astFreeList[j])) != orxFALSE)
+      {
+        // Removes i and restarts with the moved one
+        sstAtlasGen.astFreeList[i] = sstAtlasGen.astFreeList[--sstAtlasGen.u32FreeCount];
+        j = i + 1;
+      }
+      // Is j contained in i?
+      else if(IsContained(&(sstAtlasGen.astFreeList[j]), &(sstAtlasGen.astFreeList[i])) != orxFALSE)
+      {
+        // Removes j
+        sstAtlasGen.astFreeList[j] = sstAtlasGen.astFreeList[--sstAtlasGen.u32FreeCount];
+      }
+      else
+      {
+        // Next one
+        j++;
+      }
+    }
+  }
+
+  // Done!
+  return;
+}
+
+static orxU32 orxFASTCALL Pack()
+{
+  orxU32 u32PlacedCount, u32Page;
+
+  // Sorts images
+  qsort(sstAtlasGen.apstImageList, sstAtlasGen.u32ImageCount, sizeof(orxATLASGEN_IMAGE *), CompareImages);
+
+  // For all pages, while some images remain
+  for(u32PlacedCount = 0, u32Page = 0; u32PlacedCount < sstAtlasGen.u32ImageCount; u32Page++)
+  {
+    orxU32 u32PagePlacedCount, i;
+
+    // Resets free list: the extra padding allows images to touch the page's right & bottom edges
+    sstAtlasGen.u32FreeCount = 0;
+    AddFreeRect(0, 0, sstAtlasGen.u32PageSize + sstAtlasGen.u32Padding, sstAtlasGen.u32PageSize + sstAtlasGen.u32Padding);
+
+    // For all images
+    for(i = 0, u32PagePlacedCount = 0; i < sstAtlasGen.u32ImageCount; i++)
+    {
+      orxATLASGEN_IMAGE *pstImage = sstAtlasGen.apstImageList[i];
+
+      // Not placed yet?
+      if(pstImage->u32Page == orxU32_UNDEFINED)
+      {
+        orxATLASGEN_RECT stRect;
+
+        // Gets padded size
+        stRect.u32Width   = pstImage->stRect.u32Width + sstAtlasGen.u32Padding;
+        stRect.u32Height  = pstImage->stRect.u32Height + sstAtlasGen.u32Padding;
+
+        // Finds position
+        if(FindPosition(stRect.u32Width, stRect.u32Height, &(stRect.u32X), &(stRect.u32Y)) != orxFALSE)
+        {
+          // Places it
+          PlaceRect(&stRect);
+
+          // Stores it
+          pstImage->stRect.u32X = stRect.u32X;
+          pstImage->stRect.u32Y = stRect.u32Y;
+          pstImage->u32Page     = u32Page;
+
+          // Updates counters
+          u32PagePlacedCount++;
+          u32PlacedCount++;
+        }
+      }
+    }
+
+    // Nothing placed?
+    if(u32PagePlacedCount == 0)
+    {
+      // Logs message
+      orxATLASGEN_LOG(PACK, "%u images couldn't fit in a %ux%u page, aborting.", sstAtlasGen.u32ImageCount - u32PlacedCount, sstAtlasGen.u32PageSize, sstAtlasGen.u32PageSize);
+
+      // Stops
+      break;
+    }
+  }
+
+  // Done!
+  return u32Page;
+}
+
+static orxSTATUS orxFASTCALL SavePage(orxU32 _u32Page)
+{
+  orxU32    u32Width, u32Height, i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Gets page extent
+  for(i = 0, u32Width = 0, u32Height = 0; i < sstAtlasGen.u32ImageCount; i++)
+  {
+    const orxATLASGEN_IMAGE *pstImage = sstAtlasGen.apstImageList[i];
+
+    // On this page?
+    if(pstImage->u32Page == _u32Page)
+    {
+      // Updates extent
+      u32Width  = orxMAX(u32Width, pstImage->stRect.u32X + pstImage->stRect.u32Width);
+      u32Height = orxMAX(u32Height, pstImage->stRect.u32Y + pstImage->stRect.u32Height);
+    }
+  }
+
+  // Valid?
+  if((u32Width > 0) && (u32Height > 0))
+  {
+    orxU8 *au8PageData;
+
+    // Allocates page data
+    au8PageData = (orxU8 *)orxMemory_Allocate(u32Width * u32Height * sizeof(orxRGBA), orxMEMORY_TYPE_TEMP);
+    orxASSERT(au8PageData != orxNULL);
+    orxMemory_Zero(au8PageData, u32Width * u32Height * sizeof(orxRGBA));
+
+    // For all images
+    for(i = 0; i < sstAtlasGen.u32ImageCount; i++)
+    {
+      const orxATLASGEN_IMAGE *pstImage = sstAtlasGen.apstImageList[i];
+
+      // On this page?
+      if(pstImage->u32Page == _u32Page)
+      {
+        orxU8  *au8ImageData;
+        orxU32  u32ImageSize, u32Row;
+
+        // Allocates image data
+        u32ImageSize  = pstImage->stRect.u32Width * pstImage->stRect.u32Height * sizeof(orxRGBA);
+        au8ImageData  = (orxU8 *)orxMemory_Allocate(u32ImageSize, orxMEMORY_TYPE_TEMP);
+        orxASSERT(au8ImageData != orxNULL);
+
+        // Gets its pixels
+        if(orxDisplay_GetBitmapData(pstImage->pstBitmap, au8ImageData, u32ImageSize) != orxSTATUS_FAILURE)
+        {
+          // For all rows
+          for(u32Row = 0; u32Row < pstImage->stRect.u32Height; u32Row++)
+          {
+            // Copies it
+            orxMemory_Copy(au8PageData + ((pstImage->stRect.u32Y + u32Row) * u32Width + pstImage->stRect.u32X) * sizeof(orxRGBA),
+                           au8ImageData + u32Row * pstImage->stRect.u32Width * sizeof(orxRGBA),
+                           pstImage->stRect.u32Width * sizeof(orxRGBA));
+          }
+        }
+        else
+        {
+          // Logs message
+          orxATLASGEN_LOG(PAGE, "Couldn't get pixels of '%s', leaving its region empty.", pstImage->zFileName);
+        }
+
+        // Frees image data
+        orxMemory_Free(au8ImageData);
+      }
+    }
+
+    {
+      orxBITMAP  *pstPageBitmap;
+      orxCHAR     acBuffer[256];
+
+      // Gets page file name
+      orxString_NPrint(acBuffer, sizeof(acBuffer), "%s-%u.png", sstAtlasGen.zAtlasName, _u32Page);
+
+      // Creates page bitmap
+      pstPageBitmap = orxDisplay_CreateBitmap(u32Width, u32Height);
+
+      // Success?
+      if((pstPageBitmap != orxNULL)
+      && (orxDisplay_SetBitmapData(pstPageBitmap, au8PageData, u32Width * u32Height * sizeof(orxRGBA)) != orxSTATUS_FAILURE)
+      && (orxDisplay_SaveBitmap(pstPageBitmap, acBuffer) != orxSTATUS_FAILURE))
+      {
+        // Waits until all tasks are complete
+        while(orxThread_GetTaskCount() != 0)
+          ;
+
+        // Logs message
+        orxATLASGEN_LOG(SAVE, "Writing '%s' (%ux%u): SUCCESS.", acBuffer, u32Width, u32Height);
+
+        // Updates result
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        // Logs message
+        orxATLASGEN_LOG(SAVE, "Writing '%s': FAILURE.", acBuffer);
+      }
+
+      // Has bitmap?
+      if(pstPageBitmap != orxNULL)
+      {
+        // Deletes it
+        orxDisplay_DeleteBitmap(pstPageBitmap);
+      }
+    }
+
+    // Frees page data
+    orxMemory_Free(au8PageData);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessInputParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // For all input files
+  for(i = 1; i < _u32ParamCount; i++)
+  {
+    // Found?
+    if(orxResource_Locate(orxTEXTURE_KZ_RESOURCE_GROUP, _azParams[i]) != orxNULL)
+    {
+      orxATLASGEN_IMAGE *pstImage;
+
+      // Allocates image
+      pstImage = (orxATLASGEN_IMAGE *)orxBank_Allocate(sstAtlasGen.pstImageBank);
+      orxASSERT(pstImage != orxNULL);
+      orxMemory_Zero(pstImage, sizeof(orxATLASGEN_IMAGE));
+
+      // Stores it
+      pstImage->zFileName = orxString_Duplicate(_azParams[i]);
+      pstImage->u32Page   = orxU32_UNDEFINED;
+      sstAtlasGen.u32ImageCount++;
+
+      // Updates status
+      orxFLAG_SET(sstAtlasGen.u32Flags, orxATLASGEN_KU32_STATIC_FLAG_INPUT, orxATLASGEN_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      // Logs message
+      orxATLASGEN_LOG(INPUT, "Couldn't find image '%s', skipping.", _azParams[i]);
+    }
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessOutputParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Has a valid output parameter?
+  if(_u32ParamCount > 1)
+  {
+    // Stores it
+    sstAtlasGen.zAtlasName = orxString_Duplicate(_azParams[1]);
+
+    // Logs message
+    orxATLASGEN_LOG(OUTPUT, "Output atlas name set to: %s.", sstAtlasGen.zAtlasName);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessSizeParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxU32    u32Size;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Has a valid size parameter?
+  if((_u32ParamCount > 1)
+  && (orxString_ToU32(_azParams[1], &u32Size, orxNULL) != orxSTATUS_FAILURE)
+  && (u32Size > 0))
+  {
+    // Stores it
+    sstAtlasGen.u32PageSize = u32Size;
+
+    // Logs message
+    orxATLASGEN_LOG(SIZE, "Maximum page size set to: %u.", u32Size);
+  }
+  else
+  {
+    // Logs message
+    orxATLASGEN_LOG(SIZE, "Invalid page size, defaulting to: %u.", orxATLASGEN_KU32_DEFAULT_SIZE);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessPaddingParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxU32    u32Padding;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Has a valid padding parameter?
+  if((_u32ParamCount > 1)
+  && (orxString_ToU32(_azParams[1], &u32Padding, orxNULL) != orxSTATUS_FAILURE))
+  {
+    // Stores it
+    sstAtlasGen.u32Padding = u32Padding;
+
+    // Logs message
+    orxATLASGEN_LOG(PADDING, "Image padding set to: %u.", u32Padding);
+  }
+  else
+  {
+    // Logs message
+    orxATLASGEN_LOG(PADDING, "Invalid image padding, defaulting to: %u.", orxATLASGEN_KU32_DEFAULT_PADDING);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Setup()
+{
+  // Adds module dependencies
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PARAM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_FILE);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_TEXTURE);
+
+  // Done!
+  return;
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxATLASGEN_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxATLASGEN_DECLARE_PARAM("i", "input", "Input images", "List of image files to pack, they will be referenced by these exact names in the generated config", ProcessInputParams)
+    orxATLASGEN_DECLARE_PARAM("o", "output", "Atlas output name", "Atlas base output name: -<page>.png will be added to the images and .ini will be added to the config file", ProcessOutputParams)
+    orxATLASGEN_DECLARE_PARAM("s", "size", "Maximum page size", "Maximum width and height of each atlas page, in pixels", ProcessSizeParams)
+    orxATLASGEN_DECLARE_PARAM("p", "padding", "Image padding", "Number of transparent pixels between packed images", ProcessPaddingParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstAtlasGen, sizeof(orxATLASGEN_STATIC));
+
+  // Sets defaults
+  sstAtlasGen.u32PageSize = orxATLASGEN_KU32_DEFAULT_SIZE;
+  sstAtlasGen.u32Padding  = orxATLASGEN_KU32_DEFAULT_PADDING;
+
+  // Creates image bank
+  sstAtlasGen.pstImageBank = orxBank_Create(orxATLASGEN_KU32_IMAGE_BANK_SIZE, sizeof(orxATLASGEN_IMAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+  // Success?
+  if(sstAtlasGen.pstImageBank != orxNULL)
+  {
+    // For all params
+    for(i = 0; (i < orxARRAY_GET_ITEM_COUNT(astParamList)) && (eResult != orxSTATUS_FAILURE); i++)
+    {
+      // Registers param
+      eResult = orxParam_Register(&astParamList[i]);
+    }
+  }
+  else
+  {
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Success?
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    // No atlas name?
+    if(sstAtlasGen.zAtlasName == orxNULL)
+    {
+      // Logs message
+      orxATLASGEN_LOG(OUTPUT, "No output provided, defaulting to: %s.", orxATLASGEN_KZ_DEFAULT_NAME);
+
+      // Uses default one
+      sstAtlasGen.zAtlasName = orxString_Duplicate(orxATLASGEN_KZ_DEFAULT_NAME);
+    }
+
+    // No input?
+    if(!orxFLAG_TEST(sstAtlasGen.u32Flags, orxATLASGEN_KU32_STATIC_FLAG_INPUT))
+    {
+      // Logs message
+      orxATLASGEN_LOG(INPUT, "No valid image provided, aborting.");
+    }
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+  // Has image bank?
+  if(sstAtlasGen.pstImageBank != orxNULL)
+  {
+    orxATLASGEN_IMAGE *pstImage;
+
+    // For all images
+    for(pstImage = (orxATLASGEN_IMAGE *)orxBank_GetNext(sstAtlasGen.pstImageBank, orxNULL);
+        pstImage != orxNULL;
+        pstImage = (orxATLASGEN_IMAGE *)orxBank_GetNext(sstAtlasGen.pstImageBank, pstImage))
+    {
+      // Has bitmap?
+      if(pstImage->pstBitmap != orxNULL)
+      {
+        // Deletes it
+        orxDisplay_DeleteBitmap(pstImage->pstBitmap);
+      }
+
+      // Frees its name
+      orxString_Delete(pstImage->zFileName);
+    }
+
+    // Deletes bank
+    orxBank_Delete(sstAtlasGen.pstImageBank);
+    sstAtlasGen.pstImageBank = orxNULL;
+  }
+
+  // Has image list?
+  if(sstAtlasGen.apstImageList != orxNULL)
+  {
+    // Frees it
+    orxMemory_Free(sstAtlasGen.apstImageList);
+    sstAtlasGen.apstImageList = orxNULL;
+  }
+
+  // Has free list?
+  if(sstAtlasGen.astFreeList != orxNULL)
+  {
+    // Frees it
+    orxMemory_Free(sstAtlasGen.astFreeList);
+    sstAtlasGen.astFreeList = orxNULL;
+  }
+
+  // Has atlas name?
+  if(sstAtlasGen.zAtlasName)
+  {
+    // Frees its string
+    orxString_Delete(sstAtlasGen.zAtlasName);
+    sstAtlasGen.zAtlasName = orxNULL;
+  }
+
+  // Done!
+  return;
+}
+
+static void Run()
+{
+  // Ready?
+  if(orxFLAG_TEST_ALL(sstAtlasGen.u32Flags, orxATLASGEN_KU32_STATIC_MASK_READY))
+  {
+    orxATLASGEN_IMAGE  *pstImage;
+    orxU32              u32LoadedCount, u32PageCount, i;
+
+    // Allocates image list
+    sstAtlasGen.apstImageList = (orxATLASGEN_IMAGE **)orxMemory_Allocate(sstAtlasGen.u32ImageCount * sizeof(orxATLASGEN_IMAGE *), orxMEMORY_TYPE_TEMP);
+    orxASSERT(sstAtlasGen.apstImageList != orxNULL);
+
+    // Forces synchronous loading
+    orxDisplay_SetTempBitmap(orxNULL);
+
+    // For all images
+    for(pstImage = (orxATLASGEN_IMAGE *)orxBank_GetNext(sstAtlasGen.pstImageBank, orxNULL), u32LoadedCount = 0;
+        pstImage != orxNULL;
+        pstImage = (orxATLASGEN_IMAGE *)orxBank_GetNext(sstAtlasGen.pstImageBank, pstImage))
+    {
+      // Loads it
+      pstImage->pstBitmap = orxDisplay_LoadBitmap(pstImage->zFileName);
+
+      // Success?
+      if(pstImage->pstBitmap != orxNULL)
+      {
+        orxFLOAT fWidth, fHeight;
+
+        // Gets its size
+        orxDisplay_GetBitmapSize(pstImage->pstBitmap, &fWidth, &fHeight);
+        pstImage->stRect.u32Width   = orxF2U(fWidth);
+        pstImage->stRect.u32Height  = orxF2U(fHeight);
+
+        // Too large?
+        if((pstImage->stRect.u32Width > sstAtlasGen.u32PageSize)
+        || (pstImage->stRect.u32Height > sstAtlasGen.u32PageSize))
+        {
+          // Logs message
+          orxATLASGEN_LOG(LOAD, "'%s': %ux%u is larger than the page size, skipping.", pstImage->zFileName, pstImage->stRect.u32Width, pstImage->stRect.u32Height);
+        }
+        else
+        {
+          // Adds it to the list
+          sstAtlasGen.apstImageList[u32LoadedCount++] = pstImage;
+        }
+      }
+      else
+      {
+        // Logs message
+        orxATLASGEN_LOG(LOAD, "'%s': FAILURE, skipping.", pstImage->zFileName);
+      }
+    }
+
+    // Only keeps loaded images
+    sstAtlasGen.u32ImageCount = u32LoadedCount;
+
+    // Logs message
+    orxATLASGEN_LOG(LOAD, "%u images loaded.", u32LoadedCount);
+
+    // Packs them
+    u32PageCount = Pack();
+
+    // Pushes atlas section
+    orxConfig_PushSection(orxTEXTURE_KZ_CONFIG_ATLAS);
+
+    // For all pages
+    for(i = 0; i < u32PageCount; i++)
+    {
+      // Saves it
+      if(SavePage(i) != orxSTATUS_FAILURE)
+      {
+        orxU32 j;
+
+        // For all its images
+        for(j = 0; j < sstAtlasGen.u32ImageCount; j++)
+        {
+          pstImage = sstAtlasGen.apstImageList[j];
+
+          // On this page?
+          if(pstImage->u32Page == i)
+          {
+            orxCHAR         acPage[256], acOrigin[64], acSize[64];
+            const orxSTRING azValueList[3];
+
+            // Prints its region
+            orxString_NPrint(acPage, sizeof(acPage), "%s-%u.png", sstAtlasGen.zAtlasName, i);
+            orxString_NPrint(acOrigin, sizeof(acOrigin), "(%u, %u)", pstImage->stRect.u32X, pstImage->stRect.u32Y);
+            orxString_NPrint(acSize, sizeof(acSize), "(%u, %u)", pstImage->stRect.u32Width, pstImage->stRect.u32Height);
+            azValueList[0] = acPage;
+            azValueList[1] = acOrigin;
+            azValueList[2] = acSize;
+
+            // Stores it
+            orxConfig_SetListString(pstImage->zFileName, azValueList, 3);
+          }
+        }
+      }
+    }
+
+    // Pops config section
+    orxConfig_PopSection();
+
+    // Has pages?
+    if(u32PageCount > 0)
+    {
+      orxCHAR acBuffer[256];
+
+      // Logs message
+      orxATLASGEN_LOG(PROCESS, "%u images packed in %u page(s).", sstAtlasGen.u32ImageCount, u32PageCount);
+
+      // Gets config file name
+      orxString_NPrint(acBuffer, sizeof(acBuffer), "%s.ini", sstAtlasGen.zAtlasName);
+
+      // Saves it
+      if(orxConfig_Save(acBuffer, orxFALSE, SaveFilter) != orxSTATUS_FAILURE)
+      {
+        // Logs message
+        orxATLASGEN_LOG(SAVE, "Writing '%s': SUCCESS.", acBuffer);
+      }
+      else
+      {
+        // Logs message
+        orxATLASGEN_LOG(SAVE, "Writing '%s': FAILURE.", acBuffer);
+      }
+    }
+  }
+
+  // Done!
+  return;
+}
+
+int main(int argc, char **argv)
+{
+  // Inits the Debug System
+  orxDEBUG_INIT();
+
+  // Registers main module
+  orxModule_Register(orxMODULE_ID_MAIN, "MAIN", Setup, Init, Exit);
+
+  // Set config bootstrap function
+  orxConfig_SetBootstrap(Bootstrap);
+
+  // Sends the command line arguments to orxParam module
+  if(orxParam_SetArgs(argc, argv) != orxSTATUS_FAILURE)
+  {
+    // Inits the engine
+    if(orxModule_Init(orxMODULE_ID_MAIN) != orxSTATUS_FAILURE)
+    {
+      // Runs
+      Run();
+
+      // Exits from engine
+      orxModule_Exit(orxMODULE_ID_MAIN);
+    }
+
+    // Clears params
+    orxParam_SetArgs(0, orxNULL);
+  }
+
+  // Exits from the Debug system
+  orxDEBUG_EXIT();
+
+  // Done!
+  return EXIT_SUCCESS;
+}